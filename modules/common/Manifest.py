@@ -13,8 +13,10 @@ modules = { "local" : ["anti_windup_accumulator",
                        "prbs_for_sys_id",
                        "pulse_syncr",
                        "mov_avg_dyn",
+                       "mov_avg_bram",
                        "biquad",
                        "iir_filt",
+                       "iir_filt_tdm",
                        "i2c_slave_iface"] };
 
 files = [ "ifc_common_pkg.vhd" ];
@@ -1,3 +1,4 @@
 files = [
-        "biquad.vhd"
+        "biquad.vhd",
+        "biquad_pipe.vhd",
 ]
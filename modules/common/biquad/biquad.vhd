@@ -9,6 +9,14 @@
 -- Standard     : VHDL'08
 --------------------------------------------------------------------------------
 -- Description  : Implementation of biquad filter using its canonical form.
+--
+--                With g_COEFFS_DOUBLE_BUFFER, coeffs_i is a shadow set: a
+--                pulse on coeffs_load_i makes the biquad take it as a whole
+--                in the middle of the next sample, after b0 is used and
+--                before the products for the sample after it are taken, so
+--                that every sample is computed with a single set. Hold
+--                coeffs_i while coeffs_pending_o is '1'. Until the first
+--                load, all coefficients are zero.
 --------------------------------------------------------------------------------
 -- Copyright (c) 2023 CNPEM
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -43,7 +51,10 @@ ENTITY biquad IS
     g_Y_FRAC_WIDTH      : NATURAL;
 
     -- Extra bits for internal arithmetic
-    g_EXTRA_BITS        : NATURAL
+    g_EXTRA_BITS        : NATURAL;
+
+    -- Take coeffs_i only on coeffs_load_i
+    g_COEFFS_DOUBLE_BUFFER : BOOLEAN := FALSE
   );
   PORT (
     -- Clock
@@ -66,6 +77,12 @@ ENTITY biquad IS
                                 a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
                                 a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
                               );
+    -- Load coeffs_i (g_COEFFS_DOUBLE_BUFFER only)
+    coeffs_load_i       : IN  STD_LOGIC := '0';
+    -- A load is waiting for the next sample
+    coeffs_pending_o    : OUT STD_LOGIC;
+    -- coeffs_i was just taken
+    coeffs_loaded_o     : OUT STD_LOGIC;
 
     -- Busy flag
     busy_o              : OUT STD_LOGIC;
@@ -105,6 +122,16 @@ ARCHITECTURE behave OF biquad IS
            SFIXED(MAXIMUM(b0_times_w'LEFT, aux_b'LEFT)+1 DOWNTO
                   MINIMUM(b0_times_w'RIGHT, aux_b'RIGHT)) := (OTHERS => '0');
 
+  -- Coefficients in use
+  SIGNAL coeffs : t_biquad_coeffs(
+                    b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+                  ) := (OTHERS => (OTHERS => '0'));
+  SIGNAL coeffs_pending : STD_LOGIC := '0';
+
   SIGNAL state : NATURAL RANGE 0 TO 6 := 0;
 BEGIN
   PROCESS(clk_i) IS
@@ -151,7 +178,7 @@ BEGIN
           --           w[n - 1] for the next iteration
           --           w[n - 2] for the next iteration
           WHEN 2 =>
-            b0_times_w_tmp <= coeffs_i.b0*w;
+            b0_times_w_tmp <= coeffs.b0*w;
             w_d1 <= w;
             w_d2 <= w_d1;
             state <= 3;
@@ -164,10 +191,10 @@ BEGIN
           WHEN 3 =>
             b0_times_w <= resize(b0_times_w_tmp, b0_times_w'LEFT,
                                  b0_times_w'RIGHT);
-            a1_times_w_d1_tmp <= coeffs_i.a1*w_d1;
-            a2_times_w_d2_tmp <= coeffs_i.a2*w_d2;
-            b1_times_w_d1_tmp <= coeffs_i.b1*w_d1;
-            b2_times_w_d2_tmp <= coeffs_i.b2*w_d2;
+            a1_times_w_d1_tmp <= coeffs.a1*w_d1;
+            a2_times_w_d2_tmp <= coeffs.a2*w_d2;
+            b1_times_w_d1_tmp <= coeffs.b1*w_d1;
+            b2_times_w_d2_tmp <= coeffs.b2*w_d2;
             state <= 4;
 
           -- Computes:  a1*w[n - 1] for the next iteration (resized)
@@ -208,6 +235,37 @@ BEGIN
     END IF;
   END PROCESS;
 
+  gen_coeffs_double_buffer : IF g_COEFFS_DOUBLE_BUFFER GENERATE
+    PROCESS(clk_i) IS
+    BEGIN
+      IF rising_edge(clk_i) THEN
+        IF rst_n_i = '0' THEN
+          coeffs_pending <= '0';
+          coeffs_loaded_o <= '0';
+        ELSE
+          coeffs_loaded_o <= '0';
+
+          -- b0 is used in state 2 and the other coefficients in state 3,
+          -- for the next sample
+          IF state = 2 AND coeffs_pending = '1' THEN
+            coeffs <= coeffs_i;
+            coeffs_pending <= '0';
+            coeffs_loaded_o <= '1';
+          END IF;
+
+          IF coeffs_load_i = '1' THEN
+            coeffs_pending <= '1';
+          END IF;
+        END IF;
+      END IF;
+    END PROCESS;
+  ELSE GENERATE
+    coeffs <= coeffs_i;
+    coeffs_loaded_o <= '0';
+  END GENERATE gen_coeffs_double_buffer;
+
+  coeffs_pending_o <= coeffs_pending;
+
   busy_o <= '1' WHEN (state = 0 AND x_valid_i = '1') ELSE
             '1' WHEN state = 1 ELSE
             '1' WHEN state = 2 ELSE
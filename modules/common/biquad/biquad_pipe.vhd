@@ -0,0 +1,324 @@
+--------------------------------------------------------------------------------
+-- Title        : Pipelined Biquad Filter
+-- Project      :
+--------------------------------------------------------------------------------
+-- File         : biquad_pipe.vhd
+-- Company      : CNPEM, LNLS - GIE
+-- Platform     : Generic
+-- Standard     : VHDL'08
+--------------------------------------------------------------------------------
+-- Description  : A biquad that takes a sample per clock cycle, with the same
+--                generics and coefficients as biquad.
+--
+--                The recursion is restructured by scattered look-ahead:
+--                H(z) = N(z)/D(z) is computed as N(z)*P(z)/D'(z), with
+--                D'(z) = D(z)*P(z) = 1 + c1*z^-M + c2*z^-(2*M) for
+--                M = g_LOOKAHEAD. The poles of D' are the M-th powers of
+--                those of D, so D' is stable if D is, and the feedback loop
+--                has M cycles to compute y[n - M] instead of one. N(z) and
+--                P(z) (order 2*M-2) are FIRs in transposed form.
+--
+--                P(z) is the impulse response h of 1/D(z) up to z^-(M-1),
+--                followed by h[M+j] + c1*h[j] for j < M-1, where
+--                c1 = a2*h[M-2] - h[M] and c2 = a2^M. A small sequential
+--                engine recomputes them from coeffs_i all the time and
+--                switches to the new set at once, every 3*M cycles. After a
+--                change of coeffs_i, the output shows a transient.
+--
+--                Every register only moves on x_valid_i, so y[n] only shows
+--                up at y_o once x[n + c_BIQUAD_PIPE_LATENCY - 1] is taken;
+--                with x_valid_i always '1', that is c_BIQUAD_PIPE_LATENCY
+--                cycles after x[n] is at x_i. y_valid_o stays '0' until the
+--                first x_i has made it through.
+--
+--                The results are not bit-exact with biquad, since both
+--                round at different places, but the frequency response is
+--                the same up to the rounding noise. The look-ahead adds
+--                gain to the intermediate values, which get
+--                log2(4*g_LOOKAHEAD) extra integer bits.
+--------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+LIBRARY ieee;
+USE ieee.std_logic_1164.ALL;
+USE ieee.fixed_pkg.ALL;
+
+LIBRARY work;
+USE work.ifc_common_pkg.ALL;
+
+ENTITY biquad_pipe IS
+  GENERIC (
+    -- Integer width of x
+    g_X_INT_WIDTH       : NATURAL;
+    -- Fractionary width of x
+    g_X_FRAC_WIDTH      : NATURAL;
+
+    -- Integer width of coefficients
+    g_COEFF_INT_WIDTH   : NATURAL;
+    -- Fractionary width of coefficients
+    g_COEFF_FRAC_WIDTH  : NATURAL;
+
+    -- Integer width of y
+    g_Y_INT_WIDTH       : NATURAL;
+    -- Fractionary width of y
+    g_Y_FRAC_WIDTH      : NATURAL;
+
+    -- Extra bits for internal arithmetic
+    g_EXTRA_BITS        : NATURAL;
+
+    -- Look-ahead (M), i.e. cycles in the feedback loop (at least 3)
+    g_LOOKAHEAD         : NATURAL := 3
+  );
+  PORT (
+    -- Clock
+    clk_i               : IN  STD_LOGIC;
+    -- Reset
+    rst_n_i             : IN  STD_LOGIC;
+
+    -- Input
+    -- x[n]
+    x_i                 : IN  SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
+    -- Input valid
+    x_valid_i           : IN  STD_LOGIC;
+
+    -- Coefficients
+    -- b0, b1, b2, a1, a2 (a0 = 1)
+    coeffs_i            : IN  t_biquad_coeffs(
+                                b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+                              );
+
+    -- Output
+    -- y[n - c_BIQUAD_PIPE_LATENCY + 1], x[n] being the last x_i taken
+    y_o                 : OUT SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
+    -- Output valid
+    y_valid_o           : OUT STD_LOGIC
+  );
+END ENTITY biquad_pipe;
+
+ARCHITECTURE behave OF biquad_pipe IS
+  FUNCTION f_log2_ceil(n : NATURAL) RETURN NATURAL IS
+    VARIABLE v_bits : NATURAL := 0;
+  BEGIN
+    WHILE 2**v_bits < n LOOP
+      v_bits := v_bits + 1;
+    END LOOP;
+    RETURN v_bits;
+  END FUNCTION f_log2_ceil;
+
+  CONSTANT c_M : NATURAL := g_LOOKAHEAD;
+  -- Taps of P(z)
+  CONSTANT c_P_TAPS : NATURAL := 2*c_M - 1;
+  -- |h[k]| <= k+1 for a stable D(z), so P(z) and c1 stay under 4*M
+  CONSTANT c_GROWTH : NATURAL := f_log2_ceil(4*c_M);
+
+  -- Format of P(z), c1 and c2
+  CONSTANT c_P_LEFT : INTEGER := MAXIMUM(g_COEFF_INT_WIDTH, 1) + c_GROWTH - 1;
+  CONSTANT c_P_RIGHT : INTEGER := -(g_COEFF_FRAC_WIDTH + g_EXTRA_BITS);
+
+  -- Format of the internal signals, as w in biquad plus the growth
+  CONSTANT c_ACC_LEFT : INTEGER :=
+    (g_COEFF_INT_WIDTH + g_X_INT_WIDTH + g_EXTRA_BITS + c_GROWTH)-1;
+  CONSTANT c_ACC_RIGHT : INTEGER :=
+    -(g_COEFF_FRAC_WIDTH + g_X_FRAC_WIDTH + g_EXTRA_BITS);
+
+  SUBTYPE t_coeff IS SFIXED(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH);
+  SUBTYPE t_p IS SFIXED(c_P_LEFT DOWNTO c_P_RIGHT);
+  SUBTYPE t_acc IS SFIXED(c_ACC_LEFT DOWNTO c_ACC_RIGHT);
+  TYPE t_coeff_arr IS ARRAY (NATURAL RANGE <>) OF t_coeff;
+  TYPE t_p_arr IS ARRAY (NATURAL RANGE <>) OF t_p;
+  TYPE t_acc_arr IS ARRAY (NATURAL RANGE <>) OF t_acc;
+  TYPE t_n_prod_arr IS ARRAY (NATURAL RANGE <>) OF
+    SFIXED(g_COEFF_INT_WIDTH + g_X_INT_WIDTH - 1 DOWNTO
+           -(g_COEFF_FRAC_WIDTH + g_X_FRAC_WIDTH));
+  TYPE t_p_prod_arr IS ARRAY (NATURAL RANGE <>) OF
+    SFIXED(c_P_LEFT + c_ACC_LEFT + 1 DOWNTO c_P_RIGHT + c_ACC_RIGHT);
+
+  -- Coefficients engine
+  TYPE t_engine_state IS (START, IMPULSE, C1, P_TAIL, SWAP);
+  SIGNAL engine_state : t_engine_state := START;
+  SIGNAL step : NATURAL RANGE 0 TO c_P_TAPS := 0;
+  SIGNAL b_new : t_coeff_arr(0 TO 2) := (OTHERS => (OTHERS => '0'));
+  SIGNAL a1_new, a2_new : t_coeff := (OTHERS => '0');
+  -- h[0] to h[2*M-2], then P(z)
+  SIGNAL h : t_p_arr(0 TO c_P_TAPS-1) := (OTHERS => (OTHERS => '0'));
+  SIGNAL a2_pow, c1_new : t_p := (OTHERS => '0');
+
+  -- Coefficients in use
+  SIGNAL b : t_coeff_arr(0 TO 2) := (OTHERS => (OTHERS => '0'));
+  SIGNAL p : t_p_arr(0 TO c_P_TAPS-1) := (OTHERS => (OTHERS => '0'));
+  SIGNAL c1, c2 : t_p := (OTHERS => '0');
+
+  -- N(z)
+  SIGNAL x : SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH) := (OTHERS => '0');
+  SIGNAL n_prod : t_n_prod_arr(0 TO 2) := (OTHERS => (OTHERS => '0'));
+  SIGNAL n_term, n_sum : t_acc_arr(0 TO 2) := (OTHERS => (OTHERS => '0'));
+
+  -- P(z)
+  SIGNAL p_prod : t_p_prod_arr(0 TO c_P_TAPS-1) := (OTHERS => (OTHERS => '0'));
+  SIGNAL p_term, p_sum : t_acc_arr(0 TO c_P_TAPS-1) := (OTHERS => (OTHERS => '0'));
+
+  -- 1/D'(z)
+  -- y_hist(k) is y[n - 1 - k], as seen by y_acc
+  SIGNAL y_acc : t_acc := (OTHERS => '0');
+  SIGNAL y_hist : t_acc_arr(1 TO 2*c_M-3) := (OTHERS => (OTHERS => '0'));
+  SIGNAL c1_prod, c2_prod : SFIXED(c_P_LEFT + c_ACC_LEFT + 1 DOWNTO c_P_RIGHT + c_ACC_RIGHT) :=
+           (OTHERS => '0');
+  SIGNAL c1_term, c2_term : t_acc := (OTHERS => '0');
+
+  SIGNAL warmup : NATURAL RANGE 0 TO c_BIQUAD_PIPE_LATENCY-1 := 0;
+BEGIN
+  ASSERT g_LOOKAHEAD >= 3
+    REPORT "biquad_pipe: g_LOOKAHEAD must be at least 3"
+    SEVERITY FAILURE;
+
+  -- Computes P(z), c1 and c2 for coeffs_i and swaps them with the ones in
+  -- use, over and over
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF rst_n_i = '0' THEN
+        engine_state <= START;
+      ELSE
+        CASE engine_state IS
+          WHEN START =>
+            b_new <= (coeffs_i.b0, coeffs_i.b1, coeffs_i.b2);
+            a1_new <= coeffs_i.a1;
+            a2_new <= coeffs_i.a2;
+            h(0) <= to_sfixed(1.0, c_P_LEFT, c_P_RIGHT);
+            a2_pow <= resize(coeffs_i.a2, c_P_LEFT, c_P_RIGHT);
+            step <= 1;
+            engine_state <= IMPULSE;
+
+          -- Computes: h[k] = -a1*h[k - 1] - a2*h[k - 2]
+          --           a2^(k + 1), up to a2^M
+          WHEN IMPULSE =>
+            IF step = 1 THEN
+              h(step) <= resize(-(a1_new*h(0)), c_P_LEFT, c_P_RIGHT);
+            ELSE
+              h(step) <= resize(-(a1_new*h(step-1)) - a2_new*h(step-2),
+                                c_P_LEFT, c_P_RIGHT);
+            END IF;
+            IF step < c_M THEN
+              a2_pow <= resize(a2_new*a2_pow, c_P_LEFT, c_P_RIGHT);
+            END IF;
+            IF step = c_P_TAPS-1 THEN
+              engine_state <= C1;
+            ELSE
+              step <= step + 1;
+            END IF;
+
+          -- Computes: c1 = -(p1^M + p2^M) = a2*h[M - 2] - h[M]
+          WHEN C1 =>
+            c1_new <= resize(a2_new*h(c_M-2) - h(c_M), c_P_LEFT, c_P_RIGHT);
+            step <= 0;
+            engine_state <= P_TAIL;
+
+          -- Computes: P[M + j] = h[M + j] + c1*h[j]
+          WHEN P_TAIL =>
+            h(c_M + step) <= resize(h(c_M + step) + c1_new*h(step),
+                                    c_P_LEFT, c_P_RIGHT);
+            IF step = c_M-2 THEN
+              engine_state <= SWAP;
+            ELSE
+              step <= step + 1;
+            END IF;
+
+          WHEN SWAP =>
+            b <= b_new;
+            p <= h;
+            c1 <= c1_new;
+            c2 <= a2_pow;
+            engine_state <= START;
+        END CASE;
+      END IF;
+    END IF;
+  END PROCESS;
+
+  PROCESS(clk_i) IS
+    VARIABLE v_y_sum : SFIXED(c_ACC_LEFT+2 DOWNTO c_ACC_RIGHT);
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF rst_n_i = '0' THEN
+        x <= (OTHERS => '0');
+        n_prod <= (OTHERS => (OTHERS => '0'));
+        n_term <= (OTHERS => (OTHERS => '0'));
+        n_sum <= (OTHERS => (OTHERS => '0'));
+        p_prod <= (OTHERS => (OTHERS => '0'));
+        p_term <= (OTHERS => (OTHERS => '0'));
+        p_sum <= (OTHERS => (OTHERS => '0'));
+        y_acc <= (OTHERS => '0');
+        y_hist <= (OTHERS => (OTHERS => '0'));
+        c1_prod <= (OTHERS => '0');
+        c2_prod <= (OTHERS => '0');
+        c1_term <= (OTHERS => '0');
+        c2_term <= (OTHERS => '0');
+        warmup <= 0;
+        y_o <= (OTHERS => '0');
+        y_valid_o <= '0';
+      ELSE
+        y_valid_o <= '0';
+
+        -- x, n_prod, n_term, n_sum, p_prod, p_term, p_sum, y_acc and y_o
+        -- make up c_BIQUAD_PIPE_LATENCY
+        IF x_valid_i = '1' THEN
+          x <= x_i;
+
+          -- Computes: v[n] = b0*x[n] + b1*x[n - 1] + b2*x[n - 2]
+          --           (transposed form, product, resize and sum stages)
+          FOR k IN 0 TO 2 LOOP
+            n_prod(k) <= b(k)*x;
+            n_term(k) <= resize(n_prod(k), c_ACC_LEFT, c_ACC_RIGHT);
+          END LOOP;
+          n_sum(2) <= n_term(2);
+          FOR k IN 0 TO 1 LOOP
+            n_sum(k) <= resize(n_term(k) + n_sum(k+1), c_ACC_LEFT, c_ACC_RIGHT);
+          END LOOP;
+
+          -- Computes: u[n] = P[0]*v[n] + ... + P[2*M - 2]*v[n - 2*M + 2]
+          --           (same structure, v[n] = n_sum(0))
+          FOR k IN 0 TO c_P_TAPS-1 LOOP
+            p_prod(k) <= p(k)*n_sum(0);
+            p_term(k) <= resize(p_prod(k), c_ACC_LEFT, c_ACC_RIGHT);
+          END LOOP;
+          p_sum(c_P_TAPS-1) <= p_term(c_P_TAPS-1);
+          FOR k IN 0 TO c_P_TAPS-2 LOOP
+            p_sum(k) <= resize(p_term(k) + p_sum(k+1), c_ACC_LEFT, c_ACC_RIGHT);
+          END LOOP;
+
+          -- Computes: y[n] = u[n] - c1*y[n - M] - c2*y[n - 2*M]
+          -- The products take two cycles, so they start from y[n - M] and
+          -- y[n - 2*M] as seen two cycles before, in y_hist(M - 3) and
+          -- y_hist(2*M - 3) (y_acc itself for M = 3)
+          IF c_M = 3 THEN
+            c1_prod <= c1*y_acc;
+          ELSE
+            c1_prod <= c1*y_hist(MAXIMUM(c_M-3, 1));
+          END IF;
+          c2_prod <= c2*y_hist(2*c_M-3);
+          c1_term <= resize(c1_prod, c_ACC_LEFT, c_ACC_RIGHT);
+          c2_term <= resize(c2_prod, c_ACC_LEFT, c_ACC_RIGHT);
+          v_y_sum := p_sum(0) - c1_term - c2_term;
+          y_acc <= resize(v_y_sum, c_ACC_LEFT, c_ACC_RIGHT);
+          y_hist(1) <= y_acc;
+          FOR k IN 2 TO 2*c_M-3 LOOP
+            y_hist(k) <= y_hist(k-1);
+          END LOOP;
+
+          y_o <= resize(y_acc, y_o'LEFT, y_o'RIGHT);
+
+          IF warmup = c_BIQUAD_PIPE_LATENCY-1 THEN
+            y_valid_o <= '1';
+          ELSE
+            warmup <= warmup + 1;
+          END IF;
+        END IF;
+      END IF;
+    END IF;
+  END PROCESS;
+END ARCHITECTURE behave;
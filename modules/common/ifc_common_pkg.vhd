@@ -17,6 +17,9 @@ package ifc_common_pkg is
   -- Type that wraps all internal biquads' coefficients (a0 = 1)
   type t_iir_filt_coeffs is array (natural range <>) of t_biquad_coeffs;
 
+  -- Cycles from x_i to y_o in biquad_pipe, with x_valid_i always '1'
+  constant c_BIQUAD_PIPE_LATENCY : natural := 9;
+
   --------------------------------------------------------------------
   -- Components
   --------------------------------------------------------------------
@@ -166,13 +169,28 @@ package ifc_common_pkg is
     -- Length of receiving delay counters
     g_rx_delay_width                         : natural := 32;
     -- Length of transmitter delay counters
-    g_tx_delay_width                         : natural := 32
+    g_tx_delay_width                         : natural := 32;
+    -- Receive samples per clk_i cycle, for the fine phase of the received
+    -- trigger timestamps. 1 samples the line once per clk_i cycle, 4, 6 or 8
+    -- use an ISERDES clocked by clk_ser_i
+    g_rx_oversampling                        : natural := 1;
+    -- Length of the receive timestamps
+    g_rx_ts_width                            : natural := 64;
+    -- Transmit samples per clk_i cycle, for the fine delay and width of the
+    -- transmitted triggers. 1 drives the line once per clk_i cycle, 4, 6 or 8
+    -- use an OSERDES clocked by clk_ser_i
+    g_tx_oversampling                        : natural := 1
   );
   port
   (
     -- Clock/Resets
     clk_i                                    : in std_logic;
     rst_n_i                                  : in std_logic;
+    -- Oversampling clock, at g_rx_oversampling/2 (g_tx_oversampling/2) times
+    -- clk_i and phase aligned to it. Only used if g_rx_oversampling > 1 or
+    -- g_tx_oversampling > 1. It clocks both the ISERDES and the OSERDES, so
+    -- both ratios must be the same if both are > 1
+    clk_ser_i                                : in std_logic := '0';
 
     -------------------------------
     -- Trigger configuration
@@ -196,6 +214,12 @@ package ifc_common_pkg is
     trig_rx_delay_length_i                   : in unsigned(g_rx_delay_width-1 downto 0);
     -- Number of detected transmitted triggers to external module
     trig_tx_delay_length_i                   : in unsigned(g_tx_delay_width-1 downto 0);
+    -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to delay the
+    -- transmitted pulse after trig_tx_delay_length_i
+    trig_tx_fine_delay_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
+    -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to widen the
+    -- transmitted pulse after trig_tx_extensor_length_i
+    trig_tx_fine_width_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
 
     -------------------------------
     -- Counters
@@ -209,6 +233,19 @@ package ifc_common_pkg is
     -- Number of detected transmitted triggers to external module
     trig_tx_cnt_o                            : out unsigned(g_tx_counter_width-1 downto 0);
 
+    -------------------------------
+    -- Receive timestamps
+    -------------------------------
+    -- Coarse time base, in clk_i cycles
+    trig_rx_ts_i                             : in unsigned(g_rx_ts_width-1 downto 0) := (others => '0');
+    -- Coarse timestamp of the last received trigger
+    trig_rx_ts_o                             : out unsigned(g_rx_ts_width-1 downto 0);
+    -- Fine phase of the last received trigger, in 1/g_rx_oversampling of a
+    -- clk_i cycle after trig_rx_ts_o
+    trig_rx_ts_fine_o                        : out natural range 0 to g_rx_oversampling-1;
+    -- Timestamp valid
+    trig_rx_ts_valid_o                       : out std_logic;
+
     -------------------------------
     ---- External ports
     -------------------------------
@@ -307,6 +344,26 @@ package ifc_common_pkg is
   );
   end component mov_avg_dyn;
 
+  component mov_avg_bram is
+  generic (
+    g_MAX_LENGTH    : natural := 1024;
+    g_DATA_WIDTH    : natural := 32;
+    g_NUM_CHANNELS  : natural := 1
+  );
+  port (
+    clk_i           : in std_logic;
+    rst_n_i         : in std_logic;
+    length_i        : in natural range 1 to g_MAX_LENGTH := 1;
+    length_o        : out natural range 1 to g_MAX_LENGTH;
+    data_i          : in signed(g_DATA_WIDTH-1 downto 0);
+    ch_i            : in natural range 0 to g_NUM_CHANNELS-1 := 0;
+    valid_i         : in std_logic;
+    avgd_data_o     : out signed(g_DATA_WIDTH-1 downto 0);
+    ch_o            : out natural range 0 to g_NUM_CHANNELS-1;
+    valid_o         : out std_logic
+  );
+  end component mov_avg_bram;
+
   component biquad is
     generic (
       g_X_INT_WIDTH       : natural;
@@ -315,7 +372,8 @@ package ifc_common_pkg is
       g_COEFF_FRAC_WIDTH  : natural;
       g_Y_INT_WIDTH       : natural;
       g_Y_FRAC_WIDTH      : natural;
-      g_EXTRA_BITS        : natural
+      g_EXTRA_BITS        : natural;
+      g_COEFFS_DOUBLE_BUFFER : boolean := false
     );
     port (
       clk_i               : in  std_logic;
@@ -329,6 +387,9 @@ package ifc_common_pkg is
                                   a1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
                                   a2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH)
                                 );
+      coeffs_load_i       : in  std_logic := '0';
+      coeffs_pending_o    : out std_logic;
+      coeffs_loaded_o     : out std_logic;
 
       busy_o              : out std_logic;
       y_o                 : out sfixed(g_Y_INT_WIDTH-1 downto -g_Y_FRAC_WIDTH);
@@ -336,6 +397,34 @@ package ifc_common_pkg is
     );
   END COMPONENT biquad;
 
+  component biquad_pipe is
+    generic (
+      g_X_INT_WIDTH       : natural;
+      g_X_FRAC_WIDTH      : natural;
+      g_COEFF_INT_WIDTH   : natural;
+      g_COEFF_FRAC_WIDTH  : natural;
+      g_Y_INT_WIDTH       : natural;
+      g_Y_FRAC_WIDTH      : natural;
+      g_EXTRA_BITS        : natural;
+      g_LOOKAHEAD         : natural := 3
+    );
+    port (
+      clk_i               : in  std_logic;
+      rst_n_i             : in  std_logic;
+      x_i                 : in  sfixed(g_X_INT_WIDTH-1 downto -g_X_FRAC_WIDTH);
+      x_valid_i           : in  std_logic;
+      coeffs_i            : in  t_biquad_coeffs(
+                                  b0(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  b1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  b2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  a1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  a2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH)
+                                );
+      y_o                 : out sfixed(g_Y_INT_WIDTH-1 downto -g_Y_FRAC_WIDTH);
+      y_valid_o           : out std_logic
+    );
+  end component biquad_pipe;
+
   component iir_filt is
     generic (
       g_NUM_BIQUADS       : natural;
@@ -346,7 +435,8 @@ package ifc_common_pkg is
       g_Y_INT_WIDTH       : natural;
       g_Y_FRAC_WIDTH      : natural;
       g_ARITH_EXTRA_BITS  : natural;
-      g_IFCS_EXTRA_BITS   : natural
+      g_IFCS_EXTRA_BITS   : natural;
+      g_COEFFS_DOUBLE_BUFFER : boolean := false
     );
     port (
       clk_i               : in  std_logic;
@@ -360,12 +450,49 @@ package ifc_common_pkg is
                                   a1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
                                   a2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH)
                                 );
+      coeffs_commit_i     : in  std_logic := '0';
+      coeffs_pending_o    : out std_logic;
       busy_o              : out std_logic;
       y_o                 : out sfixed(g_Y_INT_WIDTH-1 downto -g_Y_FRAC_WIDTH);
       y_valid_o           : out std_logic
     );
   end component iir_filt;
 
+  component iir_filt_tdm is
+    generic (
+      g_NUM_CHANNELS      : natural;
+      g_NUM_BIQUADS       : natural;
+      g_X_INT_WIDTH       : natural;
+      g_X_FRAC_WIDTH      : natural;
+      g_COEFF_INT_WIDTH   : natural;
+      g_COEFF_FRAC_WIDTH  : natural;
+      g_Y_INT_WIDTH       : natural;
+      g_Y_FRAC_WIDTH      : natural;
+      g_ARITH_EXTRA_BITS  : natural;
+      g_IFCS_EXTRA_BITS   : natural
+    );
+    port (
+      clk_i               : in  std_logic;
+      rst_n_i             : in  std_logic;
+      x_i                 : in  sfixed(g_X_INT_WIDTH-1 downto -g_X_FRAC_WIDTH);
+      x_valid_i           : in  std_logic;
+      coeffs_i            : in  t_biquad_coeffs(
+                                  b0(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  b1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  b2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  a1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                                  a2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH)
+                                );
+      coeffs_ch_i         : in  natural range 0 to g_NUM_CHANNELS-1;
+      coeffs_biquad_i     : in  natural range 0 to g_NUM_BIQUADS-1;
+      coeffs_wr_i         : in  std_logic;
+      busy_o              : out std_logic;
+      y_o                 : out sfixed(g_Y_INT_WIDTH-1 downto -g_Y_FRAC_WIDTH);
+      y_ch_o              : out natural range 0 to g_NUM_CHANNELS-1;
+      y_valid_o           : out std_logic
+    );
+  end component iir_filt_tdm;
+
   component i2c_slave_iface is
     generic (
       -- 7 bits slave address
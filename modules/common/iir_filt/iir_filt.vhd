@@ -9,6 +9,12 @@
 -- Standard     : VHDL'08
 --------------------------------------------------------------------------------
 -- Description  : Cascades biquad filters for achieving higher-order IIR filter.
+--
+--                With g_COEFFS_DOUBLE_BUFFER, a pulse on coeffs_commit_i
+--                loads coeffs_i into every biquad (see biquad.vhd). The
+--                load follows the samples down the cascade, so that each
+--                sample goes through all the biquads with the same set.
+--                Hold coeffs_i while coeffs_pending_o is '1'.
 --------------------------------------------------------------------------------
 -- Copyright (c) 2023 CNPEM
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -49,7 +55,10 @@ ENTITY iir_filt IS
     -- Extra bits for biquads' internal arithmetic
     g_ARITH_EXTRA_BITS  : NATURAL;
     -- Extra bits for between-biquads cascade interfaces
-    g_IFCS_EXTRA_BITS   : NATURAL
+    g_IFCS_EXTRA_BITS   : NATURAL;
+
+    -- Take coeffs_i only on coeffs_commit_i
+    g_COEFFS_DOUBLE_BUFFER : BOOLEAN := FALSE
   );
   PORT (
     -- Clock
@@ -72,6 +81,10 @@ ENTITY iir_filt IS
                                 a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
                                 a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
                               );
+    -- Load coeffs_i (g_COEFFS_DOUBLE_BUFFER only)
+    coeffs_commit_i     : IN  STD_LOGIC := '0';
+    -- A commit is still making its way down the cascade
+    coeffs_pending_o    : OUT STD_LOGIC;
 
     -- Busy flag
     busy_o              : OUT STD_LOGIC;
@@ -97,6 +110,8 @@ ARCHITECTURE behave OF iir_filt IS
 
   SIGNAL cascade_ifcs : t_cascade_ifcs(g_NUM_BIQUADS-1 DOWNTO 0);
   SIGNAL busy : STD_LOGIC_VECTOR(g_NUM_BIQUADS-1 DOWNTO 0);
+  SIGNAL coeffs_load, coeffs_loaded, coeffs_pending :
+           STD_LOGIC_VECTOR(g_NUM_BIQUADS-1 DOWNTO 0);
 BEGIN
   gen_biquads : FOR idx IN 0 TO g_NUM_BIQUADS-1
     GENERATE
@@ -108,7 +123,8 @@ BEGIN
           g_COEFF_FRAC_WIDTH  => g_COEFF_FRAC_WIDTH,
           g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
           g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH + g_IFCS_EXTRA_BITS,
-          g_EXTRA_BITS        => g_ARITH_EXTRA_BITS
+          g_EXTRA_BITS        => g_ARITH_EXTRA_BITS,
+          g_COEFFS_DOUBLE_BUFFER => g_COEFFS_DOUBLE_BUFFER
         )
         PORT MAP (
           clk_i               => clk_i,
@@ -116,6 +132,9 @@ BEGIN
           x_i                 => cascade_ifcs(idx).x,
           x_valid_i           => cascade_ifcs(idx).x_valid,
           coeffs_i            => coeffs_i(idx),
+          coeffs_load_i       => coeffs_load(idx),
+          coeffs_pending_o    => coeffs_pending(idx),
+          coeffs_loaded_o     => coeffs_loaded(idx),
           busy_o              => busy(idx),
           y_o                 => cascade_ifcs(idx).y,
           y_valid_o           => cascade_ifcs(idx).y_valid
@@ -124,16 +143,22 @@ BEGIN
 
   cascade_ifcs(0).x <= resize(x_i, cascade_ifcs(0).x'LEFT, cascade_ifcs(0).x'RIGHT);
   cascade_ifcs(0).x_valid <= x_valid_i;
+  coeffs_load(0) <= coeffs_commit_i;
 
   gen_cascade_conn : FOR idx IN 0 TO g_NUM_BIQUADS-2
     GENERATE
       cascade_ifcs(idx + 1).x <= cascade_ifcs(idx).y;
       cascade_ifcs(idx + 1).x_valid <= cascade_ifcs(idx).y_valid;
+      coeffs_load(idx + 1) <= coeffs_loaded(idx);
     END GENERATE gen_cascade_conn;
 
   y_o <= resize(cascade_ifcs(g_NUM_BIQUADS-1).y, y_o'LEFT, y_o'RIGHT);
   y_valid_o <= cascade_ifcs(g_NUM_BIQUADS-1).y_valid;
 
+  -- The load is also in flight for the cycle it takes to reach the next
+  -- biquad
+  coeffs_pending_o <= (OR coeffs_pending) OR (OR coeffs_load(g_NUM_BIQUADS-1 DOWNTO 1));
+
   -- Since all biquads have the same FSM length, it's enough to consider only
   -- the first cascaded biquad's busy flag.
   busy_o <= busy(0);
@@ -0,0 +1,277 @@
+/*
+ * Bit-exact model of biquad.vhd
+ *
+ * The widths are template parameters named after the biquad generics.
+ * Biquad reproduces the core one sample at a time, with the same resize()
+ * of every intermediate as the FSM of biquad.vhd. BiquadBank runs many
+ * independent channels at once, each one with its own coefficients, in
+ * 64-bit vector lanes: it gives the same results as Biquad but only
+ * supports the widths whose products fit two 32-bit limbs (see the
+ * static_asserts). Build with -march=native (or at least -mavx2) to get
+ * four lanes instead of two.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef BIQUAD_MODEL_H
+#define BIQUAD_MODEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "fixed_model.h"
+
+namespace iir_model {
+
+/* Raw b0, b1, b2, a1 and a2 (a0 = 1), in the coefficient format */
+struct BiquadCoeffs {
+    int64_t b0 = 0, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+};
+
+template <int XIntWidth, int XFracWidth, int CoeffIntWidth, int CoeffFracWidth,
+          int YIntWidth, int YFracWidth, int ExtraBits>
+struct BiquadFormat {
+    static constexpr int x_int = XIntWidth, x_frac = XFracWidth;
+    static constexpr int coeff_int = CoeffIntWidth, coeff_frac = CoeffFracWidth;
+    static constexpr int y_int = YIntWidth, y_frac = YFracWidth;
+    static constexpr int extra_bits = ExtraBits;
+
+    static constexpr int x_bits = x_int + x_frac;
+    static constexpr int coeff_bits = coeff_int + coeff_frac;
+    static constexpr int y_bits = y_int + y_frac;
+
+    /* w, aux_a, aux_b and the resized products */
+    static constexpr int w_frac = coeff_frac + x_frac + extra_bits;
+    static constexpr int w_bits = coeff_int + x_int + extra_bits + w_frac;
+
+    static_assert(x_bits <= 64 && coeff_bits <= 64 && y_bits <= 64,
+                  "ports wider than 64 bits are not supported");
+    static_assert(coeff_bits + w_bits + 2 <= 127,
+                  "internal arithmetic does not fit 128 bits");
+
+    static int64_t x_from_real(double x) { return to_sfixed(x, x_int, x_frac); }
+    static double y_to_real(int64_t y) { return to_real(y, y_frac); }
+
+    /* The coefficients as converted by to_sfixed(real) */
+    static BiquadCoeffs coeffs_from_real(double b0, double b1, double b2, double a1, double a2)
+    {
+        BiquadCoeffs c;
+        c.b0 = to_sfixed(b0, coeff_int, coeff_frac);
+        c.b1 = to_sfixed(b1, coeff_int, coeff_frac);
+        c.b2 = to_sfixed(b2, coeff_int, coeff_frac);
+        c.a1 = to_sfixed(a1, coeff_int, coeff_frac);
+        c.a2 = to_sfixed(a2, coeff_int, coeff_frac);
+        return c;
+    }
+};
+
+template <typename Fmt>
+class Biquad {
+public:
+    explicit Biquad(const BiquadCoeffs &c = BiquadCoeffs()) : c_(c) {}
+
+    void set_coeffs(const BiquadCoeffs &c) { c_ = c; }
+    const BiquadCoeffs &coeffs() const { return c_; }
+
+    /* State after rst_n_i */
+    void reset() { w_d1_ = aux_a_ = aux_b_ = 0; }
+
+    /* One x_valid_i to y_valid_o round, on raw values */
+    int64_t step(int64_t x)
+    {
+        constexpr int wf = Fmt::w_frac, wb = Fmt::w_bits, cf = Fmt::coeff_frac;
+
+        /* w_tmp is as fine as w, so only saturates */
+        wide_t w = saturate(wide_t(x) * (wide_t(1) << (wf - Fmt::x_frac)) + aux_a_, wb);
+        wide_t b0_w = resize(c_.b0 * w, wf + cf, wf, wb);
+
+        /* The products for the next sample are taken after the shift */
+        wide_t w_d2 = w_d1_;
+        w_d1_ = w;
+        wide_t a1_w_d1 = resize(c_.a1 * w_d1_, wf + cf, wf, wb);
+        wide_t a2_w_d2 = resize(c_.a2 * w_d2, wf + cf, wf, wb);
+        wide_t b1_w_d1 = resize(c_.b1 * w_d1_, wf + cf, wf, wb);
+        wide_t b2_w_d2 = resize(c_.b2 * w_d2, wf + cf, wf, wb);
+
+        wide_t y = resize(b0_w + aux_b_, wf, Fmt::y_frac, Fmt::y_bits);
+
+        aux_a_ = saturate(-a1_w_d1 - a2_w_d2, wb);
+        aux_b_ = saturate(b1_w_d1 + b2_w_d2, wb);
+        return static_cast<int64_t>(y);
+    }
+
+    void filter(const int64_t *x, int64_t *y, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; i++)
+            y[i] = step(x[i]);
+    }
+
+private:
+    BiquadCoeffs c_;
+    wide_t w_d1_ = 0, aux_a_ = 0, aux_b_ = 0;
+};
+
+namespace detail {
+
+/* Four lanes with AVX2, two otherwise */
+#ifdef __AVX2__
+constexpr std::size_t vec_bytes = 32;
+#else
+constexpr std::size_t vec_bytes = 16;
+#endif
+typedef int64_t vec_t __attribute__((vector_size(vec_bytes)));
+typedef uint64_t uvec_t __attribute__((vector_size(vec_bytes)));
+constexpr std::size_t lanes = sizeof(vec_t) / sizeof(int64_t);
+
+inline vec_t shl(vec_t v, int s)
+{
+    return (vec_t)((uvec_t)v << s);
+}
+
+template <int Bits>
+inline vec_t saturate(vec_t v)
+{
+    if constexpr (Bits >= 64) {
+        return v;
+    } else {
+        const vec_t max = vec_t{} + ((int64_t(1) << (Bits - 1)) - 1);
+        const vec_t min = -max - 1;
+        v = v > max ? max : v;
+        return v < min ? min : v;
+    }
+}
+
+/* Rounds q + rem * 2**-S to nearest, ties to even, with 0 <= rem < 2**S.
+ * The comparisons give -1 in the lanes that round up */
+template <int S>
+inline vec_t round_even(vec_t q, vec_t rem)
+{
+    const int64_t half = int64_t(1) << (S - 1);
+    return q - ((rem > half) | ((rem == half) & ((q & 1) != 0)));
+}
+
+/* resize() of a raw value by dropping S fractional bits, before saturation */
+template <int S>
+inline vec_t round_shift(vec_t v)
+{
+    if constexpr (S == 0)
+        return v;
+    else
+        return round_even<S>(v >> S, v & (int64_t)((uint64_t(1) << S) - 1));
+}
+
+/* resize() of the product c*w by dropping F fractional bits, before
+ * saturation. c fits 32 bits and w 62 bits, so the product is split at
+ * bit 32 as h * 2**32 + l, with 0 <= l < 2**32 */
+template <int F>
+inline vec_t mul_round_shift(vec_t c, vec_t w)
+{
+    vec_t pl = c * (w & 0xffffffff);
+    vec_t h = c * (w >> 32) + (pl >> 32);
+    vec_t l = pl & 0xffffffff;
+    if constexpr (F == 0)
+        return shl(h, 32) + l;
+    else
+        return round_even<F>(shl(h, 32 - F) + (l >> F), l & ((int64_t(1) << F) - 1));
+}
+
+} /* namespace detail */
+
+template <typename Fmt>
+class BiquadBank {
+    static_assert(Fmt::coeff_bits <= 32 && Fmt::coeff_frac <= 32,
+                  "coefficients wider than 32 bits are not supported");
+    static_assert(Fmt::w_bits <= 62 && Fmt::coeff_int + Fmt::w_bits <= 63,
+                  "internal arithmetic does not fit 64-bit lanes");
+    static_assert(Fmt::y_frac <= Fmt::w_frac ||
+                  Fmt::w_bits + 1 + Fmt::y_frac - Fmt::w_frac <= 64,
+                  "y does not fit 64-bit lanes");
+
+public:
+    explicit BiquadBank(std::size_t channels) :
+        channels_(channels), blocks_((channels + detail::lanes - 1) / detail::lanes)
+    {
+    }
+
+    std::size_t channels() const { return channels_; }
+
+    void set_coeffs(std::size_t ch, const BiquadCoeffs &c)
+    {
+        Block &b = blocks_[ch / detail::lanes];
+        std::size_t l = ch % detail::lanes;
+        b.b0[l] = c.b0;
+        b.b1[l] = c.b1;
+        b.b2[l] = c.b2;
+        b.a1[l] = c.a1;
+        b.a2[l] = c.a2;
+    }
+
+    void reset()
+    {
+        for (auto &b : blocks_)
+            b.w_d1 = b.aux_a = b.aux_b = detail::vec_t{};
+    }
+
+    /* Filters n samples of every channel. x and y hold n rows of channels()
+     * raw values, x[i * channels() + ch]; they may be the same buffer */
+    void filter(const int64_t *x, int64_t *y, std::size_t n)
+    {
+        for (std::size_t k = 0; k < blocks_.size(); k++) {
+            std::size_t ch = k * detail::lanes;
+            std::size_t nl = std::min(detail::lanes, channels_ - ch);
+            Block b = blocks_[k];
+
+            for (std::size_t i = 0; i < n; i++) {
+                detail::vec_t xv{};
+                std::memcpy(&xv, x + i * channels_ + ch, nl * sizeof(int64_t));
+                detail::vec_t yv = step(b, xv);
+                std::memcpy(y + i * channels_ + ch, &yv, nl * sizeof(int64_t));
+            }
+            blocks_[k] = b;
+        }
+    }
+
+private:
+    struct Block {
+        detail::vec_t b0{}, b1{}, b2{}, a1{}, a2{};
+        detail::vec_t w_d1{}, aux_a{}, aux_b{};
+    };
+
+    /* Same as Biquad::step(), lane by lane */
+    static detail::vec_t step(Block &b, detail::vec_t x)
+    {
+        using namespace detail;
+        constexpr int wf = Fmt::w_frac, wb = Fmt::w_bits, cf = Fmt::coeff_frac;
+
+        vec_t w = saturate<wb>(shl(x, wf - Fmt::x_frac) + b.aux_a);
+        vec_t b0_w = saturate<wb>(mul_round_shift<cf>(b.b0, w));
+
+        vec_t w_d2 = b.w_d1;
+        b.w_d1 = w;
+        vec_t a1_w_d1 = saturate<wb>(mul_round_shift<cf>(b.a1, w));
+        vec_t a2_w_d2 = saturate<wb>(mul_round_shift<cf>(b.a2, w_d2));
+        vec_t b1_w_d1 = saturate<wb>(mul_round_shift<cf>(b.b1, w));
+        vec_t b2_w_d2 = saturate<wb>(mul_round_shift<cf>(b.b2, w_d2));
+
+        vec_t y;
+        if constexpr (Fmt::y_frac <= wf)
+            y = round_shift<wf - Fmt::y_frac>(b0_w + b.aux_b);
+        else
+            y = shl(b0_w + b.aux_b, Fmt::y_frac - wf);
+
+        b.aux_a = saturate<wb>(-a1_w_d1 - a2_w_d2);
+        b.aux_b = saturate<wb>(b1_w_d1 + b2_w_d2);
+        return saturate<Fmt::y_bits>(y);
+    }
+
+    std::size_t channels_;
+    std::vector<Block> blocks_;
+};
+
+} /* namespace iir_model */
+
+#endif /* BIQUAD_MODEL_H */
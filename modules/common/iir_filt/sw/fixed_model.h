@@ -0,0 +1,77 @@
+/*
+ * Bit-exact model of the ieee.fixed_pkg operations used by biquad.vhd and
+ * iir_filt.vhd
+ *
+ * An sfixed(I-1 downto -F) is held as its raw two's complement integer v,
+ * with value v * 2**-F and I + F bits. Additions, subtractions and products
+ * are exact in fixed_pkg, so only resize() and to_sfixed(real) need a model.
+ * Both use the package defaults: fixed_saturate and fixed_round.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef FIXED_MODEL_H
+#define FIXED_MODEL_H
+
+#include <cmath>
+#include <cstdint>
+
+namespace iir_model {
+
+/* Wide enough for every full precision intermediate of biquad.vhd */
+typedef __int128 wide_t;
+
+/* Clamps v to a 'bits' wide signed integer */
+constexpr wide_t saturate(wide_t v, int bits)
+{
+    const wide_t max = (wide_t(1) << (bits - 1)) - 1;
+    const wide_t min = -max - 1;
+    return v > max ? max : v < min ? min : v;
+}
+
+/* resize() of a raw value with 'from_frac' fractional bits to 'frac'
+ * fractional bits and 'bits' bits. fixed_round rounds to nearest with ties
+ * to even; a value that saturates is not rounded, which gives the same
+ * result as rounding first */
+constexpr wide_t resize(wide_t v, int from_frac, int frac, int bits)
+{
+    if (frac < from_frac) {
+        const int s = from_frac - frac;
+        const wide_t rem = v & ((wide_t(1) << s) - 1);
+        const wide_t half = wide_t(1) << (s - 1);
+        v >>= s;
+        if (rem > half || (rem == half && (v & 1)))
+            v++;
+    } else {
+        v *= wide_t(1) << (frac - from_frac);
+    }
+    return saturate(v, bits);
+}
+
+/* to_sfixed(a, int_width-1, -frac_width). fixed_pkg takes the magnitude
+ * truncated to fixed_guard_bits (3) extra fractional bits, negates it and
+ * resizes that, so the guard bits decide ties: this is not plain rounding
+ * of a */
+inline int64_t to_sfixed(double a, int int_width, int frac_width)
+{
+    const int guard_bits = 3;
+    const int bits = int_width + frac_width;
+    const double lim = std::ldexp(1.0, int_width - 1);
+
+    if (a >= lim || a < -lim)
+        return static_cast<int64_t>(saturate(a < 0 ? -(wide_t(1) << bits) : wide_t(1) << bits, bits));
+
+    wide_t g = static_cast<wide_t>(std::floor(std::ldexp(std::fabs(a), frac_width + guard_bits)));
+    return static_cast<int64_t>(resize(a < 0 ? -g : g, frac_width + guard_bits, frac_width, bits));
+}
+
+/* to_real() of a raw value */
+inline double to_real(int64_t v, int frac_width)
+{
+    return std::ldexp(static_cast<double>(v), -frac_width);
+}
+
+} /* namespace iir_model */
+
+#endif /* FIXED_MODEL_H */
@@ -0,0 +1,142 @@
+/*
+ * Bit-exact model of iir_filt.vhd
+ *
+ * A cascade of biquad models, with the same input and output resize() as
+ * iir_filt.vhd. The number of biquads is a constructor argument, since it
+ * does not change the arithmetic. IirFilt runs one channel a sample at a
+ * time and IirFiltBank runs many channels at once, with BiquadBank.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef IIR_FILT_MODEL_H
+#define IIR_FILT_MODEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "biquad_model.h"
+
+namespace iir_model {
+
+template <int XIntWidth, int XFracWidth, int CoeffIntWidth, int CoeffFracWidth,
+          int YIntWidth, int YFracWidth, int ArithExtraBits, int IfcsExtraBits>
+struct IirFiltFormat {
+    static constexpr int x_int = XIntWidth, x_frac = XFracWidth;
+    static constexpr int y_int = YIntWidth, y_frac = YFracWidth;
+    static constexpr int ifcs_extra_bits = IfcsExtraBits;
+    static constexpr int x_bits = x_int + x_frac;
+    static constexpr int y_bits = y_int + y_frac;
+
+    /* Each biquad of the cascade */
+    typedef BiquadFormat<XIntWidth, XFracWidth + IfcsExtraBits, CoeffIntWidth, CoeffFracWidth,
+                         YIntWidth, YFracWidth + IfcsExtraBits, ArithExtraBits> biquad;
+
+    static int64_t x_from_real(double x) { return to_sfixed(x, x_int, x_frac); }
+    static double y_to_real(int64_t y) { return to_real(y, y_frac); }
+
+    /* The y of a biquad drives the x of the next one bit by bit, which only
+     * elaborates if both have the same width */
+    static void check_cascade(std::size_t num_biquads)
+    {
+        if (num_biquads == 0)
+            throw std::invalid_argument("iir_filt needs at least one biquad");
+        if (num_biquads > 1 && x_bits != y_bits)
+            throw std::invalid_argument("cascaded biquads need x and y of the same width");
+    }
+
+    /* resize() of the input to the cascade format; it only adds bits */
+    static int64_t to_cascade(int64_t x)
+    {
+        return static_cast<int64_t>(resize(x, x_frac, biquad::x_frac, biquad::x_bits));
+    }
+
+    static int64_t from_cascade(int64_t y)
+    {
+        return static_cast<int64_t>(resize(y, biquad::y_frac, y_frac, y_bits));
+    }
+};
+
+template <typename Fmt>
+class IirFilt {
+public:
+    explicit IirFilt(std::size_t num_biquads) : biquads_(num_biquads)
+    {
+        Fmt::check_cascade(num_biquads);
+    }
+
+    std::size_t num_biquads() const { return biquads_.size(); }
+
+    void set_coeffs(std::size_t idx, const BiquadCoeffs &c) { biquads_[idx].set_coeffs(c); }
+
+    void reset()
+    {
+        for (auto &b : biquads_)
+            b.reset();
+    }
+
+    int64_t step(int64_t x)
+    {
+        int64_t v = Fmt::to_cascade(x);
+        for (auto &b : biquads_)
+            v = b.step(v);
+        return Fmt::from_cascade(v);
+    }
+
+    void filter(const int64_t *x, int64_t *y, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; i++)
+            y[i] = step(x[i]);
+    }
+
+private:
+    std::vector<Biquad<typename Fmt::biquad>> biquads_;
+};
+
+template <typename Fmt>
+class IirFiltBank {
+public:
+    IirFiltBank(std::size_t channels, std::size_t num_biquads) :
+        channels_(channels), stages_(num_biquads, BiquadBank<typename Fmt::biquad>(channels))
+    {
+        Fmt::check_cascade(num_biquads);
+    }
+
+    std::size_t channels() const { return channels_; }
+    std::size_t num_biquads() const { return stages_.size(); }
+
+    void set_coeffs(std::size_t ch, std::size_t idx, const BiquadCoeffs &c)
+    {
+        stages_[idx].set_coeffs(ch, c);
+    }
+
+    void reset()
+    {
+        for (auto &s : stages_)
+            s.reset();
+    }
+
+    /* Same layout as BiquadBank::filter(). The biquads are run one after
+     * the other over the whole block, in place on y */
+    void filter(const int64_t *x, int64_t *y, std::size_t n)
+    {
+        const std::size_t len = n * channels_;
+        for (std::size_t i = 0; i < len; i++)
+            y[i] = Fmt::to_cascade(x[i]);
+        for (auto &s : stages_)
+            s.filter(y, y, n);
+        for (std::size_t i = 0; i < len; i++)
+            y[i] = Fmt::from_cascade(y[i]);
+    }
+
+private:
+    std::size_t channels_;
+    std::vector<BiquadBank<typename Fmt::biquad>> stages_;
+};
+
+} /* namespace iir_model */
+
+#endif /* IIR_FILT_MODEL_H */
@@ -0,0 +1,171 @@
+/*
+ * biquad model self-test
+ *
+ * Checks the fixed_pkg model on hand-computed cases, the biquad model
+ * against the floating point values of the biquad testbench, with the same
+ * 1% tolerance, and BiquadBank against Biquad, bit by bit.
+ *
+ * Given the file written by biquad_tb with g_TEST_Y_DUMP_FILENAME (see
+ * 'make ghdl-check'), also checks the model against GHDL, bit by bit.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "biquad_model.h"
+#include "tb_files.h"
+
+using namespace iir_model;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/* The biquad_tb defaults */
+typedef BiquadFormat<15, 10, 1, 31, 15, 10, 1> TbFormat;
+
+static void test_fixed()
+{
+    /* Ties go to even, the rest to nearest */
+    CHECK(resize(0x6, 2, 0, 8) == 2);       /* 1.5 */
+    CHECK(resize(0xa, 2, 0, 8) == 2);       /* 2.5 */
+    CHECK(resize(0x2, 2, 0, 8) == 0);       /* 0.5 */
+    CHECK(resize(0x3, 2, 0, 8) == 1);       /* 0.75 */
+    CHECK(resize(-0x2, 2, 0, 8) == 0);      /* -0.5 */
+    CHECK(resize(-0x6, 2, 0, 8) == -2);     /* -1.5 */
+    CHECK(resize(-0x5, 2, 0, 8) == -1);     /* -1.25 */
+
+    /* Saturation, also after rounding up */
+    CHECK(resize(100, 0, 0, 4) == 7);
+    CHECK(resize(-100, 0, 0, 4) == -8);
+    CHECK(resize(0x1e, 2, 0, 4) == 7);      /* 7.5 */
+    CHECK(resize(3, 0, 2, 8) == 12);
+
+    /* to_sfixed() only sees 3 guard bits, so this is a tie */
+    CHECK(to_sfixed(0.03125 + 1e-9, 1, 4) == 0);
+    CHECK(to_sfixed(-0.03125 - 1e-9, 1, 4) == 0);
+    CHECK(to_sfixed(0.03125 + 0.0078125, 1, 4) == 1);
+    CHECK(to_sfixed(0.1, 2, 4) == 2);
+    CHECK(to_sfixed(1.0, 1, 31) == 0x7fffffff);
+    CHECK(to_sfixed(-1.0, 1, 31) == -0x80000000ll);
+    CHECK(to_sfixed(-5.0, 1, 31) == -0x80000000ll);
+}
+
+static void test_reference()
+{
+    std::vector<double> x, y;
+    read_x_y(TB_DIR "/biquad/biquad_x_y.dat", x, y);
+    Biquad<TbFormat> b(read_coeffs<TbFormat>(TB_DIR "/biquad/biquad_coeffs.dat", 1)[0]);
+
+    for (std::size_t i = 0; i < x.size(); i++) {
+        double v = TbFormat::y_to_real(b.step(TbFormat::x_from_real(x[i])));
+        if (std::fabs(v / y[i] - 1.0) > 0.01) {
+            std::fprintf(stderr, "sample %zu: got %g, expected %g\n", i, v, y[i]);
+            failures++;
+        }
+    }
+}
+
+/* Random coefficients, including unstable sets, and inputs up to full
+ * scale, so that every intermediate saturates now and then */
+template <typename Fmt>
+static void test_bank(std::mt19937_64 &rng, std::size_t channels, std::size_t n)
+{
+    std::uniform_int_distribution<int64_t> coeff(-(int64_t(1) << (Fmt::coeff_bits - 1)),
+                                                 (int64_t(1) << (Fmt::coeff_bits - 1)) - 1);
+    std::uniform_int_distribution<int> shift(0, Fmt::x_bits - 1);
+
+    std::vector<Biquad<Fmt>> ref(channels);
+    BiquadBank<Fmt> bank(channels);
+    for (std::size_t ch = 0; ch < channels; ch++) {
+        BiquadCoeffs c;
+        c.b0 = coeff(rng);
+        c.b1 = coeff(rng);
+        c.b2 = coeff(rng);
+        /* Most channels get a1 and a2 scaled down, to stay stable */
+        int s = ch % 4 ? Fmt::coeff_int + 1 : 0;
+        c.a1 = coeff(rng) >> s;
+        c.a2 = coeff(rng) >> s;
+        /* Coarse coefficients make the products round ties often */
+        if (ch % 4 == 1) {
+            const int64_t mask = ~((int64_t(1) << std::max(Fmt::coeff_frac - 2, 0)) - 1);
+            c.b0 &= mask;
+            c.b1 &= mask;
+            c.b2 &= mask;
+            c.a1 &= mask;
+            c.a2 &= mask;
+        }
+        ref[ch].set_coeffs(c);
+        bank.set_coeffs(ch, c);
+    }
+
+    std::vector<int64_t> x(n * channels), y(n * channels);
+    for (auto &v : x)
+        v = static_cast<int64_t>(rng()) >> (64 - Fmt::x_bits + shift(rng));
+
+    bank.filter(x.data(), y.data(), n / 2);
+    bank.filter(x.data() + n / 2 * channels, y.data() + n / 2 * channels, n - n / 2);
+
+    std::size_t mismatches = 0;
+    for (std::size_t ch = 0; ch < channels; ch++)
+        for (std::size_t i = 0; i < n; i++)
+            mismatches += ref[ch].step(x[i * channels + ch]) != y[i * channels + ch];
+    CHECK(mismatches == 0);
+
+    /* After a reset, both start over */
+    bank.reset();
+    ref[channels - 1].reset();
+    bank.filter(x.data(), y.data(), 1);
+    CHECK(y[channels - 1] == ref[channels - 1].step(x[channels - 1]));
+}
+
+static void test_ghdl(const char *path)
+{
+    std::vector<double> x, y;
+    read_x_y(TB_DIR "/biquad/biquad_x_y.dat", x, y);
+    Biquad<TbFormat> b(read_coeffs<TbFormat>(TB_DIR "/biquad/biquad_coeffs.dat", 1)[0]);
+    std::vector<int64_t> ghdl = read_y_dump(path);
+
+    CHECK(ghdl.size() == x.size());
+    for (std::size_t i = 0; i < x.size() && i < ghdl.size(); i++) {
+        int64_t v = b.step(TbFormat::x_from_real(x[i]));
+        if (v != ghdl[i]) {
+            std::fprintf(stderr, "sample %zu: model %lld, GHDL %lld\n", i,
+                         static_cast<long long>(v), static_cast<long long>(ghdl[i]));
+            failures++;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::mt19937_64 rng(2026);
+
+    test_fixed();
+    test_reference();
+    test_bank<TbFormat>(rng, 37, 2000);
+    /* Coefficients with no integer bits, and y finer than w */
+    test_bank<BiquadFormat<12, 4, 0, 24, 6, 40, 2>>(rng, 9, 2000);
+    test_bank<BiquadFormat<5, 21, 3, 29, 5, 21, 1>>(rng, 64, 1000);
+    if (argc > 1)
+        test_ghdl(argv[1]);
+
+    if (failures) {
+        std::fprintf(stderr, "biquad_model_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("biquad_model_test: OK\n");
+    return EXIT_SUCCESS;
+}
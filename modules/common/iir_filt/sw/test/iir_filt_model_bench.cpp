@@ -0,0 +1,61 @@
+/*
+ * iir_filt model throughput benchmark
+ *
+ * Filters a block of samples of many channels with the iir_filt testbench
+ * format, with IirFilt one channel at a time and with IirFiltBank, and
+ * prints the time taken and the throughput, in biquad samples per second.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "iir_filt_model.h"
+
+using namespace iir_model;
+
+typedef IirFiltFormat<5, 21, 3, 29, 5, 21, 1, 0> Format;
+
+int main()
+{
+    const std::size_t channels = 320, num_biquads = 5, n = 10000;
+    typedef std::chrono::steady_clock clock;
+
+    /* Fourth order low-pass sections, the exact values do not matter */
+    BiquadCoeffs c = Format::biquad::coeffs_from_real(0.0029, 0.0058, 0.0029, -1.84, 0.85);
+
+    std::vector<int64_t> x(channels * n), y(channels * n), ys(n), xs(n);
+    std::mt19937_64 rng(1);
+    for (auto &v : x)
+        v = static_cast<int64_t>(rng()) >> (64 - Format::x_bits + 2);
+
+    IirFiltBank<Format> bank(channels, num_biquads);
+    std::vector<IirFilt<Format>> filt(channels, IirFilt<Format>(num_biquads));
+    for (std::size_t ch = 0; ch < channels; ch++)
+        for (std::size_t i = 0; i < num_biquads; i++) {
+            bank.set_coeffs(ch, i, c);
+            filt[ch].set_coeffs(i, c);
+        }
+
+    auto t0 = clock::now();
+    for (std::size_t ch = 0; ch < channels; ch++) {
+        for (std::size_t i = 0; i < n; i++)
+            xs[i] = x[i * channels + ch];
+        filt[ch].filter(xs.data(), ys.data(), n);
+    }
+    auto t1 = clock::now();
+    bank.filter(x.data(), y.data(), n);
+    auto t2 = clock::now();
+
+    const double samples = double(channels) * n * num_biquads;
+    double ts = std::chrono::duration<double>(t1 - t0).count();
+    double tb = std::chrono::duration<double>(t2 - t1).count();
+    std::printf("%zu channels, %zu biquads, %zu samples\n", channels, num_biquads, n);
+    std::printf("IirFilt:     %8.1f ms %8.1f M/s\n", ts * 1e3, samples / ts / 1e6);
+    std::printf("IirFiltBank: %8.1f ms %8.1f M/s\n", tb * 1e3, samples / tb / 1e6);
+    return 0;
+}
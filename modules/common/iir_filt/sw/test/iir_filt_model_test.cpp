@@ -0,0 +1,157 @@
+/*
+ * iir_filt model self-test
+ *
+ * Checks the iir_filt model against the floating point values of the
+ * iir_filt testbench, with the same 1% tolerance, and IirFiltBank against
+ * IirFilt, bit by bit.
+ *
+ * Given the file written by iir_filt_tb with g_TEST_Y_DUMP_FILENAME (see
+ * 'make ghdl-check'), also checks the model against GHDL, bit by bit.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "iir_filt_model.h"
+#include "tb_files.h"
+
+using namespace iir_model;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/* The iir_filt_tb defaults */
+typedef IirFiltFormat<5, 21, 3, 29, 5, 21, 1, 0> TbFormat;
+const std::size_t tb_num_biquads = 5;
+
+static IirFilt<TbFormat> tb_filter()
+{
+    IirFilt<TbFormat> f(tb_num_biquads);
+    auto c = read_coeffs<TbFormat::biquad>(TB_DIR "/iir_filt/iir_filt_coeffs.dat",
+                                           tb_num_biquads);
+    for (std::size_t i = 0; i < tb_num_biquads; i++)
+        f.set_coeffs(i, c[i]);
+    return f;
+}
+
+static void test_reference()
+{
+    std::vector<double> x, y;
+    read_x_y(TB_DIR "/iir_filt/iir_filt_x_y.dat", x, y);
+    IirFilt<TbFormat> f = tb_filter();
+
+    for (std::size_t i = 0; i < x.size(); i++) {
+        double v = TbFormat::y_to_real(f.step(TbFormat::x_from_real(x[i])));
+        if (std::fabs(v / y[i] - 1.0) > 0.01) {
+            std::fprintf(stderr, "sample %zu: got %g, expected %g\n", i, v, y[i]);
+            failures++;
+        }
+    }
+}
+
+static void test_cascade()
+{
+    typedef IirFiltFormat<5, 21, 3, 29, 6, 21, 1, 0> Mismatched;
+    bool thrown = false;
+    try {
+        IirFilt<Mismatched> f(2);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    /* A single biquad has nothing to connect */
+    IirFilt<Mismatched> f(1);
+    CHECK(f.num_biquads() == 1);
+}
+
+/* Every channel gets the testbench filter with its coefficients perturbed,
+ * as when designing a set per corrector */
+template <typename Fmt>
+static void test_bank(std::mt19937_64 &rng, std::size_t channels, std::size_t n)
+{
+    auto c0 = read_coeffs<typename Fmt::biquad>(TB_DIR "/iir_filt/iir_filt_coeffs.dat",
+                                                tb_num_biquads);
+    std::uniform_int_distribution<int64_t> delta(-1000, 1000);
+    std::uniform_real_distribution<double> amplitude(0.0, 20.0);
+
+    std::vector<IirFilt<Fmt>> ref(channels, IirFilt<Fmt>(tb_num_biquads));
+    IirFiltBank<Fmt> bank(channels, tb_num_biquads);
+    for (std::size_t ch = 0; ch < channels; ch++) {
+        for (std::size_t i = 0; i < tb_num_biquads; i++) {
+            BiquadCoeffs c = c0[i];
+            c.a1 += delta(rng);
+            c.a2 += delta(rng);
+            c.b0 += delta(rng);
+            ref[ch].set_coeffs(i, c);
+            bank.set_coeffs(ch, i, c);
+        }
+    }
+
+    std::vector<int64_t> x(n * channels), y(n * channels);
+    for (std::size_t ch = 0; ch < channels; ch++) {
+        double a = amplitude(rng);
+        for (std::size_t i = 0; i < n; i++)
+            x[i * channels + ch] = Fmt::x_from_real(a * std::sin(0.001 * (ch + 1) * i) +
+                                                    (rng() % 16 == 0 ? a : 0.0));
+    }
+
+    bank.filter(x.data(), y.data(), n);
+
+    std::size_t mismatches = 0;
+    for (std::size_t ch = 0; ch < channels; ch++)
+        for (std::size_t i = 0; i < n; i++)
+            mismatches += ref[ch].step(x[i * channels + ch]) != y[i * channels + ch];
+    CHECK(mismatches == 0);
+}
+
+static void test_ghdl(const char *path)
+{
+    std::vector<double> x, y;
+    read_x_y(TB_DIR "/iir_filt/iir_filt_x_y.dat", x, y);
+    IirFilt<TbFormat> f = tb_filter();
+    std::vector<int64_t> ghdl = read_y_dump(path);
+
+    CHECK(ghdl.size() == x.size());
+    for (std::size_t i = 0; i < x.size() && i < ghdl.size(); i++) {
+        int64_t v = f.step(TbFormat::x_from_real(x[i]));
+        if (v != ghdl[i]) {
+            std::fprintf(stderr, "sample %zu: model %lld, GHDL %lld\n", i,
+                         static_cast<long long>(v), static_cast<long long>(ghdl[i]));
+            failures++;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::mt19937_64 rng(2026);
+
+    test_reference();
+    test_cascade();
+    test_bank<TbFormat>(rng, 19, 3000);
+    /* Extra bits between the biquads */
+    test_bank<IirFiltFormat<5, 21, 2, 24, 5, 21, 1, 3>>(rng, 8, 3000);
+    if (argc > 1)
+        test_ghdl(argv[1]);
+
+    if (failures) {
+        std::fprintf(stderr, "iir_filt_model_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("iir_filt_model_test: OK\n");
+    return EXIT_SUCCESS;
+}
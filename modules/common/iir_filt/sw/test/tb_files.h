@@ -0,0 +1,77 @@
+/*
+ * Readers for the data files of the biquad and iir_filt testbenches
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef TB_FILES_H
+#define TB_FILES_H
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "biquad_model.h"
+
+/* Testbench directory, relative to the sw directory */
+#ifndef TB_DIR
+#define TB_DIR "../../../../testbench/common"
+#endif
+
+/* Lines of b0 b1 b2 a1 a2, converted like the testbenches do */
+template <typename BiquadFmt>
+std::vector<iir_model::BiquadCoeffs> read_coeffs(const std::string &path, std::size_t n)
+{
+    std::ifstream f(path);
+    std::vector<iir_model::BiquadCoeffs> v;
+    double b0, b1, b2, a1, a2;
+
+    while (v.size() < n && f >> b0 >> b1 >> b2 >> a1 >> a2)
+        v.push_back(BiquadFmt::coeffs_from_real(b0, b1, b2, a1, a2));
+    if (v.size() != n)
+        throw std::runtime_error(path + ": missing coefficients");
+    return v;
+}
+
+/* Lines of x and the expected y */
+inline void read_x_y(const std::string &path, std::vector<double> &x, std::vector<double> &y)
+{
+    std::ifstream f(path);
+    double a, b;
+
+    while (f >> a >> b) {
+        x.push_back(a);
+        y.push_back(b);
+    }
+    if (x.empty())
+        throw std::runtime_error(path + ": no samples");
+}
+
+/* y as written by the testbenches with g_TEST_Y_DUMP_FILENAME: one binary
+ * string per line, sign-extended here */
+inline std::vector<int64_t> read_y_dump(const std::string &path)
+{
+    std::ifstream f(path);
+    std::vector<int64_t> v;
+    std::string line;
+
+    if (!f)
+        throw std::runtime_error(path + ": cannot open");
+    while (std::getline(f, line)) {
+        if (line.empty())
+            continue;
+        uint64_t u = 0;
+        for (char c : line)
+            u = u << 1 | (c == '1');
+        if (line.size() < 64 && line[0] == '1')
+            u |= ~uint64_t(0) << line.size();
+        v.push_back(static_cast<int64_t>(u));
+    }
+    return v;
+}
+
+#endif /* TB_FILES_H */
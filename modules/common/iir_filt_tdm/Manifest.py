@@ -0,0 +1,3 @@
+files = [
+        "iir_filt_tdm.vhd"
+]
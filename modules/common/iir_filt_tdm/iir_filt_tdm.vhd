@@ -0,0 +1,457 @@
+--------------------------------------------------------------------------------
+-- Title        : Time-multiplexed Infinite Impulse Response (IIR) Filter
+-- Project      :
+--------------------------------------------------------------------------------
+-- File         : iir_filt_tdm.vhd
+-- Company      : CNPEM, LNLS - GIE
+-- Platform     : Generic
+-- Standard     : VHDL'08
+--------------------------------------------------------------------------------
+-- Description  : g_NUM_CHANNELS independent iir_filt cascades computed by a
+--                single pipelined biquad datapath (5 multipliers, instead of
+--                5*g_NUM_BIQUADS per channel).
+--
+--                The per channel and per biquad state (w[n - 1] and the two
+--                partial sums) and coefficients are kept in RAMs. A frame
+--                is one sample of every channel: x_i is taken in channel
+--                order, 0 first, and once the last channel is in, the frame
+--                goes through the datapath once per biquad, a channel per
+--                cycle. A pass over the channels takes
+--                max(g_NUM_CHANNELS, c_MIN_PASS_LEN) cycles, so that the y of
+--                a biquad is back before the next biquad of the same channel
+--                needs it; with fewer channels the datapath idles. y_o comes
+--                out in channel order, tagged by y_ch_o.
+--
+--                The next frame may be written while one is computed; busy_o
+--                is '1' when x_i can't be taken, i.e. two frames are waiting
+--                or the state is being cleared after a reset (one cycle per
+--                channel and biquad).
+--
+--                Each channel gives the same y, bit by bit, as an iir_filt
+--                with the same generics.
+--
+--                A coefficient write takes effect from the next sample the
+--                datapath starts for that channel and biquad.
+--------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+LIBRARY ieee;
+USE ieee.std_logic_1164.ALL;
+USE ieee.fixed_pkg.ALL;
+
+LIBRARY work;
+USE work.ifc_common_pkg.ALL;
+
+ENTITY iir_filt_tdm IS
+  GENERIC (
+    -- Number of channels
+    g_NUM_CHANNELS      : NATURAL;
+
+    -- Number of internal biquads per channel
+    -- The order is given by 2*g_NUM_BIQUADS
+    g_NUM_BIQUADS       : NATURAL;
+
+    -- Integer width of x
+    g_X_INT_WIDTH       : NATURAL;
+    -- Fractionary width of x
+    g_X_FRAC_WIDTH      : NATURAL;
+
+    -- Integer width of coefficients
+    g_COEFF_INT_WIDTH   : NATURAL;
+    -- Fractionary width of coefficients
+    g_COEFF_FRAC_WIDTH  : NATURAL;
+
+    -- Integer width of y
+    g_Y_INT_WIDTH       : NATURAL;
+    -- Fractionary width of y
+    g_Y_FRAC_WIDTH      : NATURAL;
+
+    -- Extra bits for biquads' internal arithmetic
+    g_ARITH_EXTRA_BITS  : NATURAL;
+    -- Extra bits for between-biquads cascade interfaces
+    g_IFCS_EXTRA_BITS   : NATURAL
+  );
+  PORT (
+    -- Clock
+    clk_i               : IN  STD_LOGIC;
+    -- Reset
+    rst_n_i             : IN  STD_LOGIC;
+
+    -- Input
+    -- x[n] of channels 0 to g_NUM_CHANNELS-1, in this order
+    x_i                 : IN  SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
+    -- Input valid
+    x_valid_i           : IN  STD_LOGIC;
+
+    -- Coefficients of biquad coeffs_biquad_i of channel coeffs_ch_i
+    -- b0, b1, b2, a1, a2 (a0 = 1)
+    coeffs_i            : IN  t_biquad_coeffs(
+                                b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                                a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+                              );
+    coeffs_ch_i         : IN  NATURAL RANGE 0 TO g_NUM_CHANNELS-1;
+    coeffs_biquad_i     : IN  NATURAL RANGE 0 TO g_NUM_BIQUADS-1;
+    -- Coefficients write strobe
+    coeffs_wr_i         : IN  STD_LOGIC;
+
+    -- Busy flag
+    busy_o              : OUT STD_LOGIC;
+
+    -- Output
+    -- y[n]
+    y_o                 : OUT SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
+    -- Channel of y_o
+    y_ch_o              : OUT NATURAL RANGE 0 TO g_NUM_CHANNELS-1;
+    -- Output valid
+    y_valid_o           : OUT STD_LOGIC
+  );
+END ENTITY iir_filt_tdm;
+
+ARCHITECTURE behave OF iir_filt_tdm IS
+  -- x and y formats between the biquads, as in iir_filt
+  CONSTANT c_X_FRAC_WIDTH : NATURAL := g_X_FRAC_WIDTH + g_IFCS_EXTRA_BITS;
+  CONSTANT c_Y_FRAC_WIDTH : NATURAL := g_Y_FRAC_WIDTH + g_IFCS_EXTRA_BITS;
+  CONSTANT c_X_WIDTH : NATURAL := g_X_INT_WIDTH + c_X_FRAC_WIDTH;
+  CONSTANT c_Y_WIDTH : NATURAL := g_Y_INT_WIDTH + c_Y_FRAC_WIDTH;
+  CONSTANT c_COEFF_WIDTH : NATURAL := g_COEFF_INT_WIDTH + g_COEFF_FRAC_WIDTH;
+
+  -- Format of w and of the partial sums, as in biquad
+  CONSTANT c_W_LEFT : INTEGER := (g_COEFF_INT_WIDTH + g_X_INT_WIDTH + g_ARITH_EXTRA_BITS)-1;
+  CONSTANT c_W_RIGHT : INTEGER := -(g_COEFF_FRAC_WIDTH + c_X_FRAC_WIDTH + g_ARITH_EXTRA_BITS);
+  CONSTANT c_W_WIDTH : NATURAL := c_W_LEFT - c_W_RIGHT + 1;
+
+  -- Cycles from an operation being issued until its y can be read back by
+  -- the next one of the same channel
+  CONSTANT c_MIN_PASS_LEN : NATURAL := 8;
+  CONSTANT c_PASS_LEN : NATURAL := MAXIMUM(g_NUM_CHANNELS, c_MIN_PASS_LEN);
+  CONSTANT c_NUM_OPS : NATURAL := g_NUM_CHANNELS*g_NUM_BIQUADS;
+
+  -- One channel through one biquad
+  TYPE t_op IS RECORD
+    valid   : STD_LOGIC;
+    ch      : NATURAL RANGE 0 TO g_NUM_CHANNELS-1;
+    biquad  : NATURAL RANGE 0 TO g_NUM_BIQUADS-1;
+  END RECORD;
+  TYPE t_op_pipe IS ARRAY (NATURAL RANGE <>) OF t_op;
+  CONSTANT c_OP_NONE : t_op := (valid => '0', ch => 0, biquad => 0);
+
+  -- Two frames of x, in the cascade format
+  TYPE t_x_ram IS ARRAY (0 TO 2*g_NUM_CHANNELS-1) OF
+    STD_LOGIC_VECTOR(c_X_WIDTH-1 DOWNTO 0);
+  -- y of the last biquad computed for each channel, as the x of the next
+  TYPE t_fb_ram IS ARRAY (0 TO g_NUM_CHANNELS-1) OF
+    STD_LOGIC_VECTOR(c_X_WIDTH-1 DOWNTO 0);
+  -- w[n - 1], aux_a and aux_b of each biquad of each channel
+  TYPE t_state_ram IS ARRAY (0 TO c_NUM_OPS-1) OF
+    STD_LOGIC_VECTOR(3*c_W_WIDTH-1 DOWNTO 0);
+  -- b0, b1, b2, a1 and a2 of each biquad of each channel
+  TYPE t_coeffs_ram IS ARRAY (0 TO c_NUM_OPS-1) OF
+    STD_LOGIC_VECTOR(5*c_COEFF_WIDTH-1 DOWNTO 0);
+
+  -- y goes raw into the x of the next biquad, as in iir_filt (only
+  -- elaborates if both have the same width when g_NUM_BIQUADS > 1)
+  FUNCTION f_y_to_x(y : STD_LOGIC_VECTOR) RETURN STD_LOGIC_VECTOR IS
+    VARIABLE v_x : STD_LOGIC_VECTOR(c_X_WIDTH-1 DOWNTO 0) := (OTHERS => '0');
+  BEGIN
+    FOR idx IN 0 TO MINIMUM(c_X_WIDTH, y'LENGTH)-1 LOOP
+      v_x(idx) := y(y'RIGHT + idx);
+    END LOOP;
+    RETURN v_x;
+  END FUNCTION f_y_to_x;
+
+  FUNCTION f_coeff(word : STD_LOGIC_VECTOR; idx : NATURAL) RETURN SFIXED IS
+  BEGIN
+    RETURN to_sfixed(word((5-idx)*c_COEFF_WIDTH-1 DOWNTO (4-idx)*c_COEFF_WIDTH),
+                     g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+  END FUNCTION f_coeff;
+
+  SIGNAL x_ram : t_x_ram := (OTHERS => (OTHERS => '0'));
+  SIGNAL fb_ram : t_fb_ram := (OTHERS => (OTHERS => '0'));
+  SIGNAL state_ram : t_state_ram := (OTHERS => (OTHERS => '0'));
+  SIGNAL coeffs_ram : t_coeffs_ram := (OTHERS => (OTHERS => '0'));
+
+  -- Input side
+  SIGNAL wr_bank : NATURAL RANGE 0 TO 1 := 0;
+  SIGNAL wr_ch : NATURAL RANGE 0 TO g_NUM_CHANNELS-1 := 0;
+  SIGNAL x_wr : STD_LOGIC;
+  SIGNAL x_wr_adr : NATURAL RANGE 0 TO 2*g_NUM_CHANNELS-1;
+  SIGNAL frame_full : STD_LOGIC_VECTOR(1 DOWNTO 0) := "00";
+  SIGNAL busy : STD_LOGIC;
+
+  -- State clearing after reset
+  SIGNAL clearing : STD_LOGIC := '1';
+  SIGNAL clear_adr : NATURAL RANGE 0 TO c_NUM_OPS-1 := 0;
+
+  -- Scheduler
+  SIGNAL running : STD_LOGIC := '0';
+  SIGNAL rd_bank : NATURAL RANGE 0 TO 1 := 0;
+  SIGNAL slot : NATURAL RANGE 0 TO c_PASS_LEN-1 := 0;
+  SIGNAL pass : NATURAL RANGE 0 TO g_NUM_BIQUADS-1 := 0;
+  SIGNAL issue_x_adr : NATURAL RANGE 0 TO 2*g_NUM_CHANNELS-1 := 0;
+
+  -- op(k) is the operation in stage k
+  SIGNAL op : t_op_pipe(0 TO 7) := (OTHERS => c_OP_NONE);
+
+  SIGNAL x_q, fb_q : STD_LOGIC_VECTOR(c_X_WIDTH-1 DOWNTO 0) := (OTHERS => '0');
+  SIGNAL state_q : STD_LOGIC_VECTOR(3*c_W_WIDTH-1 DOWNTO 0) := (OTHERS => '0');
+  SIGNAL coeffs_q : STD_LOGIC_VECTOR(5*c_COEFF_WIDTH-1 DOWNTO 0) :=
+           (OTHERS => '0');
+  SIGNAL state_wr : STD_LOGIC;
+  SIGNAL state_wr_adr : NATURAL RANGE 0 TO c_NUM_OPS-1;
+  SIGNAL state_wr_dat : STD_LOGIC_VECTOR(3*c_W_WIDTH-1 DOWNTO 0);
+
+  -- Datapath, named after biquad (the number is the stage)
+  SIGNAL w3, w4, w5, w6, w7, w_d1_2, w_d1_3, aux_a7, aux_b2, aux_b3, aux_b4,
+         aux_b5, aux_b7, b0_times_w, a1_times_w_d1, a2_times_w_d2,
+         b1_times_w_d1, b2_times_w_d2 :
+           SFIXED(c_W_LEFT DOWNTO c_W_RIGHT) := (OTHERS => '0');
+  SIGNAL b0_2, b1_2, b2_2, a1_2, a2_2, b0_3, b1_3, b2_3, a1_3, a2_3 :
+           SFIXED(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH) :=
+             (OTHERS => '0');
+  SIGNAL b0_times_w_tmp, a1_times_w_d1_tmp, a2_times_w_d2_tmp,
+         b1_times_w_d1_tmp, b2_times_w_d2_tmp :
+           SFIXED((g_COEFF_INT_WIDTH + c_W_LEFT + 1)-1 DOWNTO
+                  -g_COEFF_FRAC_WIDTH + c_W_RIGHT) := (OTHERS => '0');
+  SIGNAL w_tmp :
+           SFIXED(MAXIMUM(g_X_INT_WIDTH-1, c_W_LEFT)+1 DOWNTO
+                  MINIMUM(-c_X_FRAC_WIDTH, c_W_RIGHT)) := (OTHERS => '0');
+  SIGNAL aux_a_tmp : SFIXED(c_W_LEFT+2 DOWNTO c_W_RIGHT) := (OTHERS => '0');
+  SIGNAL aux_b_tmp, y_tmp : SFIXED(c_W_LEFT+1 DOWNTO c_W_RIGHT) :=
+           (OTHERS => '0');
+  SIGNAL y7 : SFIXED(g_Y_INT_WIDTH-1 DOWNTO -c_Y_FRAC_WIDTH) := (OTHERS => '0');
+BEGIN
+  ASSERT g_NUM_BIQUADS = 1 OR c_X_WIDTH = c_Y_WIDTH
+    REPORT "iir_filt_tdm: cascaded biquads need x and y of the same width"
+    SEVERITY FAILURE;
+
+  busy <= '1' WHEN clearing = '1' OR frame_full(wr_bank) = '1' ELSE '0';
+  busy_o <= busy;
+
+  x_wr <= x_valid_i AND NOT busy;
+  x_wr_adr <= wr_bank*g_NUM_CHANNELS + wr_ch;
+
+  -- Input frames, state clearing and scheduling
+  PROCESS(clk_i) IS
+    VARIABLE v_frame_full : STD_LOGIC_VECTOR(1 DOWNTO 0);
+    VARIABLE v_rd_bank : NATURAL RANGE 0 TO 1;
+    VARIABLE v_running : STD_LOGIC;
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF rst_n_i = '0' THEN
+        wr_bank <= 0;
+        wr_ch <= 0;
+        frame_full <= "00";
+        clearing <= '1';
+        clear_adr <= 0;
+        running <= '0';
+        rd_bank <= 0;
+        slot <= 0;
+        pass <= 0;
+        op <= (OTHERS => c_OP_NONE);
+      ELSE
+        v_frame_full := frame_full;
+        v_rd_bank := rd_bank;
+        v_running := running;
+
+        IF clearing = '1' THEN
+          IF clear_adr = c_NUM_OPS-1 THEN
+            clearing <= '0';
+          ELSE
+            clear_adr <= clear_adr + 1;
+          END IF;
+        END IF;
+
+        IF x_wr = '1' THEN
+          IF wr_ch = g_NUM_CHANNELS-1 THEN
+            wr_ch <= 0;
+            v_frame_full(wr_bank) := '1';
+            wr_bank <= 1 - wr_bank;
+          ELSE
+            wr_ch <= wr_ch + 1;
+          END IF;
+        END IF;
+
+        -- Issues channel slot of biquad pass; the slots past the last
+        -- channel are bubbles
+        op(0) <= c_OP_NONE;
+        IF running = '1' THEN
+          IF slot < g_NUM_CHANNELS THEN
+            op(0).valid <= '1';
+            op(0).ch <= slot;
+            issue_x_adr <= rd_bank*g_NUM_CHANNELS + slot;
+          END IF;
+          op(0).biquad <= pass;
+
+          IF slot = c_PASS_LEN-1 THEN
+            slot <= 0;
+            -- The first pass is the last one to read x
+            IF pass = 0 THEN
+              v_frame_full(rd_bank) := '0';
+              v_rd_bank := 1 - rd_bank;
+            END IF;
+            IF pass = g_NUM_BIQUADS-1 THEN
+              v_running := '0';
+            ELSE
+              pass <= pass + 1;
+            END IF;
+          ELSE
+            slot <= slot + 1;
+          END IF;
+        END IF;
+
+        -- Frames go back to back
+        IF v_running = '0' AND clearing = '0' AND v_frame_full(v_rd_bank) = '1' THEN
+          v_running := '1';
+          slot <= 0;
+          pass <= 0;
+        END IF;
+
+        frame_full <= v_frame_full;
+        rd_bank <= v_rd_bank;
+        running <= v_running;
+
+        op(1 TO 7) <= op(0 TO 6);
+      END IF;
+    END IF;
+  END PROCESS;
+
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF x_wr = '1' THEN
+        x_ram(x_wr_adr) <= to_slv(resize(x_i, g_X_INT_WIDTH-1, -c_X_FRAC_WIDTH));
+      END IF;
+      x_q <= x_ram(issue_x_adr);
+    END IF;
+  END PROCESS;
+
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF op(7).valid = '1' THEN
+        fb_ram(op(7).ch) <= f_y_to_x(to_slv(y7));
+      END IF;
+      fb_q <= fb_ram(op(0).ch);
+    END IF;
+  END PROCESS;
+
+  -- The clearing sweep only runs with the datapath empty
+  state_wr <= clearing OR op(7).valid;
+  state_wr_adr <= clear_adr WHEN clearing = '1' ELSE
+                  op(7).biquad*g_NUM_CHANNELS + op(7).ch;
+  state_wr_dat <= (OTHERS => '0') WHEN clearing = '1' ELSE
+                  to_slv(w7) & to_slv(aux_a7) & to_slv(aux_b7);
+
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF state_wr = '1' THEN
+        state_ram(state_wr_adr) <= state_wr_dat;
+      END IF;
+      state_q <= state_ram(op(0).biquad*g_NUM_CHANNELS + op(0).ch);
+    END IF;
+  END PROCESS;
+
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF coeffs_wr_i = '1' THEN
+        coeffs_ram(coeffs_biquad_i*g_NUM_CHANNELS + coeffs_ch_i) <=
+          to_slv(coeffs_i.b0) & to_slv(coeffs_i.b1) & to_slv(coeffs_i.b2) &
+          to_slv(coeffs_i.a1) & to_slv(coeffs_i.a2);
+      END IF;
+      coeffs_q <= coeffs_ram(op(0).biquad*g_NUM_CHANNELS + op(0).ch);
+    END IF;
+  END PROCESS;
+
+  -- Same operations and resizes as the biquad FSM, one stage each
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      -- Computes: w[n] = x[n] - a1*w[n - 1] - a2*w[n - 2] (full precision)
+      IF op(1).biquad = 0 THEN
+        w_tmp <= to_sfixed(x_q, g_X_INT_WIDTH-1, -c_X_FRAC_WIDTH) +
+                 to_sfixed(state_q(2*c_W_WIDTH-1 DOWNTO c_W_WIDTH), c_W_LEFT, c_W_RIGHT);
+      ELSE
+        w_tmp <= to_sfixed(fb_q, g_X_INT_WIDTH-1, -c_X_FRAC_WIDTH) +
+                 to_sfixed(state_q(2*c_W_WIDTH-1 DOWNTO c_W_WIDTH), c_W_LEFT, c_W_RIGHT);
+      END IF;
+      w_d1_2 <= to_sfixed(state_q(3*c_W_WIDTH-1 DOWNTO 2*c_W_WIDTH), c_W_LEFT, c_W_RIGHT);
+      aux_b2 <= to_sfixed(state_q(c_W_WIDTH-1 DOWNTO 0), c_W_LEFT, c_W_RIGHT);
+      b0_2 <= f_coeff(coeffs_q, 0);
+      b1_2 <= f_coeff(coeffs_q, 1);
+      b2_2 <= f_coeff(coeffs_q, 2);
+      a1_2 <= f_coeff(coeffs_q, 3);
+      a2_2 <= f_coeff(coeffs_q, 4);
+
+      -- Computes: w[n] (resized)
+      w3 <= resize(w_tmp, w3'LEFT, w3'RIGHT);
+      w_d1_3 <= w_d1_2;
+      aux_b3 <= aux_b2;
+      b0_3 <= b0_2;
+      b1_3 <= b1_2;
+      b2_3 <= b2_2;
+      a1_3 <= a1_2;
+      a2_3 <= a2_2;
+
+      -- Computes: b0*w[n] (full precision)
+      --           a1*w[n], a2*w[n - 1], b1*w[n], b2*w[n - 1] for the next
+      --           iteration (full precision)
+      b0_times_w_tmp <= b0_3*w3;
+      a1_times_w_d1_tmp <= a1_3*w3;
+      a2_times_w_d2_tmp <= a2_3*w_d1_3;
+      b1_times_w_d1_tmp <= b1_3*w3;
+      b2_times_w_d2_tmp <= b2_3*w_d1_3;
+      w4 <= w3;
+      aux_b4 <= aux_b3;
+
+      -- Computes: the products (resized)
+      b0_times_w <= resize(b0_times_w_tmp, b0_times_w'LEFT, b0_times_w'RIGHT);
+      a1_times_w_d1 <= resize(a1_times_w_d1_tmp, a1_times_w_d1'LEFT,
+                              a1_times_w_d1'RIGHT);
+      a2_times_w_d2 <= resize(a2_times_w_d2_tmp, a2_times_w_d2'LEFT,
+                              a2_times_w_d2'RIGHT);
+      b1_times_w_d1 <= resize(b1_times_w_d1_tmp, b1_times_w_d1'LEFT,
+                              b1_times_w_d1'RIGHT);
+      b2_times_w_d2 <= resize(b2_times_w_d2_tmp, b2_times_w_d2'LEFT,
+                              b2_times_w_d2'RIGHT);
+      w5 <= w4;
+      aux_b5 <= aux_b4;
+
+      -- Computes: y[n] = b0*w[n] + b1*w[n - 1] + b2*w[n - 2] (full precision)
+      --           -a1*w[n] - a2*w[n - 1] for the next iteration (full precision)
+      --           b1*w[n] + b2*w[n - 1] for the next iteration (full precision)
+      y_tmp <= b0_times_w + aux_b5;
+      aux_a_tmp <= -a1_times_w_d1 - a2_times_w_d2;
+      aux_b_tmp <= b1_times_w_d1 + b2_times_w_d2;
+      w6 <= w5;
+
+      -- Computes: y[n] and the partial sums (resized)
+      y7 <= resize(y_tmp, y7'LEFT, y7'RIGHT);
+      aux_a7 <= resize(aux_a_tmp, aux_a7'LEFT, aux_a7'RIGHT);
+      aux_b7 <= resize(aux_b_tmp, aux_b7'LEFT, aux_b7'RIGHT);
+      w7 <= w6;
+    END IF;
+  END PROCESS;
+
+  PROCESS(clk_i) IS
+  BEGIN
+    IF rising_edge(clk_i) THEN
+      IF rst_n_i = '0' THEN
+        y_valid_o <= '0';
+      ELSE
+        y_valid_o <= '0';
+        IF op(7).valid = '1' AND op(7).biquad = g_NUM_BIQUADS-1 THEN
+          y_o <= resize(y7, y_o'LEFT, y_o'RIGHT);
+          y_ch_o <= op(7).ch;
+          y_valid_o <= '1';
+        END IF;
+      END IF;
+    END IF;
+  END PROCESS;
+END ARCHITECTURE behave;
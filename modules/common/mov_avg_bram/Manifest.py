@@ -0,0 +1,3 @@
+files = [
+    "mov_avg_bram.vhd"
+]
@@ -0,0 +1,295 @@
+--------------------------------------------------------------------------------
+-- Title      : BRAM-backed moving average filter
+-- Project    :
+--------------------------------------------------------------------------------
+-- File       : mov_avg_bram.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Generic
+-- Standard   : VHDL'08
+--------------------------------------------------------------------------------
+-- Description: A moving average filter over any number of taps from 1 to
+--              g_MAX_LENGTH, selected at runtime.
+--
+--              A RAM keeps the running sum of the input, A[n] = data[0] + ...
+--              + data[n], for the last g_MAX_LENGTH samples, so the sum of
+--              the last L samples is A[n] - A[n - L] for any L. A[n] wraps
+--              around, which doesn't matter for the difference. Changing the
+--              length doesn't touch this state: the first output after the
+--              change is already the average of the last length_i samples.
+--
+--              The sum is divided by L by multiplying it with
+--              ceil(2**k/L), which gives floor(sum/L) exactly for a large
+--              enough k (the same rounding as the shifts of mov_avg_dyn).
+--              The reciprocal is computed by a sequential divider, taking
+--              c_RECIP_CYCLES cycles after length_i changes; the old length
+--              stays in use until then, and length_o tells which one is.
+--
+--              Up to g_NUM_CHANNELS channels may be interleaved, in any
+--              order, each sample tagged with its channel by ch_i. Each
+--              channel gets its own region of the RAM and its own A[n], and
+--              all of them use the same length. The tag comes out at ch_o.
+--              A[n] and the RAM write pointer of each channel are kept in a
+--              small RAM of their own, read a cycle ahead; a sample of the
+--              channel written in that cycle gets the new values forwarded.
+--
+--              rst_n_i doesn't clear the sample history, which starts as
+--              zeros.
+--------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity mov_avg_bram is
+  generic (
+    -- Maximum number of taps
+    g_MAX_LENGTH    : natural := 1024;
+
+    -- Data width
+    g_DATA_WIDTH    : natural := 32;
+
+    -- Number of interleaved channels
+    g_NUM_CHANNELS  : natural := 1
+  );
+  port (
+    -- Clock
+    clk_i           : in std_logic;
+
+    -- Reset
+    rst_n_i         : in std_logic;
+
+    -- Number of taps (order + 1)
+    length_i        : in natural range 1 to g_MAX_LENGTH := 1;
+
+    -- Number of taps in use
+    length_o        : out natural range 1 to g_MAX_LENGTH;
+
+    -- Data
+    data_i          : in signed(g_DATA_WIDTH-1 downto 0);
+
+    -- Channel of data (data_i)
+    ch_i            : in natural range 0 to g_NUM_CHANNELS-1 := 0;
+
+    -- Valid for data (data_i)
+    valid_i         : in std_logic;
+
+    -- Averaged data
+    avgd_data_o     : out signed(g_DATA_WIDTH-1 downto 0);
+
+    -- Channel of averaged data (avgd_data_o)
+    ch_o            : out natural range 0 to g_NUM_CHANNELS-1;
+
+    -- Valid for averaged data (avgd_data_o)
+    valid_o         : out std_logic
+  );
+end entity mov_avg_bram;
+
+architecture beh of mov_avg_bram is
+  function f_log2_ceil(n : natural) return natural is
+    variable v_bits : natural := 0;
+  begin
+    while 2**v_bits < n loop
+      v_bits := v_bits + 1;
+    end loop;
+    return v_bits;
+  end function;
+
+  -- Bits to hold any length, which is also the RAM address width
+  constant c_LEN_WIDTH : natural := f_log2_ceil(g_MAX_LENGTH+1);
+
+  -- Width of A[n] and of the sums
+  constant c_SUM_WIDTH : natural := g_DATA_WIDTH + c_LEN_WIDTH;
+
+  -- The sum is offset by L*2**(g_DATA_WIDTH-1) so that it is positive, and
+  -- then below L*2**g_DATA_WIDTH. The reciprocal is ceil(2**c_K/L) =
+  -- (2**c_K + e)/L, with e < L, so the product is off from sum/L by
+  -- e*sum/(L*2**c_K) < 2**-c_LEN_WIDTH < 1/L, which can't reach the next
+  -- integer.
+  constant c_K : natural := g_DATA_WIDTH + 2*c_LEN_WIDTH;
+
+  -- Sequential divider cycles, one per quotient bit
+  constant c_RECIP_CYCLES : natural := c_K + 1;
+
+  type t_sum_arr is array (natural range <>) of unsigned(c_SUM_WIDTH-1 downto 0);
+  type t_ptr_arr is array (natural range <>) of unsigned(c_LEN_WIDTH-1 downto 0);
+
+  -- A[n] of the last 2**c_LEN_WIDTH samples of each channel, channel ch at
+  -- ch*2**c_LEN_WIDTH
+  signal ram : t_sum_arr(0 to g_NUM_CHANNELS*2**c_LEN_WIDTH-1) :=
+    (others => (others => '0'));
+  signal wr_ptrs : t_ptr_arr(0 to g_NUM_CHANNELS-1) := (others => (others => '0'));
+  signal sum_q : unsigned(c_SUM_WIDTH-1 downto 0) := (others => '0');
+
+  -- Length and reciprocal in use
+  signal length : natural range 1 to g_MAX_LENGTH := 1;
+  signal recip : unsigned(c_K downto 0) := (c_K => '1', others => '0');
+
+  -- Divider
+  signal div_busy : std_logic := '0';
+  signal div_length : natural range 1 to g_MAX_LENGTH := 1;
+  signal div_num : unsigned(c_K downto 0) := (others => '0');
+  signal div_rem : unsigned(c_LEN_WIDTH downto 0) := (others => '0');
+  signal div_quot : unsigned(c_K downto 0) := (others => '0');
+  signal div_bit : natural range 0 to c_K := 0;
+
+  -- Pipeline
+  signal valid_d0, valid_d1, valid_d2, valid_d3 : std_logic := '0';
+  signal data_d0 : signed(g_DATA_WIDTH-1 downto 0) := (others => '0');
+  signal length_d0, length_d1 : natural range 1 to g_MAX_LENGTH := 1;
+  signal recip_d0, recip_d1, recip_d2 : unsigned(c_K downto 0) := (others => '0');
+  signal ch_d0, ch_d1, ch_d2, ch_d3 : natural range 0 to g_NUM_CHANNELS-1 := 0;
+  -- A[n] and RAM write pointer of each channel, and their values read for
+  -- the sample in the 1st stage
+  signal sums : t_sum_arr(0 to g_NUM_CHANNELS-1) := (others => (others => '0'));
+  signal sum_rd : unsigned(c_SUM_WIDTH-1 downto 0) := (others => '0');
+  signal wr_ptr_rd : unsigned(c_LEN_WIDTH-1 downto 0) := (others => '0');
+  -- Values written by the 2nd stage, for a sample of the same channel right
+  -- behind
+  signal fwd : std_logic := '0';
+  signal sum_wr : unsigned(c_SUM_WIDTH-1 downto 0) := (others => '0');
+  signal wr_ptr_wr : unsigned(c_LEN_WIDTH-1 downto 0) := (others => '0');
+  signal sum_d1 : unsigned(c_SUM_WIDTH-1 downto 0) := (others => '0');
+  signal offset_sum : unsigned(c_SUM_WIDTH-1 downto 0) := (others => '0');
+  signal prod : unsigned(c_SUM_WIDTH+c_K downto 0) := (others => '0');
+begin
+  -- Computes ceil(2**c_K/div_length) = floor((2**c_K + div_length - 1)/div_length),
+  -- a bit per cycle, and switches length and recip to it at once
+  process(clk_i) is
+    variable v_rem : unsigned(c_LEN_WIDTH downto 0);
+    variable v_quot : unsigned(c_K downto 0);
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        length <= 1;
+        recip <= (c_K => '1', others => '0');
+        div_busy <= '0';
+      elsif div_busy = '0' then
+        if length_i /= length then
+          div_length <= length_i;
+          div_num <= shift_left(to_unsigned(1, c_K+1), c_K) + (length_i - 1);
+          div_rem <= (others => '0');
+          div_bit <= c_K;
+          div_busy <= '1';
+        end if;
+      else
+        v_rem := div_rem(c_LEN_WIDTH-1 downto 0) & div_num(div_bit);
+        v_quot := div_quot;
+        if v_rem >= div_length then
+          v_rem := v_rem - div_length;
+          v_quot(div_bit) := '1';
+        else
+          v_quot(div_bit) := '0';
+        end if;
+        div_rem <= v_rem;
+        div_quot <= v_quot;
+
+        if div_bit = 0 then
+          length <= div_length;
+          recip <= v_quot;
+          div_busy <= '0';
+        else
+          div_bit <= div_bit - 1;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  length_o <= length;
+
+  process(clk_i) is
+    variable v_prev : unsigned(c_SUM_WIDTH-1 downto 0);
+    variable v_ptr : unsigned(c_LEN_WIDTH-1 downto 0);
+    variable v_sum : unsigned(c_SUM_WIDTH-1 downto 0);
+  begin
+    if rising_edge(clk_i) then
+      -- ##################### MOVING AVERAGE 1ST STAGE #######################
+      -- Sample time n + 1 cc (clock cycle):
+      --  A[n - 1] and the write pointer of the channel read
+      if valid_i = '1' then
+        data_d0 <= data_i;
+        ch_d0 <= ch_i;
+        length_d0 <= length;
+        recip_d0 <= recip;
+      end if;
+      sum_rd <= sums(ch_i);
+      wr_ptr_rd <= wr_ptrs(ch_i);
+      -- The 2nd stage is writing them now
+      if valid_d0 = '1' and ch_d0 = ch_i then
+        fwd <= '1';
+      else
+        fwd <= '0';
+      end if;
+      -- ######################################################################
+
+      -- ##################### MOVING AVERAGE 2ND STAGE #######################
+      -- Sample time n + 2 cc:
+      --  A[n] = A[n - 1] + data[n], stored, and A[n - length] read
+      -- NOTE: A[n] and the RAM are left alone by rst_n_i, so that they stay
+      --       consistent with each other.
+      if fwd = '1' then
+        v_prev := sum_wr;
+        v_ptr := wr_ptr_wr;
+      else
+        v_prev := sum_rd;
+        v_ptr := wr_ptr_rd;
+      end if;
+      if valid_d0 = '1' then
+        v_sum := v_prev + unsigned(resize(data_d0, c_SUM_WIDTH));
+        sums(ch_d0) <= v_sum;
+        wr_ptrs(ch_d0) <= v_ptr + 1;
+        sum_wr <= v_sum;
+        wr_ptr_wr <= v_ptr + 1;
+        sum_d1 <= v_sum;
+        ram(ch_d0*2**c_LEN_WIDTH + to_integer(v_ptr)) <= v_sum;
+        ch_d1 <= ch_d0;
+        length_d1 <= length_d0;
+        recip_d1 <= recip_d0;
+      end if;
+      sum_q <= ram(ch_d0*2**c_LEN_WIDTH +
+                   to_integer(v_ptr - to_unsigned(length_d0, c_LEN_WIDTH)));
+      -- ######################################################################
+
+      -- ##################### MOVING AVERAGE 3RD STAGE #######################
+      -- Sample time n + 3 cc:
+      --  data[n] + ... + data[n - (length - 1)] + length*2**(g_DATA_WIDTH-1)
+      offset_sum <= sum_d1 - sum_q +
+                    shift_left(to_unsigned(length_d1, c_SUM_WIDTH), g_DATA_WIDTH-1);
+      recip_d2 <= recip_d1;
+      ch_d2 <= ch_d1;
+      -- ######################################################################
+
+      -- ##################### MOVING AVERAGE 4TH STAGE #######################
+      -- Sample time n + 4 cc:
+      --  (offset sum)*ceil(2**c_K/length)
+      prod <= offset_sum * recip_d2;
+      ch_d3 <= ch_d2;
+      -- ######################################################################
+
+      -- ##################### MOVING AVERAGE 5TH STAGE #######################
+      -- Sample time n + 5 cc:
+      --  (data[n] + ... + data[n - (length - 1)])/length, removing the
+      --  offset (2**(g_DATA_WIDTH-1)) by flipping the sign bit
+      avgd_data_o <= signed(not prod(c_K+g_DATA_WIDTH-1) &
+                            prod(c_K+g_DATA_WIDTH-2 downto c_K));
+      ch_o <= ch_d3;
+      -- ######################################################################
+
+      if rst_n_i = '0' then
+        valid_d0 <= '0';
+        valid_d1 <= '0';
+        valid_d2 <= '0';
+        valid_d3 <= '0';
+        valid_o <= '0';
+      else
+        valid_d0 <= valid_i;
+        valid_d1 <= valid_d0;
+        valid_d2 <= valid_d1;
+        valid_d3 <= valid_d2;
+        valid_o <= valid_d3;
+      end if;
+    end if;
+  end process;
+end architecture beh;
@@ -58,13 +58,28 @@ generic
   -- Length of receiving delay counters
   g_rx_delay_width                 : natural := 32;
   -- Length of transmitter delay counters
-  g_tx_delay_width                 : natural := 32
+  g_tx_delay_width                 : natural := 32;
+  -- Receive samples per clk_i cycle, for the fine phase of the received
+  -- trigger timestamps. 1 samples the line once per clk_i cycle, 4, 6 or 8
+  -- use an ISERDES clocked by clk_ser_i
+  g_rx_oversampling                        : natural := 1;
+  -- Length of the receive timestamps
+  g_rx_ts_width                            : natural := 64;
+  -- Transmit samples per clk_i cycle, for the fine delay and width of the
+  -- transmitted triggers. 1 drives the line once per clk_i cycle, 4, 6 or 8
+  -- use an OSERDES clocked by clk_ser_i
+  g_tx_oversampling                        : natural := 1
 );
 port
 (
   -- Clock/Resets
   clk_i                                    : in std_logic;
   rst_n_i                                  : in std_logic;
+  -- Oversampling clock, at g_rx_oversampling/2 (g_tx_oversampling/2) times
+  -- clk_i and phase aligned to it. Only used if g_rx_oversampling > 1 or
+  -- g_tx_oversampling > 1. It clocks both the ISERDES and the OSERDES, so
+  -- both ratios must be the same if both are > 1
+  clk_ser_i                                : in std_logic := '0';
 
   -------------------------------
   -- Trigger configuration
@@ -88,6 +103,12 @@ port
   trig_rx_delay_length_i                   : in unsigned(g_rx_delay_width-1 downto 0);
   -- Number of detected transmitted triggers to external module
   trig_tx_delay_length_i                   : in unsigned(g_tx_delay_width-1 downto 0);
+  -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to delay the
+  -- transmitted pulse after trig_tx_delay_length_i
+  trig_tx_fine_delay_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
+  -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to widen the
+  -- transmitted pulse after trig_tx_extensor_length_i
+  trig_tx_fine_width_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
 
   -------------------------------
   -- Counters
@@ -101,6 +122,19 @@ port
   -- Number of detected transmitted triggers to external module
   trig_tx_cnt_o                            : out unsigned(g_tx_counter_width-1 downto 0);
 
+  -------------------------------
+  -- Receive timestamps
+  -------------------------------
+  -- Coarse time base, in clk_i cycles
+  trig_rx_ts_i                             : in unsigned(g_rx_ts_width-1 downto 0) := (others => '0');
+  -- Coarse timestamp of the last received trigger
+  trig_rx_ts_o                             : out unsigned(g_rx_ts_width-1 downto 0);
+  -- Fine phase of the last received trigger, in 1/g_rx_oversampling of a
+  -- clk_i cycle after trig_rx_ts_o
+  trig_rx_ts_fine_o                        : out natural range 0 to g_rx_oversampling-1;
+  -- Timestamp valid
+  trig_rx_ts_valid_o                       : out std_logic;
+
   -------------------------------
   ---- External ports
   -------------------------------
@@ -130,20 +164,31 @@ architecture rtl of trigger_io is
 
   signal trig_in_phys                      : std_logic;
   signal trig_out_phys                     : std_logic;
+  signal trig_out_phys_par                 : std_logic_vector(g_rx_oversampling-1 downto 0);
+  signal trig_in_phys_par                  : std_logic_vector(g_tx_oversampling-1 downto 0);
 
 begin
 
+  -- clk_ser_i clocks both the ISERDES and the OSERDES
+  assert (g_rx_oversampling = 1 or g_tx_oversampling = 1 or
+            g_rx_oversampling = g_tx_oversampling)
+  report "[trigger_io] g_rx_oversampling and g_tx_oversampling must be the same if both are > 1"
+  severity failure;
+
   -----------------------------------------------------------------------------
   -- Physical connection
   ----------------------------------------------------------------------------
   cmp_trigger_io_physical : trigger_io_physical
   generic map (
     g_with_bidirectional_trigger           => g_with_bidirectional_trigger,
-    g_iobuf_instantiation_type             => g_iobuf_instantiation_type
+    g_iobuf_instantiation_type             => g_iobuf_instantiation_type,
+    g_rx_oversampling                      => g_rx_oversampling,
+    g_tx_oversampling                      => g_tx_oversampling
   )
   port map (
     clk_i                                  => clk_i,
     rst_n_i                                => rst_n_i,
+    clk_ser_i                              => clk_ser_i,
 
     -------------------------------
     -- Trigger configuration
@@ -163,7 +208,9 @@ begin
     -- Trigger input/output ports
     -------------------------------
     trig_in_i                              => trig_in_phys,
-    trig_out_o                             => trig_out_phys
+    trig_in_par_i                          => trig_in_phys_par,
+    trig_out_o                             => trig_out_phys,
+    trig_out_par_o                         => trig_out_phys_par
   );
 
   trig_dbg_o <= trig_out_phys;
@@ -176,7 +223,9 @@ begin
     g_sync_edge                              => g_sync_edge,
     g_rx_debounce_width                      => g_rx_debounce_width,
     g_rx_counter_width                       => g_rx_counter_width,
-    g_rx_delay_width                         => g_rx_delay_width
+    g_rx_delay_width                         => g_rx_delay_width,
+    g_rx_oversampling                        => g_rx_oversampling,
+    g_rx_ts_width                            => g_rx_ts_width
   )
   port map (
     -- Clock/Resets
@@ -195,10 +244,19 @@ begin
     trig_rx_rst_n_i                          => trig_rx_rst_n_i,
     trig_rx_cnt_o                            => trig_rx_cnt_o,
 
+    -------------------------------
+    -- Timestamps
+    -------------------------------
+    trig_rx_ts_i                             => trig_rx_ts_i,
+    trig_rx_ts_o                             => trig_rx_ts_o,
+    trig_rx_ts_fine_o                        => trig_rx_ts_fine_o,
+    trig_rx_ts_valid_o                       => trig_rx_ts_valid_o,
+
     -------------------------------
     -- External ports
     -------------------------------
     trig_i                                   => trig_out_phys,
+    trig_par_i                               => trig_out_phys_par,
 
     -------------------------------
     -- Trigger output ports
@@ -213,7 +271,8 @@ begin
   generic map (
     g_tx_extensor_width                      => g_tx_extensor_width,
     g_tx_counter_width                       => g_tx_counter_width,
-    g_tx_delay_width                         => g_tx_delay_width
+    g_tx_delay_width                         => g_tx_delay_width,
+    g_tx_oversampling                        => g_tx_oversampling
   )
   port map (
     -- Clock/Resets
@@ -225,6 +284,8 @@ begin
     -------------------------------
     trig_tx_extensor_length_i                => trig_tx_extensor_length_i,
     trig_tx_delay_length_i                   => trig_tx_delay_length_i,
+    trig_tx_fine_delay_i                     => trig_tx_fine_delay_i,
+    trig_tx_fine_width_i                     => trig_tx_fine_width_i,
 
     -------------------------------
     -- Counters
@@ -236,6 +297,7 @@ begin
     -- External ports
     -------------------------------
     trig_o                                   => trig_in_phys,
+    trig_par_o                               => trig_in_phys_par,
 
     -------------------------------
     -- Trigger input ports
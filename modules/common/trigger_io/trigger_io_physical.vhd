@@ -44,13 +44,24 @@ generic
   g_with_bidirectional_trigger             : boolean := true;
   -- IOBUF instantiation type if g_with_bidirectional_trigger = true.
   -- Possible values are: "native" or "inferred"
-  g_iobuf_instantiation_type               : string := "native"
+  g_iobuf_instantiation_type               : string := "native";
+  -- Receive samples per clk_i cycle. 1 samples the line once per clk_i
+  -- cycle, 4, 6 or 8 use an ISERDES clocked by clk_ser_i
+  g_rx_oversampling                        : natural := 1;
+  -- Transmit samples per clk_i cycle. 1 drives the line once per clk_i
+  -- cycle, 4, 6 or 8 use an OSERDES clocked by clk_ser_i
+  g_tx_oversampling                        : natural := 1
 );
 port
 (
   -- Clock/Resets
   clk_i                                    : in std_logic;
   rst_n_i                                  : in std_logic;
+  -- Oversampling clock, at g_rx_oversampling/2 (g_tx_oversampling/2) times
+  -- clk_i and phase aligned to it. Only used if g_rx_oversampling > 1 or
+  -- g_tx_oversampling > 1. It clocks both the ISERDES and the OSERDES, so
+  -- both ratios must be the same if both are > 1
+  clk_ser_i                                : in std_logic := '0';
 
   -------------------------------
   -- Trigger configuration
@@ -82,8 +93,16 @@ port
   -------------------------------
   -- Trigger data input from FPGA
   trig_in_i                                : in std_logic;
+  -- Trigger data input from FPGA, oversampled. trig_in_par_i(0) is the
+  -- first sample in time (clk_i). Only used if g_tx_oversampling > 1, in
+  -- which case trig_in_i must be the OR of its samples
+  trig_in_par_i                            : in std_logic_vector(g_tx_oversampling-1 downto 0) := (others => '0');
   -- Trigger data output from FPGA
-  trig_out_o                               : out std_logic
+  trig_out_o                               : out std_logic;
+  -- Trigger data output from FPGA, oversampled. trig_out_par_o(0) is the
+  -- first sample in time (clk_i). Same as trig_out_o, not registered, if
+  -- g_rx_oversampling = 1
+  trig_out_par_o                           : out std_logic_vector(g_rx_oversampling-1 downto 0)
 );
 end entity trigger_io_physical;
 
@@ -95,6 +114,8 @@ architecture rtl of trigger_io_physical is
 
   -- Signals
   signal trig_rx                           : std_logic;
+  -- trig_rx for the fabric
+  signal trig_rx_int                       : std_logic;
   signal trig_rx_fpga                      : std_logic;
   signal trig_tx                           : std_logic;
   signal trig_tx_fpga                      : std_logic;
@@ -106,6 +127,10 @@ architecture rtl of trigger_io_physical is
   signal trig_dir_polarized                : std_logic;
   signal trig_tx_polarized                 : std_logic;
   signal trig_dir_ext                      : std_logic;
+  signal trig_rx_par                       : std_logic_vector(g_rx_oversampling-1 downto 0);
+  signal trig_tx_par                       : std_logic_vector(g_tx_oversampling-1 downto 0);
+  signal trig_tx_ser                       : std_logic;
+  signal trig_in_dly                       : std_logic_vector(2 downto 0) := (others => '0');
 
 begin
 
@@ -117,9 +142,90 @@ begin
   -----------------------------------------------------------------------------
   -- Trigger to/from FPGA side assignments
   ----------------------------------------------------------------------------
-  trig_tx_fpga <= trig_in_i;
   trig_out_o <= trig_rx_fpga;
 
+  -----------------------------------------------------------------------------
+  -- Receive oversampling
+  ----------------------------------------------------------------------------
+  gen_without_rx_oversampling : if g_rx_oversampling = 1 generate
+    trig_rx_int <= trig_rx;
+    trig_out_par_o(0) <= trig_rx_fpga;
+  end generate;
+
+  gen_with_rx_oversampling : if g_rx_oversampling > 1 generate
+
+    -- The ISERDES must be fed straight from the input buffer, so the
+    -- direction is applied to its output instead, and the fabric gets the
+    -- line from its pass-through output
+    cmp_iserdes_generic : iserdes_generic
+    generic map (
+      g_ratio                                => g_rx_oversampling
+    )
+    port map (
+      clk_ser_i                              => clk_ser_i,
+      clk_par_i                              => clk_i,
+      rst_n_i                                => rst_n_i,
+      ser_i                                  => trig_rx,
+      ser_o                                  => trig_rx_int,
+      par_o                                  => trig_rx_par
+    );
+
+    trig_out_par_o <= trig_rx_par when trig_dir_int = c_trig_dir_fpga_input or
+                                       not(g_with_bidirectional_trigger)
+                        else (others => '0'); -- FPGA is output
+  end generate;
+
+  -----------------------------------------------------------------------------
+  -- Transmit oversampling
+  ----------------------------------------------------------------------------
+  gen_without_tx_oversampling : if g_tx_oversampling = 1 generate
+    trig_tx_fpga <= trig_in_i;
+  end generate;
+
+  gen_with_tx_oversampling : if g_tx_oversampling > 1 generate
+
+    -- The samples go through the same polarity and wired-OR logic as
+    -- trig_in_i below, for the pin that carries the data: the direction pin
+    -- with the wired-OR scheme, the output pin otherwise
+    p_tx_par : process(clk_i)
+      variable v_sample : std_logic;
+    begin
+      if rising_edge(clk_i) then
+        for i in 0 to g_tx_oversampling-1 loop
+          v_sample := trig_in_par_i(i);
+          if g_with_bidirectional_trigger then
+            v_sample := not (v_sample);
+          end if;
+          v_sample := v_sample xor trig_pol_int;
+          if g_with_bidirectional_trigger and trig_dir_int /= c_trig_dir_fpga_output then
+            v_sample := trig_dir_polarized;
+          end if;
+          trig_tx_par(i) <= v_sample;
+        end loop;
+
+        trig_in_dly <= trig_in_dly(1 downto 0) & trig_in_i;
+      end if;
+    end process;
+
+    cmp_oserdes_generic : oserdes_generic
+    generic map (
+      g_ratio                                => g_tx_oversampling
+    )
+    port map (
+      clk_ser_i                              => clk_ser_i,
+      clk_par_i                              => clk_i,
+      rst_n_i                                => rst_n_i,
+      par_i                                  => trig_tx_par,
+      ser_o                                  => trig_tx_ser
+    );
+
+    -- With the wired-OR scheme, the IOBUF must drive the line for the
+    -- whole serialized pulse, so it drives from the clock cycle the pulse
+    -- comes in to three cycles after it, which allows for up to two cycles
+    -- of OSERDES latency
+    trig_tx_fpga <= trig_in_i or trig_in_dly(0) or trig_in_dly(1) or trig_in_dly(2);
+  end generate;
+
   -----------------------------------------------------------------------------
   -- Trigger data/direction control
   ----------------------------------------------------------------------------
@@ -188,19 +294,20 @@ begin
 
     end generate;
 
-    trig_rx_fpga <= trig_rx when trig_dir_int = c_trig_dir_fpga_input
+    trig_rx_fpga <= trig_rx_int when trig_dir_int = c_trig_dir_fpga_input
                        else '0'; -- FPGA is output
     -- Trigger direction external output
-    trig_dir_o <= trig_dir_ext;
+    trig_dir_o <= trig_dir_ext when g_tx_oversampling = 1 else trig_tx_ser;
 
   end generate;
 
   gen_without_bidir_trigger : if not(g_with_bidirectional_trigger) generate
 
-    trig_rx_fpga      <= trig_i;
+    trig_rx           <= trig_i;
+    trig_rx_fpga      <= trig_rx_int;
     -- Use regular data/dir pins, as we don't implement the wired-OR logic in
     -- this case
-    trig_o            <= trig_tx_polarized;
+    trig_o            <= trig_tx_polarized when g_tx_oversampling = 1 else trig_tx_ser;
     -- Trigger direction external output
     trig_dir_o        <= trig_dir_polarized;
 
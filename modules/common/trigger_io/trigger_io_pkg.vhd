@@ -13,13 +13,24 @@ package trigger_io_pkg is
     g_with_bidirectional_trigger             : boolean := true;
     -- IOBUF instantiation type if g_with_bidirectional_trigger = true.
     -- Possible values are: "native" or "inferred"
-    g_iobuf_instantiation_type               : string := "native"
+    g_iobuf_instantiation_type               : string := "native";
+    -- Receive samples per clk_i cycle. 1 samples the line once per clk_i
+    -- cycle, 4, 6 or 8 use an ISERDES clocked by clk_ser_i
+    g_rx_oversampling                        : natural := 1;
+    -- Transmit samples per clk_i cycle. 1 drives the line once per clk_i
+    -- cycle, 4, 6 or 8 use an OSERDES clocked by clk_ser_i
+    g_tx_oversampling                        : natural := 1
   );
   port
   (
     -- Clock/Resets
     clk_i                                    : in std_logic;
     rst_n_i                                  : in std_logic;
+    -- Oversampling clock, at g_rx_oversampling/2 (g_tx_oversampling/2) times
+    -- clk_i and phase aligned to it. Only used if g_rx_oversampling > 1 or
+    -- g_tx_oversampling > 1. It clocks both the ISERDES and the OSERDES, so
+    -- both ratios must be the same if both are > 1
+    clk_ser_i                                : in std_logic := '0';
 
     -------------------------------
     -- Trigger configuration
@@ -51,8 +62,16 @@ package trigger_io_pkg is
     -------------------------------
     -- Trigger data input from FPGA
     trig_in_i                                : in std_logic;
+    -- Trigger data input from FPGA, oversampled. trig_in_par_i(0) is the
+    -- first sample in time (clk_i). Only used if g_tx_oversampling > 1, in
+    -- which case trig_in_i must be the OR of its samples
+    trig_in_par_i                            : in std_logic_vector(g_tx_oversampling-1 downto 0) := (others => '0');
     -- Trigger data output from FPGA
-    trig_out_o                               : out std_logic
+    trig_out_o                               : out std_logic;
+    -- Trigger data output from FPGA, oversampled. trig_out_par_o(0) is the
+    -- first sample in time (clk_i). Same as trig_out_o, not registered, if
+    -- g_rx_oversampling = 1
+    trig_out_par_o                           : out std_logic_vector(g_rx_oversampling-1 downto 0)
   );
   end component;
 
@@ -66,7 +85,11 @@ package trigger_io_pkg is
     -- Length of receive counters
     g_rx_counter_width                       : natural := 8;
     -- Length of receiving delay counters
-    g_rx_delay_width                         : natural := 32
+    g_rx_delay_width                         : natural := 32;
+    -- Receive samples per clk_i cycle (trig_par_i). 1 uses trig_i
+    g_rx_oversampling                        : natural := 1;
+    -- Length of the timestamps
+    g_rx_ts_width                            : natural := 64
   );
   port
   (
@@ -90,11 +113,28 @@ package trigger_io_pkg is
     -- Number of detected received triggers from external module
     trig_rx_cnt_o                            : out unsigned(g_rx_counter_width-1 downto 0);
 
+    -------------------------------
+    -- Timestamps
+    -------------------------------
+    -- Coarse time base, in clk_i cycles
+    trig_rx_ts_i                             : in unsigned(g_rx_ts_width-1 downto 0) := (others => '0');
+    -- Coarse timestamp of the last received trigger
+    trig_rx_ts_o                             : out unsigned(g_rx_ts_width-1 downto 0);
+    -- Fine phase of the last received trigger, in 1/g_rx_oversampling of a
+    -- clk_i cycle after trig_rx_ts_o
+    trig_rx_ts_fine_o                        : out natural range 0 to g_rx_oversampling-1;
+    -- Timestamp valid, a clock cycle after the received trigger and before
+    -- its delay (trig_rx_delay_length_i)
+    trig_rx_ts_valid_o                       : out std_logic;
+
     -------------------------------
     -- External ports
     -------------------------------
     -- Trigger input from external
     trig_i                                   : in std_logic;
+    -- Trigger input from external, oversampled. trig_par_i(0) is the first
+    -- sample in time. Only used if g_rx_oversampling > 1
+    trig_par_i                               : in std_logic_vector(g_rx_oversampling-1 downto 0) := (others => '0');
 
     -------------------------------
     -- Trigger output ports
@@ -112,7 +152,9 @@ package trigger_io_pkg is
     -- Length of transmitter counters
     g_tx_counter_width                       : natural := 8;
     -- Length of transmitter delay counters
-    g_tx_delay_width                         : natural := 32
+    g_tx_delay_width                         : natural := 32;
+    -- Transmit samples per clk_i cycle (trig_par_o)
+    g_tx_oversampling                        : natural := 1
   );
   port
   (
@@ -127,6 +169,12 @@ package trigger_io_pkg is
     trig_tx_extensor_length_i                : in unsigned(g_tx_extensor_width-1 downto 0);
     -- Number of detected transmitted triggers to external module
     trig_tx_delay_length_i                   : in unsigned(g_tx_delay_width-1 downto 0);
+    -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to delay the
+    -- transmitted pulse after trig_tx_delay_length_i
+    trig_tx_fine_delay_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
+    -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to widen the
+    -- transmitted pulse after trig_tx_extensor_length_i
+    trig_tx_fine_width_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
 
     -------------------------------
     -- Counters
@@ -141,6 +189,9 @@ package trigger_io_pkg is
     -------------------------------
     -- Trigger output to external
     trig_o                                   : out std_logic;
+    -- Trigger output to external, oversampled. trig_par_o(0) is the first
+    -- sample in time. Same as trig_o if g_tx_oversampling = 1
+    trig_par_o                               : out std_logic_vector(g_tx_oversampling-1 downto 0);
 
     -------------------------------
     -- Trigger input ports
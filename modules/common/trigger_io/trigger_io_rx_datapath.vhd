@@ -12,6 +12,13 @@
 -------------------------------------------------------------------------------
 -- Description: Receives trigger from a hardware line. It supports,
 -- debouncing, polarity, direction control and controllable delay.
+--
+-- Each received trigger is timestamped with the edge that started it, rising
+-- or, with g_sync_edge = "negative", falling. The timestamp is trig_rx_ts_i at
+-- the clk_i cycle the edge is seen plus a fine phase in 1/g_rx_oversampling
+-- of a clk_i cycle, from the samples of trig_par_i.
+-- Both are offset from the actual edge by the fixed latency of the sampling
+-- path, which is the same for every trigger.
 -------------------------------------------------------------------------------
 -- Revisions  :
 -- Date        Version  Author  Description
@@ -36,7 +43,11 @@ generic
   -- Length of receive counters
   g_rx_counter_width                       : natural := 8;
   -- Length of receiving delay counters
-  g_rx_delay_width                         : natural := 32
+  g_rx_delay_width                         : natural := 32;
+  -- Receive samples per clk_i cycle (trig_par_i). 1 uses trig_i
+  g_rx_oversampling                        : natural := 1;
+  -- Length of the timestamps
+  g_rx_ts_width                            : natural := 64
 );
 port
 (
@@ -60,11 +71,28 @@ port
   -- Number of detected received triggers from external module
   trig_rx_cnt_o                            : out unsigned(g_rx_counter_width-1 downto 0);
 
+  -------------------------------
+  -- Timestamps
+  -------------------------------
+  -- Coarse time base, in clk_i cycles
+  trig_rx_ts_i                             : in unsigned(g_rx_ts_width-1 downto 0) := (others => '0');
+  -- Coarse timestamp of the last received trigger
+  trig_rx_ts_o                             : out unsigned(g_rx_ts_width-1 downto 0);
+  -- Fine phase of the last received trigger, in 1/g_rx_oversampling of a
+  -- clk_i cycle after trig_rx_ts_o
+  trig_rx_ts_fine_o                        : out natural range 0 to g_rx_oversampling-1;
+  -- Timestamp valid, a clock cycle after the received trigger and before
+  -- its delay (trig_rx_delay_length_i)
+  trig_rx_ts_valid_o                       : out std_logic;
+
   -------------------------------
   -- External ports
   -------------------------------
   -- Trigger input from external
   trig_i                                   : in std_logic;
+  -- Trigger input from external, oversampled. trig_par_i(0) is the first
+  -- sample in time. Only used if g_rx_oversampling > 1
+  trig_par_i                               : in std_logic_vector(g_rx_oversampling-1 downto 0) := (others => '0');
 
   -------------------------------
   -- Trigger output ports
@@ -76,6 +104,18 @@ end entity trigger_io_rx_datapath;
 
 architecture rtl of trigger_io_rx_datapath is
 
+  -- Line level after the edge that starts a trigger
+  function f_edge_level(sync_edge : string) return std_logic is
+  begin
+    if sync_edge = "negative" then
+      return '0';
+    else
+      return '1';
+    end if;
+  end function;
+
+  constant c_edge_level                    : std_logic := f_edge_level(g_sync_edge);
+
   -- Signals
   signal trig_rx                           : t_trig_channel;
   signal trig_rx_debounced                 : t_trig_channel;
@@ -83,6 +123,12 @@ architecture rtl of trigger_io_rx_datapath is
 
   signal trig_rx_cnt_slv                   : std_logic_vector(g_rx_counter_width-1 downto 0);
 
+  signal trig_rx_sync                      : std_logic;
+  signal trig_rx_samples                   : std_logic_vector(g_rx_oversampling-1 downto 0);
+  signal trig_rx_last_sample               : std_logic;
+  signal trig_rx_edge_ts                   : unsigned(g_rx_ts_width-1 downto 0);
+  signal trig_rx_edge_fine                 : natural range 0 to g_rx_oversampling-1;
+
 begin
 
   -----------------------------------------------------------------------------
@@ -103,9 +149,61 @@ begin
       rst_n_i                              => rst_n_i,
       data_i                               => trig_rx.pulse,
       len_i                                => std_logic_vector(trig_rx_debounce_length_i),
-      pulse_o                              => trig_rx_debounced.pulse
+      pulse_o                              => trig_rx_debounced.pulse,
+      dbg_data_sync_o                      => trig_rx_sync,
+      dbg_data_degliteched_o               => open
   );
 
+  ----------------------------------------------------------------------------
+  -- Timestamps: the last g_sync_edge edge before a received trigger is the
+  -- one that started it, as any later edge would have restarted the debounce
+  ----------------------------------------------------------------------------
+  assert (g_sync_edge = "positive" or g_sync_edge = "negative")
+  report "[trigger_io_rx_datapath] Only g_sync_edge = positive or negative is supported"
+  severity failure;
+
+  gen_without_oversampling : if g_rx_oversampling = 1 generate
+    trig_rx_samples(0) <= trig_rx_sync;
+  end generate;
+
+  gen_with_oversampling : if g_rx_oversampling > 1 generate
+    p_rx_samples : process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        trig_rx_samples <= trig_par_i;
+      end if;
+    end process;
+  end generate;
+
+  p_rx_ts : process(clk_i)
+    variable v_prev : std_logic;
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        trig_rx_last_sample <= not c_edge_level;
+        trig_rx_edge_ts <= (others => '0');
+        trig_rx_edge_fine <= 0;
+        trig_rx_ts_valid_o <= '0';
+      else
+        v_prev := trig_rx_last_sample;
+        for i in 0 to g_rx_oversampling-1 loop
+          if v_prev /= c_edge_level and trig_rx_samples(i) = c_edge_level then
+            trig_rx_edge_ts <= trig_rx_ts_i;
+            trig_rx_edge_fine <= i;
+          end if;
+          v_prev := trig_rx_samples(i);
+        end loop;
+        trig_rx_last_sample <= v_prev;
+
+        trig_rx_ts_valid_o <= trig_rx_debounced.pulse;
+        if trig_rx_debounced.pulse = '1' then
+          trig_rx_ts_o <= trig_rx_edge_ts;
+          trig_rx_ts_fine_o <= trig_rx_edge_fine;
+        end if;
+      end if;
+    end if;
+  end process;
+
   cmp_rx_delay_gen_dyn : delay_gen_dyn
   generic map (
     -- delay counter width
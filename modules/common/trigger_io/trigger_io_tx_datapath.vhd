@@ -12,6 +12,12 @@
 -------------------------------------------------------------------------------
 -- Description: Receives trigger from a hardware line. It supports,
 -- debouncing, polarity, direction control and controllable delay.
+--
+-- With g_tx_oversampling > 1, the delayed and extended pulse is also handed
+-- out as g_tx_oversampling samples per clk_i cycle (trig_par_o), delayed by
+-- trig_tx_fine_delay_i more samples and widened by trig_tx_fine_width_i
+-- samples, for an OSERDES. trig_o is then the OR of the samples, a clock
+-- cycle later than without oversampling.
 -------------------------------------------------------------------------------
 -- Revisions  :
 -- Date        Version  Author  Description
@@ -34,7 +40,9 @@ generic
   -- Length of transmitter counters
   g_tx_counter_width                       : natural := 8;
   -- Length of transmitter delay counters
-  g_tx_delay_width                         : natural := 32
+  g_tx_delay_width                         : natural := 32;
+  -- Transmit samples per clk_i cycle (trig_par_o)
+  g_tx_oversampling                        : natural := 1
 );
 port
 (
@@ -49,6 +57,12 @@ port
   trig_tx_extensor_length_i                : in unsigned(g_tx_extensor_width-1 downto 0);
   -- Number of detected transmitted triggers to external module
   trig_tx_delay_length_i                   : in unsigned(g_tx_delay_width-1 downto 0);
+  -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to delay the
+  -- transmitted pulse after trig_tx_delay_length_i
+  trig_tx_fine_delay_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
+  -- Samples, in 1/g_tx_oversampling of a clk_i cycle, to widen the
+  -- transmitted pulse after trig_tx_extensor_length_i
+  trig_tx_fine_width_i                     : in natural range 0 to g_tx_oversampling-1 := 0;
 
   -------------------------------
   -- Counters
@@ -63,6 +77,9 @@ port
   -------------------------------
   -- Trigger output to external
   trig_o                                   : out std_logic;
+  -- Trigger output to external, oversampled. trig_par_o(0) is the first
+  -- sample in time. Same as trig_o if g_tx_oversampling = 1
+  trig_par_o                               : out std_logic_vector(g_tx_oversampling-1 downto 0);
 
   -------------------------------
   -- Trigger input ports
@@ -81,6 +98,10 @@ architecture rtl of trigger_io_tx_datapath is
 
   signal trig_tx_cnt_slv                   : std_logic_vector(g_tx_counter_width-1 downto 0);
 
+  -- Extended pulse of the previous clock cycles
+  signal trig_tx_dly_extended_d1           : std_logic := '0';
+  signal trig_tx_dly_extended_d2           : std_logic := '0';
+
 begin
 
   -----------------------------------------------------------------------------
@@ -117,7 +138,55 @@ begin
       extended_o                           => trig_tx_dly_extended.pulse
   );
 
-  trig_o <= trig_tx_dly_extended.pulse;
+  gen_without_oversampling : if g_tx_oversampling = 1 generate
+    trig_o <= trig_tx_dly_extended.pulse;
+    trig_par_o(0) <= trig_tx_dly_extended.pulse;
+  end generate;
+
+  ----------------------------------------------------------------------------
+  -- Fine delay and width: sample i of clock cycle k is the extended pulse
+  -- at any of the samples k*g_tx_oversampling + i - fine delay - m, for m
+  -- from 0 to the fine width. These go back at most two clock cycles.
+  ----------------------------------------------------------------------------
+  gen_with_oversampling : if g_tx_oversampling > 1 generate
+    p_tx_par : process(clk_i)
+      variable v_idx : integer;
+      variable v_sample : std_logic;
+      variable v_any : std_logic;
+    begin
+      if rising_edge(clk_i) then
+        if rst_n_i = '0' then
+          trig_tx_dly_extended_d1 <= '0';
+          trig_tx_dly_extended_d2 <= '0';
+          trig_par_o <= (others => '0');
+          trig_o <= '0';
+        else
+          v_any := '0';
+          for i in 0 to g_tx_oversampling-1 loop
+            v_sample := '0';
+            for m in 0 to g_tx_oversampling-1 loop
+              if m <= trig_tx_fine_width_i then
+                v_idx := i - trig_tx_fine_delay_i - m;
+                if v_idx >= 0 then
+                  v_sample := v_sample or trig_tx_dly_extended.pulse;
+                elsif v_idx >= -g_tx_oversampling then
+                  v_sample := v_sample or trig_tx_dly_extended_d1;
+                else
+                  v_sample := v_sample or trig_tx_dly_extended_d2;
+                end if;
+              end if;
+            end loop;
+            trig_par_o(i) <= v_sample;
+            v_any := v_any or v_sample;
+          end loop;
+          trig_o <= v_any;
+
+          trig_tx_dly_extended_d1 <= trig_tx_dly_extended.pulse;
+          trig_tx_dly_extended_d2 <= trig_tx_dly_extended_d1;
+        end if;
+      end if;
+    end process;
+  end generate;
 
   ----------------------------------------------------------------------------
   -- Pulse counters
@@ -80,6 +80,8 @@ entity DMA_Calculate is
     ThereIs_Dex    : out std_logic;     -- Not the last descriptor
     HA64bit        : out std_logic;     -- Host Address is 64-bit
     Addr_Inc       : out std_logic;     -- Peripheral Address increase token
+    Dex_Prefetch   : out std_logic;     -- Descriptors fetched in batches
+    Dex_WBack      : out std_logic;     -- Completion written back to host
 
 
     -- FSM indicators
@@ -202,6 +204,8 @@ architecture Behavioral of DMA_Calculate is
   signal HA64bit_i  : std_logic;
   signal Addr_Inc_i : std_logic;
   signal use_PA     : std_logic;
+  signal Prefetch_i : std_logic;
+  signal WBack_i    : std_logic;
 
   --      for better timing
   signal HA_gap : std_logic_vector(C_MAXSIZE_FLD_BIT_TOP downto 0);
@@ -227,6 +231,8 @@ begin
   ThereIs_Dex    <= ThereIs_Dex_i;
   HA64bit        <= HA64bit_i;
   Addr_Inc       <= Addr_Inc_i;
+  Dex_Prefetch   <= Prefetch_i;
+  Dex_WBack      <= WBack_i;
 
   --
   DMA_PA_Loaded  <= DMA_PA_Loaded_i;
@@ -265,6 +271,8 @@ begin
       if dma_reset = '1' then
         Addr_Inc_i       <= '0';
         use_PA           <= '0';
+        Prefetch_i       <= '0';
+        WBack_i          <= '0';
         Dex_is_Last      <= '0';
         Engine_Ends      <= '1';
         DMA_BAR_Number_i <= (others => '0');
@@ -274,6 +282,8 @@ begin
         if DMA_Start = '1' or DMA_Start2 = '1' then
           Addr_Inc_i       <= DMA_Control_i(CINT_BIT_DMA_CTRL_AINC);
           use_PA           <= DMA_Control_i(CINT_BIT_DMA_CTRL_UPA);
+          Prefetch_i       <= DMA_Control_i(CINT_BIT_DMA_CTRL_PREF);
+          WBack_i          <= DMA_Control_i(CINT_BIT_DMA_CTRL_WBACK);
           Dex_is_Last      <= DMA_Control_i(CINT_BIT_DMA_CTRL_LAST);
           Engine_Ends      <= DMA_Control_i(CINT_BIT_DMA_CTRL_END);
           DMA_BAR_Number_i <= DMA_Control_i(CINT_BIT_DMA_CTRL_BAR_TOP downto CINT_BIT_DMA_CTRL_BAR_BOT);
@@ -283,6 +293,8 @@ begin
         else
           Addr_Inc_i       <= Addr_Inc_i;
           use_PA           <= use_PA;
+          Prefetch_i       <= Prefetch_i;
+          WBack_i          <= WBack_i;
           Dex_is_Last      <= Dex_is_Last;
           Engine_Ends      <= Engine_Ends;
           DMA_BAR_Number_i <= DMA_BAR_Number_i;
@@ -0,0 +1,267 @@
+----------------------------------------------------------------------------------
+-- Company:
+-- Engineer:
+--
+-- Design Name:
+-- Module Name:    DMA_Dex_Prefetch - Behavioral
+-- Project Name:
+-- Target Devices:
+-- Tool versions:
+-- Description:
+--               Descriptor prefetch buffer of a DMA channel, used when the
+--               PREF bit of the DMA Control word is set.
+--
+--               On a miss, DMA_FSM fetches up to C_DEX_PREF_DEPTH contiguous
+--               descriptors at DMA_BDA_fsm with a single MRd, never crossing
+--               a C_DEX_PREF_DEPTH*32-byte boundary. The CplD beats of that
+--               MRd are kept here instead of being written to the registers.
+--               The following descriptors whose BDA is the next one in the
+--               batch hit and are not fetched again.
+--
+--               A popped descriptor is replayed to the registers, through
+--               the same port and in the same beat format as a descriptor
+--               CplD, once it has arrived and DMA_FSM waits in
+--               dmaST_Await_Dex. So the registers are never changed while
+--               the current descriptor is still being processed.
+--
+-- Dependencies:
+--
+-- Revision 1.00 - Created.
+--
+-- Additional Comments:
+--
+----------------------------------------------------------------------------------
+
+library IEEE;
+use IEEE.STD_LOGIC_1164.all;
+use IEEE.STD_LOGIC_ARITH.all;
+use IEEE.STD_LOGIC_UNSIGNED.all;
+
+library work;
+use work.abb64Package.all;
+
+
+entity DMA_Dex_Prefetch is
+  port (
+    -- Register address of the 1st descriptor beat (PAH-1)
+    Dex_Base_Addr : in std_logic_vector(C_EP_AWIDTH-1 downto 0);
+
+    -- Descriptor CplD beats of this channel
+    Dex_WrEn   : in std_logic;
+    Dex_WrMask : in std_logic_vector(2-1 downto 0);
+    Dex_WrDin  : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+
+    -- From/to DMA_FSM
+    Pf_BDA            : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    Pf_Fetch          : in  std_logic;
+    Pf_Pop            : in  std_logic;
+    State_Is_AwaitDex : in  std_logic;
+    Pf_Leng           : out std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
+    Pf_Hit            : out std_logic;
+    Pf_Busy           : out std_logic;
+
+    -- Replay to the registers
+    Rpl_Req  : out std_logic;
+    Rpl_Ack  : in  std_logic;
+    Rpl_Mask : out std_logic_vector(2-1 downto 0);
+    Rpl_Addr : out std_logic_vector(C_EP_AWIDTH-1 downto 0);
+    Rpl_Din  : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+
+    -- Common ports
+    DMA_Start : in std_logic;
+    dma_clk   : in std_logic;
+    dma_reset : in std_logic
+    );
+
+end entity DMA_Dex_Prefetch;
+
+
+architecture Behavioral of DMA_Dex_Prefetch is
+
+  -- DW index in the prefetch buffer
+  constant C_PF_DW_BITS : integer := C_DEX_PREF_BITS+3;
+
+  type DexBufType is array (0 to 2**C_PF_DW_BITS-1) of std_logic_vector(32-1 downto 0);
+  signal Dex_Buf : DexBufType;
+
+  -- Descriptors in the next fetch
+  signal Pf_Num    : std_logic_vector(C_DEX_PREF_BITS downto 0);
+  signal Pf_Leng_i : std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
+
+  -- Batch state
+  signal Pf_Valid  : std_logic;
+  signal Pf_Left   : std_logic_vector(C_DEX_PREF_BITS downto 0);
+  signal Next_BDA  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal Pf_Hit_i  : std_logic;
+  signal Pf_Busy_i : std_logic;
+  signal Rx_DW_Cnt : std_logic_vector(C_PF_DW_BITS downto 0);
+  signal Rx_DW_End : std_logic_vector(C_PF_DW_BITS downto 0);
+  signal Rx_DW_Nxt : std_logic_vector(C_PF_DW_BITS downto 0);
+  signal Pop_Idx   : std_logic_vector(C_DEX_PREF_BITS-1 downto 0);
+
+  -- Replay
+  signal Rpl_Pending : std_logic;
+  signal Rpl_Idx     : std_logic_vector(C_DEX_PREF_BITS-1 downto 0);
+  signal Rpl_Arrived : std_logic;
+  signal Rpl_Req_i   : std_logic;
+  signal Rpl_Beat    : std_logic_vector(3-1 downto 0);
+  signal Rpl_DW_Idx  : std_logic_vector(C_PF_DW_BITS-1 downto 0);
+  signal Rpl_DW_Lo   : std_logic_vector(32-1 downto 0);
+  signal Rpl_DW_Hi   : std_logic_vector(32-1 downto 0);
+
+begin
+
+  Pf_Leng <= Pf_Leng_i;
+  Pf_Hit  <= Pf_Hit_i;
+  Pf_Busy <= Pf_Busy_i;
+  Rpl_Req <= Rpl_Req_i;
+
+
+-- ---------------------------------------------
+--  Length of the next fetch: up to the end of the aligned window,
+--    a single descriptor if BDA is not 32-byte aligned
+--
+  Pf_Num <= CONV_STD_LOGIC_VECTOR(C_DEX_PREF_DEPTH, C_DEX_PREF_BITS+1)
+            - ('0' & Pf_BDA(C_DEX_PREF_BITS+5-1 downto 5))
+            when Pf_BDA(5-1 downto 0) = C_ALL_ZEROS(5-1 downto 0)
+            else CONV_STD_LOGIC_VECTOR(1, C_DEX_PREF_BITS+1);
+
+  Pf_Leng_i <= C_ALL_ZEROS(C_TLP_FLD_WIDTH_OF_LENG+1 downto C_DEX_PREF_BITS+6) & Pf_Num & "00000";
+
+  Pf_Hit_i <= '1' when Pf_Valid = '1'
+              and Pf_Left /= C_ALL_ZEROS(C_DEX_PREF_BITS downto 0)
+              and Pf_BDA = Next_BDA
+              else '0';
+
+  -- All 8 DW of the descriptor to be replayed are in
+  Rpl_Arrived <= '1' when Rx_DW_Cnt >= ('0' & Rpl_Idx & "000") + CONV_STD_LOGIC_VECTOR(8, C_PF_DW_BITS+1)
+                 else '0';
+
+  -- DW count after the current beat
+  Rx_DW_Nxt <= Rx_DW_Cnt + CONV_STD_LOGIC_VECTOR(2, C_PF_DW_BITS+1) - Dex_WrMask(1) - Dex_WrMask(0);
+
+
+-- ---------------------------------------------
+-- Synchronous: batch state
+--   DMA_Start drops the batch, but outstanding CplD's are still
+--   counted so that they are not written to the registers.
+--
+  Syn_Pf_Batch :
+  process (dma_clk)
+  begin
+    if rising_edge(dma_clk) then
+      if dma_reset = '1' then
+        Pf_Valid    <= '0';
+        Pf_Left     <= (others => '0');
+        Next_BDA    <= (others => '0');
+        Pf_Busy_i   <= '0';
+        Rx_DW_Cnt   <= (others => '0');
+        Rx_DW_End   <= (others => '0');
+        Pop_Idx     <= (others => '0');
+        Rpl_Pending <= '0';
+        Rpl_Idx     <= (others => '0');
+      else
+        if DMA_Start = '1' then
+          Pf_Valid    <= '0';
+          Rpl_Pending <= '0';
+        elsif Pf_Fetch = '1' then
+          Pf_Valid    <= '1';
+          Pf_Left     <= Pf_Num - '1';
+          Next_BDA    <= Pf_BDA + CONV_STD_LOGIC_VECTOR(32, C_DBUS_WIDTH);
+          Pop_Idx     <= CONV_STD_LOGIC_VECTOR(1, C_DEX_PREF_BITS);
+          Rpl_Pending <= '1';
+          Rpl_Idx     <= (others => '0');
+        elsif Pf_Pop = '1' then
+          Pf_Left     <= Pf_Left - '1';
+          Next_BDA    <= Next_BDA + CONV_STD_LOGIC_VECTOR(32, C_DBUS_WIDTH);
+          Pop_Idx     <= Pop_Idx + '1';
+          Rpl_Pending <= '1';
+          Rpl_Idx     <= Pop_Idx;
+        elsif Rpl_Req_i = '1' and Rpl_Ack = '1' and Rpl_Beat = CONV_STD_LOGIC_VECTOR(4, 3) then
+          Rpl_Pending <= '0';
+        end if;
+
+        if Pf_Fetch = '1' then
+          Pf_Busy_i <= '1';
+          Rx_DW_Cnt <= (others => '0');
+          Rx_DW_End <= Pf_Num & "000";
+        elsif Dex_WrEn = '1' and Pf_Busy_i = '1' then
+          if Rx_DW_Nxt >= Rx_DW_End then
+            Pf_Busy_i <= '0';
+          end if;
+          Rx_DW_Cnt <= Rx_DW_Nxt;
+        end if;
+      end if;
+    end if;
+  end process;
+
+
+-- ---------------------------------------------
+-- Synchronous: descriptor buffer write, DW's in arrival order
+--
+  Syn_Dex_Buf_Write :
+  process (dma_clk)
+  begin
+    if rising_edge(dma_clk) then
+      if Dex_WrEn = '1' and Pf_Busy_i = '1' then
+        if Dex_WrMask(1) = '0' then
+          Dex_Buf(CONV_INTEGER(Rx_DW_Cnt(C_PF_DW_BITS-1 downto 0))) <= Dex_WrDin(32-1 downto 0);
+          if Dex_WrMask(0) = '0' then
+            Dex_Buf(CONV_INTEGER(Rx_DW_Cnt(C_PF_DW_BITS-1 downto 0) + '1')) <= Dex_WrDin(C_DBUS_WIDTH-1 downto 32);
+          end if;
+        elsif Dex_WrMask(0) = '0' then
+          Dex_Buf(CONV_INTEGER(Rx_DW_Cnt(C_PF_DW_BITS-1 downto 0))) <= Dex_WrDin(C_DBUS_WIDTH-1 downto 32);
+        end if;
+      end if;
+    end if;
+  end process;
+
+
+-- ---------------------------------------------
+-- Synchronous: replay, 5 beats as from rx_CplD_Transact
+--     beat 0    : DW0 on the upper half
+--     beat 1..3 : DW(2b-1) and DW(2b)
+--     beat 4    : DW7 on the lower half
+--
+  Syn_Replay :
+  process (dma_clk)
+  begin
+    if rising_edge(dma_clk) then
+      if dma_reset = '1' or DMA_Start = '1' then
+        Rpl_Req_i <= '0';
+        Rpl_Beat  <= (others => '0');
+      else
+        if Rpl_Req_i = '1' then
+          if Rpl_Ack = '1' then
+            if Rpl_Beat = CONV_STD_LOGIC_VECTOR(4, 3) then
+              Rpl_Req_i <= '0';
+              Rpl_Beat  <= (others => '0');
+            else
+              Rpl_Req_i <= '1';
+              Rpl_Beat  <= Rpl_Beat + '1';
+            end if;
+          end if;
+        elsif Rpl_Pending = '1' and Rpl_Arrived = '1' and State_Is_AwaitDex = '1' then
+          Rpl_Req_i <= '1';
+          Rpl_Beat  <= (others => '0');
+        end if;
+      end if;
+    end if;
+  end process;
+
+  -- DW(2b) of the descriptor
+  Rpl_DW_Idx <= (Rpl_Idx & "000") + (Rpl_Beat & '0');
+
+  Rpl_DW_Lo <= Dex_Buf(CONV_INTEGER(Rpl_DW_Idx - '1'))
+               when Rpl_Beat /= "000" else (others => '0');
+  Rpl_DW_Hi <= Dex_Buf(CONV_INTEGER(Rpl_DW_Idx))
+               when Rpl_Beat /= "100" else (others => '0');
+
+  Rpl_Din  <= Rpl_DW_Hi & Rpl_DW_Lo;
+  Rpl_Mask <= "10" when Rpl_Beat = "000" else
+              "01" when Rpl_Beat = "100" else
+              "00";
+  Rpl_Addr <= Dex_Base_Addr(C_EP_AWIDTH-1 downto C_DECODE_BIT_BOT)
+              & (Dex_Base_Addr(C_DECODE_BIT_BOT-1 downto 0) + (Rpl_Beat & "000"));
+
+end architecture Behavioral;
@@ -62,6 +62,19 @@ entity DMA_FSM is
     DMA_BDA_fsm    : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     BDA_is_64b_fsm : in std_logic;
 
+    -- Descriptor prefetch
+    Dex_Prefetch : in  std_logic;
+    Dex_Pf_Leng  : in  std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
+    Dex_Pf_Hit   : in  std_logic;
+    Dex_Pf_Busy  : in  std_logic;
+    Dex_Pf_Fetch : out std_logic;
+    Dex_Pf_Pop   : out std_logic;
+
+    -- Descriptor completion write-back
+    Dex_WBack  : in std_logic;
+    DMA_WBA    : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    WBA_is_64b : in std_logic;
+
     DMA_Snout_Length : in std_logic_vector(C_MAXSIZE_FLD_BIT_TOP downto 0);
     DMA_Body_Length  : in std_logic_vector(C_MAXSIZE_FLD_BIT_TOP downto 0);
     DMA_Tail_Length  : in std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
@@ -84,6 +97,7 @@ entity DMA_FSM is
     State_Is_Snout     : out std_logic;
     State_Is_Body      : out std_logic;
     State_Is_Tail      : out std_logic;
+    State_Is_AwaitDex  : out std_logic;
     DMA_Cmd_Ack        : out std_logic;
 
     -- To Tx Port
@@ -141,6 +155,10 @@ architecture Behavioral of DMA_FSM is
     --                the ChBuf.
     , dmaST_NextDex
 
+    -- dmaST_WBack: writing the 1-DW MWr of the descriptor completion
+    --              write-back to the ChBuf, after the last data TLP.
+    , dmaST_WBack
+
     -- dmaST_Await_Dex: after MRd(descriptor) info is written in the ChBuf,
     --                  the state machine waits for the descriptor's
     --                  arrival.
@@ -200,6 +218,16 @@ architecture Behavioral of DMA_FSM is
   --  Acknowledge for DMA_Start command
   signal DMA_Cmd_Ack_i : std_logic;
 
+  -- Descriptor prefetch
+  signal Dex_Pf_Stall   : std_logic;
+  signal Dex_Pf_Fetch_i : std_logic;
+  signal Dex_Pf_Pop_i   : std_logic;
+
+  -- Completion write-back
+  signal WBack_On      : std_logic;
+  signal Dex_Done_Cnt  : std_logic_vector(C_CHBUF_MA_BIT_TOP-C_CHBUF_MA_BIT_BOT downto 0);
+  signal Data_Ends     : std_logic;
+
   -- channel FIFO Write control
   signal ChBuf_WrDin_i : std_logic_vector(C_CHANNEL_BUF_WIDTH-1 downto 0);
   signal ChBuf_WrEn_i  : std_logic;
@@ -237,10 +265,29 @@ begin
   State_Is_Snout     <= State_Is_Snout_i;
   State_Is_Body      <= State_Is_Body_i;
   State_Is_Tail      <= State_Is_Tail_i;
+  State_Is_AwaitDex  <= State_Is_AwaitDex_i;
 
   DMA_Cmd_Ack <= DMA_Cmd_Ack_i;
 
 
+  -- Descriptor prefetch: in dmaST_NextDex, a hit pops the buffered
+  --   descriptor, a miss fetches a new batch once the last one is in.
+  Dex_Pf_Stall   <= Dex_Prefetch and not Dex_Pf_Hit and Dex_Pf_Busy;
+  Dex_Pf_Fetch_i <= '1' when DMA_State = dmaST_NextDex
+                    and Dex_Prefetch = '1' and Dex_Pf_Hit = '0' and Dex_Pf_Busy = '0'
+                    else '0';
+  Dex_Pf_Pop_i   <= '1' when DMA_State = dmaST_NextDex
+                    and Dex_Prefetch = '1' and Dex_Pf_Hit = '1'
+                    else '0';
+
+  Dex_Pf_Fetch <= Dex_Pf_Fetch_i;
+  Dex_Pf_Pop   <= Dex_Pf_Pop_i;
+
+  -- Completion write-back, if the host has set its address
+  WBack_On <= '1' when Dex_WBack = '1' and DMA_WBA /= C_ALL_ZEROS(C_DBUS_WIDTH-1 downto 0)
+              else '0';
+
+
 -- -----------------------------------------
 -- Syn_Delay: DMA_Start
 --            DMA_Start2
@@ -282,6 +329,8 @@ begin
     , ThereIs_Snout                     --_reg
     , ThereIs_Tail_reg
     , ThereIs_Dex_reg
+    , Dex_Pf_Stall
+    , WBack_On
     )
   begin
     case DMA_State is
@@ -305,10 +354,14 @@ begin
         end if;
 
       when dmaST_NextDex =>
-        if ThereIs_Snout = '1' then
+        if Dex_Pf_Stall = '1' then
+          DMA_NextState <= dmaST_NextDex;
+        elsif ThereIs_Snout = '1' then
           DMA_NextState <= dmaST_Snout;
         elsif No_More_Bodies = '0' then
           DMA_NextState <= dmaST_Body;
+        elsif WBack_On = '1' then
+          DMA_NextState <= dmaST_WBack;
         else
           DMA_NextState <= dmaST_Await_Dex;
         end if;
@@ -323,6 +376,8 @@ begin
           DMA_NextState <= dmaST_Body;
         elsif ThereIs_Tail_reg = '1' then
           DMA_NextState <= dmaST_Tail;
+        elsif WBack_On = '1' then
+          DMA_NextState <= dmaST_WBack;
         elsif ThereIs_Dex_reg = '1' then
           DMA_NextState <= dmaST_Await_Dex;
         else
@@ -333,6 +388,15 @@ begin
         DMA_NextState <= dmaST_Stomp;
 
       when dmaST_Tail =>
+        if WBack_On = '1' then
+          DMA_NextState <= dmaST_WBack;
+        elsif ThereIs_Dex_reg = '1' then
+          DMA_NextState <= dmaST_Await_Dex;
+        else
+          DMA_NextState <= dmaST_Init;
+        end if;
+
+      when dmaST_WBack =>
         if ThereIs_Dex_reg = '1' then
           DMA_NextState <= dmaST_Await_Dex;
         else
@@ -456,6 +520,33 @@ begin
     end if;
   end process;
 
+-- -------------------------------------------------------------
+-- Synchronous reg: Dex_Done_Cnt
+--                  Descriptors whose data TLP's are all in the ChBuf,
+--                  since the DMA start. Carried by the write-back MWr.
+--
+  Data_Ends <= '1' when (DMA_State = dmaST_Tail
+                         or DMA_State = dmaST_Stomp
+                         or DMA_State = dmaST_NextDex)
+                    and (DMA_NextState = dmaST_WBack
+                         or DMA_NextState = dmaST_Await_Dex
+                         or DMA_NextState = dmaST_Init)
+               else '0';
+
+  Syn_Dex_Done_Cnt :
+  process (dma_clk)
+  begin
+    if rising_edge(dma_clk) then
+      if dma_reset = '1' or DMA_Start = '1' then
+        Dex_Done_Cnt <= (others => '0');
+      elsif Data_Ends = '1' then
+        Dex_Done_Cnt <= Dex_Done_Cnt + '1';
+      else
+        Dex_Done_Cnt <= Dex_Done_Cnt;
+      end if;
+    end if;
+  end process;
+
 -------------------------------------------------------------------
 -- Synchronous Output: DMA_Abstract_Buffer_Write
 --
@@ -488,7 +579,7 @@ begin
         case DMA_State is
   
           when dmaST_NextDex =>
-            ChBuf_WrEn_i <= '1';
+            ChBuf_WrEn_i <= not Dex_Pf_Stall and not Dex_Pf_Pop_i;
             ChBuf_WrDin_i <= (others => '0');  -- must be the first argument
             ChBuf_WrDin_i(C_CHBUF_HA_BIT_TOP downto C_CHBUF_HA_BIT_BOT)           <= DMA_BDA_fsm;
             ChBuf_WrDin_i(C_CHBUF_MA_BIT_TOP downto C_CHBUF_MA_BIT_BOT)           <= C_ALL_ZEROS(C_CHBUF_MA_BIT_TOP downto C_CHBUF_MA_BIT_BOT);  -- any value
@@ -496,7 +587,11 @@ begin
             ChBuf_WrDin_i(C_CHBUF_DMA_BAR_BIT_TOP downto C_CHBUF_DMA_BAR_BIT_BOT) <= DMA_BAR_Number;
             ChBuf_WrDin_i(C_CHBUF_FMT_BIT_TOP)                              <= C_TLP_HAS_NO_DATA;  --C_MRD_HEAD0_WORD(C_TLP_FMT_BIT_TOP);
             ChBuf_WrDin_i(C_CHBUF_FMT_BIT_BOT)                              <= BDA_is_64b_fsm;
-            ChBuf_WrDin_i(C_CHBUF_LENG_BIT_TOP downto C_CHBUF_LENG_BIT_BOT) <= C_NEXT_BD_LENGTH(C_TLP_FLD_WIDTH_OF_LENG+1 downto 2);
+            if Dex_Prefetch = '1' then
+              ChBuf_WrDin_i(C_CHBUF_LENG_BIT_TOP downto C_CHBUF_LENG_BIT_BOT) <= Dex_Pf_Leng(C_TLP_FLD_WIDTH_OF_LENG+1 downto 2);
+            else
+              ChBuf_WrDin_i(C_CHBUF_LENG_BIT_TOP downto C_CHBUF_LENG_BIT_BOT) <= C_NEXT_BD_LENGTH(C_TLP_FLD_WIDTH_OF_LENG+1 downto 2);
+            end if;
             ChBuf_WrDin_i(C_CHBUF_QVALID_BIT) <= '1';
             ChBuf_WrDin_i(C_CHBUF_AINC_BIT)   <= DMA_Addr_Inc;  -- any value
             ChBuf_WrDin_i(C_CHBUF_ATTR_BIT_TOP downto C_CHBUF_ATTR_BIT_BOT) <= C_RELAXED_ORDERING & C_NO_SNOOP;
@@ -586,6 +681,21 @@ begin
             ChBuf_WrDin_i(C_CHBUF_TC_BIT_TOP downto C_CHBUF_TC_BIT_BOT)     <= us_MWr_Param_Vec(2 downto 0);
             ChBuf_WrDin_i(C_CHBUF_ATTR_BIT_TOP downto C_CHBUF_ATTR_BIT_BOT) <= us_MWr_Param_Vec(5 downto 4);  -- C_RELAXED_ORDERING & C_NO_SNOOP;
   
+          -- The payload DW is '1' & Dex_Done_Cnt, carried in the MA field.
+          --   Strict ordering, so it can not pass the data MWr's.
+          when dmaST_WBack =>
+            ChBuf_WrEn_i <= '1';
+            ChBuf_WrDin_i <= (others => '0');  -- must be the first argument
+            ChBuf_WrDin_i(C_CHBUF_HA_BIT_TOP downto C_CHBUF_HA_BIT_BOT)           <= DMA_WBA;
+            ChBuf_WrDin_i(C_CHBUF_MA_BIT_TOP downto C_CHBUF_MA_BIT_BOT)           <= Dex_Done_Cnt;
+            ChBuf_WrDin_i(C_CHBUF_TAG_BIT_TOP downto C_CHBUF_TAG_BIT_BOT)         <= Pkt_Tag;
+            ChBuf_WrDin_i(C_CHBUF_DMA_BAR_BIT_TOP downto C_CHBUF_DMA_BAR_BIT_BOT) <= CONV_STD_LOGIC_VECTOR(CINT_WBACK_SPACE_BAR, C_ENCODE_BAR_NUMBER);
+            ChBuf_WrDin_i(C_CHBUF_FMT_BIT_TOP) <= '1';  -- MWr
+            ChBuf_WrDin_i(C_CHBUF_FMT_BIT_BOT) <= WBA_is_64b;
+            ChBuf_WrDin_i(C_CHBUF_LENG_BIT_TOP downto C_CHBUF_LENG_BIT_BOT) <= CONV_STD_LOGIC_VECTOR(1, C_TLP_FLD_WIDTH_OF_LENG);
+            ChBuf_WrDin_i(C_CHBUF_QVALID_BIT) <= '1';
+            ChBuf_WrDin_i(C_CHBUF_TC_BIT_TOP downto C_CHBUF_TC_BIT_BOT)     <= us_MWr_Param_Vec(2 downto 0);
+  
           when others =>
             ChBuf_WrEn_i  <= '0';
             ChBuf_WrDin_i <= ChBuf_WrDin_i;
@@ -16,6 +16,13 @@
 --
 -- Revision 1.10 - Msg Tag incremented.  20.07.2007
 --
+-- Revision 1.20 - MSI vector per source and MSI coalescing.
+--                 With MSI, each interrupt source k is sent as vector k,
+--                 or as the last allocated vector if the host granted
+--                 less. Coalesced sources (IRQ_Coal_Mask) send one MSI
+--                 every IRQ_Coal_Ctrl count events, or once the timeout
+--                 has expired since the first pending event.
+--
 -- Additional Comments:
 --
 ----------------------------------------------------------------------------------
@@ -37,6 +44,10 @@ entity Interrupts is
     -- System Interrupt register from Registers module
     Sys_IRQ : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
 
+    -- MSI coalescing from Registers module
+    IRQ_Coal_Ctrl : in std_logic_vector(32-1 downto 0);
+    IRQ_Coal_Mask : in std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+
     -- Interrupt generator signals
     IG_Reset        : in  std_logic;
     IG_Host_Clear   : in  std_logic;
@@ -88,7 +99,27 @@ architecture Behavioral of Interrupts is
   signal edge_Irpt_Req_i  : std_logic;
 
   signal inta_trigger : std_logic;
-  signal msi_trigger  : std_logic;
+  signal Irpt_Trigger : std_logic;
+
+  -- MSI per source
+  type CoalCntArray is array (C_NUM_OF_INTERRUPTS-1 downto 0)
+    of std_logic_vector(CINT_BIT_IRQ_COAL_CNT_TOP-CINT_BIT_IRQ_COAL_CNT_BOT downto 0);
+  type CoalTmrArray is array (C_NUM_OF_INTERRUPTS-1 downto 0)
+    of std_logic_vector(CINT_BIT_IRQ_COAL_TOUT_TOP-CINT_BIT_IRQ_COAL_TOUT_BOT downto 0);
+
+  signal Sys_IRQ_r1   : std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+  signal Irq_Edge     : std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+  signal Coal_Thresh  : std_logic_vector(CINT_BIT_IRQ_COAL_CNT_TOP-CINT_BIT_IRQ_COAL_CNT_BOT downto 0);
+  signal Coal_Tout    : std_logic_vector(CINT_BIT_IRQ_COAL_TOUT_TOP-CINT_BIT_IRQ_COAL_TOUT_BOT downto 0);
+  signal Coal_Prescal : std_logic_vector(C_IRQ_COAL_TICK_BITS-1 downto 0);
+  signal Coal_Tick    : std_logic;
+  signal Coal_Cnt     : CoalCntArray;
+  signal Coal_Tmr     : CoalTmrArray;
+  signal Msi_Pend     : std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+  signal Msi_Pend_Idx : std_logic_vector(8-1 downto 0);
+  signal Msi_Vec_Max  : std_logic_vector(8-1 downto 0);
+  signal Msi_Src      : std_logic_vector(8-1 downto 0);
+  signal Msi_Sent     : std_logic;
 
   signal Irpt_RE_i   : std_logic;
   signal Irpt_Qout_i : std_logic_vector(C_CHANNEL_BUF_WIDTH-1 downto 0) := (others => '0');
@@ -99,7 +130,6 @@ architecture Behavioral of Interrupts is
   signal edge_MsgCode_is_ASSERT  : std_logic;
 
   signal Interrupts_ORed    : std_logic;
-  signal Interrupts_ORed_r1 : std_logic;
 
   -- Interrupt Generator
   signal IG_Trigger_i : std_logic;
@@ -123,7 +153,6 @@ begin
   -- cfg_interrupt should be explicitly clarified!
   cfg_interrupt_assert <= cfg_interrupt_assert_i;
   cfg_interrupt_di     <= cfg_interrupt_di_i;
-  cfg_interrupt_di_i   <= (others => '0');
 
   -- Channel mode interface.
   Irpt_RE_i <= Irpt_RE;
@@ -166,7 +195,6 @@ begin
       else
         Interrupts_ORed <= '1';
       end if;
-      Interrupts_ORed_r1 <= Interrupts_ORed;
     end if;
   end process;
 
@@ -175,10 +203,148 @@ begin
   begin
     if rising_edge(user_clk) then
       inta_trigger <= Interrupts_ORed;
-      --rising edge, because interrupt handling differs between legacy INTA and MSI
-      msi_trigger  <= Interrupts_ORed and not(Interrupts_ORed_r1);
     end if;
   end process;
+
+  --rising edges, because interrupt handling differs between legacy INTA and MSI
+  Irpt_Trigger <= inta_trigger when cfg_interrupt_msienable = '0'
+                  else '0' when Msi_Pend = C_ALL_ZEROS(C_NUM_OF_INTERRUPTS-1 downto 0)
+                  else '1';
+
+-- ---------------------------------------------------------------
+-- Rising edge of each interrupt
+--
+  Syn_Irq_Edge :
+  process (user_clk)
+  begin
+    if rising_edge(user_clk) then
+      if user_reset = '1' then
+        Sys_IRQ_r1 <= (others => '0');
+        Irq_Edge   <= (others => '0');
+      else
+        Sys_IRQ_r1 <= Sys_IRQ(C_NUM_OF_INTERRUPTS-1 downto 0);
+        Irq_Edge   <= Sys_IRQ(C_NUM_OF_INTERRUPTS-1 downto 0) and not Sys_IRQ_r1;
+      end if;
+    end if;
+  end process;
+
+  Coal_Thresh <= IRQ_Coal_Ctrl(CINT_BIT_IRQ_COAL_CNT_TOP downto CINT_BIT_IRQ_COAL_CNT_BOT);
+  Coal_Tout   <= IRQ_Coal_Ctrl(CINT_BIT_IRQ_COAL_TOUT_TOP downto CINT_BIT_IRQ_COAL_TOUT_BOT);
+
+-- ---------------------------------------------------------------
+-- Coalescing timeout tick, every 2**C_IRQ_COAL_TICK_BITS cycles
+--
+  Syn_Coal_Prescaler :
+  process (user_clk)
+  begin
+    if rising_edge(user_clk) then
+      if user_reset = '1' then
+        Coal_Prescal <= (others => '0');
+        Coal_Tick    <= '0';
+      else
+        Coal_Prescal <= Coal_Prescal + '1';
+        if Coal_Prescal = C_ALL_ONES(C_IRQ_COAL_TICK_BITS-1 downto 0) then
+          Coal_Tick <= '1';
+        else
+          Coal_Tick <= '0';
+        end if;
+      end if;
+    end if;
+  end process;
+
+-- ---------------------------------------------------------------
+-- MSI pending flag of each source
+--   Not coalesced: set on every rising edge.
+--   Coalesced: events are counted, the flag is set when the count
+--   reaches Coal_Thresh (0 and 1 mean every event) or when Coal_Tout
+--   (if not 0) ticks have gone by since the first counted event.
+--   The flag is cleared when the MSI of the source has been sent, and
+--   everything is dropped while MSI is disabled.
+--
+  Gen_Msi_Pend : for k in 0 to C_NUM_OF_INTERRUPTS-1 generate
+
+    Syn_Msi_Pend :
+    process (user_clk)
+    begin
+      if rising_edge(user_clk) then
+        if user_reset = '1' or cfg_interrupt_msienable = '0' then
+          Coal_Cnt(k) <= (others => '0');
+          Coal_Tmr(k) <= (others => '0');
+          Msi_Pend(k) <= '0';
+        elsif IRQ_Coal_Mask(k) = '0' then
+          Coal_Cnt(k) <= (others => '0');
+          Coal_Tmr(k) <= (others => '0');
+          if Irq_Edge(k) = '1' then
+            Msi_Pend(k) <= '1';
+          elsif Msi_Sent = '1' and Msi_Src = CONV_STD_LOGIC_VECTOR(k, 8) then
+            Msi_Pend(k) <= '0';
+          else
+            Msi_Pend(k) <= Msi_Pend(k);
+          end if;
+        else
+          if Irq_Edge(k) = '1' and Coal_Cnt(k) + '1' >= Coal_Thresh then
+            Coal_Cnt(k) <= (others => '0');
+            Coal_Tmr(k) <= (others => '0');
+            Msi_Pend(k) <= '1';
+          elsif Coal_Tick = '1' and Coal_Cnt(k) /= C_ALL_ZEROS(CINT_BIT_IRQ_COAL_CNT_TOP-CINT_BIT_IRQ_COAL_CNT_BOT downto 0)
+            and Coal_Tout /= C_ALL_ZEROS(CINT_BIT_IRQ_COAL_TOUT_TOP-CINT_BIT_IRQ_COAL_TOUT_BOT downto 0)
+            and Coal_Tmr(k) + '1' >= Coal_Tout
+          then
+            Coal_Cnt(k) <= (others => '0');
+            Coal_Tmr(k) <= (others => '0');
+            Msi_Pend(k) <= '1';
+          else
+            if Irq_Edge(k) = '1' then
+              Coal_Cnt(k) <= Coal_Cnt(k) + '1';
+            else
+              Coal_Cnt(k) <= Coal_Cnt(k);
+            end if;
+            if Coal_Tick = '1' and Coal_Cnt(k) /= C_ALL_ZEROS(CINT_BIT_IRQ_COAL_CNT_TOP-CINT_BIT_IRQ_COAL_CNT_BOT downto 0) then
+              Coal_Tmr(k) <= Coal_Tmr(k) + '1';
+            else
+              Coal_Tmr(k) <= Coal_Tmr(k);
+            end if;
+            if Msi_Sent = '1' and Msi_Src = CONV_STD_LOGIC_VECTOR(k, 8) then
+              Msi_Pend(k) <= '0';
+            else
+              Msi_Pend(k) <= Msi_Pend(k);
+            end if;
+          end if;
+        end if;
+      end if;
+    end process;
+
+  end generate;
+
+-- ---------------------------------------------------------------
+-- Lowest pending source, sent first
+--
+  Comb_Msi_Pend_Idx :
+  process (Msi_Pend)
+  begin
+    Msi_Pend_Idx <= (others => '0');
+    for k in C_NUM_OF_INTERRUPTS-1 downto 0 loop
+      if Msi_Pend(k) = '1' then
+        Msi_Pend_Idx <= CONV_STD_LOGIC_VECTOR(k, 8);
+      end if;
+    end loop;
+  end process;
+
+-- ---------------------------------------------------------------
+-- Last MSI vector granted by the host (Multiple Message Enable)
+--
+  Comb_Msi_Vec_Max :
+  process (cfg_interrupt_mmenable)
+  begin
+    case cfg_interrupt_mmenable is
+      when "000"  => Msi_Vec_Max <= X"00";
+      when "001"  => Msi_Vec_Max <= X"01";
+      when "010"  => Msi_Vec_Max <= X"03";
+      when "011"  => Msi_Vec_Max <= X"07";
+      when "100"  => Msi_Vec_Max <= X"0F";
+      when others => Msi_Vec_Max <= X"1F";
+    end case;
+  end process;
 -------------------------------------------
 ---- Cfg Interface mode
 -------------------------------------------
@@ -188,6 +354,11 @@ begin
     Irpt_Req      <= '0';  -- Cfg interface mode, channel disabled.
     Msg_Code      <= (others => '0');
 
+    Msi_Sent <= '1' when edge_Intrpt_State = IntST_Asserting
+                and cfg_interrupt_rdy = '1'
+                and cfg_interrupt_msienable = '1'
+                else '0';
+
     States_Machine_Irpt :
     process (user_clk)
     begin
@@ -196,6 +367,8 @@ begin
           edge_Intrpt_State      <= IntST_RST;
           cfg_interrupt_i        <= '0';
           cfg_interrupt_assert_i <= '0';
+          cfg_interrupt_di_i     <= (others => '0');
+          Msi_Src                <= (others => '0');
         else
           case edge_Intrpt_State is
   
@@ -205,10 +378,18 @@ begin
               cfg_interrupt_assert_i <= '0';
   
             when IntST_Idle =>
-              if (inta_trigger or msi_trigger) = '1' then
+              if Irpt_Trigger = '1' then
                 edge_Intrpt_State      <= IntST_Asserting;
                 cfg_interrupt_i        <= '1';
                 cfg_interrupt_assert_i <= not(cfg_interrupt_msienable);
+                Msi_Src                <= Msi_Pend_Idx;
+                if cfg_interrupt_msienable = '0' then
+                  cfg_interrupt_di_i <= (others => '0');
+                elsif Msi_Pend_Idx > Msi_Vec_Max then
+                  cfg_interrupt_di_i <= Msi_Vec_Max;
+                else
+                  cfg_interrupt_di_i <= Msi_Pend_Idx;
+                end if;
               else
                 edge_Intrpt_State      <= IntST_Idle;
                 cfg_interrupt_i        <= '0';
@@ -271,6 +452,9 @@ begin
 
     cfg_interrupt          <= '0';  -- Channel mode, cfg interface disabled.
     cfg_interrupt_assert_i <= '0';
+    cfg_interrupt_di_i     <= (others => '0');
+    Msi_Src                <= (others => '0');
+    Msi_Sent               <= '0';
 
     Irpt_Req <= edge_Irpt_Req_i;
     Msg_Code <= C_MSGCODE_INTA when edge_MsgCode_is_ASSERT = '1'
@@ -6,6 +6,7 @@ files = ["ddr_Transact.vhd",
          "Tx_Output_Arbitor.vhd",
          "wb_transact.vhd",
          "DMA_Calculate.vhd",
+         "DMA_Dex_Prefetch.vhd",
          "rx_dsDMA_Channel.vhd",
          "rx_MWr_Channel.vhd",
          "tlpControl.vhd",
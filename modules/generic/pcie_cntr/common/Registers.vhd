@@ -96,6 +96,7 @@ entity Regs_Group is
     DMA_us_BDA        : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     DMA_us_Length     : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     DMA_us_Control    : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    DMA_us_WBA        : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     usDMA_BDA_eq_Null : out std_logic;  -- obsolete
     us_MWr_Param_Vec  : out std_logic_vector(6-1 downto 0);
     DMA_us_Status     : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
@@ -105,6 +106,7 @@ entity Regs_Group is
     -- Calculation in advance, for better timing
     usHA_is_64b  : out std_logic;
     usBDA_is_64b : out std_logic;
+    usWBA_is_64b : out std_logic;
 
     -- Calculation in advance, for better timing
     usLeng_Hi19b_True : out std_logic;
@@ -141,7 +143,12 @@ entity Regs_Group is
     ddr_mm2s_sts_tlast : in STD_LOGIC;
     
     -- to Interrupts Module
-    Sys_IRQ : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    Sys_IRQ       : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    IRQ_Coal_Ctrl : out std_logic_vector(32-1 downto 0);
+    IRQ_Coal_Mask : out std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+
+    -- User interrupt requests, synchronous to user_clk
+    Usr_IRQ_Req : in std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0);
 
     -- System error and info
     Tx_TimeOut      : in  std_logic;
@@ -249,6 +256,7 @@ architecture Behavioral of Regs_Group is
   signal DMA_us_BDA_o_Hi          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Length_o_Hi       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Control_o_Hi      : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal DMA_us_WBA_o_Hi          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Status_o_Hi       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Transf_Bytes_o_Hi : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_PA_o_Lo           : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
@@ -256,6 +264,7 @@ architecture Behavioral of Regs_Group is
   signal DMA_us_BDA_o_Lo          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Length_o_Lo       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Control_o_Lo      : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal DMA_us_WBA_o_Lo          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Status_o_Lo       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Transf_Bytes_o_Lo : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
 
@@ -269,6 +278,14 @@ architecture Behavioral of Regs_Group is
   signal Sys_Int_Enable_o_Hi : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal Sys_Int_Enable_o_Lo : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
 
+  -- MSI coalescing
+  signal IRQ_Coal_Ctrl_i    : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Mask_i    : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Ctrl_o_Hi : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Ctrl_o_Lo : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Mask_o_Hi : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Mask_o_Lo : std_logic_vector(32-1 downto 0);
+
   -- General Control and Status
   signal Sys_Error_i    : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal Sys_Error_o_Hi : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
@@ -353,6 +370,7 @@ architecture Behavioral of Regs_Group is
   signal DMA_us_BDA_i          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Length_i       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Control_i      : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal DMA_us_WBA_i          : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Status_i       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Transf_Bytes_i : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
 
@@ -361,6 +379,7 @@ architecture Behavioral of Regs_Group is
   -- Calculation in advance, for better timing
   signal usHA_is_64b_i  : std_logic;
   signal usBDA_is_64b_i : std_logic;
+  signal usWBA_is_64b_i : std_logic;
 
   -- Calculation in advance, for better timing
   signal usLeng_Hi19b_True_i : std_logic;
@@ -412,11 +431,13 @@ begin
   DMA_us_BDA        <= DMA_us_BDA_i;
   DMA_us_Length     <= DMA_us_Length_i;
   DMA_us_Control    <= DMA_us_Control_i;
+  DMA_us_WBA        <= DMA_us_WBA_i;
   usDMA_BDA_eq_Null <= '0';
   DMA_us_Status_i   <= DMA_us_Status;
 
   usHA_is_64b  <= usHA_is_64b_i;
   usBDA_is_64b <= usBDA_is_64b_i;
+  usWBA_is_64b <= usWBA_is_64b_i;
 
   usLeng_Hi19b_True <= usLeng_Hi19b_True_i;
   usLeng_Lo7b_True  <= usLeng_Lo7b_True_i;
@@ -452,6 +473,9 @@ begin
   -- Register to Interrupt handler module
   Sys_IRQ <= Sys_IRQ_i;
 
+  IRQ_Coal_Ctrl <= IRQ_Coal_Ctrl_i;
+  IRQ_Coal_Mask <= IRQ_Coal_Mask_i(C_NUM_OF_INTERRUPTS-1 downto 0);
+
   -- Message routing method
   Msg_Routing <= General_Control_i(C_GCR_MSG_ROUT_BIT_TOP downto C_GCR_MSG_ROUT_BIT_BOT);
 
@@ -821,6 +845,44 @@ begin
     end if;
   end process;
 
+-- -------------------------------------------------------
+-- Synchronous Registered: IRQ_Coal_Ctrl_i, IRQ_Coal_Mask_i
+--   Reset value leaves coalescing off
+  SysReg_IRQ_Coalescing :
+  process (user_clk)
+  begin
+    if rising_edge(user_clk) then
+      if user_lnk_up = '0' then
+        IRQ_Coal_Ctrl_i <= (others => '0');
+        IRQ_Coal_Mask_i <= (others => '0');
+      else
+        if Regs_WrEn_r2 = '1'
+          and Reg_WrMuxer_Hi(CINT_ADDR_IRQ_COAL_CTRL) = '1'
+        then
+          IRQ_Coal_Ctrl_i <= Regs_WrDin_r2(64-1 downto 32);
+        elsif Regs_WrEn_r2 = '1'
+          and Reg_WrMuxer_Lo(CINT_ADDR_IRQ_COAL_CTRL) = '1'
+        then
+          IRQ_Coal_Ctrl_i <= Regs_WrDin_r2(32-1 downto 0);
+        else
+          IRQ_Coal_Ctrl_i <= IRQ_Coal_Ctrl_i;
+        end if;
+
+        if Regs_WrEn_r2 = '1'
+          and Reg_WrMuxer_Hi(CINT_ADDR_IRQ_COAL_MASK) = '1'
+        then
+          IRQ_Coal_Mask_i(C_NUM_OF_INTERRUPTS-1 downto 0) <= Regs_WrDin_r2(32+C_NUM_OF_INTERRUPTS-1 downto 32);
+        elsif Regs_WrEn_r2 = '1'
+          and Reg_WrMuxer_Lo(CINT_ADDR_IRQ_COAL_MASK) = '1'
+        then
+          IRQ_Coal_Mask_i(C_NUM_OF_INTERRUPTS-1 downto 0) <= Regs_WrDin_r2(C_NUM_OF_INTERRUPTS-1 downto 0);
+        else
+          IRQ_Coal_Mask_i <= IRQ_Coal_Mask_i;
+        end if;
+      end if;
+    end if;
+  end process;
+
 --  -----------------------------------------------
 --  DDR SDRAM address page
 --  -----------------------------------------------
@@ -1073,6 +1135,41 @@ begin
     end if;
   end process;
 
+-- -------------------------------------------------------
+-- Synchronous output: DMA_us_WBA_i
+--   Descriptor write-back address, kept over channel resets
+  Syn_Output_DMA_us_WBA :
+  process (user_clk)
+  begin
+    if rising_edge(user_clk) then
+      if user_lnk_up = '0' then
+        DMA_us_WBA_i   <= (others => '0');
+        usWBA_is_64b_i <= '0';
+      else
+
+        if Regs_WrEn_r2 = '1' and Reg_WrMuxer_Hi(CINT_ADDR_DMA_US_WBAH) = '1' then
+          DMA_us_WBA_i(C_DBUS_WIDTH-1 downto 32) <= Regs_WrDin_r2(C_DBUS_WIDTH-1 downto 32);
+          usWBA_is_64b_i                         <= WrDin_r2_not_Zero_Hi;
+        elsif Regs_WrEn_r2 = '1' and Reg_WrMuxer_Lo(CINT_ADDR_DMA_US_WBAH) = '1' then
+          DMA_us_WBA_i(C_DBUS_WIDTH-1 downto 32) <= Regs_WrDin_r2(32-1 downto 0);
+          usWBA_is_64b_i                         <= WrDin_r2_not_Zero_Lo;
+        else
+          DMA_us_WBA_i(C_DBUS_WIDTH-1 downto 32) <= DMA_us_WBA_i(C_DBUS_WIDTH-1 downto 32);
+          usWBA_is_64b_i                         <= usWBA_is_64b_i;
+        end if;
+
+        if Regs_WrEn_r2 = '1' and Reg_WrMuxer_Hi(CINT_ADDR_DMA_US_WBAL) = '1' then
+          DMA_us_WBA_i(32-1 downto 0) <= Regs_WrDin_r2(C_DBUS_WIDTH-1 downto 32);
+        elsif Regs_WrEn_r2 = '1' and Reg_WrMuxer_Lo(CINT_ADDR_DMA_US_WBAL) = '1' then
+          DMA_us_WBA_i(32-1 downto 0) <= Regs_WrDin_r2(32-1 downto 0);
+        else
+          DMA_us_WBA_i(32-1 downto 0) <= DMA_us_WBA_i(32-1 downto 0);
+        end if;
+
+      end if;
+    end if;
+  end process;
+
 -- -------------------------------------------------------
 -- Synchronous Registered: DMA_us_Length_i
   RxTrn_DMA_us_Length :
@@ -1916,7 +2013,12 @@ begin
 
 -- -------------------------------------------------------
 --
-  Sys_Int_Status_i <= (
+  Sys_Int_Status_i(C_DBUS_WIDTH-1 downto CINT_BIT_USR_IRQ_BOT+C_NUM_OF_USR_IRQ) <= (others => '0');
+
+  -- User interrupts, level sensitive
+  Sys_Int_Status_i(CINT_BIT_USR_IRQ_BOT+C_NUM_OF_USR_IRQ-1 downto CINT_BIT_USR_IRQ_BOT) <= Usr_IRQ_Req;
+
+  Sys_Int_Status_i(CINT_BIT_USR_IRQ_BOT-1 downto 0) <= (
     CINT_BIT_TX_DDR_TOUT_ISR => tx_timeout,
     CINT_BIT_TX_WB_TOUT_ISR  => tx_wb_timeout,
 
@@ -1960,6 +2062,15 @@ begin
  <= DMA_us_BDA_i(C_DBUS_WIDTH/2-1 downto 0) when Reg_RdMuxer_Hi(CINT_ADDR_DMA_US_BDAL) = '1'
     else (others => '0');
 
+  --  Descriptor Write-back Address
+  DMA_us_WBA_o_Hi(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2)
+ <= DMA_us_WBA_i(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2) when Reg_RdMuxer_Hi(CINT_ADDR_DMA_US_WBAH) = '1'
+    else (others => '0');
+
+  DMA_us_WBA_o_Hi(C_DBUS_WIDTH/2-1 downto 0)
+ <= DMA_us_WBA_i(C_DBUS_WIDTH/2-1 downto 0) when Reg_RdMuxer_Hi(CINT_ADDR_DMA_US_WBAL) = '1'
+    else (others => '0');
+
   --  Length
   DMA_us_Length_o_Hi(32-1 downto 0)
  <= DMA_us_Length_i(32-1 downto 0) when Reg_RdMuxer_Hi(CINT_ADDR_DMA_US_LENG) = '1'
@@ -2007,6 +2118,15 @@ begin
  <= DMA_us_BDA_i(C_DBUS_WIDTH/2-1 downto 0) when Reg_RdMuxer_Lo(CINT_ADDR_DMA_US_BDAL) = '1'
     else (others => '0');
 
+  --  Descriptor Write-back Address
+  DMA_us_WBA_o_Lo(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2)
+ <= DMA_us_WBA_i(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2) when Reg_RdMuxer_Lo(CINT_ADDR_DMA_US_WBAH) = '1'
+    else (others => '0');
+
+  DMA_us_WBA_o_Lo(C_DBUS_WIDTH/2-1 downto 0)
+ <= DMA_us_WBA_i(C_DBUS_WIDTH/2-1 downto 0) when Reg_RdMuxer_Lo(CINT_ADDR_DMA_US_WBAL) = '1'
+    else (others => '0');
+
   --  Length
   DMA_us_Length_o_Lo(32-1 downto 0)
  <= DMA_us_Length_i(32-1 downto 0) when Reg_RdMuxer_Lo(CINT_ADDR_DMA_US_LENG) = '1'
@@ -2144,6 +2264,25 @@ begin
  <= Sys_Int_Enable_i(32-1 downto 0) when Reg_RdMuxer_Lo(CINT_ADDR_IRQ_EN) = '1'
     else (others => '0');
 
+  --------------------------------------------------------------------------
+  -- MSI Coalescing
+  --------------------------------------------------------------------------
+  IRQ_Coal_Ctrl_o_Hi
+ <= IRQ_Coal_Ctrl_i when Reg_RdMuxer_Hi(CINT_ADDR_IRQ_COAL_CTRL) = '1'
+    else (others => '0');
+
+  IRQ_Coal_Mask_o_Hi
+ <= IRQ_Coal_Mask_i when Reg_RdMuxer_Hi(CINT_ADDR_IRQ_COAL_MASK) = '1'
+    else (others => '0');
+
+  IRQ_Coal_Ctrl_o_Lo
+ <= IRQ_Coal_Ctrl_i when Reg_RdMuxer_Lo(CINT_ADDR_IRQ_COAL_CTRL) = '1'
+    else (others => '0');
+
+  IRQ_Coal_Mask_o_Lo
+ <= IRQ_Coal_Mask_i when Reg_RdMuxer_Lo(CINT_ADDR_IRQ_COAL_MASK) = '1'
+    else (others => '0');
+
   -- ----------------------------------------------------------------------------------
   -- ----------------------------------------------------------------------------------
   Gen_IG_Read : if IMP_INT_GENERATOR generate
@@ -2297,12 +2436,16 @@ begin
   
           or Sys_Int_Status_o_Hi (32-1 downto 0)
           or Sys_Int_Enable_o_Hi (32-1 downto 0)
+          or IRQ_Coal_Ctrl_o_Hi (32-1 downto 0)
+          or IRQ_Coal_Mask_o_Hi (32-1 downto 0)
   
           or DMA_us_PA_o_Hi (32-1 downto 0)
           or DMA_us_HA_o_Hi (C_DBUS_WIDTH-1 downto 32)
           or DMA_us_HA_o_Hi (32-1 downto 0)
           or DMA_us_BDA_o_Hi (C_DBUS_WIDTH-1 downto 32)
           or DMA_us_BDA_o_Hi (32-1 downto 0)
+          or DMA_us_WBA_o_Hi (C_DBUS_WIDTH-1 downto 32)
+          or DMA_us_WBA_o_Hi (32-1 downto 0)
           or DMA_us_Length_o_Hi (32-1 downto 0)
           or DMA_us_Control_o_Hi (32-1 downto 0)
           or DMA_us_Status_o_Hi (32-1 downto 0)
@@ -2333,12 +2476,16 @@ begin
   
           or Sys_Int_Status_o_Lo (32-1 downto 0)
           or Sys_Int_Enable_o_Lo (32-1 downto 0)
+          or IRQ_Coal_Ctrl_o_Lo (32-1 downto 0)
+          or IRQ_Coal_Mask_o_Lo (32-1 downto 0)
   
           or DMA_us_PA_o_Lo (32-1 downto 0)
           or DMA_us_HA_o_Lo (C_DBUS_WIDTH-1 downto 32)
           or DMA_us_HA_o_Lo (32-1 downto 0)
           or DMA_us_BDA_o_Lo (C_DBUS_WIDTH-1 downto 32)
           or DMA_us_BDA_o_Lo (32-1 downto 0)
+          or DMA_us_WBA_o_Lo (C_DBUS_WIDTH-1 downto 32)
+          or DMA_us_WBA_o_Lo (32-1 downto 0)
           or DMA_us_Length_o_Lo (32-1 downto 0)
           or DMA_us_Control_o_Lo (32-1 downto 0)
           or DMA_us_Status_o_Lo (32-1 downto 0)
@@ -88,6 +88,8 @@ entity rx_CplD_Transact is
     Regs_WrMask : out std_logic_vector(2-1 downto 0);
     Regs_WrAddr : out std_logic_vector(C_EP_AWIDTH-1 downto 0);
     Regs_WrDin  : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    -- '1': the beat belongs to an upstream descriptor
+    Regs_WrDex_us : out std_logic;
 
     -- DDR write port
     ddr_s2mm_cmd_tvalid : out STD_LOGIC;
@@ -220,6 +222,7 @@ architecture Behavioral of rx_CplD_Transact is
   signal Regs_WrMask_i : std_logic_vector(2-1 downto 0);
   signal Regs_WrAddr_i : std_logic_vector(C_EP_AWIDTH-1 downto 0);
   signal Regs_WrDin_i  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal Regs_WrDex_us_i : std_logic;
 
   --  Calculation @ trn_rsof_n=0
   signal Reg_WrAddr_if_last_us : std_logic_vector(C_EP_AWIDTH-1 downto 0);
@@ -257,7 +260,8 @@ architecture Behavioral of rx_CplD_Transact is
   signal RegAddr_us_Dex : std_logic_vector(C_EP_AWIDTH-1 downto 0);
   signal RegAddr_ds_Dex : std_logic_vector(C_EP_AWIDTH-1 downto 0);
 
-  signal CplD_Tag_on_Dex : std_logic;
+  signal CplD_Tag_on_Dex   : std_logic;
+  signal CplD_Tag_on_usDex : std_logic;
 
   -- ----------------------------------------------------------------------
   signal Req_ID_Match_i    : std_logic;
@@ -421,6 +425,7 @@ begin
   Regs_WrMask <= Regs_WrMask_i;
   Regs_WrAddr <= Regs_WrAddr_i;
   Regs_WrDin  <= Regs_WrDin_i;
+  Regs_WrDex_us <= Regs_WrDex_us_i;
 
   ---  Dex Tag output to us DMA channel
   usDMA_dex_Tag <= usDMA_dex_Tag_i;
@@ -907,8 +912,15 @@ begin
   begin
     if rising_edge(user_clk) then
       if user_reset = '1' then
-        CplD_Tag_on_Dex <= '0';
+        CplD_Tag_on_Dex   <= '0';
+        CplD_Tag_on_usDex <= '0';
       else
+        if CplD_Tag(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) = C_TAG0_DMA_USB(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) then
+          CplD_Tag_on_usDex <= '1';
+        else
+          CplD_Tag_on_usDex <= '0';
+        end if;
+
         if CplD_Tag(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) = C_TAG0_DMA_USB(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) then
           CplD_Tag_on_Dex <= '1';
         elsif CplD_Tag(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) = C_TAG0_DMA_DSB(C_TAG_WIDTH-1 downto C_TAG_WIDTH-C_TAG_DECODE_BITS) then
@@ -931,7 +943,9 @@ begin
         Regs_WrEn_i   <= '0';
         Regs_WrMask_i <= (others => '0');
         Regs_WrDin_i  <= (others => '0');
+        Regs_WrDex_us_i <= '0';
       else
+        Regs_WrDex_us_i <= CplD_Tag_on_usDex;
         case RxCplDTrn_State is
           when ST_CplD_AFetch =>
             if CplD_Tag_on_Dex = '1' then
@@ -136,6 +136,7 @@ entity rx_Transact is
     DMA_us_Control    : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     usDMA_BDA_eq_Null : in  std_logic;
     us_MWr_Param_Vec  : in  std_logic_vector(6-1 downto 0);
+    DMA_us_WBA        : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     DMA_us_Status     : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
     DMA_us_Done       : out std_logic;
     DMA_us_Busy       : out std_logic;
@@ -144,6 +145,7 @@ entity rx_Transact is
     -- Calculation in advance, for better timing
     usHA_is_64b  : in std_logic;
     usBDA_is_64b : in std_logic;
+    usWBA_is_64b : in std_logic;
 
     -- Calculation in advance, for better timing
     usLeng_Hi19b_True : in std_logic;
@@ -160,7 +162,9 @@ entity rx_Transact is
     MRd_Channel_Rst : in std_logic;
 
     -- to Interrupt module
-    Sys_IRQ : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    Sys_IRQ       : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    IRQ_Coal_Ctrl : in std_logic_vector(32-1 downto 0);
+    IRQ_Coal_Mask : in std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
 
     -- Event Buffer write port
     wb_FIFO_we   : out std_logic;
@@ -280,6 +284,36 @@ architecture Behavioral of rx_Transact is
 
   --transmission ready signals from CplD, MWr
   signal cpld_ready, mwr_ready : std_logic;
+
+  -- Registers write port A, for collision check
+  signal Regs_WrEn0_i   : std_logic;
+  signal Regs_WrAddr0_i : std_logic_vector(C_EP_AWIDTH-1 downto 0);
+
+  -- Descriptor beats from the CplD channel
+  signal CplD_Regs_WrEn    : std_logic;
+  signal CplD_Regs_WrMask  : std_logic_vector(2-1 downto 0);
+  signal CplD_Regs_WrAddr  : std_logic_vector(C_EP_AWIDTH-1 downto 0);
+  signal CplD_Regs_WrDin   : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal CplD_Regs_WrDex_us : std_logic;
+  signal CplD_Regs_Pass    : std_logic;
+  signal Regs_PortA_Idle   : std_logic;
+
+  -- Descriptor prefetch of the DMA channels
+  signal usDex_WrEn    : std_logic;
+  signal usDex_Pf_Busy : std_logic;
+  signal usDex_Rpl_Req  : std_logic;
+  signal usDex_Rpl_Ack  : std_logic;
+  signal usDex_Rpl_Mask : std_logic_vector(2-1 downto 0);
+  signal usDex_Rpl_Addr : std_logic_vector(C_EP_AWIDTH-1 downto 0);
+  signal usDex_Rpl_Din  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+
+  signal dsDex_WrEn    : std_logic;
+  signal dsDex_Pf_Busy : std_logic;
+  signal dsDex_Rpl_Req  : std_logic;
+  signal dsDex_Rpl_Ack  : std_logic;
+  signal dsDex_Rpl_Mask : std_logic_vector(2-1 downto 0);
+  signal dsDex_Rpl_Addr : std_logic_vector(C_EP_AWIDTH-1 downto 0);
+  signal dsDex_Rpl_Din  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   
 begin
 
@@ -290,6 +324,39 @@ begin
   ddr_s2mm_tkeep <= cpld_s2mm_tkeep when cpld_s2mm_tvalid = '1' else mwr_s2mm_tkeep;
   ddr_s2mm_tlast <= cpld_s2mm_tlast when cpld_s2mm_tvalid = '1' else mwr_s2mm_tlast;
 
+  -- ------------------------------------------------
+  -- Registers write port B: descriptor CplD beats, or the replay of
+  --   a prefetched descriptor. Beats of a descriptor batch are kept by
+  --   the prefetch buffer of the channel. Replays take the free cycles
+  --   of both ports, upstream first.
+  --
+  Regs_WrEn0   <= Regs_WrEn0_i;
+  Regs_WrAddr0 <= Regs_WrAddr0_i;
+
+  usDex_WrEn <= CplD_Regs_WrEn and CplD_Regs_WrDex_us;
+  dsDex_WrEn <= CplD_Regs_WrEn and not CplD_Regs_WrDex_us;
+
+  CplD_Regs_Pass <= (usDex_WrEn and not usDex_Pf_Busy)
+                    or (dsDex_WrEn and not dsDex_Pf_Busy);
+
+  Regs_PortA_Idle <= '1' when Regs_WrEn0_i = '0' and Regs_WrAddr0_i = C_ALL_ONES(C_EP_AWIDTH-1 downto 0)
+                     else '0';
+
+  usDex_Rpl_Ack <= usDex_Rpl_Req and Regs_PortA_Idle and not CplD_Regs_Pass;
+  dsDex_Rpl_Ack <= dsDex_Rpl_Req and Regs_PortA_Idle and not CplD_Regs_Pass and not usDex_Rpl_Req;
+
+  Regs_WrEn1   <= CplD_Regs_Pass or usDex_Rpl_Ack or dsDex_Rpl_Ack;
+  Regs_WrMask1 <= usDex_Rpl_Mask when usDex_Rpl_Ack = '1' else
+                  dsDex_Rpl_Mask when dsDex_Rpl_Ack = '1' else
+                  CplD_Regs_WrMask;
+  Regs_WrAddr1 <= usDex_Rpl_Addr when usDex_Rpl_Ack = '1' else
+                  dsDex_Rpl_Addr when dsDex_Rpl_Ack = '1' else
+                  CplD_Regs_WrAddr;
+  Regs_WrDin1  <= usDex_Rpl_Din when usDex_Rpl_Ack = '1' else
+                  dsDex_Rpl_Din when dsDex_Rpl_Ack = '1' else
+                  CplD_Regs_WrDin when CplD_Regs_Pass = '1' else
+                  (others => '0');
+
   wb_FIFO_we   <= wb_FIFO_we_i;
   wb_FIFO_wsof <= wb_FIFO_wsof_i;
   wb_FIFO_weof <= wb_FIFO_weof_i;
@@ -428,9 +495,9 @@ begin
         wb_fifo_full => wb_fifo_full,
 
         -- To registers module
-        Regs_WrEn   => Regs_WrEn0 ,     -- OUT std_logic;
+        Regs_WrEn   => Regs_WrEn0_i ,   -- OUT std_logic;
         Regs_WrMask => Regs_WrMask0 ,   -- OUT std_logic_vector(2-1 downto 0);
-        Regs_WrAddr => Regs_WrAddr0 ,   -- OUT std_logic_vector(16-1 downto 0);
+        Regs_WrAddr => Regs_WrAddr0_i , -- OUT std_logic_vector(16-1 downto 0);
         Regs_WrDin  => Regs_WrDin0 ,    -- OUT std_logic_vector(32-1 downto 0);
 
         -- DDR write port
@@ -504,10 +571,11 @@ begin
         wb_fifo_full => wb_fifo_full,
 
         -- To registers module
-        Regs_WrEn   => Regs_WrEn1,      -- OUT std_logic;
-        Regs_WrMask => Regs_WrMask1,    -- OUT std_logic_vector(2-1 downto 0);
-        Regs_WrAddr => Regs_WrAddr1,    -- OUT std_logic_vector(16-1 downto 0);
-        Regs_WrDin  => Regs_WrDin1,     -- OUT std_logic_vector(32-1 downto 0);
+        Regs_WrEn     => CplD_Regs_WrEn,     -- OUT std_logic;
+        Regs_WrMask   => CplD_Regs_WrMask,   -- OUT std_logic_vector(2-1 downto 0);
+        Regs_WrAddr   => CplD_Regs_WrAddr,   -- OUT std_logic_vector(16-1 downto 0);
+        Regs_WrDin    => CplD_Regs_WrDin,    -- OUT std_logic_vector(32-1 downto 0);
+        Regs_WrDex_us => CplD_Regs_WrDex_us, -- OUT std_logic;
 
         -- DDR write port
         ddr_s2mm_cmd_tvalid => cpld_s2mm_cmd_tvalid,
@@ -568,16 +636,29 @@ begin
         DMA_us_Control    => DMA_us_Control,  -- IN  std_logic_vector(31 downto 0);
         usDMA_BDA_eq_Null => usDMA_BDA_eq_Null,  -- IN  std_logic;
         us_MWr_Param_Vec  => us_MWr_Param_Vec,  -- IN  std_logic_vector(5 downto 0);
+        DMA_us_WBA        => DMA_us_WBA,  -- IN  std_logic_vector(63 downto 0);
 
         -- Calculation in advance, for better timing
         usHA_is_64b  => usHA_is_64b ,   -- IN  std_logic;
         usBDA_is_64b => usBDA_is_64b ,  -- IN  std_logic;
+        usWBA_is_64b => usWBA_is_64b ,  -- IN  std_logic;
 
         usLeng_Hi19b_True => usLeng_Hi19b_True ,  --  IN  std_logic;
         usLeng_Lo7b_True  => usLeng_Lo7b_True ,   --  IN  std_logic;
 
         usDMA_dex_Tag => usDMA_dex_Tag ,  -- OUT std_logic_vector( 7 downto 0);
 
+        -- Descriptor prefetch
+        Dex_WrEn     => usDex_WrEn ,        -- IN  std_logic;
+        Dex_WrMask   => CplD_Regs_WrMask ,  -- IN  std_logic_vector(2-1 downto 0);
+        Dex_WrDin    => CplD_Regs_WrDin ,   -- IN  std_logic_vector(63 downto 0);
+        Dex_Pf_Busy  => usDex_Pf_Busy ,     -- OUT std_logic;
+        Dex_Rpl_Req  => usDex_Rpl_Req ,     -- OUT std_logic;
+        Dex_Rpl_Ack  => usDex_Rpl_Ack ,     -- IN  std_logic;
+        Dex_Rpl_Mask => usDex_Rpl_Mask ,    -- OUT std_logic_vector(2-1 downto 0);
+        Dex_Rpl_Addr => usDex_Rpl_Addr ,    -- OUT std_logic_vector(C_EP_AWIDTH-1 downto 0);
+        Dex_Rpl_Din  => usDex_Rpl_Din ,     -- OUT std_logic_vector(63 downto 0);
+
         cfg_dcommand => cfg_dcommand ,  -- IN  std_logic_vector(16-1 downto 0)
 
         user_clk => user_clk            -- IN std_logic;
@@ -641,6 +722,17 @@ begin
         -- tag for descriptor
         dsDMA_dex_Tag => dsDMA_dex_Tag,  -- IN  std_logic_vector( 7 downto 0);
 
+        -- Descriptor prefetch
+        Dex_WrEn     => dsDex_WrEn ,        -- IN  std_logic;
+        Dex_WrMask   => CplD_Regs_WrMask ,  -- IN  std_logic_vector(2-1 downto 0);
+        Dex_WrDin    => CplD_Regs_WrDin ,   -- IN  std_logic_vector(63 downto 0);
+        Dex_Pf_Busy  => dsDex_Pf_Busy ,     -- OUT std_logic;
+        Dex_Rpl_Req  => dsDex_Rpl_Req ,     -- OUT std_logic;
+        Dex_Rpl_Ack  => dsDex_Rpl_Ack ,     -- IN  std_logic;
+        Dex_Rpl_Mask => dsDex_Rpl_Mask ,    -- OUT std_logic_vector(2-1 downto 0);
+        Dex_Rpl_Addr => dsDex_Rpl_Addr ,    -- OUT std_logic_vector(C_EP_AWIDTH-1 downto 0);
+        Dex_Rpl_Din  => dsDex_Rpl_Din ,     -- OUT std_logic_vector(63 downto 0);
+
         -- Additional
         cfg_dcommand => cfg_dcommand ,  -- IN  std_logic_vector(16-1 downto 0)
 
@@ -656,6 +748,9 @@ begin
       port map(
         Sys_IRQ => Sys_IRQ ,            -- IN  std_logic_vector(31 downto 0);
 
+        IRQ_Coal_Ctrl => IRQ_Coal_Ctrl ,  -- IN  std_logic_vector(31 downto 0);
+        IRQ_Coal_Mask => IRQ_Coal_Mask ,  -- IN  std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+
         -- Interrupt generator signals
         IG_Reset        => IG_Reset ,   -- IN  std_logic;
         IG_Host_Clear   => IG_Host_Clear ,  -- IN  std_logic;
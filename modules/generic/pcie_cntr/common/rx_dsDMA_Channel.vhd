@@ -65,6 +65,19 @@ entity dsDMA_Transact is
     -- from Cpl/D channel
     dsDMA_dex_Tag : in std_logic_vector(C_TAG_WIDTH-1 downto 0);
 
+    -- Descriptor CplD beats of this channel, to the prefetch buffer
+    Dex_WrEn    : in  std_logic;
+    Dex_WrMask  : in  std_logic_vector(2-1 downto 0);
+    Dex_WrDin   : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    Dex_Pf_Busy : out std_logic;
+
+    -- Prefetched descriptor replay to the registers
+    Dex_Rpl_Req  : out std_logic;
+    Dex_Rpl_Ack  : in  std_logic;
+    Dex_Rpl_Mask : out std_logic_vector(2-1 downto 0);
+    Dex_Rpl_Addr : out std_logic_vector(C_EP_AWIDTH-1 downto 0);
+    Dex_Rpl_Din  : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+
     -- Downstream Control Signals from MWr Channel
     dsDMA_Start : in std_logic;         -- out of 1st dex
     dsDMA_Stop  : in std_logic;         -- out of 1st dex
@@ -148,6 +161,17 @@ architecture Behavioral of dsDMA_Transact is
   signal dsThereIs_Dex    : std_logic;
   signal dsHA64bit        : std_logic;
   signal ds_AInc          : std_logic;
+  signal dsDex_Prefetch   : std_logic;
+
+  -- Descriptor prefetch, replayed beats start one register before PAH
+  constant C_DS_DEX_BASE_ADDR : std_logic_vector(C_EP_AWIDTH-1 downto 0)
+    := CONV_STD_LOGIC_VECTOR(CINT_ADDR_DMA_DS_PAH-1, C_DECODE_BIT_BOT) & "00";
+
+  signal dsDex_Pf_Leng    : std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
+  signal dsDex_Pf_Hit     : std_logic;
+  signal dsDex_Pf_Busy    : std_logic;
+  signal dsDex_Pf_Fetch   : std_logic;
+  signal dsDex_Pf_Pop     : std_logic;
 
   signal Tag_DMA_dsp : std_logic_vector(C_TAG_WIDTH-1 downto 0);
 
@@ -156,6 +180,7 @@ architecture Behavioral of dsDMA_Transact is
   signal dsState_Is_Snout     : std_logic;
   signal dsState_Is_Body      : std_logic;
   signal dsState_Is_Tail      : std_logic;
+  signal dsState_Is_AwaitDex  : std_logic;
 
   signal dsChBuf_ValidRd : std_logic;
   signal dsBDA_nAligned  : std_logic;
@@ -251,6 +276,8 @@ begin
         ThereIs_Dex    => dsThereIs_Dex ,
         HA64bit        => dsHA64bit ,
         Addr_Inc       => ds_AInc ,
+        Dex_Prefetch   => dsDex_Prefetch ,
+        Dex_WBack      => open ,        -- upstream only
 
         DMA_Start  => dsDMA_Start ,
         DMA_Start2 => dsDMA_Start2 ,
@@ -296,6 +323,17 @@ begin
         DMA_BDA_fsm    => dsDMA_BDA_fsm ,
         BDA_is_64b_fsm => dsBDA_is_64b_fsm ,
 
+        Dex_Prefetch => dsDex_Prefetch ,
+        Dex_Pf_Leng  => dsDex_Pf_Leng ,
+        Dex_Pf_Hit   => dsDex_Pf_Hit ,
+        Dex_Pf_Busy  => dsDex_Pf_Busy ,
+        Dex_Pf_Fetch => dsDex_Pf_Fetch ,
+        Dex_Pf_Pop   => dsDex_Pf_Pop ,
+
+        Dex_WBack  => '0' ,
+        DMA_WBA    => C_ALL_ZEROS(C_DBUS_WIDTH-1 downto 0) ,
+        WBA_is_64b => '0' ,
+
         DMA_Snout_Length => dsDMA_Snout_Length ,
         DMA_Body_Length  => dsDMA_Body_Length ,
         DMA_Tail_Length  => dsDMA_Tail_Length ,
@@ -325,6 +363,7 @@ begin
         State_Is_Snout     => dsState_Is_Snout ,
         State_Is_Body      => dsState_Is_Body ,
         State_Is_Tail      => dsState_Is_Tail ,
+        State_Is_AwaitDex  => dsState_Is_AwaitDex ,
 
         DMA_Cmd_Ack => DMA_Cmd_Ack ,
 
@@ -332,6 +371,37 @@ begin
         dma_reset => Local_Reset_i
         );
 
+  -- Descriptor prefetch buffer
+  ds_Dex_Prefetch :
+    entity work.DMA_Dex_Prefetch
+      port map(
+        Dex_Base_Addr => C_DS_DEX_BASE_ADDR ,
+
+        Dex_WrEn   => Dex_WrEn ,
+        Dex_WrMask => Dex_WrMask ,
+        Dex_WrDin  => Dex_WrDin ,
+
+        Pf_BDA            => dsDMA_BDA_fsm ,
+        Pf_Fetch          => dsDex_Pf_Fetch ,
+        Pf_Pop            => dsDex_Pf_Pop ,
+        State_Is_AwaitDex => dsState_Is_AwaitDex ,
+        Pf_Leng           => dsDex_Pf_Leng ,
+        Pf_Hit            => dsDex_Pf_Hit ,
+        Pf_Busy           => dsDex_Pf_Busy ,
+
+        Rpl_Req  => Dex_Rpl_Req ,
+        Rpl_Ack  => Dex_Rpl_Ack ,
+        Rpl_Mask => Dex_Rpl_Mask ,
+        Rpl_Addr => Dex_Rpl_Addr ,
+        Rpl_Din  => Dex_Rpl_Din ,
+
+        DMA_Start => dsDMA_Start ,
+        dma_clk   => user_clk ,
+        dma_reset => Local_Reset_i
+        );
+
+  Dex_Pf_Busy <= dsDex_Pf_Busy;
+
   dsChBuf_ValidRd <= MRd_dsp_RE;  -- MRd_dsp_re_i and not MRd_dsp_empty_i;
 
 -- -------------------------------------------------
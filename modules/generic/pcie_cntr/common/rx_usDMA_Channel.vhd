@@ -57,6 +57,10 @@ entity usDMA_Transact is
     usDMA_BDA_eq_Null : in std_logic;
     us_MWr_Param_Vec  : in std_logic_vector(6-1 downto 0);
 
+    -- Descriptor completion write-back address
+    DMA_us_WBA   : in std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    usWBA_is_64b : in std_logic;
+
     -- Calculation in advance, for better timing
     usHA_is_64b  : in std_logic;
     usBDA_is_64b : in std_logic;
@@ -68,6 +72,19 @@ entity usDMA_Transact is
     -- from Cpl/D channel
     usDMA_dex_Tag : in std_logic_vector(C_TAG_WIDTH-1 downto 0);
 
+    -- Descriptor CplD beats of this channel, to the prefetch buffer
+    Dex_WrEn    : in  std_logic;
+    Dex_WrMask  : in  std_logic_vector(2-1 downto 0);
+    Dex_WrDin   : in  std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+    Dex_Pf_Busy : out std_logic;
+
+    -- Prefetched descriptor replay to the registers
+    Dex_Rpl_Req  : out std_logic;
+    Dex_Rpl_Ack  : in  std_logic;
+    Dex_Rpl_Mask : out std_logic_vector(2-1 downto 0);
+    Dex_Rpl_Addr : out std_logic_vector(C_EP_AWIDTH-1 downto 0);
+    Dex_Rpl_Din  : out std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+
     -- Upstream Control Signals from MWr Channel
     usDMA_Start : in std_logic;         -- out of 1st dex
     usDMA_Stop  : in std_logic;         -- out of 1st dex
@@ -125,12 +142,25 @@ architecture Behavioral of usDMA_Transact is
   signal usThereIs_Dex    : std_logic;
   signal usHA64bit        : std_logic;
   signal us_AInc          : std_logic;
+  signal usDex_Prefetch   : std_logic;
+  signal usDex_WBack      : std_logic;
+
+  -- Descriptor prefetch, replayed beats start one register before PAH
+  constant C_US_DEX_BASE_ADDR : std_logic_vector(C_EP_AWIDTH-1 downto 0)
+    := CONV_STD_LOGIC_VECTOR(CINT_ADDR_DMA_US_PAH-1, C_DECODE_BIT_BOT) & "00";
+
+  signal usDex_Pf_Leng    : std_logic_vector(C_TLP_FLD_WIDTH_OF_LENG+1 downto 0);
+  signal usDex_Pf_Hit     : std_logic;
+  signal usDex_Pf_Busy    : std_logic;
+  signal usDex_Pf_Fetch   : std_logic;
+  signal usDex_Pf_Pop     : std_logic;
 
   -- FSM state indicators
   signal usState_Is_LoadParam : std_logic;
   signal usState_Is_Snout     : std_logic;
   signal usState_Is_Body      : std_logic;
   signal usState_Is_Tail      : std_logic;
+  signal usState_Is_AwaitDex  : std_logic;
 
   signal usChBuf_ValidRd : std_logic;
   signal usBDA_nAligned  : std_logic;
@@ -237,6 +267,8 @@ begin
         ThereIs_Dex    => usThereIs_Dex ,
         HA64bit        => usHA64bit ,
         Addr_Inc       => us_AInc ,
+        Dex_Prefetch   => usDex_Prefetch ,
+        Dex_WBack      => usDex_WBack ,
 
 
         DMA_Start  => usDMA_Start ,
@@ -282,6 +314,17 @@ begin
         DMA_BDA_fsm    => usDMA_BDA_fsm ,
         BDA_is_64b_fsm => usBDA_is_64b_fsm ,
 
+        Dex_Prefetch => usDex_Prefetch ,
+        Dex_Pf_Leng  => usDex_Pf_Leng ,
+        Dex_Pf_Hit   => usDex_Pf_Hit ,
+        Dex_Pf_Busy  => usDex_Pf_Busy ,
+        Dex_Pf_Fetch => usDex_Pf_Fetch ,
+        Dex_Pf_Pop   => usDex_Pf_Pop ,
+
+        Dex_WBack  => usDex_WBack ,
+        DMA_WBA    => DMA_us_WBA ,
+        WBA_is_64b => usWBA_is_64b ,
+
         DMA_Snout_Length => usDMA_Snout_Length ,
         DMA_Body_Length  => usDMA_Body_Length ,
         DMA_Tail_Length  => usDMA_Tail_Length ,
@@ -311,6 +354,7 @@ begin
         State_Is_Snout     => usState_Is_Snout ,
         State_Is_Body      => usState_Is_Body ,
         State_Is_Tail      => usState_Is_Tail ,
+        State_Is_AwaitDex  => usState_Is_AwaitDex ,
 
         DMA_Cmd_Ack => DMA_Cmd_Ack ,
 
@@ -319,6 +363,37 @@ begin
         dma_reset => Local_Reset_i
         );
 
+  -- Descriptor prefetch buffer
+  us_Dex_Prefetch :
+    entity work.DMA_Dex_Prefetch
+      port map(
+        Dex_Base_Addr => C_US_DEX_BASE_ADDR ,
+
+        Dex_WrEn   => Dex_WrEn ,
+        Dex_WrMask => Dex_WrMask ,
+        Dex_WrDin  => Dex_WrDin ,
+
+        Pf_BDA            => usDMA_BDA_fsm ,
+        Pf_Fetch          => usDex_Pf_Fetch ,
+        Pf_Pop            => usDex_Pf_Pop ,
+        State_Is_AwaitDex => usState_Is_AwaitDex ,
+        Pf_Leng           => usDex_Pf_Leng ,
+        Pf_Hit            => usDex_Pf_Hit ,
+        Pf_Busy           => usDex_Pf_Busy ,
+
+        Rpl_Req  => Dex_Rpl_Req ,
+        Rpl_Ack  => Dex_Rpl_Ack ,
+        Rpl_Mask => Dex_Rpl_Mask ,
+        Rpl_Addr => Dex_Rpl_Addr ,
+        Rpl_Din  => Dex_Rpl_Din ,
+
+        DMA_Start => usDMA_Start ,
+        dma_clk   => user_clk ,
+        dma_reset => Local_Reset_i
+        );
+
+  Dex_Pf_Busy <= usDex_Pf_Busy;
+
   usChBuf_ValidRd <= usTlp_RE;          -- usTlp_RE_i and not usTlp_empty_i;
 
 -- -------------------------------------------------
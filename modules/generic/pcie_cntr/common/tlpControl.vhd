@@ -133,6 +133,9 @@ entity tlpControl is
     cfg_interrupt_do         : in  std_logic_vector(7 downto 0);
     cfg_interrupt_assert     : out std_logic;
 
+    -- User interrupt requests, synchronous to user_clk
+    usr_irq_req : in std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0);
+
     -- Local signals
     pcie_link_width : in std_logic_vector(CINT_BIT_LWIDTH_IN_GSR_TOP-CINT_BIT_LWIDTH_IN_GSR_BOT downto 0);
     cfg_dcommand    : in std_logic_vector(16-1 downto 0);
@@ -231,6 +234,7 @@ architecture Behavioral of tlpControl is
   signal DMA_us_Control    : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal usDMA_BDA_eq_Null : std_logic;
   signal us_MWr_Param_Vec  : std_logic_vector(6-1 downto 0);
+  signal DMA_us_WBA        : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Status     : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DMA_us_Done_i     : std_logic;
   signal DMA_us_Busy_i     : std_logic;
@@ -239,6 +243,7 @@ architecture Behavioral of tlpControl is
   -- Calculation in advance, for better timing
   signal usHA_is_64b       : std_logic;
   signal usBDA_is_64b      : std_logic;
+  signal usWBA_is_64b      : std_logic;
   -- Calculation in advance, for better timing
   signal usLeng_Hi19b_True : std_logic;
   signal usLeng_Lo7b_True  : std_logic;
@@ -261,7 +266,9 @@ architecture Behavioral of tlpControl is
   signal Regs_RdAddr : std_logic_vector(C_EP_AWIDTH-1 downto 0);
   signal Regs_RdQout : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   -- Register to Interrupt module
-  signal Sys_IRQ : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal Sys_IRQ       : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal IRQ_Coal_Ctrl : std_logic_vector(32-1 downto 0);
+  signal IRQ_Coal_Mask : std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
   -- Message routing method
   signal Msg_Routing : std_logic_vector(C_GCR_MSG_ROUT_BIT_TOP-C_GCR_MSG_ROUT_BIT_BOT downto 0);
   -- Interrupt Generation Signals
@@ -399,6 +406,7 @@ begin
         DMA_us_Control    => DMA_us_Control ,  -- IN  std_logic_vector(31 downto 0);
         usDMA_BDA_eq_Null => usDMA_BDA_eq_Null ,  -- IN  std_logic;
         us_MWr_Param_Vec  => us_MWr_Param_Vec ,  -- IN  std_logic_vector(6-1   downto 0);
+        DMA_us_WBA        => DMA_us_WBA ,  -- IN  std_logic_vector(63 downto 0);
         DMA_us_Status     => DMA_us_Status ,  -- OUT std_logic_vector(31 downto 0);
         DMA_us_Done       => DMA_us_Done_i ,  -- OUT std_logic;
         DMA_us_Busy       => DMA_us_Busy_i ,  -- OUT std_logic;
@@ -406,6 +414,7 @@ begin
 
         usHA_is_64b  => usHA_is_64b ,   -- IN  std_logic;
         usBDA_is_64b => usBDA_is_64b ,  -- IN  std_logic;
+        usWBA_is_64b => usWBA_is_64b ,  -- IN  std_logic;
 
         usLeng_Hi19b_True => usLeng_Hi19b_True ,  -- IN  std_logic;
         usLeng_Lo7b_True  => usLeng_Lo7b_True ,   -- IN  std_logic;
@@ -422,6 +431,8 @@ begin
 
         -- to Interrupt module
         Sys_IRQ => Sys_IRQ ,            -- IN  std_logic_vector(31 downto 0);
+        IRQ_Coal_Ctrl => IRQ_Coal_Ctrl ,  -- IN  std_logic_vector(31 downto 0);
+        IRQ_Coal_Mask => IRQ_Coal_Mask ,  -- IN  std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
 
         IG_Reset        => IG_Reset ,
         IG_Host_Clear   => IG_Host_Clear ,
@@ -575,12 +586,14 @@ begin
         DMA_us_Control    => DMA_us_Control ,  -- OUT std_logic_vector(31 downto 0);
         usDMA_BDA_eq_Null => usDMA_BDA_eq_Null ,  -- OUT std_logic;
         us_MWr_Param_Vec  => us_MWr_Param_Vec ,  -- OUT std_logic_vector(6-1   downto 0);
+        DMA_us_WBA        => DMA_us_WBA ,  -- OUT std_logic_vector(63 downto 0);
         DMA_us_Status     => DMA_us_Status ,  -- IN  std_logic_vector(31 downto 0);
         DMA_us_Done       => DMA_us_Done_i ,  -- IN  std_logic;
         DMA_us_Tout       => DMA_us_Tout ,    -- IN  std_logic;
 
         usHA_is_64b  => usHA_is_64b ,   -- OUT std_logic;
         usBDA_is_64b => usBDA_is_64b ,  -- OUT std_logic;
+        usWBA_is_64b => usWBA_is_64b ,  -- OUT std_logic;
 
         usLeng_Hi19b_True => usLeng_Hi19b_True ,  -- OUT std_logic;
         usLeng_Lo7b_True  => usLeng_Lo7b_True ,   -- OUT std_logic;
@@ -599,7 +612,10 @@ begin
         ddr_axi_reset => ddr_axi_reset,
 
         -- to Interrupt module
-        Sys_IRQ => Sys_IRQ ,            -- OUT std_logic_vector(31 downto 0);
+        Sys_IRQ       => Sys_IRQ ,        -- OUT std_logic_vector(31 downto 0);
+        IRQ_Coal_Ctrl => IRQ_Coal_Ctrl ,  -- OUT std_logic_vector(31 downto 0);
+        IRQ_Coal_Mask => IRQ_Coal_Mask ,  -- OUT std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0);
+        Usr_IRQ_Req   => usr_irq_req ,    -- IN  std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0);
 
         -- System error and info
         Tx_TimeOut      => Tx_TimeOut ,
@@ -117,6 +117,10 @@ architecture Behavioral of tx_Mem_Reader is
   signal Regs_Hit           : std_logic;
   signal Regs_Write_mbuf_r : std_logic_vector(2 downto 0);
 
+  -- Descriptor write-back, payload carried in StartAddr
+  signal Wback_Hit  : std_logic;
+  signal Wback_Data : std_logic_vector(32-1 downto 0);
+
   -- Wishbone interface
   signal wb_rdc_sof_i              : std_logic;
   signal wb_rdc_v_i                : std_logic;
@@ -141,6 +145,7 @@ architecture Behavioral of tx_Mem_Reader is
   signal wb_FIFO_Dout_wire : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal DDR_Dout_wire     : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal Regs_RdQout_wire  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
+  signal Wback_Dout_wire   : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
   signal mbuf_Din_wire_OR  : std_logic_vector(C_DBUS_WIDTH-1 downto 0);
 
   -- Output port of the memory buffer
@@ -271,6 +276,8 @@ begin
         DDR_FIFO_Hit       <= '0';
         Regs_Hit           <= '0';
         Regs_RdEn          <= '0';
+        Wback_Hit          <= '0';
+        Wback_Data         <= (others => '0');
         regs_Rd_Counter    <= (others => '0');
         DDR_Rd_Counter     <= (others => '0');
         DDR_Rd_Cntr_eq_One <= '0';
@@ -303,6 +310,7 @@ begin
               ddr_fifo_hit    <= '0';
               Regs_Hit        <= '0';
               Regs_RdEn       <= '0';
+              Wback_Hit       <= '0';
               TxTLP_eof_n     <= '1';
               Address_var     <= (others => '1');
               RdCmd_Ack_i     <= '0';
@@ -345,6 +353,19 @@ begin
                 Regs_RdEn       <= '0';
                 Address_var     <= Address_var;
                 TxMReader_State <= St_mR_wb_A;
+              elsif BAR_value(C_ENCODE_BAR_NUMBER-1 downto 0)
+                 = CONV_STD_LOGIC_VECTOR(CINT_WBACK_SPACE_BAR, C_ENCODE_BAR_NUMBER)
+              then
+                -- 1-DW write-back: done flag and completed descriptors.
+                -- Regs_RdEn only times the mbuf write.
+                wb_FIFO_Hit     <= '0';
+                DDR_FIFO_Hit    <= '0';
+                Regs_Hit        <= '0';
+                Regs_RdEn       <= '1';
+                Wback_Hit       <= '1';
+                Wback_Data      <= '1' & StartAddr(31-1 downto 0);
+                Address_var     <= Address_var;
+                TxMReader_State <= St_mR_CmdLatch;
               else
                 wb_FIFO_Hit     <= '0';
                 DDR_FIFO_Hit    <= '0';
@@ -716,7 +737,13 @@ begin
   Regs_RdQout_wire <= (Regs_RdQout(C_DBUS_WIDTH/2-1 downto 0) & Regs_RdQout(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2))  --watch out!
                            when Regs_Hit = '1' else (others => '0');
 
-  mbuf_Din_wire_OR <= wb_FIFO_Dout_wire or DDR_Dout_wire or Regs_RdQout_wire;
+  Wback_Dout_wire  <= (Wback_Data & C_ALL_ZEROS(C_DBUS_WIDTH/2-1 downto 0))
+                           when Wback_Hit = '1' and Shift_1st_QWord_k = '1'
+                           else (C_ALL_ZEROS(C_DBUS_WIDTH-1 downto C_DBUS_WIDTH/2) & Wback_Data)
+                           when Wback_Hit = '1'
+                           else (others => '0');
+
+  mbuf_Din_wire_OR <= wb_FIFO_Dout_wire or DDR_Dout_wire or Regs_RdQout_wire or Wback_Dout_wire;
 
 -----------------------------------------------------
 -- Synchronous Delay: mbuf_WE
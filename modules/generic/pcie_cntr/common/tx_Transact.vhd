@@ -751,6 +751,11 @@ begin
               StartAddr       <= C_ALL_ZEROS(C_DBUS_WIDTH-1 downto C_WB_AWIDTH) & WBAddr_usTlp;
               Shift_1st_QWord <= not usTlp_Qout_to_TLP(C_TLP_FMT_BIT_BOT);
               is_CplD         <= '0';
+            elsif BAR_usTlp = CONV_STD_LOGIC_VECTOR(CINT_WBACK_SPACE_BAR, C_ENCODE_BAR_NUMBER) then
+              BAR_value       <= BAR_usTlp(C_ENCODE_BAR_NUMBER-1 downto 0);
+              StartAddr       <= C_ALL_ZEROS(C_DBUS_WIDTH-1 downto C_PRAM_AWIDTH+2) & mAddr_usTlp;
+              Shift_1st_QWord <= not usTlp_Qout_to_TLP(C_TLP_FMT_BIT_BOT);
+              is_CplD         <= '0';
             else
               BAR_value <= '0' & BAR_pioCplD(C_ENCODE_BAR_NUMBER-2 downto 0);
               StartAddr <= (C_ALL_ZEROS(C_DBUS_WIDTH-1 downto C_EP_AWIDTH) & Regs_Addr_pioCplD);
@@ -1075,7 +1080,9 @@ begin
       us_DMA_Bytes_i <= '0' & s_axis_tx_tdata_i(C_TLP_FLD_WIDTH_OF_LENG-1 downto 0) & "00";
       if s_axis_tx_tdata_i(C_TLP_FMT_BIT_TOP) = '1'
         and s_axis_tx_tdata_i(C_TLP_TYPE_BIT_TOP downto C_TLP_TYPE_BIT_BOT)
-         = C_ALL_ZEROS(C_TLP_TYPE_BIT_TOP downto C_TLP_TYPE_BIT_BOT) then
+         = C_ALL_ZEROS(C_TLP_TYPE_BIT_TOP downto C_TLP_TYPE_BIT_BOT)
+        and BAR_value /= CONV_STD_LOGIC_VECTOR(CINT_WBACK_SPACE_BAR, C_ENCODE_BAR_NUMBER)  -- not DMA data
+      then
         us_DMA_Bytes_Add_i <= not trn_tsof_n_i
                               and s_axis_tx_tvalid_i
                               and s_axis_tx_tready_i;
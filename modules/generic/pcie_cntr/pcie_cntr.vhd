@@ -118,6 +118,9 @@ entity pcie_cntr is
     SEL_O : out std_logic;
     CYC_O : out std_logic;
     --/ Wishbone interface
+    -- User interrupt requests, level sensitive, any clock domain.
+    -- Mapped to IRQ status bits CINT_BIT_USR_IRQ_BOT and up.
+    usr_irq_req_i : in std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     pcie_user_clk : out std_logic;
     ext_rst_o : out std_logic;
@@ -320,6 +323,9 @@ architecture Behavioral of pcie_cntr is
   signal localId         : std_logic_vector(15 downto 0);
   signal pcie_link_width : std_logic_vector(5 downto 0);
 
+  signal usr_irq_req_r1 : std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0);
+  signal usr_irq_req_r2 : std_logic_vector(C_NUM_OF_USR_IRQ-1 downto 0);
+
 begin
 
   sys_reset_c <= not pci_sys_rst_n;
@@ -712,6 +718,8 @@ theTlpControl: entity work.tlpControl
   cfg_interrupt_do         => cfg_interrupt_do ,
   cfg_interrupt_assert     => cfg_interrupt_assert ,
 
+  usr_irq_req => usr_irq_req_r2 ,
+
   m_axis_rx_tbar_hit => m_axis_rx_tbar_hit ,
   s_axis_tx_tvalid   => s_axis_tx_tvalid ,
   m_axis_rx_tready   => m_axis_rx_tready ,
@@ -884,5 +892,15 @@ Wishbone_intf: entity work.wb_transact
 
   pcie_user_clk <= user_clk;
 
+  -- User interrupts to user_clk domain
+  usr_irq_sync :
+  process (user_clk)
+  begin
+    if rising_edge(user_clk) then
+      usr_irq_req_r1 <= usr_irq_req_i;
+      usr_irq_req_r2 <= usr_irq_req_r1;
+    end if;
+  end process;
+
 
 end Behavioral;
@@ -430,6 +430,11 @@ package abb64Package is
   --  Maximum 8 DW for the CplD carrying next BDA
   constant C_NEXT_BD_LENG_MSB : integer := 3;
 
+  --  Descriptors fetched by one MRd when prefetch is on. 4*32 bytes is the
+  --  smallest Max_Read_Request_Size, so the request is always legal.
+  constant C_DEX_PREF_BITS  : integer := 2;
+  constant C_DEX_PREF_DEPTH : integer := 2**C_DEX_PREF_BITS;
+
   ------------------------------------------------------------------------
   --  To determine the max.size parameters, 6 bits are used.
   constant C_MAXSIZE_FLD_BIT_TOP : integer := C_TLP_FLD_WIDTH_OF_LENG +2;
@@ -452,6 +457,10 @@ package abb64Package is
   constant CINT_REGS_SPACE_BAR : integer := 0;
   constant CINT_FIFO_SPACE_BAR : integer := 4;
   constant CINT_DDR_SPACE_BAR  : integer := 2;
+  --  Pseudo BAR of the descriptor write-back MWr, whose payload is carried
+  --  in the channel buffer. Must not match the real BARs nor the all-ones
+  --  idle value of the Tx BAR latches.
+  constant CINT_WBACK_SPACE_BAR : integer := 5;
   ------------------------------------------------------------------------
 
   ----------------------------------------------------------------------------------
@@ -478,6 +487,18 @@ package abb64Package is
   --        Maximal number of Interrupts
   constant C_NUM_OF_INTERRUPTS : integer := 16;
 
+  --        User interrupt requests, on the upper bits of the IRQ status
+  constant C_NUM_OF_USR_IRQ       : integer := 8;
+  constant CINT_BIT_USR_IRQ_BOT   : integer := 8;
+
+  --        MSI coalescing control: events per message and timeout, the
+  --        latter in units of 2**C_IRQ_COAL_TICK_BITS user clock cycles
+  constant CINT_BIT_IRQ_COAL_CNT_TOP  : integer := 15;
+  constant CINT_BIT_IRQ_COAL_CNT_BOT  : integer := 0;
+  constant CINT_BIT_IRQ_COAL_TOUT_TOP : integer := 31;
+  constant CINT_BIT_IRQ_COAL_TOUT_BOT : integer := 16;
+  constant C_IRQ_COAL_TICK_BITS       : integer := 10;
+
   ------------------------------------------------------------------------
   -- Minimal register set
   constant CINT_ADDR_VERSION : integer := 0;
@@ -559,9 +580,17 @@ package abb64Package is
   --------  Downstream DMA transferred byte count (R)
   constant CINT_ADDR_DS_TRANSF_BC : integer := 38;
 
+  --------  Upstream DMA descriptor write-back address (W+R)
+  constant CINT_ADDR_DMA_US_WBAH : integer := 39;
+  constant CINT_ADDR_DMA_US_WBAL : integer := 40;
+
+  --------  MSI coalescing control (W+R) and source mask (W+R)
+  constant CINT_ADDR_IRQ_COAL_CTRL : integer := 41;
+  constant CINT_ADDR_IRQ_COAL_MASK : integer := 42;
+
   ------------------------------------------------------------------------
   --        Number of registers
-  constant C_NUM_OF_ADDRESSES : integer := 39;
+  constant C_NUM_OF_ADDRESSES : integer := 43;
   --
   ------------------------------------------------------------------------
 
@@ -570,6 +599,8 @@ package abb64Package is
   --
   constant CINT_BIT_DMA_CTRL_VALID : integer := 25;
   constant CINT_BIT_DMA_CTRL_LAST  : integer := 24;
+  constant CINT_BIT_DMA_CTRL_WBACK : integer := 22;
+  constant CINT_BIT_DMA_CTRL_PREF  : integer := 21;
   constant CINT_BIT_DMA_CTRL_UPA   : integer := 20;
   constant CINT_BIT_DMA_CTRL_AINC  : integer := 15;
   constant CINT_BIT_DMA_CTRL_END   : integer := 08;
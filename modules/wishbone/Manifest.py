@@ -23,4 +23,5 @@ modules = { "local" : [
                         "wb_evt_cnt",
                         "wb_master_uart",
                         "wb_si57x_ctrl",
+                        "wb_iir_filt",
                       ] };
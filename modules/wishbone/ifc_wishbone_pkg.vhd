@@ -1005,7 +1005,10 @@ package ifc_wishbone_pkg is
     g_fifo_fc_size                            : natural := 64;
     g_sim_readback                            : boolean := false;
     g_ddr_interface_type                      : string  := "AXIS";
-    g_max_burst_size                          : natural := 4
+    g_max_burst_size                          : natural := 4;
+    g_max_outstanding_bursts                  : natural := 8;
+    g_decim_max_avg_order_sel                 : natural := 0;
+    g_with_delta_comp                         : boolean := false
   );
   port
   (
@@ -1140,7 +1143,10 @@ package ifc_wishbone_pkg is
     g_fifo_fc_size                            : natural := 64;
     g_sim_readback                            : boolean := false;
     g_ddr_interface_type                      : string  := "AXIS";
-    g_max_burst_size                          : natural := 4
+    g_max_burst_size                          : natural := 4;
+    g_max_outstanding_bursts                  : natural := 8;
+    g_decim_max_avg_order_sel                 : natural := 0;
+    g_with_delta_comp                         : boolean := false
   );
   port
   (
@@ -1687,7 +1693,10 @@ package ifc_wishbone_pkg is
     g_sim_readback                            : boolean := false;
     g_acq_num_cores                           : natural := 2;
     g_ddr_interface_type                      : string  := "AXIS";
-    g_max_burst_size                          : natural := 4
+    g_max_burst_size                          : natural := 4;
+    g_max_outstanding_bursts                  : natural := 8;
+    g_decim_max_avg_order_sel                 : natural := 0;
+    g_with_delta_comp                         : boolean := false
   );
   port
   (
@@ -1814,7 +1823,10 @@ package ifc_wishbone_pkg is
     g_sim_readback                            : boolean := false;
     g_acq_num_cores                           : natural := 2;
     g_ddr_interface_type                      : string  := "AXIS";
-    g_max_burst_size                          : natural := 4
+    g_max_burst_size                          : natural := 4;
+    g_max_outstanding_bursts                  : natural := 8;
+    g_decim_max_avg_order_sel                 : natural := 0;
+    g_with_delta_comp                         : boolean := false
   );
   port
   (
@@ -1972,6 +1984,8 @@ package ifc_wishbone_pkg is
     wb_ma_rty_i                               : in  std_logic                                             := '0';
     wb_ma_ack_i                               : in  std_logic                                             := '0';
     wb_ma_stall_i                             : in  std_logic                                             := '0';
+    -- User interrupt requests, level sensitive
+    usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                          : out std_logic;
     pcie_clk_o                                : out std_logic;
@@ -2032,6 +2046,8 @@ package ifc_wishbone_pkg is
     wb_ma_i                                   : in  t_wishbone_master_in := cc_dummy_slave_out;
     wb_ma_o                                   : out t_wishbone_master_out;
 
+    -- User interrupt requests, level sensitive
+    usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                          : out std_logic;
     pcie_clk_o                                : out std_logic;
@@ -2131,6 +2147,8 @@ package ifc_wishbone_pkg is
     wb_ma_rty_i                               : in  std_logic                                             := '0';
     wb_ma_ack_i                               : in  std_logic                                             := '0';
     wb_ma_stall_i                             : in  std_logic                                             := '0';
+    -- User interrupt requests, level sensitive
+    usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                          : out std_logic;
     pcie_clk_o                                : out std_logic;
@@ -2191,6 +2209,8 @@ package ifc_wishbone_pkg is
     wb_ma_i                                   : in  t_wishbone_master_in := cc_dummy_slave_out;
     wb_ma_o                                   : out t_wishbone_master_out;
 
+    -- User interrupt requests, level sensitive
+    usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                          : out std_logic;
     pcie_clk_o                                : out std_logic;
@@ -2334,7 +2354,8 @@ package ifc_wishbone_pkg is
     g_sync_edge                               : string                         := "positive";
     g_trig_num                                : natural range 1 to 24          := 8;
     g_intern_num                              : natural range 1 to 24          := 8;
-    g_rcv_intern_num                          : natural range 1 to 24          := 2);
+    g_rcv_intern_num                          : natural range 1 to 24          := 2;
+    g_seq_size                                : natural range 2 to 256         := 256);
   port (
     clk_i                                     : in    std_logic;
     rst_n_i                                   : in    std_logic;
@@ -2367,7 +2388,8 @@ package ifc_wishbone_pkg is
     g_sync_edge                               : string                         := "positive";
     g_trig_num                                : natural range 1 to 24          := 8;
     g_intern_num                              : natural range 1 to 24          := 8;
-    g_rcv_intern_num                          : natural range 1 to 24          := 2);
+    g_rcv_intern_num                          : natural range 1 to 24          := 2;
+    g_seq_size                                : natural range 2 to 256         := 256);
   port (
     rst_n_i                                   : in    std_logic;
     clk_i                                     : in    std_logic;
@@ -2389,7 +2411,9 @@ package ifc_wishbone_pkg is
     g_address_granularity                     : t_wishbone_address_granularity := WORD;
     g_sync_edge                               : string                         := "positive";
     g_trig_num                                : natural range 1 to 24          := 8; -- channels facing outside the FPGA. Limit defined by wb_slave_trigger.vhd
-    g_trigger_tristate                        : boolean                        := true
+    g_trigger_tristate                        : boolean                        := true;
+    g_evt_log_size                            : natural                        := 512; -- entries of the trigger event log
+    g_count_width                             : natural range 16 to 64         := 48   -- width of the pulse counters
   );
   port (
     clk_i                                     : in std_logic;
@@ -2398,6 +2422,9 @@ package ifc_wishbone_pkg is
     ref_clk_i                                 : in std_logic;
     ref_rst_n_i                               : in std_logic;
 
+    -- Counter snapshot strobe (ref_clk_i)
+    cnt_snap_i                                : in std_logic := '0';
+
     -------------------------------
     ---- Wishbone Control Interface signals
     -------------------------------
@@ -2448,7 +2475,9 @@ package ifc_wishbone_pkg is
       g_address_granularity                   : t_wishbone_address_granularity := WORD;
       g_sync_edge                             : string                         := "positive";
       g_trig_num                              : natural range 1 to 24          := 8;
-      g_trigger_tristate                      : boolean                        := true
+      g_trigger_tristate                      : boolean                        := true;
+      g_evt_log_size                          : natural                        := 512;
+      g_count_width                           : natural range 16 to 64         := 48
   );
   port
   (
@@ -2458,6 +2487,9 @@ package ifc_wishbone_pkg is
     ref_clk_i                                 : in std_logic;
     ref_rst_n_i                               : in std_logic;
 
+    -- Counter snapshot strobe (ref_clk_i)
+    cnt_snap_i                                : in std_logic := '0';
+
     -----------------------------
     -- Wishbone signals
     -----------------------------
@@ -2760,7 +2792,11 @@ package ifc_wishbone_pkg is
   component wb_master_uart is
   generic (
     g_END_LINE_CHAR:  std_logic_vector(7 downto 0) := x"0A";
-    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC
+    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC;
+    -- log2 of the receive FIFO size, in bytes
+    g_RX_FIFO_LOG2:   natural                      := 6;
+    -- log2 of the read FIFO size, in words (PIPELINED mode only)
+    g_RD_FIFO_LOG2:   natural                      := 4
   );
   port (
     -- Core clock
@@ -2791,7 +2827,11 @@ package ifc_wishbone_pkg is
   component xwb_master_uart is
   generic (
     g_END_LINE_CHAR:  std_logic_vector(7 downto 0) := x"0A";
-    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC
+    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC;
+    -- log2 of the receive FIFO size, in bytes
+    g_RX_FIFO_LOG2:   natural                      := 6;
+    -- log2 of the read FIFO size, in words (PIPELINED mode only)
+    g_RD_FIFO_LOG2:   natural                      := 4
   );
   port (
     -- Core clock
@@ -2947,12 +2987,12 @@ package ifc_wishbone_pkg is
     wbd_width     => x"7",                     -- 8/16/32-bit port granularity (0111)
     sdb_component => (
     addr_first    => x"0000000000000000",
-    addr_last     => x"00000000000003FF",
+    addr_last     => x"0000000000003FFF",
     product => (
     vendor_id     => x"1000000000001215",     -- LNLS
     device_id     => x"84b6a5ac",
-    version       => x"00000001",
-    date          => x"20160512",
+    version       => x"00000002",
+    date          => x"20261017",
     name          => "LNLS_TRIGGER_MUX   ")));
 
   -- Trigger Interface
@@ -2964,12 +3004,12 @@ package ifc_wishbone_pkg is
     wbd_width     => x"7",                     -- 8/16/32-bit port granularity (0111)
     sdb_component => (
     addr_first    => x"0000000000000000",
-    addr_last     => x"00000000000003FF",
+    addr_last     => x"00000000000007FF",
     product => (
     vendor_id     => x"1000000000001215",     -- LNLS
     device_id     => x"bcbb78d2",
-    version       => x"00000001",
-    date          => x"20160203",
+    version       => x"00000003",
+    date          => x"20261017",
     name          => "LNLS_TRIGGER_IFACE ")));
 
   -- fmcpico_1m_4CH
@@ -13,6 +13,9 @@ files = ["wb_acq_core.vhd",
         "acq_ddr3_axis_read.vhd",
         "acq_cnt.vhd",
         "acq_sel_chan.vhd",
+        "acq_decim.vhd",
+        "acq_delta_enc.vhd",
+        "acq_delta_comp.vhd",
         "acq_2_diff_cnt.vhd",
         "data_checker.vhd",
         "acq_pulse_level_sync.vhd",
@@ -44,6 +44,11 @@ package acq_core_pkg is
   constant c_acq_max_coalesce_factor        : natural := c_acq_chan_cmplt_width/c_acq_chan_max_w;
   constant c_acq_id_width                   : natural := f_log2_size(c_acq_max_coalesce_factor)+1;
 
+  -- Multi-channel frames. Each frame word is numbered by its acq_id, so a
+  -- frame can't be longer than that
+  constant c_acq_max_frame_size             : natural := 2**c_acq_id_width;
+  constant c_acq_frame_size_log2_width      : natural := 3;
+
   constant c_ddr3_ui_diff_threshold         : natural := 3;
 
   -- UI Commands
@@ -316,6 +321,15 @@ package acq_core_pkg is
   function f_max_align_array(arr1 : t_property_value_array; arr2 : t_payld_ratio_array)
     return t_property_value_array;
 
+  -- Number of words, in log2, of a frame holding all channels of the mask.
+  -- 0 for a single channel
+  function f_acq_chan_mask_frame_log2(chan_mask : std_logic_vector)
+    return natural;
+
+  -- Width of the words stored by acq_fc_fifo for a channel of the given width
+  function f_acq_chan_word_width(width : natural)
+    return natural;
+
   -----------------------------
   -- Components declaration
   ----------------------------
@@ -323,6 +337,112 @@ package acq_core_pkg is
   function f_gen_std_logic_vector(size : natural; value : std_logic)
     return std_logic_vector;
 
+  component acq_delta_enc
+  generic
+  (
+    -- Width of the input samples and output words. Either 64 or 128
+    g_word_width                              : natural := 64;
+    g_num_atoms                               : natural := 4;
+    g_atom_width                              : natural := 16
+  );
+  port
+  (
+    clk_i                                     : in std_logic;
+    rst_n_i                                   : in std_logic;
+
+    -- Drops any pending data and starts a new block, with sequence number 0
+    start_i                                   : in std_logic;
+    -- Samples per block, log2. Sampled on start_i
+    block_log2_i                              : in unsigned(3 downto 0);
+    -- Closes the current block after the sample of the same cycle, if any
+    flush_i                                   : in std_logic := '0';
+
+    data_i                                    : in std_logic_vector(g_word_width-1 downto 0);
+    valid_i                                   : in std_logic;
+
+    data_o                                    : out std_logic_vector(g_word_width-1 downto 0);
+    valid_o                                   : out std_logic;
+    -- Samples were dropped since start_i
+    ovf_o                                     : out std_logic
+  );
+  end component;
+
+  component acq_delta_comp
+  generic
+  (
+    g_data_width                              : natural := 128;
+    g_acq_num_channels                        : natural := 1;
+    g_acq_channels                            : t_acq_chan_param_array
+  );
+  port
+  (
+    clk_i                                     : in std_logic;
+    rst_n_i                                   : in std_logic;
+
+    -----------------------------
+    -- Configuration
+    -----------------------------
+    comp_en_i                                 : in std_logic;
+    block_log2_i                              : in unsigned(3 downto 0);
+    lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+    -- Acquisition start. Latches the configuration
+    lmt_valid_i                               : in std_logic;
+    -- Acquisition stop. Closes the block in progress
+    acq_stop_i                                : in std_logic := '0';
+
+    -----------------------------
+    -- Acquisiton Interface
+    -----------------------------
+    acq_data_i                                : in std_logic_vector(g_data_width-1 downto 0);
+    acq_valid_i                               : in std_logic;
+    acq_trig_i                                : in std_logic;
+
+    -----------------------------
+    -- Output Interface
+    -----------------------------
+    acq_data_o                                : out std_logic_vector(g_data_width-1 downto 0);
+    acq_valid_o                               : out std_logic;
+    acq_trig_o                                : out std_logic;
+
+    -- Compressing the current acquisition
+    comp_active_o                             : out std_logic;
+    -- Samples were dropped by the encoder since the acquisition start
+    comp_ovf_o                                : out std_logic
+  );
+  end component;
+
+  component acq_decim
+  generic
+  (
+    g_acq_num_channels                        : natural := 1;
+    g_acq_channels                            : t_acq_chan_param_array;
+    g_max_avg_order_sel                       : natural := 0;
+    g_decim_ratio_width                       : natural := 16
+  );
+  port
+  (
+    clk_i                                     : in std_logic;
+    rst_n_i                                   : in std_logic;
+
+    decim_ratio_i                             : in unsigned(g_decim_ratio_width-1 downto 0);
+    avg_order_sel_i                           : in unsigned(3 downto 0);
+    decim_chan_mask_i                         : in std_logic_vector(g_acq_num_channels-1 downto 0);
+    lmt_valid_i                               : in std_logic;
+
+    acq_val_low_i                             : in t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+    acq_val_high_i                            : in t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+    acq_dvalid_i                              : in std_logic_vector(g_acq_num_channels-1 downto 0);
+    acq_id_i                                  : in t_acq_id_array(g_acq_num_channels-1 downto 0);
+    acq_trig_i                                : in std_logic_vector(g_acq_num_channels-1 downto 0);
+
+    acq_val_low_o                             : out t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+    acq_val_high_o                            : out t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+    acq_dvalid_o                              : out std_logic_vector(g_acq_num_channels-1 downto 0);
+    acq_id_o                                  : out t_acq_id_array(g_acq_num_channels-1 downto 0);
+    acq_trig_o                                : out std_logic_vector(g_acq_num_channels-1 downto 0)
+  );
+  end component;
+
   component acq_sel_chan
   generic
   (
@@ -345,6 +465,8 @@ package acq_core_pkg is
 
     -- Current channel selection ID
     lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+    lmt_chan_mask_i                           : in std_logic_vector(g_acq_num_channels-1 downto 0) := (others => '0');
+    lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
     -- Acquisition limits valid signal
     lmt_valid_i                               : in std_logic;
 
@@ -354,7 +476,8 @@ package acq_core_pkg is
     acq_data_o                                : out std_logic_vector(g_acq_data_width-1 downto 0);
     acq_dvalid_o                              : out std_logic;
     acq_id_o                                  : out t_acq_id;
-    acq_trig_o                                : out std_logic
+    acq_trig_o                                : out std_logic;
+    acq_frame_ovf_o                           : out std_logic
   );
   end component;
 
@@ -404,6 +527,7 @@ package acq_core_pkg is
 
     -- Current channel selection ID
     lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+    lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
     -- Acquisition limits valid signal
     lmt_valid_i                               : in std_logic;
 
@@ -438,6 +562,7 @@ package acq_core_pkg is
     -----------------------------
     acq_start_i                               : in  std_logic := '0';
     acq_now_i                                 : in  std_logic := '0';
+    acq_stream_i                              : in  std_logic := '0';
     acq_stop_i                                : in  std_logic := '0';
     acq_data_i                                : in  std_logic_vector(g_acq_data_width-1 downto 0) := (others => '0');
     acq_trig_i                                : in  std_logic := '0';
@@ -452,6 +577,7 @@ package acq_core_pkg is
     shots_nb_i                                : in unsigned(15 downto 0);
     -- Current channel selection ID
     lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+    lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
     -- Acquisition limits valid signal
     lmt_valid_i                               : in std_logic;
     samples_cnt_o                             : out unsigned(c_acq_samples_size-1 downto 0);
@@ -869,7 +995,8 @@ package acq_core_pkg is
     g_ddr_payload_width                       : natural := 256;     -- be careful changing these!
     g_ddr_dq_width                            : natural := 64;      -- be careful changing these!
     g_ddr_addr_width                          : natural := 32;      -- be careful changing these!
-    g_max_burst_size                          : natural := 4        -- be careful changing these!
+    g_max_burst_size                          : natural := 4;       -- be careful changing these!
+    g_max_outstanding_bursts                  : natural := 8
   );
   port
   (
@@ -892,6 +1019,15 @@ package acq_core_pkg is
     wr_end_addr_i                             : in std_logic_vector(g_ddr_addr_width-1 downto 0);
     wr_trig_cnt_off_i                         : in unsigned(g_trig_cnt_off_width-1 downto 0);
 
+    stream_en_i                               : in std_logic := '0';
+    stream_overwrite_i                        : in std_logic := '0';
+    stream_rd_ptr_i                           : in std_logic_vector(g_ddr_addr_width-1 downto 0) := (others => '0');
+    stream_wr_ptr_o                           : out std_logic_vector(g_ddr_addr_width-1 downto 0);
+    stream_overrun_o                          : out std_logic;
+
+    perf_beats_o                              : out std_logic_vector(31 downto 0);
+    perf_cycles_o                             : out std_logic_vector(31 downto 0);
+
     lmt_all_trans_done_p_o                    : out std_logic;
     lmt_ddr_trig_addr_o                       : out std_logic_vector(g_ddr_addr_width-1 downto 0);
     lmt_rst_i                                 : in std_logic;
@@ -1524,4 +1660,33 @@ package body acq_core_pkg is
     return res;
   end;
 
+  function f_acq_chan_mask_frame_log2(chan_mask : std_logic_vector)
+    return natural
+  is
+    variable num_chan : natural := 0;
+  begin
+    for i in chan_mask'range loop
+      if chan_mask(i) = '1' then
+        num_chan := num_chan + 1;
+      end if;
+    end loop;
+
+    if num_chan <= 1 then
+      return 0;
+    end if;
+
+    return f_log2_size(min(num_chan, c_acq_max_frame_size));
+  end;
+
+  function f_acq_chan_word_width(width : natural)
+    return natural
+  is
+  begin
+    if width > c_acq_chan_width then
+      return c_acq_chan_max_w;
+    else
+      return c_acq_chan_width;
+    end if;
+  end;
+
 end acq_core_pkg;
@@ -46,7 +46,11 @@ generic
   g_ddr_payload_width                       : natural := 256;     -- be careful changing these!
   g_ddr_dq_width                            : natural := 64;      -- be careful changing these!
   g_ddr_addr_width                          : natural := 32;      -- be careful changing these!
-  g_max_burst_size                          : natural := 4        -- be careful changing these!
+  g_max_burst_size                          : natural := 4;       -- be careful changing these!
+  -- Maximum number of AXI write bursts posted by the datamover and not yet
+  -- acknowledged. The datamover S2MM address pipeline depth is an upper
+  -- bound as well
+  g_max_outstanding_bursts                  : natural := 8
 );
 port
 (
@@ -69,6 +73,22 @@ port
   wr_end_addr_i                             : in std_logic_vector(g_ddr_addr_width-1 downto 0);
   wr_trig_cnt_off_i                         : in unsigned(g_trig_cnt_off_width-1 downto 0);
 
+  -- Streaming mode. The memory area is used as a ring buffer, written up to
+  -- the word before stream_rd_ptr_i (or overwritten, flagging an overrun, if
+  -- stream_overwrite_i is set). stream_wr_ptr_o is the address following the
+  -- last word acknowledged by the memory
+  stream_en_i                               : in std_logic := '0';
+  stream_overwrite_i                        : in std_logic := '0';
+  stream_rd_ptr_i                           : in std_logic_vector(g_ddr_addr_width-1 downto 0) := (others => '0');
+  stream_wr_ptr_o                           : out std_logic_vector(g_ddr_addr_width-1 downto 0);
+  stream_overrun_o                          : out std_logic;
+
+  -- Performance counters, cleared by wr_start_i. perf_beats_o counts
+  -- payload words accepted by the datamover and perf_cycles_o the cycles in
+  -- which a payload word was waiting. Both stop when perf_cycles_o saturates
+  perf_beats_o                              : out std_logic_vector(31 downto 0);
+  perf_cycles_o                             : out std_logic_vector(31 downto 0);
+
   lmt_all_trans_done_p_o                    : out std_logic;
   lmt_ddr_trig_addr_o                       : out std_logic_vector(g_ddr_addr_width-1 downto 0);
   lmt_rst_i                                 : in std_logic;
@@ -190,12 +210,21 @@ architecture rtl of acq_ddr3_axis_write is
   -- Constants for ddr3 address bits
   constant c_ddr_align_shift                : natural := f_log2_size(c_addr_ddr_inc);
 
+  -- Burst lengths posted by the datamover and not yet acknowledged. An
+  -- address request may already be in flight when allow_addr_req is
+  -- deasserted, hence the extra position
+  constant c_stream_burst_fifo_size         : natural := 2**f_log2_size(g_max_outstanding_bursts+1);
+  constant c_stream_burst_fifo_size_log2    : natural := f_log2_size(c_stream_burst_fifo_size);
+
   subtype t_addr_cnt is unsigned(c_addr_cnt_width-1 downto 0);
   type t_addr_cnt_array is array (natural range <>) of t_addr_cnt;
 
   subtype t_addr_cnt_s is std_logic_vector(c_addr_cnt_width-1 downto 0);
   type t_addr_cnt_s_array is array (natural range <>) of t_addr_cnt_s;
 
+  subtype t_stream_burst_len is unsigned(8 downto 0);
+  type t_stream_burst_len_array is array (natural range <>) of t_stream_burst_len;
+
   -- Flow control signals
   signal lmt_pre_pkt_size                   : unsigned(c_pkt_size_width-1 downto 0);
   signal lmt_pre_pkt_size_s                 : std_logic_vector(c_pkt_size_width-1 downto 0);
@@ -313,6 +342,26 @@ architecture rtl of acq_ddr3_axis_write is
   signal ddr_trig_cnt_off_s                 : std_logic_vector(g_trig_cnt_off_width-1 downto 0);
   signal ddr_trig_cnt_off                   : unsigned(g_trig_cnt_off_width-1 downto 0);
 
+  -- Streaming signals
+  signal stream_rd_ptr_alig                 : std_logic_vector(g_ddr_addr_width-1 downto 0);
+  signal stream_addr_next                   : unsigned(g_ddr_addr_width-1 downto 0);
+  signal stream_ring_full                   : std_logic;
+  signal stream_stall                       : std_logic;
+  signal stream_overrun                     : std_logic;
+  signal stream_wr_ptr                      : unsigned(g_ddr_addr_width-1 downto 0);
+  signal stream_wr_ptr_next                 : unsigned(g_ddr_addr_width-1 downto 0);
+  signal stream_burst_len                   : t_stream_burst_len_array(c_stream_burst_fifo_size-1 downto 0);
+  signal stream_burst_wr_idx                : unsigned(c_stream_burst_fifo_size_log2-1 downto 0);
+  signal stream_burst_rd_idx                : unsigned(c_stream_burst_fifo_size_log2-1 downto 0);
+
+  -- Outstanding bursts
+  signal bursts_outstanding                 : unsigned(f_log2_size(g_max_outstanding_bursts+1)-1 downto 0);
+  signal allow_addr_req                     : std_logic;
+
+  -- Performance counters
+  signal perf_beats                         : unsigned(31 downto 0);
+  signal perf_cycles                        : unsigned(31 downto 0);
+
   signal ddr_eop_in                         : std_logic_vector(c_ddr_eop_width-1 downto 0);
   signal ddr_keep_in                        : std_logic_vector(c_ddr_keep_width-1 downto 0);
   signal ddr_data_eop_keep_in               : std_logic_vector(g_ddr_header_width+g_ddr_payload_width+c_ddr_eop_width+c_ddr_keep_width-1 downto 0);
@@ -447,7 +496,7 @@ begin
   fifo_fc_stall_o <= pl_stall;
   fifo_fc_dreq_o <= pl_dreq;
 
-  pl_stall <= pl_stall_cmd or pl_stall_pld;
+  pl_stall <= pl_stall_cmd or pl_stall_pld or stream_stall;
   pl_dreq <= pl_dreq_cmd and pl_dreq_pld;
 
   -- DDR valid input signal
@@ -700,6 +749,113 @@ begin
   dbg_ddr_addr_init_o <= std_logic_vector(ddr_addr_init);
   dbg_ddr_addr_max_o <= std_logic_vector(ddr_addr_max);
 
+  -----------------------------------------------------------------------------
+  -- Streaming ring buffer
+  -----------------------------------------------------------------------------
+
+  stream_rd_ptr_alig <= stream_rd_ptr_i(stream_rd_ptr_i'left downto c_ddr_align_shift) &
+                             f_gen_std_logic_vector(c_ddr_align_shift, '0');
+
+  -- Writing the current word would make the write pointer reach the read
+  -- pointer, which software reads as an empty ring. So, keep one word free
+  stream_addr_next <= ddr_addr_init when ddr_addr_wrap_counter = '1' else
+                        ddr_addr_cnt_axis + c_addr_ddr_inc_axis;
+  stream_ring_full <= '1' when stream_en_i = '1' and
+                                 stream_addr_next = unsigned(stream_rd_ptr_alig) else '0';
+
+  stream_stall <= stream_ring_full and not stream_overwrite_i;
+
+  p_stream_overrun : process(ext_clk_i)
+  begin
+    if rising_edge(ext_clk_i) then
+      if ext_rst_n_i = '0' then
+        stream_overrun <= '0';
+      else
+        if wr_start_i = '1' then
+          stream_overrun <= '0';
+        -- Without overwriting, a full ring only stalls the writer
+        elsif ddr_valid_in = '1' and stream_ring_full = '1' and
+              stream_overwrite_i = '1' then
+          stream_overrun <= '1';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  stream_overrun_o <= stream_overrun;
+
+  -- The write pointer only advances when the memory acknowledges a burst, so
+  -- everything before it can be read back. The datamover posts the length
+  -- of each burst before writing it and acknowledges them in order. Bursts
+  -- have g_ddr_payload_width bit beats and never go over the end of the
+  -- memory area, as TLAST is asserted there.
+  stream_wr_ptr_next <= stream_wr_ptr +
+                          resize(stream_burst_len(to_integer(stream_burst_rd_idx)) &
+                            f_gen_std_logic_vector(c_addr_ddr_inc_axis_log2, '0'),
+                          stream_wr_ptr'length);
+
+  p_stream_wr_ptr : process(ext_clk_i)
+  begin
+    if rising_edge(ext_clk_i) then
+      if ext_rst_n_i = '0' then
+        stream_wr_ptr <= to_unsigned(0, stream_wr_ptr'length);
+        stream_burst_wr_idx <= to_unsigned(0, stream_burst_wr_idx'length);
+        stream_burst_rd_idx <= to_unsigned(0, stream_burst_rd_idx'length);
+      else
+        if wr_start_i = '1' then
+          stream_wr_ptr <= unsigned(wr_init_addr_alig);
+          stream_burst_wr_idx <= to_unsigned(0, stream_burst_wr_idx'length);
+          stream_burst_rd_idx <= to_unsigned(0, stream_burst_rd_idx'length);
+        else
+          if axis_s2mm_ld_nxt_len_i = '1' then
+            stream_burst_len(to_integer(stream_burst_wr_idx)) <=
+              resize(unsigned(axis_s2mm_wr_len_i), t_stream_burst_len'length) + 1;
+            stream_burst_wr_idx <= stream_burst_wr_idx + 1;
+          end if;
+
+          if axis_s2mm_wr_xfer_cmplt_i = '1' then
+            stream_burst_rd_idx <= stream_burst_rd_idx + 1;
+
+            if stream_wr_ptr_next >= ddr_addr_max then
+              stream_wr_ptr <= ddr_addr_init;
+            else
+              stream_wr_ptr <= stream_wr_ptr_next;
+            end if;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  stream_wr_ptr_o <= std_logic_vector(stream_wr_ptr);
+
+  -----------------------------------------------------------------------------
+  -- Performance counters
+  -----------------------------------------------------------------------------
+  p_perf_cnt : process(ext_clk_i)
+  begin
+    if rising_edge(ext_clk_i) then
+      if ext_rst_n_i = '0' then
+        perf_beats <= to_unsigned(0, perf_beats'length);
+        perf_cycles <= to_unsigned(0, perf_cycles'length);
+      else
+        if wr_start_i = '1' then
+          perf_beats <= to_unsigned(0, perf_beats'length);
+          perf_cycles <= to_unsigned(0, perf_cycles'length);
+        elsif fc_valid_pld = '1' and perf_cycles /= (perf_cycles'range => '1') then
+          perf_cycles <= perf_cycles + 1;
+
+          if ddr_rdy_pld = '1' then
+            perf_beats <= perf_beats + 1;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  perf_beats_o <= std_logic_vector(perf_beats);
+  perf_cycles_o <= std_logic_vector(perf_cycles);
+
   -----------------------------------------------------------------------------
   -- Store DDR Trigger address
   -----------------------------------------------------------------------------
@@ -749,7 +905,9 @@ begin
                             else '0';
 
   -- Counter to detect end of transaction only
-  acq_cmd_cnt_en <= '1' when pl_cmd_cnt_en = '1' and pl_pkt_sent_cmd = '1' else '0';
+  -- A streaming acquisition never ends by itself
+  acq_cmd_cnt_en <= '1' when pl_cmd_cnt_en = '1' and pl_pkt_sent_cmd = '1' and
+                      stream_en_i = '0' else '0';
 
   -- Only count up to the sample when in pre_trigger or post_trigger and we haven't
   -- acquire enough samples
@@ -760,7 +918,8 @@ begin
                             else '0';
 
   -- Counter to detect end of transaction only
-  acq_pld_cnt_en <= '1' when pl_pld_cnt_en = '1' and pl_pkt_sent_pld = '1' else '0';
+  acq_pld_cnt_en <= '1' when pl_pld_cnt_en = '1' and pl_pkt_sent_pld = '1' and
+                      stream_en_i = '0' else '0';
 
   cmp_acq_cnt_cmd : acq_cnt
   port map
@@ -1053,8 +1212,38 @@ begin
   axis_s2mm_cmd_tdata_o(c_axis_cmd_tdata_pad_top_idx downto
     c_axis_cmd_tdata_pad_bot_idx)                             <= (others => '0');             -- cmd_pad
 
-  -- We always allow address request
-  axis_s2mm_allow_addr_req_o <= '1';
+  -- Limit the number of bursts in flight. Long bursts with a few of them
+  -- outstanding keep the memory controller busy, while still bounding the
+  -- writes that can be pending when the acquisition is stopped
+  p_outstanding_bursts : process(ext_clk_i)
+    variable v_outstanding : unsigned(bursts_outstanding'range);
+  begin
+    if rising_edge(ext_clk_i) then
+      if ext_rst_n_i = '0' or ddr_axis_rstn = '0' then
+        bursts_outstanding <= to_unsigned(0, bursts_outstanding'length);
+        allow_addr_req <= '0';
+      else
+        v_outstanding := bursts_outstanding;
+
+        if axis_s2mm_addr_req_posted_i = '1' and axis_s2mm_wr_xfer_cmplt_i = '0' then
+          v_outstanding := v_outstanding + 1;
+        elsif axis_s2mm_addr_req_posted_i = '0' and axis_s2mm_wr_xfer_cmplt_i = '1' and
+            v_outstanding /= 0 then
+          v_outstanding := v_outstanding - 1;
+        end if;
+
+        bursts_outstanding <= v_outstanding;
+
+        if v_outstanding < g_max_outstanding_bursts then
+          allow_addr_req <= '1';
+        else
+          allow_addr_req <= '0';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  axis_s2mm_allow_addr_req_o <= allow_addr_req;
 
   fc_eop_pld <= '1' when fc_dout(c_eop_high downto c_eop_low) = "1" else '0';
 
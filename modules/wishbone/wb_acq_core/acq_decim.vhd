@@ -0,0 +1,280 @@
+------------------------------------------------------------------------------
+-- Title      : Acquisition Channel Decimation
+------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : FPGA-generic
+-------------------------------------------------------------------------------
+-- Description: Runtime decimation of the acquisition channels, placed before
+--               the channel selection.
+--
+--               For every channel in decim_chan_mask_i, only one of every
+--               decim_ratio_i samples is kept. Whole samples are kept or
+--               dropped, so coalesced channels stay consistent. A trigger
+--               tagged to a dropped sample is moved to the next kept one.
+--
+--               When g_max_avg_order_sel > 0, the atoms of non-coalesced
+--               channels in the mask go through a moving average of
+--               2**avg_order_sel_i taps (mov_avg_dyn) before being decimated,
+--               working as an anti-aliasing filter. Atoms are taken as
+--               two's complement numbers.
+--
+--               Channels outside the mask only get the pipeline latency. The
+--               decimation phase restarts on lmt_valid_i.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+use work.acq_core_pkg.all;
+use work.ifc_common_pkg.all;
+
+entity acq_decim is
+generic
+(
+  g_acq_num_channels                        : natural := 1;
+  g_acq_channels                            : t_acq_chan_param_array;
+  -- Maximum moving average order selector. 0 leaves the moving average out
+  g_max_avg_order_sel                       : natural := 0;
+  g_decim_ratio_width                       : natural := 16
+);
+port
+(
+  clk_i                                     : in std_logic;
+  rst_n_i                                   : in std_logic;
+
+  -----------------------------
+  -- Configuration
+  -----------------------------
+  -- Keep one of every decim_ratio_i samples. 0 and 1 keep all of them
+  decim_ratio_i                             : in unsigned(g_decim_ratio_width-1 downto 0);
+  -- Moving average of 2**avg_order_sel_i taps. Clamped to g_max_avg_order_sel
+  avg_order_sel_i                           : in unsigned(3 downto 0);
+  -- Channels to decimate
+  decim_chan_mask_i                         : in std_logic_vector(g_acq_num_channels-1 downto 0);
+  -- Acquisition start. Restarts the decimation phase
+  lmt_valid_i                               : in std_logic;
+
+  -----------------------------
+  -- Acquisiton Interface
+  -----------------------------
+  acq_val_low_i                             : in t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  acq_val_high_i                            : in t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  acq_dvalid_i                              : in std_logic_vector(g_acq_num_channels-1 downto 0);
+  acq_id_i                                  : in t_acq_id_array(g_acq_num_channels-1 downto 0);
+  acq_trig_i                                : in std_logic_vector(g_acq_num_channels-1 downto 0);
+
+  -----------------------------
+  -- Output Interface
+  -----------------------------
+  acq_val_low_o                             : out t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  acq_val_high_o                            : out t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  acq_dvalid_o                              : out std_logic_vector(g_acq_num_channels-1 downto 0);
+  acq_id_o                                  : out t_acq_id_array(g_acq_num_channels-1 downto 0);
+  acq_trig_o                                : out std_logic_vector(g_acq_num_channels-1 downto 0)
+);
+end acq_decim;
+
+architecture rtl of acq_decim is
+
+  alias c_acq_channels : t_acq_chan_param_array(g_acq_num_channels-1 downto 0) is g_acq_channels;
+
+  constant c_num_atoms_array                : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, NUM_ATOMS);
+  constant c_atom_width_array               : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, ATOM_WIDTH);
+  constant c_num_coalesce_array             : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, NUM_COALESCE);
+
+  -- mov_avg_dyn output latency
+  constant c_avg_latency                    : natural := 2;
+
+  signal avg_order_sel                      : natural range 0 to g_max_avg_order_sel;
+  signal decim_en                           : std_logic;
+
+begin
+
+  p_cfg : process (clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        avg_order_sel <= 0;
+        decim_en <= '0';
+      else
+        if avg_order_sel_i > g_max_avg_order_sel then
+          avg_order_sel <= g_max_avg_order_sel;
+        else
+          avg_order_sel <= to_integer(avg_order_sel_i);
+        end if;
+
+        if decim_ratio_i > 1 then
+          decim_en <= '1';
+        else
+          decim_en <= '0';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  gen_chan : for i in 0 to g_acq_num_channels-1 generate
+    constant c_num_atoms                    : natural := c_num_atoms_array(i);
+    constant c_atom_width                   : natural := c_atom_width_array(i);
+    constant c_num_coalesce                 : natural := c_num_coalesce_array(i);
+    -- Averaging a coalesced channel would need the whole sample at once
+    constant c_with_avg                     : boolean := g_max_avg_order_sel > 0 and
+                                                          c_num_coalesce = 1;
+
+    signal word_in                          : t_acq_val_full_plain;
+    signal word_filt                        : t_acq_val_full_plain;
+    signal valid_filt                       : std_logic;
+    signal id_filt                          : t_acq_id;
+    signal trig_filt                        : std_logic;
+
+    signal phase                            : unsigned(g_decim_ratio_width-1 downto 0);
+    signal trig_pending                     : std_logic;
+    signal word_out                         : t_acq_val_full_plain;
+  begin
+
+    word_in <= acq_val_high_i(i) & acq_val_low_i(i);
+
+    ----------------------------------------------------------------------------
+    -- Anti-aliasing moving average
+    ----------------------------------------------------------------------------
+    gen_avg : if c_with_avg generate
+      type t_word_pipe is array (natural range <>) of t_acq_val_full_plain;
+      type t_id_pipe is array (natural range <>) of t_acq_id;
+
+      signal order_sel                      : natural range 0 to g_max_avg_order_sel;
+      signal word_pipe                      : t_word_pipe(c_avg_latency-1 downto 0);
+      signal valid_pipe                     : std_logic_vector(c_avg_latency-1 downto 0);
+      signal id_pipe                        : t_id_pipe(c_avg_latency-1 downto 0);
+      signal trig_pipe                      : std_logic_vector(c_avg_latency-1 downto 0);
+      signal word_avgd                      : t_acq_val_full_plain;
+      signal avg_en                         : std_logic;
+    begin
+
+      order_sel <= avg_order_sel when decim_chan_mask_i(i) = '1' else 0;
+
+      gen_atoms : for k in 0 to c_num_atoms-1 generate
+        signal avgd_atom                    : signed(c_atom_width-1 downto 0);
+      begin
+        cmp_mov_avg_dyn : mov_avg_dyn
+        generic map
+        (
+          g_MAX_ORDER_SEL                   => g_max_avg_order_sel,
+          g_DATA_WIDTH                      => c_atom_width
+        )
+        port map
+        (
+          clk_i                             => clk_i,
+          rst_n_i                           => rst_n_i,
+          order_sel_i                       => order_sel,
+          data_i                            => signed(word_in((k+1)*c_atom_width-1 downto k*c_atom_width)),
+          valid_i                           => acq_dvalid_i(i),
+          avgd_data_o                       => avgd_atom,
+          valid_o                           => open
+        );
+
+        word_avgd((k+1)*c_atom_width-1 downto k*c_atom_width) <= std_logic_vector(avgd_atom);
+      end generate;
+
+      -- Bits not belonging to any atom are passed through
+      gen_unused_bits : if c_num_atoms*c_atom_width < word_avgd'length generate
+        word_avgd(word_avgd'left downto c_num_atoms*c_atom_width) <=
+          word_pipe(c_avg_latency-1)(word_avgd'left downto c_num_atoms*c_atom_width);
+      end generate;
+
+      -- Match the mov_avg_dyn latency
+      p_pipe : process (clk_i)
+      begin
+        if rising_edge(clk_i) then
+          if rst_n_i = '0' then
+            valid_pipe <= (others => '0');
+            trig_pipe <= (others => '0');
+          else
+            word_pipe <= word_pipe(c_avg_latency-2 downto 0) & word_in;
+            valid_pipe <= valid_pipe(c_avg_latency-2 downto 0) & acq_dvalid_i(i);
+            id_pipe <= id_pipe(c_avg_latency-2 downto 0) & acq_id_i(i);
+            trig_pipe <= trig_pipe(c_avg_latency-2 downto 0) & acq_trig_i(i);
+          end if;
+        end if;
+      end process;
+
+      avg_en <= '1' when order_sel /= 0 else '0';
+
+      word_filt <= word_avgd when avg_en = '1' else word_pipe(c_avg_latency-1);
+      valid_filt <= valid_pipe(c_avg_latency-1);
+      id_filt <= id_pipe(c_avg_latency-1);
+      trig_filt <= trig_pipe(c_avg_latency-1);
+    end generate;
+
+    gen_no_avg : if not c_with_avg generate
+      word_filt <= word_in;
+      valid_filt <= acq_dvalid_i(i);
+      id_filt <= acq_id_i(i);
+      trig_filt <= acq_trig_i(i);
+    end generate;
+
+    ----------------------------------------------------------------------------
+    -- Decimation
+    ----------------------------------------------------------------------------
+    -- The phase only advances on the last word of a sample, so every word of
+    -- a coalesced sample gets the same keep/drop decision
+    p_decim : process (clk_i)
+      variable v_keep : std_logic;
+    begin
+      if rising_edge(clk_i) then
+        if rst_n_i = '0' then
+          phase <= to_unsigned(0, phase'length);
+          trig_pending <= '0';
+          acq_dvalid_o(i) <= '0';
+          acq_trig_o(i) <= '0';
+          acq_id_o(i) <= to_unsigned(0, c_acq_id_width);
+        else
+          if decim_en = '0' or decim_chan_mask_i(i) = '0' or phase = 0 then
+            v_keep := '1';
+          else
+            v_keep := '0';
+          end if;
+
+          word_out <= word_filt;
+          acq_id_o(i) <= id_filt;
+          acq_dvalid_o(i) <= valid_filt and v_keep;
+          acq_trig_o(i) <= '0';
+
+          if valid_filt = '1' then
+            if v_keep = '1' then
+              acq_trig_o(i) <= trig_filt or trig_pending;
+              trig_pending <= '0';
+            elsif trig_filt = '1' then
+              trig_pending <= '1';
+            end if;
+
+            if id_filt = c_num_coalesce-1 then
+              if phase >= decim_ratio_i-1 then
+                phase <= to_unsigned(0, phase'length);
+              else
+                phase <= phase + 1;
+              end if;
+            end if;
+          end if;
+
+          if lmt_valid_i = '1' then
+            phase <= to_unsigned(0, phase'length);
+            trig_pending <= '0';
+          end if;
+        end if;
+      end if;
+    end process;
+
+    acq_val_low_o(i) <= word_out(c_acq_chan_width-1 downto 0);
+    acq_val_high_o(i) <= word_out(c_acq_chan_max_w-1 downto c_acq_chan_width);
+
+  end generate;
+
+end rtl;
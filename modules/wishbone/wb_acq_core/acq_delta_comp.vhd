@@ -0,0 +1,185 @@
+------------------------------------------------------------------------------
+-- Title      : Acquisition Delta Compression
+------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : FPGA-generic
+-------------------------------------------------------------------------------
+-- Description: Optional compression of the acquired channel, placed between
+--               acq_fsm and acq_fc_fifo.
+--
+--               Every channel with NUM_COALESCE = 1 gets its own
+--               acq_delta_enc, sized for its atoms. On acquisition start,
+--               compression is turned on if comp_en_i is set and the
+--               selected channel has an encoder. The encoded words then
+--               replace the samples, with the same width, so acq_fc_fifo
+--               packs them into DDR3 words as usual. Triggers are not
+--               forwarded while compressing. A stop closes the block in
+--               progress, so that a trailing partial block can be decoded.
+--
+--               Otherwise, data goes through with no added latency.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+use work.acq_core_pkg.all;
+
+entity acq_delta_comp is
+generic
+(
+  g_data_width                              : natural := 128;
+  g_acq_num_channels                        : natural := 1;
+  g_acq_channels                            : t_acq_chan_param_array
+);
+port
+(
+  clk_i                                     : in std_logic;
+  rst_n_i                                   : in std_logic;
+
+  -----------------------------
+  -- Configuration
+  -----------------------------
+  comp_en_i                                 : in std_logic;
+  block_log2_i                              : in unsigned(3 downto 0);
+  lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+  -- Acquisition start. Latches the configuration
+  lmt_valid_i                               : in std_logic;
+  -- Acquisition stop. Closes the block in progress
+  acq_stop_i                                : in std_logic := '0';
+
+  -----------------------------
+  -- Acquisiton Interface
+  -----------------------------
+  acq_data_i                                : in std_logic_vector(g_data_width-1 downto 0);
+  acq_valid_i                               : in std_logic;
+  acq_trig_i                                : in std_logic;
+
+  -----------------------------
+  -- Output Interface
+  -----------------------------
+  acq_data_o                                : out std_logic_vector(g_data_width-1 downto 0);
+  acq_valid_o                               : out std_logic;
+  acq_trig_o                                : out std_logic;
+
+  -- Compressing the current acquisition
+  comp_active_o                             : out std_logic;
+  -- Samples were dropped by the encoder since the acquisition start
+  comp_ovf_o                                : out std_logic
+);
+end acq_delta_comp;
+
+architecture rtl of acq_delta_comp is
+
+  alias c_acq_channels : t_acq_chan_param_array(g_acq_num_channels-1 downto 0) is g_acq_channels;
+
+  constant c_width_array                    : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, WIDTH);
+  constant c_num_atoms_array                : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, NUM_ATOMS);
+  constant c_atom_width_array               : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, ATOM_WIDTH);
+  constant c_num_coalesce_array             : t_property_value_array(g_acq_num_channels-1 downto 0) :=
+                                                f_extract_property_array(c_acq_channels, NUM_COALESCE);
+
+  type t_word_array is array (natural range <>) of std_logic_vector(g_data_width-1 downto 0);
+
+  signal enc_data                           : t_word_array(g_acq_num_channels-1 downto 0);
+  signal enc_valid                          : std_logic_vector(g_acq_num_channels-1 downto 0);
+  signal enc_ovf                            : std_logic_vector(g_acq_num_channels-1 downto 0);
+  signal enc_start                          : std_logic;
+  signal enc_supported                      : std_logic_vector(g_acq_num_channels-1 downto 0);
+
+  signal curr_chan_id                       : natural range 0 to g_acq_num_channels-1;
+  signal comp_active                        : std_logic;
+
+begin
+
+  p_cfg : process (clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        curr_chan_id <= 0;
+        comp_active <= '0';
+      else
+        if lmt_valid_i = '1' then
+          if to_integer(lmt_curr_chan_id_i) < g_acq_num_channels then
+            curr_chan_id <= to_integer(lmt_curr_chan_id_i);
+            comp_active <= comp_en_i and enc_supported(to_integer(lmt_curr_chan_id_i));
+          else
+            comp_active <= '0';
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  enc_start <= lmt_valid_i;
+
+  gen_chan : for i in 0 to g_acq_num_channels-1 generate
+    -- acq_fc_fifo stores 64-bit or 128-bit words
+    constant c_word_width                   : natural := f_acq_chan_word_width(c_width_array(i));
+    constant c_supported                    : boolean :=
+                                                c_num_coalesce_array(i) = 1 and
+                                                c_word_width <= g_data_width and
+                                                c_num_atoms_array(i) > 0 and
+                                                c_num_atoms_array(i)*c_atom_width_array(i) <= c_word_width;
+  begin
+
+    gen_enc : if c_supported generate
+      signal valid_in                       : std_logic;
+      signal data_out                       : std_logic_vector(c_word_width-1 downto 0);
+    begin
+
+      valid_in <= acq_valid_i when curr_chan_id = i else '0';
+
+      cmp_acq_delta_enc : acq_delta_enc
+      generic map
+      (
+        g_word_width                        => c_word_width,
+        g_num_atoms                         => c_num_atoms_array(i),
+        g_atom_width                        => c_atom_width_array(i)
+      )
+      port map
+      (
+        clk_i                               => clk_i,
+        rst_n_i                             => rst_n_i,
+
+        start_i                             => enc_start,
+        block_log2_i                        => block_log2_i,
+        flush_i                             => acq_stop_i,
+
+        data_i                              => acq_data_i(c_word_width-1 downto 0),
+        valid_i                             => valid_in,
+
+        data_o                              => data_out,
+        valid_o                             => enc_valid(i),
+        ovf_o                               => enc_ovf(i)
+      );
+
+      enc_data(i) <= std_logic_vector(resize(unsigned(data_out), g_data_width));
+      enc_supported(i) <= '1';
+    end generate;
+
+    gen_no_enc : if not c_supported generate
+      enc_data(i) <= (others => '0');
+      enc_valid(i) <= '0';
+      enc_ovf(i) <= '0';
+      enc_supported(i) <= '0';
+    end generate;
+
+  end generate;
+
+  acq_data_o <= enc_data(curr_chan_id) when comp_active = '1' else acq_data_i;
+  acq_valid_o <= enc_valid(curr_chan_id) when comp_active = '1' else acq_valid_i;
+  acq_trig_o <= '0' when comp_active = '1' else acq_trig_i;
+
+  comp_active_o <= comp_active;
+  comp_ovf_o <= enc_ovf(curr_chan_id) and comp_active;
+
+end rtl;
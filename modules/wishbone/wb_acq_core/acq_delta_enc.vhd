@@ -0,0 +1,343 @@
+------------------------------------------------------------------------------
+-- Title      : Acquisition Delta Encoder
+------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : FPGA-generic
+-------------------------------------------------------------------------------
+-- Description: Lossless compression of the samples of a single channel.
+--
+--               Each atom is replaced by its difference to the same atom of
+--               the previous sample, zig-zag encoded so that small negative
+--               differences also become small numbers. All atoms of a sample
+--               are then stored with the bit width of the largest one:
+--
+--                 sample = tag (c_tag_width bits, the width w in 0..ATOM_WIDTH)
+--                          atom 0 .. atom N-1 (w bits each)
+--
+--               Samples are grouped in blocks of 2**block_log2_i samples. The
+--               first sample of a block is stored as a difference to zero, so
+--               blocks can be decoded independently. A block starts at an
+--               output word boundary with a header word:
+--
+--                 [15:0]  magic (0xDE1A)
+--                 [31:16] block sequence number
+--                 [39:32] atom width
+--                 [47:40] number of atoms
+--                 [51:48] block_log2_i
+--
+--               and ends with an all-ones tag, followed by zeros up to the
+--               next word boundary. Bits are packed LSB first into
+--               g_word_width-bit output words. flush_i ends a block early,
+--               so that a stream can be closed at any sample.
+--
+--               At most one word is output per clock cycle. Incompressible
+--               data arriving on every cycle eventually fills the internal
+--               buffer, after which samples are dropped and ovf_o is set
+--               until the next start_i. Blocks with dropped samples can't
+--               be decoded, but block boundaries are kept, so decoding can
+--               resume at the next header found.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+use work.genram_pkg.all;
+
+entity acq_delta_enc is
+generic
+(
+  -- Width of the input samples and output words. Either 64 or 128
+  g_word_width                              : natural := 64;
+  g_num_atoms                               : natural := 4;
+  g_atom_width                              : natural := 16
+);
+port
+(
+  clk_i                                     : in std_logic;
+  rst_n_i                                   : in std_logic;
+
+  -- Drops any pending data and starts a new block, with sequence number 0
+  start_i                                   : in std_logic;
+  -- Samples per block, log2. Sampled on start_i
+  block_log2_i                              : in unsigned(3 downto 0);
+  -- Closes the current block after the sample of the same cycle, if any
+  flush_i                                   : in std_logic := '0';
+
+  data_i                                    : in std_logic_vector(g_word_width-1 downto 0);
+  valid_i                                   : in std_logic;
+
+  data_o                                    : out std_logic_vector(g_word_width-1 downto 0);
+  valid_o                                   : out std_logic;
+  -- Samples were dropped since start_i
+  ovf_o                                     : out std_logic
+);
+end acq_delta_enc;
+
+architecture rtl of acq_delta_enc is
+
+  constant c_tag_width                      : natural := f_log2_size(g_atom_width+2);
+  constant c_tag_end                        : unsigned(c_tag_width-1 downto 0) := (others => '1');
+  constant c_magic                          : std_logic_vector(15 downto 0) := x"DE1A";
+
+  -- Header, tag and atoms of the first sample of a block, plus the end tag
+  -- when the block has a single sample
+  constant c_field_width                    : natural := g_word_width + 2*c_tag_width +
+                                                           g_num_atoms*g_atom_width;
+  -- Room for three pending output words besides the incoming field, in
+  -- whole words so that padding a block never goes past the end
+  constant c_acc_width                      : natural :=
+    ((c_field_width + g_word_width-1)/g_word_width + 3) * g_word_width;
+
+  subtype t_atom is unsigned(g_atom_width-1 downto 0);
+  type t_atom_array is array (natural range <>) of t_atom;
+
+  subtype t_width is natural range 0 to g_atom_width;
+  subtype t_field_len is natural range 0 to c_field_width;
+  subtype t_acc_cnt is natural range 0 to c_acc_width;
+
+  function f_bit_length(v : t_atom) return t_width is
+  begin
+    for i in v'left downto 0 loop
+      if v(i) = '1' then
+        return i+1;
+      end if;
+    end loop;
+    return 0;
+  end function;
+
+  signal block_mask                         : unsigned(15 downto 0);
+  signal block_log2                         : unsigned(3 downto 0);
+  signal block_idx                          : unsigned(15 downto 0);
+  signal block_seq                          : unsigned(15 downto 0);
+  signal prev                               : t_atom_array(g_num_atoms-1 downto 0);
+
+  -- Stage 1: zig-zag encoded differences
+  signal zz1                                : t_atom_array(g_num_atoms-1 downto 0);
+  signal first1                             : std_logic;
+  signal last1                              : std_logic;
+  signal flush1                             : std_logic;
+  signal valid1                             : std_logic;
+
+  -- Stage 2: sample width
+  signal zz2                                : t_atom_array(g_num_atoms-1 downto 0);
+  signal width2                             : t_width;
+  signal first2                             : std_logic;
+  signal last2                              : std_logic;
+  signal flush2                             : std_logic;
+  signal valid2                             : std_logic;
+
+  -- Stage 3: packed sample
+  signal field3                             : unsigned(c_field_width-1 downto 0);
+  signal len3                               : t_field_len;
+  signal pad3                               : std_logic;
+  signal valid3                             : std_logic;
+
+  -- Stage 4: output words
+  signal acc                                : unsigned(c_acc_width-1 downto 0);
+  signal acc_cnt                            : t_acc_cnt;
+  signal ovf                                : std_logic;
+
+begin
+
+  assert (g_word_width = 64 or g_word_width = 128)
+    report "[acq_delta_enc] g_word_width must be 64 or 128"
+    severity failure;
+
+  assert (g_num_atoms*g_atom_width <= g_word_width)
+    report "[acq_delta_enc] atoms don't fit in g_word_width"
+    severity failure;
+
+  p_delta : process (clk_i)
+    variable v_atom : t_atom;
+    variable v_diff : t_atom;
+    variable v_sign : t_atom;
+    variable v_idx  : unsigned(15 downto 0);
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' or start_i = '1' then
+        block_idx <= (others => '0');
+        valid1 <= '0';
+        first1 <= '0';
+        last1 <= '0';
+        flush1 <= '0';
+      else
+        valid1 <= valid_i;
+        v_idx := block_idx;
+
+        if valid_i = '1' then
+          for k in 0 to g_num_atoms-1 loop
+            v_atom := unsigned(data_i((k+1)*g_atom_width-1 downto k*g_atom_width));
+
+            if block_idx = 0 then
+              v_diff := v_atom;
+            else
+              v_diff := v_atom - prev(k);
+            end if;
+
+            v_sign := (others => v_diff(v_diff'left));
+            zz1(k) <= shift_left(v_diff, 1) xor v_sign;
+            prev(k) <= v_atom;
+          end loop;
+
+          if block_idx = 0 then
+            first1 <= '1';
+          else
+            first1 <= '0';
+          end if;
+
+          if block_idx = block_mask then
+            last1 <= '1';
+          else
+            last1 <= '0';
+          end if;
+
+          v_idx := (block_idx + 1) and block_mask;
+        end if;
+
+        -- A block that just ended needs no flush
+        flush1 <= '0';
+        if flush_i = '1' and v_idx /= 0 then
+          flush1 <= '1';
+          v_idx := (others => '0');
+        end if;
+
+        block_idx <= v_idx;
+      end if;
+
+      if rst_n_i = '0' then
+        block_log2 <= (others => '0');
+        block_mask <= (others => '0');
+      elsif start_i = '1' then
+        block_log2 <= block_log2_i;
+        block_mask <= shift_left(to_unsigned(1, block_mask'length),
+                                   to_integer(block_log2_i)) - 1;
+      end if;
+    end if;
+  end process;
+
+  p_width : process (clk_i)
+    variable v_width : t_width;
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' or start_i = '1' then
+        valid2 <= '0';
+        flush2 <= '0';
+      else
+        v_width := 0;
+        for k in 0 to g_num_atoms-1 loop
+          if f_bit_length(zz1(k)) > v_width then
+            v_width := f_bit_length(zz1(k));
+          end if;
+        end loop;
+
+        zz2 <= zz1;
+        width2 <= v_width;
+        first2 <= first1;
+        last2 <= last1;
+        flush2 <= flush1;
+        valid2 <= valid1;
+      end if;
+    end if;
+  end process;
+
+  p_pack : process (clk_i)
+    variable v_field : unsigned(c_field_width-1 downto 0);
+    variable v_len   : t_field_len;
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' or start_i = '1' then
+        block_seq <= (others => '0');
+        valid3 <= '0';
+      else
+        v_field := (others => '0');
+        v_len := 0;
+
+        if valid2 = '1' then
+          if first2 = '1' then
+            v_field(15 downto 0) := unsigned(c_magic);
+            v_field(31 downto 16) := block_seq;
+            v_field(39 downto 32) := to_unsigned(g_atom_width, 8);
+            v_field(47 downto 40) := to_unsigned(g_num_atoms, 8);
+            v_field(51 downto 48) := block_log2;
+            v_len := g_word_width;
+          end if;
+
+          v_field := v_field or shift_left(resize(to_unsigned(width2, c_tag_width), c_field_width), v_len);
+          v_len := v_len + c_tag_width;
+
+          -- Each difference has at most width2 significant bits
+          for k in 0 to g_num_atoms-1 loop
+            v_field := v_field or shift_left(resize(zz2(k), c_field_width), v_len);
+            v_len := v_len + width2;
+          end loop;
+        end if;
+
+        if (valid2 = '1' and last2 = '1') or flush2 = '1' then
+          v_field := v_field or shift_left(resize(c_tag_end, c_field_width), v_len);
+          v_len := v_len + c_tag_width;
+        end if;
+
+        field3 <= v_field;
+        len3 <= v_len;
+        pad3 <= (valid2 and last2) or flush2;
+        valid3 <= valid2 or flush2;
+
+        if valid2 = '1' and first2 = '1' then
+          block_seq <= block_seq + 1;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  -- Bits at and above acc_cnt are always zero
+  p_out : process (clk_i)
+    variable v_acc : unsigned(c_acc_width-1 downto 0);
+    variable v_cnt : t_acc_cnt;
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' or start_i = '1' then
+        acc <= (others => '0');
+        acc_cnt <= 0;
+        ovf <= '0';
+        valid_o <= '0';
+      else
+        v_acc := acc;
+        v_cnt := acc_cnt;
+        valid_o <= '0';
+
+        if v_cnt >= g_word_width then
+          data_o <= std_logic_vector(v_acc(g_word_width-1 downto 0));
+          valid_o <= '1';
+          v_acc := shift_right(v_acc, g_word_width);
+          v_cnt := v_cnt - g_word_width;
+        end if;
+
+        if valid3 = '1' then
+          if v_cnt > c_acc_width - c_field_width then
+            ovf <= '1';
+          else
+            v_acc := v_acc or shift_left(resize(field3, c_acc_width), v_cnt);
+            v_cnt := v_cnt + len3;
+          end if;
+
+          -- Even for a dropped sample, so that the next block stays aligned
+          if pad3 = '1' then
+            v_cnt := ((v_cnt + g_word_width-1) / g_word_width) * g_word_width;
+          end if;
+        end if;
+
+        acc <= v_acc;
+        acc_cnt <= v_cnt;
+      end if;
+    end if;
+  end process;
+
+  ovf_o <= ovf;
+
+end rtl;
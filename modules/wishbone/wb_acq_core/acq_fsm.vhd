@@ -60,6 +60,9 @@ port
   -----------------------------
   acq_start_i                               : in  std_logic := '0';
   acq_now_i                                 : in  std_logic := '0';
+  -- Streaming mode. Samples are written continuously to the DDR3 ring and
+  -- triggers are ignored until acq_stop_i
+  acq_stream_i                              : in  std_logic := '0';
   acq_stop_i                                : in  std_logic := '0';
   acq_data_i                                : in  std_logic_vector(g_acq_data_width-1 downto 0) := (others => '0');
   acq_trig_i                                : in  std_logic := '0';
@@ -74,6 +77,8 @@ port
   shots_nb_i                                : in unsigned(15 downto 0);
   -- Current channel selection ID
   lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+  -- Words per multi-channel frame, in log2. Frames are counted as samples
+  lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
   -- Acquisition limits valid signal
   lmt_valid_i                               : in std_logic;
   samples_cnt_o                             : out unsigned(c_acq_samples_size-1 downto 0);
@@ -181,6 +186,7 @@ architecture rtl of acq_fsm is
   signal pre_trig_done                      : std_logic;
   signal pre_trig_done_ext                  : std_logic;
   signal wait_trig_skip_r                   : std_logic;
+  signal stream_r                           : std_logic;
   signal wait_trig_skip_done_ext            : std_logic;
   signal post_trig_cnt                      : unsigned(c_acq_samples_size-1 downto 0);
   signal post_trig_cnt_max                  : unsigned(c_acq_samples_size-1 downto 0);
@@ -230,7 +236,8 @@ begin
   -- we need to shift the samples before outputting it to the other
   -- logic. This is safe, because the other modules only get this new value
   -- after lmt_valid signal is asserted
-  curr_num_coalesce_log2         <= c_num_coalesce_log2_array(to_integer(lmt_curr_chan_id_i));
+  curr_num_coalesce_log2         <= c_num_coalesce_log2_array(to_integer(lmt_curr_chan_id_i)) +
+                                      to_integer(lmt_frame_size_log2_i);
   curr_num_coalesce              <= c_num_coalesce_array(to_integer(lmt_curr_chan_id_i));
   pre_trig_samples_shift_s      <= std_logic_vector(shift_left(pre_trig_samples_i, curr_num_coalesce_log2));
   post_trig_samples_shift_s     <= std_logic_vector(shift_left(post_trig_samples_i, curr_num_coalesce_log2));
@@ -254,9 +261,10 @@ begin
         end if;
 
         -- If a transaction fits inside the multishot RAM prefer it instead
-        -- of the slower, external RAM
-        if shots_nb_i = to_unsigned(1, shots_nb_i'length) and
-            multishot_buffer_candidate = '0' then
+        -- of the slower, external RAM. Streaming always goes directly to
+        -- the external RAM
+        if acq_stream_i = '1' or (shots_nb_i = to_unsigned(1, shots_nb_i'length) and
+            multishot_buffer_candidate = '0') then
           single_shot <= '1';
         else
           single_shot <= '0';
@@ -268,8 +276,9 @@ begin
   multishot_buffer_sel_o <= std_logic(shots_cnt(0));
   shots_done             <= '1' when shots_cnt = to_unsigned(1, shots_cnt'length) else '0';
 
-  -- Would the transaction would fit in multishot RAM?
-  multishot_buffer_candidate <= '1' when pre_trig_samples_i + post_trig_samples_i <=
+  -- Would the transaction would fit in multishot RAM? Each coalesced word
+  -- takes one RAM position
+  multishot_buffer_candidate <= '1' when pre_trig_samples_shift + post_trig_samples_shift <=
                                 g_multishot_ram_size else '0';
 
   acq_single_shot_o <= single_shot;
@@ -329,9 +338,12 @@ begin
     if rising_edge(fs_clk_i) then
       if fs_rst_n = '0' then
         wait_trig_skip_r <= '0';
+        stream_r <= '0';
       else
         if (acq_start_i = '1') then
-          wait_trig_skip_r <= acq_now_i;
+          -- acq_now would skip writing samples altogether
+          wait_trig_skip_r <= acq_now_i and not acq_stream_i;
+          stream_r <= acq_stream_i;
         end if;
       end if;
     end if;
@@ -482,7 +494,9 @@ begin
   -- FSM commands
   acq_start      <= acq_start_i;
   acq_stop       <= acq_stop_i;
-  acq_trig_comb  <= acq_dvalid_i and acq_trig_i and acq_in_wait_trig;
+  -- In streaming mode the FSM stays in WAIT_TRIG, writing samples, until
+  -- stopped
+  acq_trig_comb  <= acq_dvalid_i and acq_trig_i and acq_in_wait_trig and not stream_r;
   acq_end_t      <= shots_done and post_trig_done;
 
   -- When FSM in IDLE, request reset
@@ -7,7 +7,14 @@
 -- Platform   : FPGA-generic
 -------------------------------------------------------------------------------
 -- Description: Simple MUX for selecting an acquisition channel. Basically a
---               1 clock cycle latency MUX
+--               1 clock cycle latency MUX.
+--
+--               With a non-zero channel mask, on each valid sample of the
+--               selected channel, the latest sample of every channel in the
+--               mask is sent instead, one per clock cycle, in ascending
+--               channel order and padded with zeroes up to 2**frame_size_log2
+--               words. The words of a frame are numbered by acq_id_o, just
+--               like the words of a coalesced channel.
 -------------------------------------------------------------------------------
 -- Copyright (c) 2013 CNPEM
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -23,6 +30,7 @@ use ieee.numeric_std.all;
 
 library work;
 use work.acq_core_pkg.all;
+use work.genram_pkg.all;
 
 entity acq_sel_chan is
 generic
@@ -46,6 +54,11 @@ port
 
   -- Current channel selection ID
   lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+  -- Channels sent together on each sample of lmt_curr_chan_id_i. All zeroes
+  -- for single channel acquisitions
+  lmt_chan_mask_i                           : in std_logic_vector(g_acq_num_channels-1 downto 0) := (others => '0');
+  -- Number of words in a frame of channels. See f_acq_chan_mask_frame_log2
+  lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
   -- Acquisition limits valid signal
   lmt_valid_i                               : in std_logic;
 
@@ -55,14 +68,39 @@ port
   acq_data_o                                : out std_logic_vector(g_acq_data_width-1 downto 0);
   acq_dvalid_o                              : out std_logic;
   acq_id_o                                  : out t_acq_id;
-  acq_trig_o                                : out std_logic
+  acq_trig_o                                : out std_logic;
+  -- A sample of the selected channel was dropped, as the previous frame was
+  -- still being sent. Cleared by lmt_valid_i
+  acq_frame_ovf_o                           : out std_logic
 );
 end acq_sel_chan;
 
 architecture rtl of acq_sel_chan is
 
+  constant c_frame_max_size                 : natural := min(2**f_log2_size(g_acq_num_channels),
+                                                             c_acq_max_frame_size);
+  constant c_frame_idx_width                : natural := f_log2_size(c_frame_max_size);
+
+  subtype t_frame_idx is unsigned(c_frame_idx_width-1 downto 0);
+  type t_frame_chan_array is array (natural range <>) of natural range 0 to g_acq_num_channels-1;
+
   signal lmt_valid                          : std_logic;
   signal lmt_curr_chan_id                   : unsigned(c_chan_id_width-1 downto 0);
+  signal lmt_frame_en                       : std_logic;
+  signal lmt_frame_last                     : t_frame_idx;
+  signal lmt_frame_chan                     : t_frame_chan_array(c_frame_max_size-1 downto 0);
+  signal lmt_frame_chan_valid               : std_logic_vector(c_frame_max_size-1 downto 0);
+
+  signal acq_data_marsh                     : t_acq_val_full_plain_array(g_acq_num_channels-1 downto 0);
+  signal acq_data_hold                      : t_acq_val_full_plain_array(g_acq_num_channels-1 downto 0);
+  signal acq_data_latest                    : t_acq_val_full_plain_array(g_acq_num_channels-1 downto 0);
+
+  signal frame_data                         : t_acq_val_full_plain_array(c_frame_max_size-1 downto 0);
+  signal frame_trig                         : std_logic;
+  signal frame_busy                         : std_logic;
+  signal frame_idx                          : t_frame_idx;
+  signal frame_ovf                          : std_logic;
+  signal frame_ref_dvalid                   : std_logic;
 
   signal acq_data_marsh_demux               : std_logic_vector(c_acq_chan_max_w-1 downto 0);
   signal acq_trig_demux                     : std_logic;
@@ -77,21 +115,121 @@ architecture rtl of acq_sel_chan is
 begin
 
   p_reg_lmt_iface : process (clk_i)
+    variable v_slot : natural;
   begin
     if rising_edge(clk_i) then
       if rst_n_i = '0' then
         lmt_valid <= '0';
         lmt_curr_chan_id <= to_unsigned(0, lmt_curr_chan_id'length);
+        lmt_frame_en <= '0';
+        lmt_frame_last <= to_unsigned(0, lmt_frame_last'length);
+        lmt_frame_chan <= (others => 0);
+        lmt_frame_chan_valid <= (others => '0');
       else
         lmt_valid <= lmt_valid_i;
 
         if lmt_valid_i = '1' then
           lmt_curr_chan_id <= lmt_curr_chan_id_i;
+
+          if unsigned(lmt_chan_mask_i) /= 0 then
+            lmt_frame_en <= '1';
+          else
+            lmt_frame_en <= '0';
+          end if;
+          lmt_frame_last <= resize(shift_left(to_unsigned(1, c_frame_idx_width+1),
+                                  to_integer(lmt_frame_size_log2_i)) - 1, lmt_frame_last'length);
+
+          -- Assign the channels of the mask to the frame slots, in order
+          v_slot := 0;
+          lmt_frame_chan_valid <= (others => '0');
+          for i in 0 to g_acq_num_channels-1 loop
+            if lmt_chan_mask_i(i) = '1' and v_slot < c_frame_max_size then
+              lmt_frame_chan(v_slot) <= i;
+              lmt_frame_chan_valid(v_slot) <= '1';
+              v_slot := v_slot + 1;
+            end if;
+          end loop;
         end if;
       end if;
     end if;
   end process;
 
+  ------------------------------------------------------------------------------
+  -- Multi-channel frames
+  ------------------------------------------------------------------------------
+
+  gen_chan_hold : for i in 0 to g_acq_num_channels-1 generate
+    acq_data_marsh(i) <= f_acq_chan_conv_val(f_acq_chan_marshall_val(acq_val_high_i(i),
+                                                                     acq_val_low_i(i)));
+
+    -- Latest sample of each channel, including the one arriving now
+    p_chan_hold : process (clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if rst_n_i = '0' then
+          acq_data_hold(i) <= (others => '0');
+        else
+          if acq_dvalid_i(i) = '1' then
+            acq_data_hold(i) <= acq_data_marsh(i);
+          end if;
+        end if;
+      end if;
+    end process;
+
+    acq_data_latest(i) <= acq_data_marsh(i) when acq_dvalid_i(i) = '1' else acq_data_hold(i);
+  end generate;
+
+  frame_ref_dvalid <= acq_dvalid_i(to_integer(lmt_curr_chan_id)) and lmt_frame_en;
+
+  -- Capture a frame on each sample of the selected channel and shift it out,
+  -- one word per clock cycle
+  p_frame : process (clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        frame_data <= (others => (others => '0'));
+        frame_trig <= '0';
+        frame_busy <= '0';
+        frame_idx <= to_unsigned(0, frame_idx'length);
+        frame_ovf <= '0';
+      else
+        if frame_busy = '1' then
+          frame_data <= t_acq_val_full_plain'(others => '0') & frame_data(frame_data'left downto 1);
+          frame_trig <= '0';
+          frame_idx <= frame_idx + 1;
+
+          if frame_idx = lmt_frame_last then
+            frame_busy <= '0';
+          end if;
+        end if;
+
+        if frame_ref_dvalid = '1' then
+          if frame_busy = '0' or frame_idx = lmt_frame_last then
+            for k in 0 to c_frame_max_size-1 loop
+              if lmt_frame_chan_valid(k) = '1' then
+                frame_data(k) <= acq_data_latest(lmt_frame_chan(k));
+              else
+                frame_data(k) <= (others => '0');
+              end if;
+            end loop;
+            frame_trig <= acq_trig_i(to_integer(lmt_curr_chan_id));
+            frame_busy <= '1';
+            frame_idx <= to_unsigned(0, frame_idx'length);
+          else
+            frame_ovf <= '1';
+          end if;
+        end if;
+
+        if lmt_valid_i = '1' then
+          frame_busy <= '0';
+          frame_ovf <= '0';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  acq_frame_ovf_o <= frame_ovf;
+
  acq_data_marsh_demux                   <=
     f_acq_chan_conv_val(f_acq_chan_marshall_val(acq_val_high_i(to_integer(lmt_curr_chan_id)),
                                                 acq_val_low_i(to_integer(lmt_curr_chan_id))));
@@ -108,10 +246,17 @@ begin
        acq_id_demux_reg <= to_unsigned(0, acq_id_demux_reg'length);
        acq_trig_demux_reg <= '0';
      else
-       acq_data_marsh_demux_reg <= acq_data_marsh_demux(g_acq_data_width-1 downto 0);
-       acq_dvalid_demux_reg <= acq_dvalid_demux;
-       acq_id_demux_reg <= acq_id_demux;
-       acq_trig_demux_reg <= acq_trig_demux;
+       if lmt_frame_en = '1' then
+         acq_data_marsh_demux_reg <= frame_data(0)(g_acq_data_width-1 downto 0);
+         acq_dvalid_demux_reg <= frame_busy;
+         acq_id_demux_reg <= resize(frame_idx, acq_id_demux_reg'length);
+         acq_trig_demux_reg <= frame_trig;
+       else
+         acq_data_marsh_demux_reg <= acq_data_marsh_demux(g_acq_data_width-1 downto 0);
+         acq_dvalid_demux_reg <= acq_dvalid_demux;
+         acq_id_demux_reg <= acq_id_demux;
+         acq_trig_demux_reg <= acq_trig_demux;
+       end if;
      end if;
    end if;
  end process;
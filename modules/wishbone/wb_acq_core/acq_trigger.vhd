@@ -76,6 +76,8 @@ port
 
   -- Current channel selection ID
   lmt_curr_chan_id_i                        : in unsigned(c_chan_id_width-1 downto 0);
+  -- Words per multi-channel frame, in log2. The trigger is aligned to frames
+  lmt_frame_size_log2_i                     : in unsigned(c_acq_frame_size_log2_width-1 downto 0) := (others => '0');
   -- Acquisition limits valid signal
   lmt_valid_i                               : in std_logic;
 
@@ -102,7 +104,8 @@ architecture rtl of acq_trigger is
   --constant c_trigger_align_samples          : natural := g_ddr_payload_width/c_narrowest_channel_width;
   constant c_trigger_coalesce_align         : natural := f_acq_chan_find_widest_num_coalesce(g_acq_channels);
   constant c_trigger_ddr_payload_align      : natural := g_ddr_payload_width/c_narrowest_channel_width;
-  constant c_trigger_align_samples          : natural := max(c_trigger_coalesce_align, c_trigger_ddr_payload_align);
+  constant c_trigger_align_samples          : natural := max(max(c_trigger_coalesce_align, c_trigger_ddr_payload_align),
+                                                             c_acq_max_frame_size);
   constant c_trigger_align_width            : natural := f_log2_size(c_trigger_align_samples);
 
   constant c_int_data_hysteresis_depth      : natural := 8;
@@ -177,6 +180,7 @@ architecture rtl of acq_trigger is
   signal acq_trig_align_cnt                 : unsigned(c_trigger_align_width-1 downto 0);
   signal acq_trig_align_cnt_en              : std_logic;
   signal acq_min_align_max                  : unsigned(c_trigger_align_width-1 downto 0);
+  signal acq_coalesce_align_max             : unsigned(c_trigger_align_width-1 downto 0);
 
   signal int_trig                           : std_logic;
   signal int_trig_over_thres                : std_logic;
@@ -231,6 +235,7 @@ begin
         acq_num_atoms_uncoalesced <= to_unsigned(0, acq_num_atoms_uncoalesced'length);
         acq_num_atoms_uncoalesced_log2 <= to_unsigned(0, acq_num_atoms_uncoalesced_log2'length);
         acq_min_align_max <= to_unsigned(0, acq_min_align_max'length);
+        acq_coalesce_align_max <= to_unsigned(0, acq_coalesce_align_max'length);
       else
         lmt_valid <= lmt_valid_i;
 
@@ -243,8 +248,11 @@ begin
                                 acq_num_atoms_uncoalesced'length);
           acq_num_atoms_uncoalesced_log2 <= to_unsigned(c_num_atoms_uncoalesced_log2_array(to_integer(lmt_curr_chan_id_i)),
                                 acq_num_atoms_uncoalesced_log2'length);
-          acq_min_align_max <= to_unsigned(c_min_align_array(to_integer(lmt_curr_chan_id_i)),
-                                acq_min_align_max'length) - 1;
+          -- Frames of channels are handled just like coalesced samples
+          acq_min_align_max <= to_unsigned(max(c_min_align_array(to_integer(lmt_curr_chan_id_i)),
+                                2**to_integer(lmt_frame_size_log2_i)), acq_min_align_max'length) - 1;
+          acq_coalesce_align_max <= to_unsigned(c_num_coalesce_array(to_integer(lmt_curr_chan_id_i)) *
+                                2**to_integer(lmt_frame_size_log2_i), acq_coalesce_align_max'length) - 1;
       else
         end if;
       end if;
@@ -522,10 +530,18 @@ begin
         -- valid values in all cases.
         if (trig_det = '1' or trig_unaligned = '1') and trig_align = '0' then
 
-          -- No need for trigger alignment if using multishot RAM
-          if acq_single_shot_i = '0' then
+          -- No need for trigger alignment to the DDR3 payload word if using
+          -- multishot RAM, but the trigger must still be at the first word
+          -- of a coalesced sample or frame
+          if acq_single_shot_i = '0' and acq_coalesce_align_max = 0 then
             trig_align <= '1';
             trig_cnt_off <= to_unsigned(0, trig_cnt_off'length);
+          elsif acq_single_shot_i = '0' then
+            if (acq_trig_align_cnt and acq_coalesce_align_max) = acq_coalesce_align_max-1 and
+                acq_valid_sel_out = '1' then -- will increment to the first word
+              trig_align <= '1';
+            end if;
+            trig_cnt_off <= to_unsigned(0, trig_cnt_off'length);
           else
             if acq_trig_align_cnt = acq_min_align_max-1 and acq_valid_sel_out = '1' then -- will increment to the first atom
               trig_align <= '1'; -- Output trigger aligned with the first atom
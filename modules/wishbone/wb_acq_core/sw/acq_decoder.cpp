@@ -0,0 +1,336 @@
+/*
+ * Acquisition core host-side sample decoder
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "acq_decoder.h"
+#include "acq_kernels.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../wbgen/wb_acq_core_regs.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "The acquisition buffers are little-endian, big-endian hosts are not supported"
+#endif
+
+namespace acq_core {
+
+/* Distance between two consecutive channel description registers */
+static constexpr uint32_t ch_desc_stride = ACQ_CORE_REG_CH1_DESC - ACQ_CORE_REG_CH0_DESC;
+
+ChannelDesc ChannelDesc::from_regs(uint32_t desc, uint32_t atom_desc)
+{
+    /* All channels share the same field layout, so CH0 macros are used */
+    ChannelDesc d;
+    d.int_width = ACQ_CORE_CH0_DESC_INT_WIDTH_R(desc);
+    d.num_coalesce = ACQ_CORE_CH0_DESC_NUM_COALESCE_R(desc);
+    d.num_atoms = ACQ_CORE_CH0_ATOM_DESC_NUM_ATOMS_R(atom_desc);
+    d.atom_width = ACQ_CORE_CH0_ATOM_DESC_ATOM_WIDTH_R(atom_desc);
+    return d;
+}
+
+void ChannelDesc::validate() const
+{
+    if (int_width == 0 || int_width % 8 != 0)
+        throw std::invalid_argument("channel width must be a non-zero multiple of 8 bits");
+    if (num_coalesce == 0)
+        throw std::invalid_argument("number of coalescing words must not be zero");
+    if (num_atoms == 0 || atom_width == 0)
+        throw std::invalid_argument("channel has no atoms");
+    if (atom_width > 56 && atom_width != 64)
+        throw std::invalid_argument("unsupported atom width " + std::to_string(atom_width));
+    if (static_cast<unsigned long>(num_atoms) * atom_width > sample_bits())
+        throw std::invalid_argument("atoms don't fit inside the channel sample");
+}
+
+CoreDesc read_core_desc(const RegRead &rd)
+{
+    CoreDesc core;
+
+    core.num_channels = ACQ_CORE_ACQ_CHAN_CTL_NUM_CHAN_R(rd(ACQ_CORE_REG_ACQ_CHAN_CTL));
+    if (core.num_channels > max_channels)
+        core.num_channels = max_channels;
+
+    for (unsigned i = 0; i < core.num_channels; i++) {
+        uint32_t desc = rd(ACQ_CORE_REG_CH0_DESC + i * ch_desc_stride);
+        uint32_t atom_desc = rd(ACQ_CORE_REG_CH0_ATOM_DESC + i * ch_desc_stride);
+        core.channels[i] = ChannelDesc::from_regs(desc, atom_desc);
+    }
+
+    return core;
+}
+
+FrameDesc FrameDesc::from_mask(const CoreDesc &core, uint32_t chan_mask, unsigned ref_chan)
+{
+    FrameDesc f;
+
+    if (ref_chan >= core.num_channels)
+        throw std::invalid_argument("reference channel out of range");
+
+    const ChannelDesc &ref = core.channels[ref_chan];
+    for (unsigned i = 0; i < core.num_channels; i++) {
+        if (!((chan_mask >> i) & 1))
+            continue;
+        const ChannelDesc &d = core.channels[i];
+        if (d.int_width != ref.int_width || d.num_coalesce != 1)
+            throw std::invalid_argument("channel " + std::to_string(i) +
+                                        " can't be part of a frame of channel " +
+                                        std::to_string(ref_chan));
+        f.channels.push_back(i);
+    }
+
+    if (f.channels.empty())
+        throw std::invalid_argument("frame has no channels");
+    if (f.channels.size() > max_frame_words)
+        throw std::invalid_argument("frame can't hold more than " +
+                                    std::to_string(max_frame_words) + " channels");
+
+    /* Same rounding as f_acq_chan_mask_frame_log2 */
+    unsigned words = 1;
+    while (words < f.channels.size())
+        words *= 2;
+
+    f.desc.int_width = ref.int_width;
+    f.desc.num_coalesce = words;
+    f.desc.atom_width = core.channels[f.channels[0]].atom_width;
+    for (unsigned c : f.channels)
+        if (core.channels[c].atom_width != f.desc.atom_width)
+            throw std::invalid_argument("frame channels must have the same atom width");
+
+    /* Atoms are numbered across the whole frame, so each word must hold a
+     * whole number of them. The padding words are not decoded */
+    if (f.desc.atom_width == 0 || ref.int_width % f.desc.atom_width != 0)
+        throw std::invalid_argument("frame channel width must be a multiple of the atom width");
+    f.atoms_per_chan = ref.int_width / f.desc.atom_width;
+    f.desc.num_atoms = f.atoms_per_chan * static_cast<unsigned>(f.channels.size());
+    f.desc.validate();
+    return f;
+}
+
+FrameDesc FrameDesc::from_regs(const RegRead &rd, const CoreDesc &core)
+{
+    uint32_t ctl = rd(ACQ_CORE_REG_ACQ_CHAN_CTL);
+    uint32_t mask = ACQ_CORE_ACQ_CHAN_MASK_MASK_R(rd(ACQ_CORE_REG_ACQ_CHAN_MASK));
+    return from_mask(core, mask, ACQ_CORE_ACQ_CHAN_CTL_WHICH_R(ctl));
+}
+
+unsigned FrameDesc::first_atom(unsigned chan) const
+{
+    for (std::size_t i = 0; i < channels.size(); i++)
+        if (channels[i] == chan)
+            return static_cast<unsigned>(i) * atoms_per_chan;
+    throw std::out_of_range("channel " + std::to_string(chan) + " is not part of the frame");
+}
+
+SimdLevel simd_level()
+{
+#ifdef ACQ_KERNELS_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return SimdLevel::avx2;
+        if (__builtin_cpu_supports("sse4.1"))
+            return SimdLevel::sse41;
+        return SimdLevel::scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::scalar;
+#endif
+}
+
+ChannelDecoder::ChannelDecoder(const ChannelDesc &desc, bool sign_extend,
+                               SimdLevel max_simd) :
+    desc_(desc), sign_extend_(sign_extend), simd_(std::min(max_simd, simd_level()))
+{
+    desc_.validate();
+}
+
+/* Extract 'width' bits starting at bit 'bit_ofs' of 'p'. Only the bytes
+ * containing the atom are touched, so it never reads past the sample */
+static inline uint64_t extract_bits(const uint8_t *p, std::size_t bit_ofs, unsigned width)
+{
+    const uint8_t *b = p + bit_ofs / 8;
+    unsigned shift = bit_ofs % 8;
+    uint64_t v = 0;
+
+    if (width == 64) {
+        std::memcpy(&v, b, sizeof(v));
+        return v;
+    }
+
+    std::memcpy(&v, b, (shift + width + 7) / 8);
+    return (v >> shift) & ((UINT64_C(1) << width) - 1);
+}
+
+static inline int64_t to_signed(uint64_t v, unsigned width)
+{
+    if (width == 64)
+        return static_cast<int64_t>(v);
+    uint64_t m = UINT64_C(1) << (width - 1);
+    return static_cast<int64_t>((v ^ m) - m);
+}
+
+int64_t ChannelDecoder::atom(const void *buf, std::size_t sample, unsigned atom) const
+{
+    if (atom >= desc_.num_atoms)
+        throw std::out_of_range("atom index out of range");
+
+    const uint8_t *p = static_cast<const uint8_t *>(buf) + sample * desc_.sample_bytes();
+    uint64_t v = extract_bits(p, static_cast<std::size_t>(atom) * desc_.atom_width,
+                              desc_.atom_width);
+
+    return sign_extend_ ? to_signed(v, desc_.atom_width) : static_cast<int64_t>(v);
+}
+
+/* Byte-aligned atoms: a single load per atom */
+template <typename W, typename T>
+static void decode_aligned(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                           unsigned natoms, T *const *atoms)
+{
+    for (std::size_t i = 0; i < nsamples; i++, p += stride) {
+        for (unsigned k = 0; k < natoms; k++) {
+            W v;
+            std::memcpy(&v, p + k * sizeof(W), sizeof(W));
+            atoms[k][i] = static_cast<T>(v);
+        }
+    }
+}
+
+template <typename T>
+static void decode_generic(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                           unsigned natoms, unsigned width, bool sign_extend,
+                           T *const *atoms)
+{
+    for (std::size_t i = 0; i < nsamples; i++, p += stride) {
+        for (unsigned k = 0; k < natoms; k++) {
+            uint64_t v = extract_bits(p, static_cast<std::size_t>(k) * width, width);
+            atoms[k][i] = sign_extend ? static_cast<T>(to_signed(v, width)) : static_cast<T>(v);
+        }
+    }
+}
+
+/* Vector kernel for the given atom width, or nullptr if there is none */
+template <typename T>
+static kernels::DecodeKernel<T> find_kernel(SimdLevel level, unsigned atom_width)
+{
+#ifdef ACQ_KERNELS_X86
+    if (atom_width == 16) {
+        if (level == SimdLevel::avx2)
+            return kernels::decode16_avx2<T>;
+        if (level == SimdLevel::sse41)
+            return kernels::decode16_sse41<T>;
+    }
+    if constexpr (sizeof(T) >= 4) {
+        if (atom_width == 32) {
+            if (level == SimdLevel::avx2)
+                return kernels::decode32_avx2<T>;
+            if (level == SimdLevel::sse41)
+                return kernels::decode32_sse41<T>;
+        }
+    }
+#else
+    (void)level;
+    (void)atom_width;
+#endif
+    return nullptr;
+}
+
+template <typename T>
+void ChannelDecoder::decode(const void *buf, std::size_t nsamples, T *const *atoms) const
+{
+    static_assert(std::is_integral<T>::value, "atoms are decoded into integer arrays");
+
+    if (desc_.atom_width > sizeof(T) * 8)
+        throw std::invalid_argument("output type is narrower than the channel atoms");
+
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    std::size_t stride = desc_.sample_bytes();
+    unsigned natoms = desc_.num_atoms;
+
+    if (auto kernel = find_kernel<T>(simd_, desc_.atom_width)) {
+        kernel(p, nsamples, stride, natoms, sign_extend_, atoms);
+        return;
+    }
+
+    switch (desc_.atom_width) {
+    case 8:
+        if (sign_extend_)
+            decode_aligned<int8_t>(p, nsamples, stride, natoms, atoms);
+        else
+            decode_aligned<uint8_t>(p, nsamples, stride, natoms, atoms);
+        break;
+    case 16:
+        if (sign_extend_)
+            decode_aligned<int16_t>(p, nsamples, stride, natoms, atoms);
+        else
+            decode_aligned<uint16_t>(p, nsamples, stride, natoms, atoms);
+        break;
+    case 32:
+        if (sign_extend_)
+            decode_aligned<int32_t>(p, nsamples, stride, natoms, atoms);
+        else
+            decode_aligned<uint32_t>(p, nsamples, stride, natoms, atoms);
+        break;
+    case 64:
+        decode_aligned<uint64_t>(p, nsamples, stride, natoms, atoms);
+        break;
+    default:
+        decode_generic(p, nsamples, stride, natoms, desc_.atom_width, sign_extend_, atoms);
+        break;
+    }
+}
+
+template void ChannelDecoder::decode<int16_t>(const void *, std::size_t, int16_t *const *) const;
+template void ChannelDecoder::decode<int32_t>(const void *, std::size_t, int32_t *const *) const;
+template void ChannelDecoder::decode<int64_t>(const void *, std::size_t, int64_t *const *) const;
+
+MappedFile::MappedFile(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "open " + path);
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "stat " + path);
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0) {
+        data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data_ == MAP_FAILED) {
+            int err = errno;
+            data_ = nullptr;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "mmap " + path);
+        }
+        /* Samples are always decoded front to back */
+        madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_)
+        munmap(data_, size_);
+}
+
+} /* namespace acq_core */
@@ -0,0 +1,148 @@
+/*
+ * Acquisition core host-side sample decoder
+ *
+ * Decodes raw acquisition buffers read back from the DDR3 memory into
+ * per-atom arrays, using the channel description registers exported by
+ * wb_acq_core (ACQ_CORE_CHn_DESC and ACQ_CORE_CHn_ATOM_DESC).
+ *
+ * A sample of channel n occupies INT_WIDTH*NUM_COALESCE bits in memory and
+ * is stored little-endian, with consecutive samples packed back-to-back
+ * (see acq_fc_fifo.vhd). Inside a sample, atom k occupies the bits
+ * [k*ATOM_WIDTH, (k+1)*ATOM_WIDTH).
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef ACQ_DECODER_H
+#define ACQ_DECODER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace acq_core {
+
+/* Number of channel description registers in the acq_core register map */
+constexpr unsigned max_channels = 24;
+/* Longest multi-channel frame, in words (c_acq_max_frame_size) */
+constexpr unsigned max_frame_words = 16;
+
+/* Contents of the ACQ_CORE_CHn_DESC and ACQ_CORE_CHn_ATOM_DESC registers */
+struct ChannelDesc {
+    unsigned int_width = 0;     /* Channel width of each DDR3 word, in bits */
+    unsigned num_coalesce = 0;  /* Number of words making up one sample */
+    unsigned num_atoms = 0;     /* Number of atoms inside a sample */
+    unsigned atom_width = 0;    /* Atom width, in bits */
+
+    static ChannelDesc from_regs(uint32_t desc, uint32_t atom_desc);
+
+    unsigned sample_bits() const { return int_width * num_coalesce; }
+    std::size_t sample_bytes() const { return sample_bits() / 8; }
+    /* Throws std::invalid_argument if the description can't be decoded */
+    void validate() const;
+};
+
+/* Register read accessor. Receives a byte offset from the acq_core base
+ * address (e.g. ACQ_CORE_REG_CH0_DESC) and returns the 32-bit register
+ * value */
+using RegRead = std::function<uint32_t(uint32_t offset)>;
+
+struct CoreDesc {
+    unsigned num_channels = 0;
+    std::array<ChannelDesc, max_channels> channels{};
+};
+
+/* Read the number of channels and every channel description, only once */
+CoreDesc read_core_desc(const RegRead &rd);
+
+/* Layout of a multi-channel frame acquisition (ACQ_CHAN_MASK.MASK set).
+ *
+ * On each sample of the reference channel (ACQ_CHAN_CTL.WHICH), the latest
+ * sample of every channel in the mask is stored, in ascending channel order
+ * and padded with zeroes up to a power of 2 number of words. A frame is then
+ * decoded as a single sample of 'desc', in which channel channels[i] takes
+ * the atoms [i*atoms_per_chan, (i+1)*atoms_per_chan) */
+struct FrameDesc {
+    ChannelDesc desc;
+    std::vector<unsigned> channels;
+    unsigned atoms_per_chan = 0;
+
+    /* Throws std::invalid_argument if the mask is empty, has more channels
+     * than a frame can hold, or selects channels which aren't single word
+     * channels as wide as the reference one */
+    static FrameDesc from_mask(const CoreDesc &core, uint32_t chan_mask, unsigned ref_chan);
+    static FrameDesc from_regs(const RegRead &rd, const CoreDesc &core);
+
+    unsigned first_atom(unsigned chan) const;
+};
+
+/* Instruction set used by the atom de-interleaving kernels */
+enum class SimdLevel {
+    scalar,
+    sse41,
+    avx2,
+};
+
+/* Best instruction set supported by the running CPU. Detected once */
+SimdLevel simd_level();
+
+/* Decodes a raw buffer of a single channel. It never copies the input, so it
+ * can be pointed directly to a memory-mapped dump or DMA buffer */
+class ChannelDecoder {
+public:
+    /* 'max_simd' limits the instruction set used by decode(). The best one
+     * supported by the CPU, up to that limit, is picked */
+    explicit ChannelDecoder(const ChannelDesc &desc, bool sign_extend = true,
+                            SimdLevel max_simd = SimdLevel::avx2);
+
+    const ChannelDesc &desc() const { return desc_; }
+    bool sign_extend() const { return sign_extend_; }
+    SimdLevel simd() const { return simd_; }
+
+    /* Number of complete samples inside a buffer of 'nbytes' bytes */
+    std::size_t num_samples(std::size_t nbytes) const
+    {
+        return nbytes / desc_.sample_bytes();
+    }
+
+    /* Read a single atom of a single sample */
+    int64_t atom(const void *buf, std::size_t sample, unsigned atom) const;
+
+    /* Unpack 'nsamples' samples starting at 'buf' into structure-of-arrays
+     * form: atoms[k][i] receives atom k of sample i. Each atoms[k] must
+     * hold at least 'nsamples' elements. T must be wide enough to hold an
+     * atom (int16_t, int32_t or int64_t). 16-bit and 32-bit atoms are
+     * transposed with SIMD kernels, other widths are unpacked one by one */
+    template <typename T>
+    void decode(const void *buf, std::size_t nsamples, T *const *atoms) const;
+
+private:
+    ChannelDesc desc_;
+    bool sign_extend_;
+    SimdLevel simd_;
+};
+
+/* Read-only memory mapping of an acquisition dump file */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const void *data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    void *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} /* namespace acq_core */
+
+#endif
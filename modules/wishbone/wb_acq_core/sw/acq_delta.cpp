@@ -0,0 +1,253 @@
+/*
+ * Acquisition core delta-compressed data decoder
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "acq_delta.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "acq_kernels.h"
+#include "../wbgen/wb_acq_core_regs.h"
+
+namespace acq_core {
+
+CompConfig CompConfig::from_regs(const RegRead &rd)
+{
+    uint32_t ctl = rd(ACQ_CORE_REG_ACQ_COMP_CTL);
+
+    CompConfig comp;
+    comp.enable = ctl & ACQ_CORE_ACQ_COMP_CTL_EN;
+    comp.block_log2 = ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_R(ctl);
+    comp.active = ctl & ACQ_CORE_ACQ_COMP_CTL_ACTIVE;
+    comp.overflow = ctl & ACQ_CORE_ACQ_COMP_CTL_OVF;
+    comp.available = ctl & ACQ_CORE_ACQ_COMP_CTL_AVAIL;
+    return comp;
+}
+
+namespace {
+
+/* LSB first reader over a byte buffer. Callers check the remaining bits */
+class BitReader {
+public:
+    BitReader(const uint8_t *p, std::size_t nbytes) : p_(p), nbytes_(nbytes) {}
+
+    std::size_t remaining() const { return nbytes_ * 8 - pos_; }
+    std::size_t pos() const { return pos_; }
+
+    uint64_t read(unsigned n)
+    {
+        if (n == 0)
+            return 0;
+        if (n > 56) {
+            uint64_t lo = read(32);
+            return lo | read(n - 32) << 32;
+        }
+
+        std::size_t byte = pos_ / 8;
+        uint64_t v = 0;
+        std::memcpy(&v, p_ + byte, std::min<std::size_t>(sizeof(v), nbytes_ - byte));
+        v = (v >> (pos_ % 8)) & ((UINT64_C(1) << n) - 1);
+        pos_ += n;
+        return v;
+    }
+
+private:
+    const uint8_t *p_;
+    std::size_t nbytes_;
+    std::size_t pos_ = 0;
+};
+
+uint64_t load_le64(const uint8_t *p)
+{
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+kernels::UndeltaKernel find_undelta_kernel(SimdLevel level)
+{
+#ifdef ACQ_KERNELS_X86
+    if (level == SimdLevel::avx2)
+        return kernels::undelta32_avx2;
+    if (level == SimdLevel::sse41)
+        return kernels::undelta32_sse41;
+#else
+    (void)level;
+#endif
+    return nullptr;
+}
+
+template <typename W, typename T>
+void store_atoms(const W *v, std::size_t n, unsigned width, bool sign_extend, T *dst)
+{
+    const unsigned shift = 64 - width;
+
+    for (std::size_t i = 0; i < n; i++) {
+        uint64_t u = static_cast<uint64_t>(v[i]) << shift;
+        dst[i] = sign_extend ? static_cast<T>(static_cast<int64_t>(u) >> shift) :
+                               static_cast<T>(u >> shift);
+    }
+}
+
+} /* namespace */
+
+DeltaDecoder::DeltaDecoder(const ChannelDesc &desc, bool sign_extend, SimdLevel max_simd) :
+    desc_(desc), sign_extend_(sign_extend), simd_(std::min(max_simd, simd_level()))
+{
+    desc_.validate();
+
+    if (desc_.num_coalesce != 1)
+        throw std::invalid_argument("coalesced channels are not compressed");
+    if (desc_.atom_width > 64)
+        throw std::invalid_argument("atoms wider than 64 bits can't be decoded");
+
+    /* See f_acq_chan_word_width */
+    word_bytes_ = desc_.int_width > 64 ? 16 : 8;
+    if (desc_.num_atoms * desc_.atom_width > word_bytes_ * 8)
+        throw std::invalid_argument("atoms don't fit in a channel word");
+
+    tag_bits_ = 1;
+    while ((1u << tag_bits_) < desc_.atom_width + 2)
+        tag_bits_++;
+}
+
+bool DeltaDecoder::parse_header(const void *buf, DeltaBlockHeader &hdr) const
+{
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    uint64_t v = load_le64(p);
+
+    if ((v & 0xffff) != delta_magic)
+        return false;
+
+    hdr.seq = static_cast<uint16_t>(v >> 16);
+    hdr.atom_width = (v >> 32) & 0xff;
+    hdr.num_atoms = (v >> 40) & 0xff;
+    hdr.block_log2 = (v >> 48) & 0xf;
+
+    if (hdr.atom_width != desc_.atom_width || hdr.num_atoms != desc_.num_atoms ||
+        (v >> 52) != 0)
+        return false;
+
+    for (std::size_t i = 8; i < word_bytes_; i++)
+        if (p[i])
+            return false;
+
+    return true;
+}
+
+std::size_t DeltaDecoder::find_block(const void *buf, std::size_t nbytes, std::size_t from) const
+{
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    DeltaBlockHeader hdr;
+
+    for (std::size_t ofs = (from + word_bytes_ - 1) / word_bytes_ * word_bytes_;
+         ofs + word_bytes_ <= nbytes; ofs += word_bytes_)
+        if (parse_header(p + ofs, hdr))
+            return ofs;
+
+    return nbytes;
+}
+
+template <typename T>
+std::size_t DeltaDecoder::decode_block(const void *buf, std::size_t nbytes, T *const *atoms,
+                                       std::size_t max_samples, std::size_t &nsamples,
+                                       DeltaBlockHeader *hdr_out) const
+{
+    static_assert(std::is_integral<T>::value, "atoms are decoded into integer arrays");
+
+    if (desc_.atom_width > sizeof(T) * 8)
+        throw std::invalid_argument("output type is narrower than the channel atoms");
+
+    nsamples = 0;
+    if (nbytes < word_bytes_)
+        return 0;
+
+    DeltaBlockHeader hdr;
+    if (!parse_header(buf, hdr))
+        throw std::runtime_error("no block header");
+
+    const unsigned width = desc_.atom_width;
+    const unsigned natoms = desc_.num_atoms;
+    const uint64_t end_tag = (UINT64_C(1) << tag_bits_) - 1;
+    const std::size_t nmax = std::min(max_samples, hdr.max_samples());
+    /* Atoms up to 32 bits are rebuilt in 32-bit lanes, the others in
+     * 64-bit ones */
+    const bool narrow = width <= 32;
+
+    std::vector<uint32_t> d32(narrow ? nmax * natoms : 0);
+    std::vector<uint64_t> d64(narrow ? 0 : nmax * natoms);
+
+    BitReader rd(static_cast<const uint8_t *>(buf) + word_bytes_, nbytes - word_bytes_);
+    std::size_t n = 0;
+
+    /* Unpack the differences, one array per atom */
+    for (;;) {
+        if (rd.remaining() < tag_bits_)
+            return 0;
+
+        uint64_t tag = rd.read(tag_bits_);
+        if (tag == end_tag)
+            break;
+        if (tag > width)
+            throw std::runtime_error("bad sample width " + std::to_string(tag));
+        if (n == nmax)
+            throw std::runtime_error("block has more than " + std::to_string(nmax) + " samples");
+        if (rd.remaining() < tag * natoms)
+            return 0;
+
+        unsigned w = static_cast<unsigned>(tag);
+        for (unsigned k = 0; k < natoms; k++) {
+            uint64_t z = rd.read(w);
+            if (narrow)
+                d32[k * nmax + n] = static_cast<uint32_t>(z);
+            else
+                d64[k * nmax + n] = z;
+        }
+        n++;
+    }
+
+    /* Rebuild the atoms */
+    auto undelta = narrow ? find_undelta_kernel(simd_) : nullptr;
+
+    for (unsigned k = 0; k < natoms; k++) {
+        if (narrow) {
+            uint32_t *v = d32.data() + k * nmax;
+            if (undelta)
+                undelta(v, n);
+            else
+                kernels::scalar_undelta<uint32_t>(v, 0, n, 0);
+            store_atoms(v, n, width, sign_extend_, atoms[k]);
+        } else {
+            uint64_t *v = d64.data() + k * nmax;
+            kernels::scalar_undelta<uint64_t>(v, 0, n, 0);
+            store_atoms(v, n, width, sign_extend_, atoms[k]);
+        }
+    }
+
+    nsamples = n;
+    if (hdr_out)
+        *hdr_out = hdr;
+
+    std::size_t bits = word_bytes_ * 8 + rd.pos();
+    return (bits + word_bytes_ * 8 - 1) / (word_bytes_ * 8) * word_bytes_;
+}
+
+template std::size_t DeltaDecoder::decode_block<int16_t>(const void *, std::size_t, int16_t *const *,
+                                                         std::size_t, std::size_t &,
+                                                         DeltaBlockHeader *) const;
+template std::size_t DeltaDecoder::decode_block<int32_t>(const void *, std::size_t, int32_t *const *,
+                                                         std::size_t, std::size_t &,
+                                                         DeltaBlockHeader *) const;
+template std::size_t DeltaDecoder::decode_block<int64_t>(const void *, std::size_t, int64_t *const *,
+                                                         std::size_t, std::size_t &,
+                                                         DeltaBlockHeader *) const;
+
+} /* namespace acq_core */
@@ -0,0 +1,100 @@
+/*
+ * Acquisition core delta-compressed data decoder
+ *
+ * With ACQ_COMP_CTL.EN set, a streaming acquisition of a channel with
+ * NUM_COALESCE = 1 is written to DDR3 compressed by acq_delta_enc.vhd. The
+ * stream is made of words as wide as the channel words (INT_WIDTH rounded
+ * up to 64 or 128 bits), with bits packed LSB first:
+ *
+ *   block  = header word, samples, end tag, zeros up to the next word
+ *   header = magic 0xDE1A [15:0], sequence number [31:16], atom width
+ *            [39:32], number of atoms [47:40], log2 of the block size [51:48]
+ *   sample = tag w (T bits), then each atom as a w-bit zig-zag encoded
+ *            difference to the same atom of the previous sample
+ *   end    = T bits set
+ *
+ * T is the number of bits needed to hold ATOM_WIDTH+1, and the first sample
+ * of each block is a difference to zero, so every block can be decoded on
+ * its own. The block in progress when the acquisition is stopped is closed
+ * early, so it may hold fewer samples.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef ACQ_DELTA_H
+#define ACQ_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "acq_decoder.h"
+
+namespace acq_core {
+
+constexpr uint16_t delta_magic = 0xde1a;
+
+struct DeltaBlockHeader {
+    uint16_t seq = 0;
+    unsigned atom_width = 0;
+    unsigned num_atoms = 0;
+    unsigned block_log2 = 0;
+
+    std::size_t max_samples() const { return std::size_t(1) << block_log2; }
+};
+
+/* Settings of ACQ_COMP_CTL */
+struct CompConfig {
+    bool enable = false;
+    unsigned block_log2 = 0;
+    bool active = false;    /* The current acquisition is compressed */
+    bool overflow = false;  /* Samples were dropped, see find_block() */
+    bool available = false; /* g_with_delta_comp */
+
+    static CompConfig from_regs(const RegRead &rd);
+};
+
+class DeltaDecoder {
+public:
+    /* Throws std::invalid_argument for coalesced channels or atoms wider
+     * than 64 bits */
+    explicit DeltaDecoder(const ChannelDesc &desc, bool sign_extend = true,
+                          SimdLevel max_simd = SimdLevel::avx2);
+
+    const ChannelDesc &desc() const { return desc_; }
+    SimdLevel simd() const { return simd_; }
+    /* Size of the compressed stream words */
+    std::size_t word_bytes() const { return word_bytes_; }
+
+    /* Parse the header at 'buf'. Returns false if it isn't a valid header
+     * for this channel */
+    bool parse_header(const void *buf, DeltaBlockHeader &hdr) const;
+
+    /* Offset of the first block header at or after 'from' (rounded up to a
+     * word), or 'nbytes' if there is none. Used to resume decoding after
+     * dropped samples or overwritten data. Compressed data may look like a
+     * header, so the block found is only trusted once it decodes */
+    std::size_t find_block(const void *buf, std::size_t nbytes, std::size_t from = 0) const;
+
+    /* Decode the block at the start of 'buf', which holds 'nbytes' bytes.
+     * atoms[k] receives atom k of each sample and must have room for
+     * 'max_samples' elements. Returns the size of the block, in bytes, and
+     * sets 'nsamples', or returns 0 if the block doesn't end inside 'buf'.
+     * Throws std::runtime_error for a corrupted block or one with more than
+     * 'max_samples' samples */
+    template <typename T>
+    std::size_t decode_block(const void *buf, std::size_t nbytes, T *const *atoms,
+                             std::size_t max_samples, std::size_t &nsamples,
+                             DeltaBlockHeader *hdr = nullptr) const;
+
+private:
+    ChannelDesc desc_;
+    bool sign_extend_;
+    SimdLevel simd_;
+    std::size_t word_bytes_;
+    unsigned tag_bits_;
+};
+
+} /* namespace acq_core */
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * Acquisition core atom de-interleaving kernels (internal header)
+ *
+ * Each kernel transposes 'nsamples' samples of 'stride' bytes, holding
+ * 'natoms' packed 16-bit or 32-bit atoms, into structure-of-arrays form.
+ * The SSE4.1 and AVX2 variants are built in separate translation units with
+ * their own instruction set flags and are only called after checking the
+ * CPU at runtime.
+ *
+ * The undelta kernels rebuild the atoms of a delta-compressed block (see
+ * acq_delta.h) from their zig-zag encoded differences, with a prefix sum.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef ACQ_KERNELS_H
+#define ACQ_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace acq_core {
+namespace kernels {
+
+template <typename T>
+using DecodeKernel = void (*)(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                              unsigned natoms, bool sign_extend, T *const *atoms);
+
+/* In place: v[i] becomes the sum of the decoded differences v[0..i], modulo
+ * 2**32. Atoms up to 32 bits wide are rebuilt in 32-bit lanes and truncated
+ * afterwards */
+using UndeltaKernel = void (*)(uint32_t *v, std::size_t n);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ACQ_KERNELS_X86 1
+
+template <typename T>
+void decode16_sse41(const uint8_t *, std::size_t, std::size_t, unsigned, bool, T *const *);
+template <typename T>
+void decode32_sse41(const uint8_t *, std::size_t, std::size_t, unsigned, bool, T *const *);
+template <typename T>
+void decode16_avx2(const uint8_t *, std::size_t, std::size_t, unsigned, bool, T *const *);
+template <typename T>
+void decode32_avx2(const uint8_t *, std::size_t, std::size_t, unsigned, bool, T *const *);
+
+void undelta32_sse41(uint32_t *v, std::size_t n);
+void undelta32_avx2(uint32_t *v, std::size_t n);
+#endif
+
+/* Scalar copy of atoms [k0, k1) of samples [i0, i1), used for the leftovers
+ * of the vector loops. It is static on purpose: every kernel translation
+ * unit gets its own copy, built with its own instruction set flags */
+template <typename W, typename T>
+static inline void scalar_atoms(const uint8_t *p, std::size_t i0, std::size_t i1,
+                                unsigned k0, unsigned k1, std::size_t stride,
+                                T *const *atoms)
+{
+    for (std::size_t i = i0; i < i1; i++) {
+        for (unsigned k = k0; k < k1; k++) {
+            W v;
+            std::memcpy(&v, p + i * stride + k * sizeof(W), sizeof(W));
+            atoms[k][i] = static_cast<T>(v);
+        }
+    }
+}
+
+/* Zig-zag decoding: 0, 1, 2, 3, 4 ... back to 0, -1, 1, -2, 2 ... */
+template <typename W>
+static inline W unzigzag(W z)
+{
+    return (z >> 1) ^ (W(0) - (z & 1));
+}
+
+/* Scalar undelta of v[i0, n), 'prev' being the value of v[i0-1] */
+template <typename W>
+static inline void scalar_undelta(W *v, std::size_t i0, std::size_t n, W prev)
+{
+    for (std::size_t i = i0; i < n; i++) {
+        prev += unzigzag(v[i]);
+        v[i] = prev;
+    }
+}
+
+} /* namespace kernels */
+} /* namespace acq_core */
+
+#endif
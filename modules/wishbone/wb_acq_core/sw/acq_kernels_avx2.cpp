@@ -0,0 +1,287 @@
+/*
+ * Acquisition core atom de-interleaving kernels, AVX2 version
+ *
+ * Must be built with -mavx2. Works like the SSE4.1 version, but each 128-bit
+ * lane transposes a different group of samples: the low lane takes samples
+ * 0..7 (0..3 for 32-bit atoms) and the high lane the next group, so every
+ * transposed register holds 16 (8) consecutive samples of one atom.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "acq_kernels.h"
+
+#ifdef ACQ_KERNELS_X86
+
+#include <immintrin.h>
+
+namespace acq_core {
+namespace kernels {
+
+namespace {
+
+inline __m256i load2x128(const uint8_t *lo, const uint8_t *hi)
+{
+    __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo));
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(l), h, 1);
+}
+
+inline __m256i load2x64(const uint8_t *lo, const uint8_t *hi)
+{
+    __m128i l = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(lo));
+    __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(hi));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(l), h, 1);
+}
+
+inline void store128(void *p, __m128i v)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+}
+
+inline void store256(void *p, __m256i v)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+}
+
+/* Store 16 16-bit atoms, widening them to T */
+template <typename T, bool S>
+inline void store16(T *dst, __m256i v)
+{
+    if constexpr (sizeof(T) == 2) {
+        store256(dst, v);
+    } else {
+        __m128i h[2] = { _mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1) };
+
+        for (int j = 0; j < 2; j++) {
+            if constexpr (sizeof(T) == 4) {
+                store256(dst + 8 * j, S ? _mm256_cvtepi16_epi32(h[j]) :
+                                          _mm256_cvtepu16_epi32(h[j]));
+            } else {
+                __m128i q = _mm_srli_si128(h[j], 8);
+                store256(dst + 8 * j, S ? _mm256_cvtepi16_epi64(h[j]) :
+                                          _mm256_cvtepu16_epi64(h[j]));
+                store256(dst + 8 * j + 4, S ? _mm256_cvtepi16_epi64(q) :
+                                              _mm256_cvtepu16_epi64(q));
+            }
+        }
+    }
+}
+
+/* Store 8 32-bit atoms, widening them to T */
+template <typename T, bool S>
+inline void store32(T *dst, __m256i v)
+{
+    if constexpr (sizeof(T) == 4) {
+        store256(dst, v);
+    } else {
+        __m128i l = _mm256_castsi256_si128(v);
+        __m128i h = _mm256_extracti128_si256(v, 1);
+        store256(dst, S ? _mm256_cvtepi32_epi64(l) : _mm256_cvtepu32_epi64(l));
+        store256(dst + 4, S ? _mm256_cvtepi32_epi64(h) : _mm256_cvtepu32_epi64(h));
+    }
+}
+
+inline void transpose_8x16(__m256i r[8])
+{
+    __m256i t0 = _mm256_unpacklo_epi16(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi16(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi16(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi16(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi16(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi16(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi16(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi16(r[6], r[7]);
+
+    __m256i u0 = _mm256_unpacklo_epi32(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi32(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi32(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi32(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi32(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi32(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi32(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi32(t5, t7);
+
+    r[0] = _mm256_unpacklo_epi64(u0, u4);
+    r[1] = _mm256_unpackhi_epi64(u0, u4);
+    r[2] = _mm256_unpacklo_epi64(u1, u5);
+    r[3] = _mm256_unpackhi_epi64(u1, u5);
+    r[4] = _mm256_unpacklo_epi64(u2, u6);
+    r[5] = _mm256_unpackhi_epi64(u2, u6);
+    r[6] = _mm256_unpacklo_epi64(u3, u7);
+    r[7] = _mm256_unpackhi_epi64(u3, u7);
+}
+
+inline void transpose_4x16(__m256i r[8])
+{
+    __m256i t0 = _mm256_unpacklo_epi16(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi16(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi16(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi16(r[6], r[7]);
+
+    __m256i u0 = _mm256_unpacklo_epi32(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi32(t0, t2);
+    __m256i u4 = _mm256_unpacklo_epi32(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi32(t4, t6);
+
+    r[0] = _mm256_unpacklo_epi64(u0, u4);
+    r[1] = _mm256_unpackhi_epi64(u0, u4);
+    r[2] = _mm256_unpacklo_epi64(u1, u5);
+    r[3] = _mm256_unpackhi_epi64(u1, u5);
+}
+
+inline void transpose_4x32(__m256i r[4])
+{
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+
+    r[0] = _mm256_unpacklo_epi64(t0, t2);
+    r[1] = _mm256_unpackhi_epi64(t0, t2);
+    r[2] = _mm256_unpacklo_epi64(t1, t3);
+    r[3] = _mm256_unpackhi_epi64(t1, t3);
+}
+
+inline void transpose_2x32(__m256i r[4])
+{
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+
+    r[0] = _mm256_unpacklo_epi64(t0, t2);
+    r[1] = _mm256_unpackhi_epi64(t0, t2);
+}
+
+template <typename T, bool S>
+void decode16(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+              unsigned natoms, T *const *atoms)
+{
+    using W = typename std::conditional<S, int16_t, uint16_t>::type;
+    std::size_t i = 0;
+
+    for (; i + 16 <= nsamples; i += 16) {
+        const uint8_t *s = p + i * stride;
+        __m256i r[8];
+        unsigned k = 0;
+
+        for (; k + 8 <= natoms; k += 8) {
+            for (int j = 0; j < 8; j++)
+                r[j] = load2x128(s + j * stride + 2 * k, s + (j + 8) * stride + 2 * k);
+            transpose_8x16(r);
+            for (int j = 0; j < 8; j++)
+                store16<T, S>(atoms[k + j] + i, r[j]);
+        }
+
+        if (k + 4 <= natoms) {
+            for (int j = 0; j < 8; j++)
+                r[j] = load2x64(s + j * stride + 2 * k, s + (j + 8) * stride + 2 * k);
+            transpose_4x16(r);
+            for (int j = 0; j < 4; j++)
+                store16<T, S>(atoms[k + j] + i, r[j]);
+            k += 4;
+        }
+
+        if (k < natoms)
+            scalar_atoms<W>(p, i, i + 16, k, natoms, stride, atoms);
+    }
+
+    scalar_atoms<W>(p, i, nsamples, 0, natoms, stride, atoms);
+}
+
+template <typename T, bool S>
+void decode32(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+              unsigned natoms, T *const *atoms)
+{
+    using W = typename std::conditional<S, int32_t, uint32_t>::type;
+    std::size_t i = 0;
+
+    for (; i + 8 <= nsamples; i += 8) {
+        const uint8_t *s = p + i * stride;
+        __m256i r[4];
+        unsigned k = 0;
+
+        for (; k + 4 <= natoms; k += 4) {
+            for (int j = 0; j < 4; j++)
+                r[j] = load2x128(s + j * stride + 4 * k, s + (j + 4) * stride + 4 * k);
+            transpose_4x32(r);
+            for (int j = 0; j < 4; j++)
+                store32<T, S>(atoms[k + j] + i, r[j]);
+        }
+
+        if (k + 2 <= natoms) {
+            for (int j = 0; j < 4; j++)
+                r[j] = load2x64(s + j * stride + 4 * k, s + (j + 4) * stride + 4 * k);
+            transpose_2x32(r);
+            for (int j = 0; j < 2; j++)
+                store32<T, S>(atoms[k + j] + i, r[j]);
+            k += 2;
+        }
+
+        if (k < natoms)
+            scalar_atoms<W>(p, i, i + 8, k, natoms, stride, atoms);
+    }
+
+    scalar_atoms<W>(p, i, nsamples, 0, natoms, stride, atoms);
+}
+
+} /* namespace */
+
+template <typename T>
+void decode16_avx2(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                   unsigned natoms, bool sign_extend, T *const *atoms)
+{
+    if (sign_extend)
+        decode16<T, true>(p, nsamples, stride, natoms, atoms);
+    else
+        decode16<T, false>(p, nsamples, stride, natoms, atoms);
+}
+
+template <typename T>
+void decode32_avx2(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                   unsigned natoms, bool sign_extend, T *const *atoms)
+{
+    if (sign_extend)
+        decode32<T, true>(p, nsamples, stride, natoms, atoms);
+    else
+        decode32<T, false>(p, nsamples, stride, natoms, atoms);
+}
+
+template void decode16_avx2<int16_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int16_t *const *);
+template void decode16_avx2<int32_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int32_t *const *);
+template void decode16_avx2<int64_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int64_t *const *);
+template void decode32_avx2<int32_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int32_t *const *);
+template void decode32_avx2<int64_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int64_t *const *);
+
+/* Prefix sum inside each 128-bit lane, then the low lane total is added to
+ * the high lane */
+void undelta32_avx2(uint32_t *v, std::size_t n)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256i carry = _mm256_setzero_si256();
+    std::size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i z = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(v + i));
+        __m256i d = _mm256_xor_si256(_mm256_srli_epi32(z, 1),
+                                     _mm256_sub_epi32(_mm256_setzero_si256(),
+                                                      _mm256_and_si256(z, one)));
+
+        d = _mm256_add_epi32(d, _mm256_slli_si256(d, 4));
+        d = _mm256_add_epi32(d, _mm256_slli_si256(d, 8));
+        __m256i lo_total = _mm256_shuffle_epi32(d, _MM_SHUFFLE(3, 3, 3, 3));
+        d = _mm256_add_epi32(d, _mm256_permute2x128_si256(lo_total, lo_total, 0x08));
+        d = _mm256_add_epi32(d, carry);
+        store256(v + i, d);
+        carry = _mm256_permutevar8x32_epi32(d, last);
+    }
+
+    scalar_undelta<uint32_t>(v, i, n,
+                             static_cast<uint32_t>(_mm256_cvtsi256_si32(carry)));
+}
+
+} /* namespace kernels */
+} /* namespace acq_core */
+
+#endif
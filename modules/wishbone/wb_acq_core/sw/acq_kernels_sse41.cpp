@@ -0,0 +1,272 @@
+/*
+ * Acquisition core atom de-interleaving kernels, SSE4.1 version
+ *
+ * Must be built with -msse4.1. 16-bit atoms are transposed 8 samples by
+ * 8 atoms at a time, 32-bit atoms 4 samples by 4 atoms at a time. When the
+ * number of atoms is not a multiple of that, a half-width transpose using
+ * 64-bit loads takes the next 4 (or 2) atoms and the remaining ones are
+ * copied one by one.
+ *
+ * The undelta kernel does the prefix sum of 4 lanes with two shifted adds,
+ * carrying the last lane over to the next 4 differences.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "acq_kernels.h"
+
+#ifdef ACQ_KERNELS_X86
+
+#include <immintrin.h>
+
+namespace acq_core {
+namespace kernels {
+
+namespace {
+
+inline __m128i load128(const uint8_t *p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+inline __m128i load64(const uint8_t *p)
+{
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p));
+}
+
+inline void store128(void *p, __m128i v)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+}
+
+/* Store 8 16-bit atoms, widening them to T */
+template <typename T, bool S>
+inline void store16(T *dst, __m128i v)
+{
+    if constexpr (sizeof(T) == 2) {
+        store128(dst, v);
+    } else if constexpr (sizeof(T) == 4) {
+        store128(dst, S ? _mm_cvtepi16_epi32(v) : _mm_cvtepu16_epi32(v));
+        v = _mm_srli_si128(v, 8);
+        store128(dst + 4, S ? _mm_cvtepi16_epi32(v) : _mm_cvtepu16_epi32(v));
+    } else {
+        for (int j = 0; j < 8; j += 2, v = _mm_srli_si128(v, 4))
+            store128(dst + j, S ? _mm_cvtepi16_epi64(v) : _mm_cvtepu16_epi64(v));
+    }
+}
+
+/* Store 4 32-bit atoms, widening them to T */
+template <typename T, bool S>
+inline void store32(T *dst, __m128i v)
+{
+    if constexpr (sizeof(T) == 4) {
+        store128(dst, v);
+    } else {
+        store128(dst, S ? _mm_cvtepi32_epi64(v) : _mm_cvtepu32_epi64(v));
+        v = _mm_srli_si128(v, 8);
+        store128(dst + 2, S ? _mm_cvtepi32_epi64(v) : _mm_cvtepu32_epi64(v));
+    }
+}
+
+/* r[j] holds atoms 0..7 of sample j. On return r[k] holds atom k of
+ * samples 0..7 */
+inline void transpose_8x16(__m128i r[8])
+{
+    __m128i t0 = _mm_unpacklo_epi16(r[0], r[1]);
+    __m128i t1 = _mm_unpackhi_epi16(r[0], r[1]);
+    __m128i t2 = _mm_unpacklo_epi16(r[2], r[3]);
+    __m128i t3 = _mm_unpackhi_epi16(r[2], r[3]);
+    __m128i t4 = _mm_unpacklo_epi16(r[4], r[5]);
+    __m128i t5 = _mm_unpackhi_epi16(r[4], r[5]);
+    __m128i t6 = _mm_unpacklo_epi16(r[6], r[7]);
+    __m128i t7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+    __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+    __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+    __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+    __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+    __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+    __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+    __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+    __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+    r[0] = _mm_unpacklo_epi64(u0, u4);
+    r[1] = _mm_unpackhi_epi64(u0, u4);
+    r[2] = _mm_unpacklo_epi64(u1, u5);
+    r[3] = _mm_unpackhi_epi64(u1, u5);
+    r[4] = _mm_unpacklo_epi64(u2, u6);
+    r[5] = _mm_unpackhi_epi64(u2, u6);
+    r[6] = _mm_unpacklo_epi64(u3, u7);
+    r[7] = _mm_unpackhi_epi64(u3, u7);
+}
+
+/* Same as transpose_8x16, but only atoms 0..3 are valid in r[j] */
+inline void transpose_4x16(__m128i r[8])
+{
+    __m128i t0 = _mm_unpacklo_epi16(r[0], r[1]);
+    __m128i t2 = _mm_unpacklo_epi16(r[2], r[3]);
+    __m128i t4 = _mm_unpacklo_epi16(r[4], r[5]);
+    __m128i t6 = _mm_unpacklo_epi16(r[6], r[7]);
+
+    __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+    __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+    __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+    __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+
+    r[0] = _mm_unpacklo_epi64(u0, u4);
+    r[1] = _mm_unpackhi_epi64(u0, u4);
+    r[2] = _mm_unpacklo_epi64(u1, u5);
+    r[3] = _mm_unpackhi_epi64(u1, u5);
+}
+
+/* r[j] holds atoms 0..3 of sample j. On return r[k] holds atom k of
+ * samples 0..3 */
+inline void transpose_4x32(__m128i r[4])
+{
+    __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+    __m128i t1 = _mm_unpackhi_epi32(r[0], r[1]);
+    __m128i t2 = _mm_unpacklo_epi32(r[2], r[3]);
+    __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+
+    r[0] = _mm_unpacklo_epi64(t0, t2);
+    r[1] = _mm_unpackhi_epi64(t0, t2);
+    r[2] = _mm_unpacklo_epi64(t1, t3);
+    r[3] = _mm_unpackhi_epi64(t1, t3);
+}
+
+/* Same as transpose_4x32, but only atoms 0..1 are valid in r[j] */
+inline void transpose_2x32(__m128i r[4])
+{
+    __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+    __m128i t2 = _mm_unpacklo_epi32(r[2], r[3]);
+
+    r[0] = _mm_unpacklo_epi64(t0, t2);
+    r[1] = _mm_unpackhi_epi64(t0, t2);
+}
+
+template <typename T, bool S>
+void decode16(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+              unsigned natoms, T *const *atoms)
+{
+    using W = typename std::conditional<S, int16_t, uint16_t>::type;
+    std::size_t i = 0;
+
+    for (; i + 8 <= nsamples; i += 8) {
+        const uint8_t *s = p + i * stride;
+        __m128i r[8];
+        unsigned k = 0;
+
+        for (; k + 8 <= natoms; k += 8) {
+            for (int j = 0; j < 8; j++)
+                r[j] = load128(s + j * stride + 2 * k);
+            transpose_8x16(r);
+            for (int j = 0; j < 8; j++)
+                store16<T, S>(atoms[k + j] + i, r[j]);
+        }
+
+        if (k + 4 <= natoms) {
+            for (int j = 0; j < 8; j++)
+                r[j] = load64(s + j * stride + 2 * k);
+            transpose_4x16(r);
+            for (int j = 0; j < 4; j++)
+                store16<T, S>(atoms[k + j] + i, r[j]);
+            k += 4;
+        }
+
+        if (k < natoms)
+            scalar_atoms<W>(p, i, i + 8, k, natoms, stride, atoms);
+    }
+
+    scalar_atoms<W>(p, i, nsamples, 0, natoms, stride, atoms);
+}
+
+template <typename T, bool S>
+void decode32(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+              unsigned natoms, T *const *atoms)
+{
+    using W = typename std::conditional<S, int32_t, uint32_t>::type;
+    std::size_t i = 0;
+
+    for (; i + 4 <= nsamples; i += 4) {
+        const uint8_t *s = p + i * stride;
+        __m128i r[4];
+        unsigned k = 0;
+
+        for (; k + 4 <= natoms; k += 4) {
+            for (int j = 0; j < 4; j++)
+                r[j] = load128(s + j * stride + 4 * k);
+            transpose_4x32(r);
+            for (int j = 0; j < 4; j++)
+                store32<T, S>(atoms[k + j] + i, r[j]);
+        }
+
+        if (k + 2 <= natoms) {
+            for (int j = 0; j < 4; j++)
+                r[j] = load64(s + j * stride + 4 * k);
+            transpose_2x32(r);
+            for (int j = 0; j < 2; j++)
+                store32<T, S>(atoms[k + j] + i, r[j]);
+            k += 2;
+        }
+
+        if (k < natoms)
+            scalar_atoms<W>(p, i, i + 4, k, natoms, stride, atoms);
+    }
+
+    scalar_atoms<W>(p, i, nsamples, 0, natoms, stride, atoms);
+}
+
+} /* namespace */
+
+template <typename T>
+void decode16_sse41(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                    unsigned natoms, bool sign_extend, T *const *atoms)
+{
+    if (sign_extend)
+        decode16<T, true>(p, nsamples, stride, natoms, atoms);
+    else
+        decode16<T, false>(p, nsamples, stride, natoms, atoms);
+}
+
+template <typename T>
+void decode32_sse41(const uint8_t *p, std::size_t nsamples, std::size_t stride,
+                    unsigned natoms, bool sign_extend, T *const *atoms)
+{
+    if (sign_extend)
+        decode32<T, true>(p, nsamples, stride, natoms, atoms);
+    else
+        decode32<T, false>(p, nsamples, stride, natoms, atoms);
+}
+
+template void decode16_sse41<int16_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int16_t *const *);
+template void decode16_sse41<int32_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int32_t *const *);
+template void decode16_sse41<int64_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int64_t *const *);
+template void decode32_sse41<int32_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int32_t *const *);
+template void decode32_sse41<int64_t>(const uint8_t *, std::size_t, std::size_t, unsigned, bool, int64_t *const *);
+
+void undelta32_sse41(uint32_t *v, std::size_t n)
+{
+    const __m128i one = _mm_set1_epi32(1);
+    __m128i carry = _mm_setzero_si128();
+    std::size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i z = _mm_loadu_si128(reinterpret_cast<const __m128i *>(v + i));
+        __m128i d = _mm_xor_si128(_mm_srli_epi32(z, 1),
+                                  _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(z, one)));
+
+        d = _mm_add_epi32(d, _mm_slli_si128(d, 4));
+        d = _mm_add_epi32(d, _mm_slli_si128(d, 8));
+        d = _mm_add_epi32(d, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(v + i), d);
+        carry = _mm_shuffle_epi32(d, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    scalar_undelta<uint32_t>(v, i, n, static_cast<uint32_t>(_mm_cvtsi128_si32(carry)));
+}
+
+} /* namespace kernels */
+} /* namespace acq_core */
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * Acquisition core DDR3 layout model
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "acq_layout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "../wbgen/wb_acq_core_regs.h"
+
+namespace acq_core {
+
+AcqConfig AcqConfig::from_regs(const RegRead &rd, const ChannelDesc &chan)
+{
+    AcqConfig cfg;
+    uint32_t shots = rd(ACQ_CORE_REG_SHOTS);
+
+    cfg.pre_samples = rd(ACQ_CORE_REG_PRE_SAMPLES);
+    cfg.post_samples = rd(ACQ_CORE_REG_POST_SAMPLES);
+    cfg.shots = ACQ_CORE_SHOTS_NB_R(shots);
+    cfg.multishot_ram_size = ACQ_CORE_SHOTS_MULTISHOT_RAM_SIZE_R(shots);
+    cfg.ddr3_start_addr = rd(ACQ_CORE_REG_DDR3_START_ADDR);
+    cfg.ddr3_end_addr = rd(ACQ_CORE_REG_DDR3_END_ADDR);
+    cfg.acq_now = (rd(ACQ_CORE_REG_CTL) & ACQ_CORE_CTL_FSM_ACQ_NOW) != 0;
+    cfg.sample_bytes = static_cast<unsigned>(chan.sample_bytes());
+    cfg.words_per_sample = chan.num_coalesce;
+    return cfg;
+}
+
+static bool is_pow2(unsigned v)
+{
+    return v && !(v & (v - 1));
+}
+
+AcqLayout::AcqLayout(const AcqConfig &cfg, const CoreGeometry &geo) :
+    cfg_(cfg), geo_(geo), anchored_(false), direct_offset_(0)
+{
+    if (!is_pow2(geo.dq_bits) || geo.dq_bits < 8 || !is_pow2(geo.payload_bits) ||
+            geo.payload_bits < geo.dq_bits)
+        throw std::invalid_argument("DDR3 payload and DQ widths must be powers of 2");
+    if (geo.addr_bits == 0 || geo.addr_bits > 32)
+        throw std::invalid_argument("DDR3 address width must be between 1 and 32");
+    if (cfg.sample_bytes == 0)
+        throw std::invalid_argument("sample size must not be zero");
+    if (cfg.shots == 0)
+        throw std::invalid_argument("number of shots must not be zero");
+    if (cfg.words_per_sample == 0)
+        throw std::invalid_argument("words per sample must not be zero");
+
+    bool axis = geo.ddr_interface == CoreGeometry::DdrInterface::axis;
+
+    payload_bytes_ = geo.payload_bits / 8;
+    unit_bytes_ = axis ? 1 : geo.dq_bits / 8;
+    inc_ = static_cast<uint32_t>(payload_bytes_ / unit_bytes_);
+
+    /* wr_{init,end}_addr_alig clear log2(payload/dq) bits in both
+     * interfaces, even though AXIS addresses are in bytes */
+    uint32_t align_mask = geo.payload_bits / geo.dq_bits - 1;
+    start_ = mask(cfg.ddr3_start_addr & ~align_mask);
+    end_ = mask(cfg.ddr3_end_addr & ~align_mask);
+
+    if (axis) {
+        /* The AXIS writer wraps after the word for which addr + inc >= end */
+        ring_words_ = end_ > start_ ? (uint64_t(end_ - start_) + inc_ - 1) / inc_ : 1;
+    } else {
+        /* The UI writer wraps after writing exactly at the end address */
+        if (end_ < start_ || (end_ - start_) % inc_ != 0)
+            throw std::invalid_argument("UI end address is never reached from the start address");
+        ring_words_ = (end_ - start_) / inc_ + 1;
+    }
+
+    uint64_t pre_bytes = uint64_t(cfg.pre_samples) * cfg.sample_bytes;
+    uint64_t post_bytes = uint64_t(cfg.post_samples) * cfg.sample_bytes;
+
+    if (pre_bytes % payload_bytes_ || post_bytes % payload_bytes_)
+        throw std::invalid_argument("pre and post-trigger sizes must be multiples of " +
+                                    std::to_string(payload_bytes_) + " bytes");
+
+    pre_words_ = pre_bytes / payload_bytes_;
+    shot_words_ = (pre_bytes + post_bytes) / payload_bytes_;
+    if (shot_words_ == 0)
+        throw std::invalid_argument("acquisition has no samples");
+
+    /* Same decision as acq_fsm single_shot */
+    if (cfg.shots == 1 && samples_per_shot() * cfg.words_per_sample > cfg.multishot_ram_size)
+        path_ = Path::direct;
+    else
+        path_ = Path::multishot_ram;
+
+    if (path_ == Path::direct) {
+        if (shot_words_ > ring_words_)
+            throw std::invalid_argument("acquisition doesn't fit in the DDR3 memory area");
+        /* With acq_now, no sample is written while waiting for the trigger */
+        anchored_ = cfg.acq_now;
+    }
+}
+
+uint32_t AcqLayout::mask(uint64_t addr) const
+{
+    return geo_.addr_bits == 32 ? static_cast<uint32_t>(addr) :
+        static_cast<uint32_t>(addr & ((UINT64_C(1) << geo_.addr_bits) - 1));
+}
+
+uint32_t AcqLayout::word_addr(uint64_t n) const
+{
+    return mask(start_ + (n % ring_words_) * inc_);
+}
+
+bool AcqLayout::trig_pos_known() const
+{
+    return path_ == Path::multishot_ram || cfg_.acq_now;
+}
+
+uint32_t AcqLayout::expected_trig_pos() const
+{
+    if (!trig_pos_known())
+        throw std::logic_error("TRIG_POS depends on the trigger arrival time");
+
+    /* No word carries the trigger flag: the writer stores the address of
+     * the word following the last one */
+    if (cfg_.acq_now || cfg_.post_samples == 0)
+        return word_addr(uint64_t(cfg_.shots) * shot_words_);
+
+    /* Only the first shot trigger is captured. Multishot triggers are
+     * always aligned with a word, so there is no offset to subtract */
+    uint32_t addr = word_addr(pre_words_);
+    if (addr == start_)
+        return mask(uint64_t(end_) + inc_);
+    return addr;
+}
+
+uint32_t AcqLayout::trig_addr(uint32_t trig_pos) const
+{
+    /* When the trigger word is the first of the area, the writers store
+     * end + inc - offset instead of start - offset */
+    uint64_t ring_units = ring_words_ * inc_;
+    uint64_t units = trig_pos > end_ ? uint64_t(trig_pos) - end_ - inc_ + ring_units :
+                                       mask(uint64_t(trig_pos) - start_);
+    return mask(start_ + units % ring_units);
+}
+
+void AcqLayout::set_trig_pos(uint32_t trig_pos)
+{
+    if (path_ != Path::direct || cfg_.acq_now)
+        return;
+
+    uint64_t off = uint64_t(mask(uint64_t(trig_addr(trig_pos)) - start_)) * unit_bytes_;
+
+    uint64_t pre_bytes = pre_words_ * payload_bytes_;
+    direct_offset_ = (off + ring_bytes() - pre_bytes) % ring_bytes();
+    anchored_ = true;
+}
+
+uint32_t AcqLayout::first_shot() const
+{
+    if (path_ == Path::direct)
+        return 0;
+    uint64_t fit = ring_words_ / shot_words_;
+    return fit >= cfg_.shots ? 0 : static_cast<uint32_t>(cfg_.shots - fit);
+}
+
+uint64_t AcqLayout::shot_first_offset(uint32_t shot) const
+{
+    if (shot >= cfg_.shots)
+        throw std::out_of_range("shot index out of range");
+
+    if (path_ == Path::direct) {
+        if (!anchored_)
+            throw std::logic_error("direct acquisition needs TRIG_POS, see set_trig_pos()");
+        return direct_offset_;
+    }
+
+    return (uint64_t(shot) * shot_words_ % ring_words_) * payload_bytes_;
+}
+
+uint64_t AcqLayout::sample_offset(uint32_t shot, uint64_t sample) const
+{
+    if (sample >= samples_per_shot())
+        throw std::out_of_range("sample index out of range");
+    return (shot_first_offset(shot) + sample * cfg_.sample_bytes) % ring_bytes();
+}
+
+uint32_t AcqLayout::sample_addr(uint32_t shot, uint64_t sample) const
+{
+    return mask(start_ + sample_offset(shot, sample) / unit_bytes_);
+}
+
+std::size_t AcqLayout::linearize(const void *ring, void *out) const
+{
+    const uint8_t *src = static_cast<const uint8_t *>(ring);
+    uint8_t *dst = static_cast<uint8_t *>(out);
+    std::size_t ring_len = ring_bytes();
+    std::size_t len = shot_bytes();
+
+    for (uint32_t shot = first_shot(); shot < cfg_.shots; shot++) {
+        std::size_t off = shot_first_offset(shot);
+        std::size_t head = std::min(len, ring_len - off);
+
+        std::memcpy(dst, src + off, head);
+        std::memcpy(dst + head, src, len - head);
+        dst += len;
+    }
+
+    return dst - static_cast<uint8_t *>(out);
+}
+
+StreamRing::StreamRing(uint32_t ddr3_start_addr, uint32_t ddr3_end_addr,
+                       const CoreGeometry &geo) :
+    addr_bits_(geo.addr_bits)
+{
+    if (geo.ddr_interface != CoreGeometry::DdrInterface::axis)
+        throw std::invalid_argument("streaming needs the AXIS DDR3 interface");
+    if (!is_pow2(geo.dq_bits) || geo.dq_bits < 8 || !is_pow2(geo.payload_bits) ||
+            geo.payload_bits < geo.dq_bits)
+        throw std::invalid_argument("DDR3 payload and DQ widths must be powers of 2");
+    if (geo.addr_bits == 0 || geo.addr_bits > 32)
+        throw std::invalid_argument("DDR3 address width must be between 1 and 32");
+
+    payload_bytes_ = geo.payload_bits / 8;
+
+    /* Same alignment and wrap condition as AcqLayout */
+    uint32_t align_mask = geo.payload_bits / geo.dq_bits - 1;
+    start_ = mask(ddr3_start_addr & ~align_mask);
+    uint32_t end = mask(ddr3_end_addr & ~align_mask);
+
+    if (end <= start_)
+        throw std::invalid_argument("streaming memory area is empty");
+    ring_words_ = (uint64_t(end - start_) + payload_bytes_ - 1) / payload_bytes_;
+    /* One word is always kept free */
+    if (ring_words_ < 2)
+        throw std::invalid_argument("streaming memory area must hold at least 2 words");
+}
+
+StreamRing StreamRing::from_regs(const RegRead &rd, const CoreGeometry &geo)
+{
+    return StreamRing(rd(ACQ_CORE_REG_DDR3_START_ADDR), rd(ACQ_CORE_REG_DDR3_END_ADDR), geo);
+}
+
+uint32_t StreamRing::mask(uint64_t addr) const
+{
+    return addr_bits_ == 32 ? static_cast<uint32_t>(addr) :
+        static_cast<uint32_t>(addr & ((UINT64_C(1) << addr_bits_) - 1));
+}
+
+uint64_t StreamRing::offset(uint32_t ptr) const
+{
+    uint64_t off = mask(uint64_t(ptr) - start_);
+    if (off >= ring_bytes() || off % payload_bytes_)
+        throw std::out_of_range("pointer outside of the streaming memory area");
+    return off;
+}
+
+uint32_t StreamRing::advance(uint32_t ptr, uint64_t bytes) const
+{
+    if (bytes % payload_bytes_)
+        throw std::invalid_argument("pointers advance by whole payload words");
+    return mask(start_ + (offset(ptr) + bytes) % ring_bytes());
+}
+
+uint64_t StreamRing::readable(uint32_t rd_ptr, uint32_t wr_ptr) const
+{
+    return (offset(wr_ptr) + ring_bytes() - offset(rd_ptr)) % ring_bytes();
+}
+
+std::size_t StreamRing::read(const void *ring, uint32_t rd_ptr, uint32_t wr_ptr,
+                             void *out, std::size_t max) const
+{
+    const uint8_t *src = static_cast<const uint8_t *>(ring);
+    uint8_t *dst = static_cast<uint8_t *>(out);
+    uint64_t off = offset(rd_ptr);
+    std::size_t len = std::min<uint64_t>(readable(rd_ptr, wr_ptr), max - max % payload_bytes_);
+    std::size_t head = std::min<uint64_t>(len, ring_bytes() - off);
+
+    std::memcpy(dst, src + off, head);
+    std::memcpy(dst + head, src, len - head);
+    return len;
+}
+
+WritePerf WritePerf::from_regs(const RegRead &rd)
+{
+    WritePerf perf;
+    perf.beats = rd(ACQ_CORE_REG_DDR3_PERF_BEATS);
+    perf.cycles = rd(ACQ_CORE_REG_DDR3_PERF_CYCLES);
+    return perf;
+}
+
+double WritePerf::efficiency() const
+{
+    return cycles ? double(beats) / cycles : 0.0;
+}
+
+double WritePerf::bytes_per_cycle(const CoreGeometry &geo) const
+{
+    return efficiency() * (geo.payload_bits / 8);
+}
+
+DecimConfig DecimConfig::from_regs(const RegRead &rd)
+{
+    uint32_t ctl = rd(ACQ_CORE_REG_ACQ_DECIM_CTL);
+
+    DecimConfig decim;
+    decim.ratio = ACQ_CORE_ACQ_DECIM_CTL_RATIO_R(ctl);
+    decim.avg_order_sel = ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_R(ctl);
+    decim.max_avg_order_sel = ACQ_CORE_ACQ_DECIM_CTL_MAX_AVG_ORDER_SEL_R(ctl);
+    decim.chan_mask = ACQ_CORE_ACQ_DECIM_MASK_MASK_R(rd(ACQ_CORE_REG_ACQ_DECIM_MASK));
+    return decim;
+}
+
+unsigned DecimConfig::avg_taps(const ChannelDesc &chan, unsigned chan_idx) const
+{
+    /* The moving average is applied whenever the channel is in the mask,
+     * even with ratio <= 1 */
+    if (!((chan_mask >> chan_idx) & 1) || chan.num_coalesce != 1)
+        return 1;
+    return 1u << std::min(avg_order_sel, max_avg_order_sel);
+}
+
+} /* namespace acq_core */
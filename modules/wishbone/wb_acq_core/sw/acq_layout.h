@@ -0,0 +1,230 @@
+/*
+ * Acquisition core DDR3 layout model
+ *
+ * Reproduces the addressing of acq_fsm, acq_multishot_dpram and
+ * acq_ddr3_{axis,ui}_write, so that the position of every sample of every
+ * shot inside the circular DDR3 area can be computed from the register
+ * values alone, and a wrapped multishot buffer can be put back in order with
+ * a single pass over it.
+ *
+ * The acquisition takes one of two paths:
+ *
+ * - Multishot RAM: used whenever SHOTS_NB > 1 or PRE_SAMPLES+POST_SAMPLES
+ *   words fits in the multishot RAM. Each shot is sent as exactly PRE+POST
+ *   samples, and shots are written back-to-back to DDR3 without realigning
+ *   the address between them. Everything, including TRIG_POS, is known in
+ *   advance.
+ *
+ * - Direct: a single shot which doesn't fit in the multishot RAM. Samples
+ *   keep being written while waiting for the trigger, so the position of
+ *   the shot is only known from TRIG_POS at the end of the acquisition.
+ *
+ * In streaming mode (STREAM_CTL.EN) the memory area is instead used as a ring
+ * buffer shared with software through the STREAM_WR_PTR and STREAM_RD_PTR
+ * registers, see StreamRing.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef ACQ_LAYOUT_H
+#define ACQ_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "acq_decoder.h"
+
+namespace acq_core {
+
+/* Synthesis parameters of wb_acq_core that affect the layout */
+struct CoreGeometry {
+    enum class DdrInterface {
+        axis,   /* Byte addresses, acq_ddr3_axis_write */
+        ui,     /* Word addresses, acq_ddr3_ui_write */
+    };
+
+    DdrInterface ddr_interface = DdrInterface::axis;  /* g_ddr_interface_type */
+    unsigned payload_bits = 256;                       /* g_ddr_payload_width */
+    unsigned dq_bits = 64;                             /* g_ddr_dq_width */
+    unsigned addr_bits = 32;                           /* g_ddr_addr_width */
+};
+
+/* Register values of a single acquisition. For multi-channel frames, 'chan'
+ * is FrameDesc::desc */
+struct AcqConfig {
+    uint32_t pre_samples = 0;
+    uint32_t post_samples = 0;
+    uint32_t shots = 1;
+    uint32_t multishot_ram_size = 2048;
+    uint32_t ddr3_start_addr = 0;
+    uint32_t ddr3_end_addr = 0;
+    bool acq_now = false;
+    /* Bytes per sample of the acquired channel (ChannelDesc::sample_bytes) */
+    unsigned sample_bytes = 8;
+    /* Multishot RAM positions taken by each sample. That is the number of
+     * coalesced words, or frame words (ChannelDesc::num_coalesce) */
+    unsigned words_per_sample = 1;
+
+    static AcqConfig from_regs(const RegRead &rd, const ChannelDesc &chan);
+};
+
+class AcqLayout {
+public:
+    enum class Path {
+        multishot_ram,
+        direct,
+    };
+
+    /* Throws std::invalid_argument if the hardware can't acquire such a
+     * configuration consistently (e.g. sizes not multiple of the DDR3
+     * payload word) */
+    explicit AcqLayout(const AcqConfig &cfg, const CoreGeometry &geo = CoreGeometry());
+
+    Path path() const { return path_; }
+
+    /* DDR3 addresses, in the units used by the DDR3 interface (bytes for
+     * AXIS, words of g_ddr_dq_width bits for UI) */
+    uint32_t ring_start() const { return start_; }
+    uint32_t addr_inc() const { return inc_; }
+    /* Address of the n-th payload word written since the start */
+    uint32_t word_addr(uint64_t n) const;
+
+    /* Sizes, in bytes */
+    std::size_t payload_bytes() const { return payload_bytes_; }
+    uint64_t ring_bytes() const { return ring_words_ * payload_bytes_; }
+    uint64_t shot_bytes() const { return shot_words_ * payload_bytes_; }
+    uint64_t samples_per_shot() const
+    {
+        return uint64_t(cfg_.pre_samples) + cfg_.post_samples;
+    }
+
+    /* Value TRIG_POS will hold at the end of the acquisition. Only known in
+     * advance for the multishot RAM path, or the direct path with
+     * acq_now */
+    bool trig_pos_known() const;
+    uint32_t expected_trig_pos() const;
+
+    /* Anchor a direct path acquisition, using the value read from TRIG_POS.
+     * Not needed for the multishot RAM path */
+    void set_trig_pos(uint32_t trig_pos);
+    /* Undo the end-of-area adjustment of TRIG_POS and return the address of
+     * the first post-trigger sample */
+    uint32_t trig_addr(uint32_t trig_pos) const;
+
+    /* Shots still present in memory are [first_shot(), shots) */
+    uint32_t first_shot() const;
+    bool wrapped() const { return first_shot() > 0; }
+
+    /* Offset inside the DDR3 area (as read back from ring_start()) and
+     * DDR3 address of a sample. 'sample' counts from the first pre-trigger
+     * sample of the shot */
+    uint64_t sample_offset(uint32_t shot, uint64_t sample) const;
+    uint32_t sample_addr(uint32_t shot, uint64_t sample) const;
+
+    /* Copy the shots still present in 'ring' (ring_bytes() bytes, read from
+     * ring_start()) to 'out', in order, each one as samples_per_shot()
+     * contiguous samples. Returns the number of bytes written */
+    std::size_t linearize(const void *ring, void *out) const;
+
+private:
+    uint64_t shot_first_offset(uint32_t shot) const;
+    uint32_t mask(uint64_t addr) const;
+
+    AcqConfig cfg_;
+    CoreGeometry geo_;
+    Path path_;
+    std::size_t payload_bytes_;
+    unsigned unit_bytes_;
+    uint32_t inc_;
+    uint32_t start_;
+    uint32_t end_;
+    uint64_t ring_words_;
+    uint64_t pre_words_;
+    uint64_t shot_words_;
+    bool anchored_;
+    uint64_t direct_offset_;
+};
+
+/* Ring buffer of a streaming acquisition (AXIS DDR3 interface only).
+ *
+ * The core writes payload words to [STREAM_RD_PTR, STREAM_WR_PTR) and keeps
+ * one word free, so that equal pointers mean an empty ring. Software consumes
+ * data and then advances STREAM_RD_PTR, which must point to the start of the
+ * area when the acquisition starts */
+class StreamRing {
+public:
+    /* Throws std::invalid_argument for the UI DDR3 interface or an empty
+     * area */
+    StreamRing(uint32_t ddr3_start_addr, uint32_t ddr3_end_addr,
+               const CoreGeometry &geo = CoreGeometry());
+
+    static StreamRing from_regs(const RegRead &rd, const CoreGeometry &geo = CoreGeometry());
+
+    uint32_t ring_start() const { return start_; }
+    uint64_t ring_bytes() const { return ring_words_ * payload_bytes_; }
+    /* Maximum number of bytes waiting to be read */
+    uint64_t capacity() const { return ring_bytes() - payload_bytes_; }
+
+    /* Offset inside the area of a pointer register value */
+    uint64_t offset(uint32_t ptr) const;
+    /* Pointer 'bytes' after 'ptr'. 'bytes' must be a multiple of the
+     * payload word */
+    uint32_t advance(uint32_t ptr, uint64_t bytes) const;
+    /* Bytes ready to be read */
+    uint64_t readable(uint32_t rd_ptr, uint32_t wr_ptr) const;
+
+    /* Copy up to 'max' ready bytes (rounded down to whole payload words)
+     * from 'ring' (ring_bytes() bytes, read from ring_start()) to 'out'.
+     * Returns the number of bytes copied; the new read pointer is
+     * advance(rd_ptr, returned value) */
+    std::size_t read(const void *ring, uint32_t rd_ptr, uint32_t wr_ptr,
+                     void *out, std::size_t max) const;
+
+private:
+    uint32_t mask(uint64_t addr) const;
+
+    unsigned addr_bits_;
+    std::size_t payload_bytes_;
+    uint32_t start_;
+    uint64_t ring_words_;
+};
+
+/* DDR3 write performance counters (DDR3_PERF_BEATS and DDR3_PERF_CYCLES),
+ * counted since the acquisition start. Only the AXIS interface implements
+ * them */
+struct WritePerf {
+    uint32_t beats = 0;     /* Payload words accepted by the memory */
+    uint32_t cycles = 0;    /* DDR3 clock cycles with a payload word waiting */
+
+    static WritePerf from_regs(const RegRead &rd);
+
+    /* Fraction of the cycles in which the memory accepted a word. 1.0 is
+     * the peak bandwidth of the payload interface */
+    double efficiency() const;
+    double bytes_per_cycle(const CoreGeometry &geo = CoreGeometry()) const;
+    bool saturated() const { return cycles == UINT32_MAX; }
+};
+
+/* Channel decimation settings (ACQ_DECIM_CTL and ACQ_DECIM_MASK). Decimated
+ * channels keep one of every 'ratio' samples, after an optional moving
+ * average of 2**avg_order_sel samples */
+struct DecimConfig {
+    uint32_t ratio = 1;
+    unsigned avg_order_sel = 0;
+    unsigned max_avg_order_sel = 0;     /* g_decim_max_avg_order_sel */
+    uint32_t chan_mask = 0;
+
+    static DecimConfig from_regs(const RegRead &rd);
+
+    bool decimated(unsigned chan) const { return ratio > 1 && (chan_mask >> chan) & 1; }
+    /* Ratio between the input and acquired sample rates of a channel */
+    uint32_t rate_divider(unsigned chan) const { return decimated(chan) ? ratio : 1; }
+    /* Moving average length applied to a channel. Coalesced channels are
+     * never averaged */
+    unsigned avg_taps(const ChannelDesc &chan, unsigned chan_idx) const;
+};
+
+} /* namespace acq_core */
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Acquisition decoder throughput benchmark
+ *
+ * Decodes a synthetic buffer with every available instruction set and
+ * prints the throughput, in input MB/s.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "acq_decoder.h"
+
+using namespace acq_core;
+
+static const char *simd_name(SimdLevel simd)
+{
+    switch (simd) {
+    case SimdLevel::avx2:
+        return "avx2";
+    case SimdLevel::sse41:
+        return "sse4.1";
+    default:
+        return "scalar";
+    }
+}
+
+template <typename T>
+static void bench(const char *name, const ChannelDesc &d)
+{
+    const std::size_t bytes = 64 << 20;
+    const int iterations = 10;
+    std::vector<uint8_t> buf(bytes);
+    std::mt19937 rng(1);
+    for (auto &b : buf)
+        b = rng();
+
+    for (SimdLevel simd : { SimdLevel::scalar, SimdLevel::sse41, SimdLevel::avx2 }) {
+        if (simd > simd_level())
+            continue;
+
+        ChannelDecoder dec(d, true, simd);
+        std::size_t nsamples = dec.num_samples(bytes);
+        std::vector<std::vector<T>> out(d.num_atoms, std::vector<T>(nsamples));
+        std::vector<T *> ptrs;
+        for (auto &v : out)
+            ptrs.push_back(v.data());
+
+        dec.decode(buf.data(), nsamples, ptrs.data());
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            dec.decode(buf.data(), nsamples, ptrs.data());
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::printf("%-24s %-8s %8.1f MB/s\n", name, simd_name(simd),
+                    bytes * iterations / elapsed.count() / 1e6);
+    }
+}
+
+int main()
+{
+    bench<int32_t>("4x16 -> int32 (64b)", {64, 1, 4, 16});
+    bench<int16_t>("4x16 -> int16 (64b)", {64, 1, 4, 16});
+    bench<int32_t>("4x32 -> int32 (128b)", {128, 1, 4, 32});
+    bench<int32_t>("16x16 -> int32 (256b)", {128, 2, 16, 16});
+    bench<int32_t>("64x16 -> int32 (1024b)", {128, 8, 64, 16});
+    return 0;
+}
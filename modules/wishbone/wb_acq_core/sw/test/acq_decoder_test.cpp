@@ -0,0 +1,221 @@
+/*
+ * Acquisition decoder self-test
+ *
+ * Packs random atoms bit by bit, the same way acq_fc_fifo lays them out in
+ * memory, and checks that they decode back to the same values.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "acq_decoder.h"
+#include "wb_acq_core_regs.h"
+
+using namespace acq_core;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static void put_bits(std::vector<uint8_t> &buf, std::size_t ofs, unsigned width, uint64_t v)
+{
+    for (unsigned b = 0; b < width; b++, ofs++)
+        if ((v >> b) & 1)
+            buf[ofs / 8] |= 1 << (ofs % 8);
+}
+
+static int64_t expected(uint64_t raw, unsigned width, bool sign_extend)
+{
+    if (!sign_extend || width == 64 || !((raw >> (width - 1)) & 1))
+        return static_cast<int64_t>(raw);
+    return static_cast<int64_t>(raw | (~UINT64_C(0) << width));
+}
+
+template <typename T>
+static void test_desc(const ChannelDesc &d, bool sign_extend, SimdLevel simd)
+{
+    /* Not a multiple of any vector block, so the scalar tails are exercised */
+    const std::size_t nsamples = 1003;
+    std::mt19937_64 rng(d.int_width * 131 + d.atom_width);
+    ChannelDecoder dec(d, sign_extend, simd);
+
+    std::vector<uint8_t> buf(nsamples * d.sample_bytes());
+    std::vector<uint64_t> raw(nsamples * d.num_atoms);
+    uint64_t mask = d.atom_width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << d.atom_width) - 1;
+
+    for (std::size_t i = 0; i < nsamples; i++)
+        for (unsigned k = 0; k < d.num_atoms; k++) {
+            uint64_t v = rng() & mask;
+            raw[i * d.num_atoms + k] = v;
+            put_bits(buf, i * d.sample_bits() + k * d.atom_width, d.atom_width, v);
+        }
+
+    CHECK(dec.num_samples(buf.size() + 1) == nsamples);
+
+    std::vector<std::vector<T>> out(d.num_atoms, std::vector<T>(nsamples));
+    std::vector<T *> ptrs;
+    for (auto &v : out)
+        ptrs.push_back(v.data());
+
+    dec.decode(buf.data(), nsamples, ptrs.data());
+
+    for (std::size_t i = 0; i < nsamples; i++)
+        for (unsigned k = 0; k < d.num_atoms; k++) {
+            int64_t e = expected(raw[i * d.num_atoms + k], d.atom_width, sign_extend);
+            CHECK(static_cast<T>(e) == out[k][i]);
+            CHECK(dec.atom(buf.data(), i, k) == e);
+        }
+}
+
+static void test_read_core_desc()
+{
+    std::map<uint32_t, uint32_t> regs;
+    regs[ACQ_CORE_REG_ACQ_CHAN_CTL] = ACQ_CORE_ACQ_CHAN_CTL_NUM_CHAN_W(2);
+    regs[ACQ_CORE_REG_CH0_DESC] = ACQ_CORE_CH0_DESC_INT_WIDTH_W(64) |
+        ACQ_CORE_CH0_DESC_NUM_COALESCE_W(1);
+    regs[ACQ_CORE_REG_CH0_ATOM_DESC] = ACQ_CORE_CH0_ATOM_DESC_NUM_ATOMS_W(4) |
+        ACQ_CORE_CH0_ATOM_DESC_ATOM_WIDTH_W(16);
+    regs[ACQ_CORE_REG_CH1_DESC] = ACQ_CORE_CH1_DESC_INT_WIDTH_W(128) |
+        ACQ_CORE_CH1_DESC_NUM_COALESCE_W(2);
+    regs[ACQ_CORE_REG_CH1_ATOM_DESC] = ACQ_CORE_CH1_ATOM_DESC_NUM_ATOMS_W(8) |
+        ACQ_CORE_CH1_ATOM_DESC_ATOM_WIDTH_W(32);
+
+    CoreDesc core = read_core_desc([&](uint32_t ofs) { return regs[ofs]; });
+
+    CHECK(core.num_channels == 2);
+    CHECK(core.channels[0].int_width == 64);
+    CHECK(core.channels[0].num_atoms == 4);
+    CHECK(core.channels[0].atom_width == 16);
+    CHECK(core.channels[1].sample_bytes() == 32);
+    CHECK(core.channels[1].num_atoms == 8);
+    CHECK(core.channels[1].atom_width == 32);
+}
+
+static void test_invalid_desc()
+{
+    ChannelDesc d{64, 1, 5, 16};
+    bool thrown = false;
+    try {
+        ChannelDecoder dec(d);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+static void test_frame()
+{
+    std::map<uint32_t, uint32_t> regs;
+    CoreDesc core;
+    core.num_channels = 6;
+    core.channels[0] = {64, 1, 4, 16};
+    core.channels[1] = {64, 1, 4, 16};
+    core.channels[2] = {128, 2, 8, 32};
+    core.channels[3] = {64, 1, 2, 16};
+    core.channels[4] = {64, 1, 4, 16};
+    core.channels[5] = {64, 2, 4, 32};
+
+    /* 3 channels, padded to 4 words */
+    regs[ACQ_CORE_REG_ACQ_CHAN_CTL] = ACQ_CORE_ACQ_CHAN_CTL_WHICH_W(1);
+    regs[ACQ_CORE_REG_ACQ_CHAN_MASK] = ACQ_CORE_ACQ_CHAN_MASK_MASK_W(0x19);
+    FrameDesc f = FrameDesc::from_regs([&](uint32_t ofs) { return regs[ofs]; }, core);
+
+    CHECK(f.channels == std::vector<unsigned>({0, 3, 4}));
+    CHECK(f.desc.int_width == 64);
+    CHECK(f.desc.num_coalesce == 4);
+    CHECK(f.desc.sample_bytes() == 32);
+    CHECK(f.atoms_per_chan == 4);
+    CHECK(f.desc.num_atoms == 12);
+    CHECK(f.first_atom(3) == 4);
+    CHECK(f.first_atom(4) == 8);
+
+    /* Frames decode as plain samples, a word per channel */
+    std::vector<uint8_t> buf(2 * f.desc.sample_bytes());
+    for (std::size_t w = 0; w < buf.size() / 8; w++)
+        for (unsigned k = 0; k < 4; k++)
+            put_bits(buf, w * 64 + k * 16, 16, w * 4 + k);
+    ChannelDecoder dec(f.desc, false);
+    CHECK(dec.atom(buf.data(), 0, f.first_atom(3) + 1) == 5);
+    CHECK(dec.atom(buf.data(), 1, f.first_atom(4) + 3) == 27);
+
+    /* A single channel is a frame of one word */
+    f = FrameDesc::from_mask(core, 0x2, 0);
+    CHECK(f.desc.num_coalesce == 1);
+    CHECK(f.first_atom(1) == 0);
+
+    for (uint32_t mask : {0x0u, 0x4u, 0x20u, 0x40u}) {
+        bool thrown = false;
+        try {
+            FrameDesc::from_mask(core, mask, 0);
+        } catch (const std::invalid_argument &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    bool thrown = false;
+    try {
+        f.first_atom(0);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+int main()
+{
+    const SimdLevel levels[] = { SimdLevel::scalar, SimdLevel::sse41, SimdLevel::avx2 };
+
+    for (SimdLevel simd : levels) {
+        if (simd > simd_level())
+            continue;
+
+        for (bool sext : {false, true}) {
+            /* Every 16-bit and 32-bit layout up to c_acq_chan_cmplt_width */
+            for (unsigned bits = 64; bits <= 1024; bits *= 2) {
+                unsigned width = bits == 64 ? 64 : 128;
+                unsigned coalesce = bits / width;
+
+                test_desc<int16_t>({width, coalesce, bits / 16, 16}, sext, simd);
+                test_desc<int32_t>({width, coalesce, bits / 16, 16}, sext, simd);
+                test_desc<int64_t>({width, coalesce, bits / 16, 16}, sext, simd);
+                test_desc<int32_t>({width, coalesce, bits / 32, 32}, sext, simd);
+                test_desc<int64_t>({width, coalesce, bits / 32, 32}, sext, simd);
+            }
+
+            /* Atoms not filling the whole sample */
+            test_desc<int32_t>({128, 1, 7, 16}, sext, simd);
+            test_desc<int32_t>({128, 1, 5, 16}, sext, simd);
+            test_desc<int32_t>({128, 1, 3, 32}, sext, simd);
+            test_desc<int64_t>({128, 2, 7, 32}, sext, simd);
+
+            test_desc<int32_t>({16, 1, 2, 8}, sext, simd);
+            test_desc<int32_t>({32, 1, 2, 12}, sext, simd);
+            test_desc<int32_t>({64, 2, 3, 20}, sext, simd);
+            test_desc<int64_t>({128, 1, 2, 50}, sext, simd);
+            test_desc<int64_t>({128, 1, 2, 64}, sext, simd);
+        }
+    }
+    test_read_core_desc();
+    test_invalid_desc();
+    test_frame();
+
+    if (failures) {
+        std::fprintf(stderr, "acq_decoder_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("acq_decoder_test: OK\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,302 @@
+/*
+ * Delta-compressed data decoder self-test
+ *
+ * Compresses random walks with a bit by bit model of acq_delta_enc.vhd and
+ * checks that they decode back to the same values, with every instruction
+ * set.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "acq_delta.h"
+#include "wb_acq_core_regs.h"
+
+using namespace acq_core;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static uint64_t width_mask(unsigned width)
+{
+    return width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << width) - 1;
+}
+
+static int64_t expected(uint64_t raw, unsigned width, bool sign_extend)
+{
+    if (!sign_extend || width == 64)
+        return static_cast<int64_t>(raw);
+    uint64_t m = UINT64_C(1) << (width - 1);
+    return static_cast<int64_t>((raw ^ m) - m);
+}
+
+/* Model of acq_delta_enc */
+class RefEncoder {
+public:
+    RefEncoder(unsigned word_bits, unsigned num_atoms, unsigned atom_width, unsigned block_log2) :
+        word_bits_(word_bits), num_atoms_(num_atoms), atom_width_(atom_width),
+        block_log2_(block_log2), prev_(num_atoms)
+    {
+        tag_bits_ = 1;
+        while ((1u << tag_bits_) < atom_width + 2)
+            tag_bits_++;
+    }
+
+    void push(const std::vector<uint64_t> &atoms)
+    {
+        const uint64_t mask = width_mask(atom_width_);
+
+        if (idx_ == 0) {
+            put(delta_magic, 16);
+            put(seq_++, 16);
+            put(atom_width_, 8);
+            put(num_atoms_, 8);
+            put(block_log2_, 4);
+            pad();
+            std::fill(prev_.begin(), prev_.end(), 0);
+        }
+
+        std::vector<uint64_t> zz(num_atoms_);
+        unsigned w = 0;
+        for (unsigned k = 0; k < num_atoms_; k++) {
+            uint64_t d = (atoms[k] - prev_[k]) & mask;
+            uint64_t sign = (d >> (atom_width_ - 1)) & 1 ? mask : 0;
+            zz[k] = ((d << 1) ^ sign) & mask;
+            prev_[k] = atoms[k];
+            while (w < atom_width_ && (zz[k] >> w))
+                w++;
+        }
+
+        put(w, tag_bits_);
+        for (unsigned k = 0; k < num_atoms_; k++)
+            put(zz[k], w);
+
+        if (++idx_ == (std::size_t(1) << block_log2_)) {
+            put(width_mask(tag_bits_), tag_bits_);
+            pad();
+            idx_ = 0;
+        }
+    }
+
+    const std::vector<uint8_t> &data() const { return out_; }
+
+private:
+    void put(uint64_t v, unsigned n)
+    {
+        out_.resize((bit_ + n + 7) / 8 + 8);
+        for (unsigned b = 0; b < n; b++, bit_++)
+            if ((v >> b) & 1)
+                out_[bit_ / 8] |= 1 << (bit_ % 8);
+        out_.resize((bit_ + 7) / 8);
+    }
+
+    void pad()
+    {
+        bit_ = (bit_ + word_bits_ - 1) / word_bits_ * word_bits_;
+        out_.resize(bit_ / 8);
+    }
+
+    unsigned word_bits_, num_atoms_, atom_width_, block_log2_, tag_bits_;
+    std::vector<uint64_t> prev_;
+    std::vector<uint8_t> out_;
+    std::size_t bit_ = 0;
+    std::size_t idx_ = 0;
+    uint16_t seq_ = 0;
+};
+
+struct Case {
+    unsigned int_width;
+    unsigned num_atoms;
+    unsigned atom_width;
+    unsigned block_log2;
+    unsigned max_step_log2;
+};
+
+template <typename T>
+static void test_roundtrip(std::mt19937_64 &rng, const Case &c, unsigned nblocks)
+{
+    ChannelDesc desc;
+    desc.int_width = c.int_width;
+    desc.num_coalesce = 1;
+    desc.num_atoms = c.num_atoms;
+    desc.atom_width = c.atom_width;
+
+    const uint64_t mask = width_mask(c.atom_width);
+    const std::size_t block = std::size_t(1) << c.block_log2;
+    const std::size_t nsamples = nblocks * block;
+
+    RefEncoder enc(c.int_width > 64 ? 128 : 64, c.num_atoms, c.atom_width, c.block_log2);
+    std::vector<std::vector<uint64_t>> raw(c.num_atoms, std::vector<uint64_t>(nsamples));
+    std::vector<uint64_t> x(c.num_atoms);
+
+    for (std::size_t i = 0; i < nsamples; i++) {
+        bool jump = rng() % 64 == 0;
+        for (unsigned k = 0; k < c.num_atoms; k++) {
+            if (jump) {
+                x[k] = rng() & mask;
+            } else {
+                unsigned step_log2 = rng() % (c.max_step_log2 + 1);
+                uint64_t step = rng() & width_mask(step_log2);
+                x[k] = (rng() & 1 ? x[k] + step : x[k] - step) & mask;
+            }
+            raw[k][i] = x[k];
+        }
+        enc.push(x);
+    }
+
+    const std::vector<uint8_t> &stream = enc.data();
+
+    for (SimdLevel simd : { SimdLevel::scalar, SimdLevel::sse41, SimdLevel::avx2 }) {
+        for (bool sign_extend : { false, true }) {
+            DeltaDecoder dec(desc, sign_extend, simd);
+            std::vector<std::vector<T>> out(c.num_atoms, std::vector<T>(block));
+            std::vector<T *> ptrs;
+            for (auto &v : out)
+                ptrs.push_back(v.data());
+
+            std::size_t ofs = 0, s = 0;
+            for (unsigned b = 0; b < nblocks; b++) {
+                std::size_t n = 0;
+                DeltaBlockHeader hdr;
+                std::size_t used = dec.decode_block(stream.data() + ofs, stream.size() - ofs,
+                                                    ptrs.data(), block, n, &hdr);
+                CHECK(used > 0 && used % dec.word_bytes() == 0);
+                CHECK(n == block);
+                CHECK(hdr.seq == b);
+                CHECK(hdr.block_log2 == c.block_log2);
+
+                bool ok = true;
+                for (unsigned k = 0; k < c.num_atoms; k++)
+                    for (std::size_t i = 0; i < n; i++)
+                        ok &= static_cast<int64_t>(out[k][i]) ==
+                              static_cast<int64_t>(static_cast<T>(
+                                  expected(raw[k][s + i], c.atom_width, sign_extend)));
+                CHECK(ok);
+
+                ofs += used;
+                s += n;
+            }
+            CHECK(ofs == stream.size());
+        }
+    }
+
+    /* A block cut short is reported as incomplete */
+    DeltaDecoder dec(desc);
+    std::vector<std::vector<T>> out(c.num_atoms, std::vector<T>(block));
+    std::vector<T *> ptrs;
+    for (auto &v : out)
+        ptrs.push_back(v.data());
+
+    std::size_t n = 0;
+    std::size_t first = dec.decode_block(stream.data(), stream.size(), ptrs.data(), block, n);
+    for (std::size_t cut = 0; cut < first; cut += dec.word_bytes())
+        CHECK(dec.decode_block(stream.data(), cut, ptrs.data(), block, n) == 0);
+
+    /* Decoding resumes at the next header after garbage */
+    if (nblocks > 1) {
+        std::vector<uint8_t> broken(stream.begin() + dec.word_bytes(), stream.end());
+        std::size_t next = dec.find_block(broken.data(), broken.size());
+        CHECK(next <= first - dec.word_bytes());
+        CHECK(dec.decode_block(broken.data() + first - dec.word_bytes(),
+                               broken.size() - (first - dec.word_bytes()),
+                               ptrs.data(), block, n) > 0);
+    }
+}
+
+static void test_invalid()
+{
+    ChannelDesc desc;
+    desc.int_width = 64;
+    desc.num_coalesce = 2;
+    desc.num_atoms = 4;
+    desc.atom_width = 16;
+
+    bool thrown = false;
+    try {
+        DeltaDecoder dec(desc);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    /* Wrong atom layout in the header */
+    desc.num_coalesce = 1;
+    DeltaDecoder dec(desc);
+    RefEncoder enc(64, 2, 32, 0);
+    enc.push({ 1, 2 });
+    DeltaBlockHeader hdr;
+    CHECK(!dec.parse_header(enc.data().data(), hdr));
+    CHECK(dec.find_block(enc.data().data(), enc.data().size()) == enc.data().size());
+
+    thrown = false;
+    std::vector<int32_t> a(4 * 4);
+    int32_t *ptrs[4] = { &a[0], &a[4], &a[8], &a[12] };
+    std::size_t n;
+    try {
+        dec.decode_block(enc.data().data(), enc.data().size(), ptrs, 4, n);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+static void test_regs()
+{
+    std::map<uint32_t, uint32_t> regs;
+    regs[ACQ_CORE_REG_ACQ_COMP_CTL] = ACQ_CORE_ACQ_COMP_CTL_EN |
+                                      ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_W(9) |
+                                      ACQ_CORE_ACQ_COMP_CTL_AVAIL;
+    CompConfig comp = CompConfig::from_regs([&](uint32_t ofs) { return regs[ofs]; });
+
+    CHECK(comp.enable);
+    CHECK(comp.block_log2 == 9);
+    CHECK(!comp.active);
+    CHECK(!comp.overflow);
+    CHECK(comp.available);
+}
+
+int main()
+{
+    std::mt19937_64 rng(2026);
+
+    static const Case cases[] = {
+        { 64, 4, 16, 6, 6 },
+        { 64, 4, 16, 0, 15 },
+        { 64, 2, 32, 4, 12 },
+        { 64, 3, 20, 3, 19 },
+        { 64, 1, 64, 5, 63 },
+        { 128, 4, 32, 5, 8 },
+        { 128, 2, 64, 4, 40 },
+        { 128, 8, 16, 7, 3 },
+    };
+
+    for (const Case &c : cases) {
+        if (c.atom_width <= 16)
+            test_roundtrip<int16_t>(rng, c, 8);
+        if (c.atom_width <= 32)
+            test_roundtrip<int32_t>(rng, c, 8);
+        test_roundtrip<int64_t>(rng, c, 8);
+    }
+    test_invalid();
+    test_regs();
+
+    if (failures) {
+        std::fprintf(stderr, "acq_delta_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("acq_delta_test: OK\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,440 @@
+/*
+ * Acquisition layout model self-test
+ *
+ * Runs random acquisitions through a word-by-word replica of the DDR3
+ * writers address counter and checks every sample position, TRIG_POS and
+ * the linearized output against the closed-form model. Streaming
+ * acquisitions are checked the same way, against a replica of the
+ * acq_ddr3_axis_write ring pointers, with a software consumer reading at a
+ * random pace.
+ *
+ * If given a log written by the wb_acq_core_test testbench (acq_layout.log),
+ * it also checks the TRIG_POS value read back from the simulated core for
+ * every test in it.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "acq_layout.h"
+#include "wb_acq_core_regs.h"
+
+using namespace acq_core;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/* What was written to a DDR3 word: shot and word index inside the shot.
+ * Words written while waiting for the trigger have shot = -1 */
+struct WordTag {
+    int shot;
+    uint64_t word;
+};
+
+struct SimResult {
+    std::map<uint32_t, WordTag> mem;
+    uint32_t trig_pos;
+};
+
+/* Mirrors p_ddr_addr_cnt and p_ddr_trig_addr of acq_ddr3_{axis,ui}_write,
+ * one accepted payload word at a time */
+static SimResult simulate(const AcqConfig &cfg, const CoreGeometry &geo,
+                          const std::vector<WordTag> &words,
+                          const std::vector<bool> &trig)
+{
+    bool axis = geo.ddr_interface == CoreGeometry::DdrInterface::axis;
+    uint64_t amask = (UINT64_C(1) << geo.addr_bits) - 1;
+    uint32_t align = geo.payload_bits / geo.dq_bits - 1;
+    uint32_t inc = axis ? geo.payload_bits / 8 : geo.payload_bits / geo.dq_bits;
+    uint32_t init = cfg.ddr3_start_addr & ~align & amask;
+    uint32_t max = cfg.ddr3_end_addr & ~align & amask;
+
+    SimResult res;
+    uint32_t cnt = init;
+    bool captured = false;
+    res.trig_pos = init;
+
+    for (std::size_t w = 0; w < words.size(); w++) {
+        res.mem[cnt] = words[w];
+
+        if (!captured && trig[w]) {
+            res.trig_pos = (cnt == init ? max + inc : cnt) & amask;
+            captured = true;
+        }
+
+        if (axis) {
+            bool wrap = uint64_t(cnt) + inc >= max || cnt >= max;
+            cnt = wrap ? init : (cnt + inc) & amask;
+        } else {
+            cnt = cnt == max ? init : (cnt + inc) & amask;
+        }
+    }
+
+    if (!captured)
+        res.trig_pos = cnt;
+
+    return res;
+}
+
+static uint8_t pattern(uint32_t shot, uint64_t byte)
+{
+    return static_cast<uint8_t>(shot * 131 + byte * 7 + (byte >> 8));
+}
+
+static void test_random(std::mt19937 &rng)
+{
+    CoreGeometry geo;
+    AcqConfig cfg;
+
+    geo.ddr_interface = rng() % 2 ? CoreGeometry::DdrInterface::axis :
+                                    CoreGeometry::DdrInterface::ui;
+    geo.payload_bits = rng() % 2 ? 256 : 512;
+    geo.dq_bits = rng() % 2 ? 32 : 64;
+    geo.addr_bits = rng() % 2 ? 32 : 28;
+
+    bool axis = geo.ddr_interface == CoreGeometry::DdrInterface::axis;
+    unsigned payload_bytes = geo.payload_bits / 8;
+    uint32_t inc = axis ? payload_bytes : geo.payload_bits / geo.dq_bits;
+
+    cfg.sample_bytes = 8u << (rng() % 4);
+    /* Either coalesced 128-bit words or a frame of 64-bit channels */
+    if (rng() % 2)
+        cfg.words_per_sample = cfg.sample_bytes > 16 ? cfg.sample_bytes / 16 : 1;
+    else
+        cfg.words_per_sample = cfg.sample_bytes / 8;
+    unsigned spw = payload_bytes / cfg.sample_bytes;    /* samples per word */
+    if (spw == 0)
+        spw = 1;
+    /* Keep every size a whole number of payload words */
+    unsigned step = cfg.sample_bytes >= payload_bytes ? 1 : spw;
+
+    cfg.pre_samples = step * (rng() % 6);
+    cfg.post_samples = step * (rng() % 6);
+    if (cfg.pre_samples + cfg.post_samples == 0)
+        cfg.post_samples = step;
+    cfg.shots = 1 + rng() % 5;
+    cfg.multishot_ram_size = rng() % 3 ? 2048 : 4;
+    cfg.acq_now = rng() % 4 == 0;
+
+    uint32_t shot_words = (cfg.pre_samples + cfg.post_samples) * cfg.sample_bytes / payload_bytes;
+    uint32_t ring_words = shot_words + rng() % (3 * shot_words * cfg.shots + 4);
+    cfg.ddr3_start_addr = (rng() % 64) * inc;
+    if (axis) {
+        /* Unaligned end addresses round up to a whole word */
+        cfg.ddr3_end_addr = cfg.ddr3_start_addr + ring_words * inc - (rng() % 2) * (inc / 2);
+    } else {
+        cfg.ddr3_end_addr = cfg.ddr3_start_addr + (ring_words - 1) * inc;
+    }
+
+    AcqLayout layout(cfg, geo);
+    CHECK(layout.ring_bytes() == uint64_t(ring_words) * payload_bytes);
+
+    /* Build the word stream the DDR3 writer sees */
+    std::vector<WordTag> words;
+    std::vector<bool> trig;
+    uint32_t pre_words = cfg.pre_samples * cfg.sample_bytes / payload_bytes;
+
+    if (layout.path() == AcqLayout::Path::direct) {
+        for (uint32_t w = 0; w < pre_words; w++) {
+            words.push_back({0, w});
+            trig.push_back(false);
+        }
+
+        /* Samples written while waiting for the trigger. Older pre-trigger
+         * samples get overwritten, so the pre-trigger window is slid */
+        if (!cfg.acq_now) {
+            uint32_t wait = rng() % (2 * ring_words);
+            for (uint32_t w = 0; w < wait; w++) {
+                words.push_back({-1, 0});
+                trig.push_back(false);
+            }
+            std::size_t n = words.size();
+            for (uint32_t w = 0; w < pre_words; w++)
+                words[n - pre_words + w] = {0, w};
+            for (uint32_t w = 0; w + pre_words < n && w < pre_words; w++)
+                words[w] = {-1, 0};
+        }
+
+        for (uint32_t w = pre_words; w < shot_words; w++) {
+            words.push_back({0, w});
+            trig.push_back(!cfg.acq_now && w == pre_words);
+        }
+    } else {
+        for (uint32_t s = 0; s < cfg.shots; s++)
+            for (uint32_t w = 0; w < shot_words; w++) {
+                words.push_back({static_cast<int>(s), w});
+                trig.push_back(!cfg.acq_now && cfg.post_samples && w == pre_words);
+            }
+    }
+
+    SimResult sim = simulate(cfg, geo, words, trig);
+
+    if (layout.trig_pos_known())
+        CHECK(layout.expected_trig_pos() == sim.trig_pos);
+    layout.set_trig_pos(sim.trig_pos);
+
+    /* Every sample of every complete shot */
+    unsigned unit_bytes = axis ? 1 : geo.dq_bits / 8;
+    std::vector<uint8_t> ring(layout.ring_bytes());
+
+    for (const auto &m : sim.mem) {
+        uint64_t ofs = uint64_t(m.first - layout.ring_start()) * unit_bytes;
+        for (unsigned b = 0; b < payload_bytes; b++)
+            ring[ofs + b] = m.second.shot < 0 ? 0xa5 :
+                pattern(m.second.shot, m.second.word * payload_bytes + b);
+    }
+
+    for (uint32_t s = layout.first_shot(); s < cfg.shots; s++) {
+        for (uint64_t j = 0; j < layout.samples_per_shot(); j++) {
+            uint64_t byte = j * cfg.sample_bytes;
+            uint32_t addr = layout.sample_addr(s, j);
+            uint32_t waddr = addr - (addr - layout.ring_start()) % inc;
+            auto it = sim.mem.find(waddr);
+
+            CHECK(it != sim.mem.end());
+            if (it == sim.mem.end())
+                continue;
+            CHECK(it->second.shot == static_cast<int>(s));
+            CHECK(it->second.word == byte / payload_bytes);
+            CHECK((addr - waddr) * unit_bytes == byte % payload_bytes);
+        }
+    }
+
+    if (layout.path() == AcqLayout::Path::multishot_ram) {
+        uint32_t fit = ring_words / shot_words;
+        CHECK(layout.first_shot() == (fit >= cfg.shots ? 0 : cfg.shots - fit));
+    }
+
+    std::vector<uint8_t> out((cfg.shots - layout.first_shot()) * layout.shot_bytes());
+    CHECK(layout.linearize(ring.data(), out.data()) == out.size());
+    for (uint32_t s = layout.first_shot(), i = 0; s < cfg.shots; s++, i++)
+        for (uint64_t b = 0; b < layout.shot_bytes(); b++)
+            if (out[i * layout.shot_bytes() + b] != pattern(s, b)) {
+                CHECK(out[i * layout.shot_bytes() + b] == pattern(s, b));
+                break;
+            }
+}
+
+/* Mirrors the stream ring logic of acq_ddr3_axis_write in throttle mode: a
+ * word is only accepted if the address after it is not the read pointer, and
+ * the write pointer only moves on burst completion */
+static void test_stream(std::mt19937 &rng)
+{
+    CoreGeometry geo;
+    geo.payload_bits = rng() % 2 ? 256 : 512;
+    geo.dq_bits = rng() % 2 ? 32 : 64;
+    geo.addr_bits = rng() % 2 ? 32 : 28;
+
+    uint32_t inc = geo.payload_bits / 8;
+    uint32_t align = geo.payload_bits / geo.dq_bits - 1;
+    uint32_t ring_words = 2 + rng() % 40;
+    uint32_t start = (rng() % 64) * inc;
+    uint32_t end = start + ring_words * inc - (rng() % 2) * (inc / 2);
+
+    StreamRing sr(start, end, geo);
+    CHECK(sr.ring_bytes() == uint64_t(ring_words) * inc);
+    CHECK(sr.capacity() == uint64_t(ring_words - 1) * inc);
+
+    uint32_t init = start & ~align;
+    uint32_t max = end & ~align;
+    uint32_t cnt = init;
+    uint32_t wr_ptr = init;
+    uint32_t rd_ptr = sr.ring_start();
+    std::deque<uint32_t> bursts;    /* posted, not yet completed */
+    uint32_t burst = 0;
+    std::vector<uint8_t> ring(sr.ring_bytes());
+    uint32_t produced = 0, consumed = 0;
+
+    for (int cycle = 0; cycle < 2000; cycle++) {
+        /* Writer */
+        bool wrap = uint64_t(cnt) + inc >= max || cnt >= max;
+        uint32_t next = wrap ? init : cnt + inc;
+        if (rng() % 4 && next != rd_ptr) {
+            std::fill_n(&ring[cnt - init], inc, static_cast<uint8_t>(produced++));
+            burst++;
+            cnt = next;
+            /* Bursts end at the end of the area, or at random */
+            if (wrap || rng() % 3 == 0) {
+                bursts.push_back(burst);
+                burst = 0;
+            }
+        }
+
+        /* Memory acknowledges */
+        if (!bursts.empty() && rng() % 3 == 0) {
+            uint64_t p = uint64_t(wr_ptr) + bursts.front() * inc;
+            wr_ptr = p >= max ? init : static_cast<uint32_t>(p);
+            bursts.pop_front();
+        }
+
+        /* Consumer */
+        CHECK(sr.readable(rd_ptr, wr_ptr) <= sr.capacity());
+        if (rng() % 5 == 0) {
+            std::vector<uint8_t> out(sr.ring_bytes());
+            std::size_t max_len = rng() % (sr.ring_bytes() + inc);
+            std::size_t n = sr.read(ring.data(), rd_ptr, wr_ptr, out.data(), max_len);
+
+            CHECK(n % inc == 0 && n <= max_len);
+            for (std::size_t w = 0; w < n / inc; w++, consumed++)
+                CHECK(out[w * inc] == static_cast<uint8_t>(consumed) &&
+                      out[w * inc + inc - 1] == out[w * inc]);
+            rd_ptr = sr.advance(rd_ptr, n);
+        }
+    }
+
+    CHECK(consumed <= produced);
+}
+
+static void test_invalid()
+{
+    AcqConfig cfg;
+    cfg.pre_samples = 3;    /* 24 bytes, not a whole 32-byte word */
+    cfg.ddr3_end_addr = 0x1000;
+    bool thrown = false;
+    try {
+        AcqLayout layout(cfg);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    CoreGeometry geo;
+    geo.ddr_interface = CoreGeometry::DdrInterface::ui;
+    thrown = false;
+    try {
+        StreamRing sr(0, 0x1000, geo);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+static void test_write_perf()
+{
+    std::map<uint32_t, uint32_t> regs;
+    regs[ACQ_CORE_REG_DDR3_PERF_BEATS] = 3000;
+    regs[ACQ_CORE_REG_DDR3_PERF_CYCLES] = 4000;
+    WritePerf perf = WritePerf::from_regs([&](uint32_t ofs) { return regs[ofs]; });
+
+    CHECK(perf.efficiency() == 0.75);
+    CHECK(perf.bytes_per_cycle() == 24.0);
+    CoreGeometry geo;
+    geo.payload_bits = 512;
+    CHECK(perf.bytes_per_cycle(geo) == 48.0);
+    CHECK(!perf.saturated());
+
+    CHECK(WritePerf().efficiency() == 0.0);
+}
+
+static void test_decim()
+{
+    std::map<uint32_t, uint32_t> regs;
+    regs[ACQ_CORE_REG_ACQ_DECIM_CTL] = ACQ_CORE_ACQ_DECIM_CTL_RATIO_W(10) |
+                                       ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_W(5) |
+                                       (4 << 20);
+    regs[ACQ_CORE_REG_ACQ_DECIM_MASK] = ACQ_CORE_ACQ_DECIM_MASK_MASK_W(0x5);
+    DecimConfig decim = DecimConfig::from_regs([&](uint32_t ofs) { return regs[ofs]; });
+
+    CHECK(decim.ratio == 10);
+    CHECK(decim.max_avg_order_sel == 4);
+    CHECK(decim.rate_divider(0) == 10);
+    CHECK(decim.rate_divider(1) == 1);
+    CHECK(decim.rate_divider(2) == 10);
+
+    ChannelDesc plain;
+    plain.num_coalesce = 1;
+    ChannelDesc coalesced;
+    coalesced.num_coalesce = 2;
+    CHECK(decim.avg_taps(plain, 0) == 16);
+    CHECK(decim.avg_taps(plain, 1) == 1);
+    CHECK(decim.avg_taps(coalesced, 2) == 1);
+
+    decim.ratio = 1;
+    CHECK(!decim.decimated(0));
+    CHECK(decim.avg_taps(plain, 0) == 16);
+    CHECK(DecimConfig().avg_taps(plain, 0) == 1);
+}
+
+/* Each line: test shots pre post start end ram_size acq_now sample_bits
+ * payload_bits dq_bits addr_bits axis trig_pos */
+static void check_tb_log(const char *path)
+{
+    FILE *f = std::fopen(path, "r");
+    if (!f) {
+        std::perror(path);
+        failures++;
+        return;
+    }
+
+    unsigned test, acq_now, sample_bits, axis;
+    unsigned long shots, pre, post, start, end, ram, trig_pos;
+    CoreGeometry geo;
+    int lines = 0;
+
+    while (std::fscanf(f, "%u %lu %lu %lu %lu %lu %lu %u %u %u %u %u %u %lu", &test,
+                       &shots, &pre, &post, &start, &end, &ram, &acq_now,
+                       &sample_bits, &geo.payload_bits, &geo.dq_bits,
+                       &geo.addr_bits, &axis, &trig_pos) == 14) {
+        AcqConfig cfg;
+        cfg.shots = shots;
+        cfg.pre_samples = pre;
+        cfg.post_samples = post;
+        cfg.ddr3_start_addr = start;
+        cfg.ddr3_end_addr = end;
+        cfg.multishot_ram_size = ram;
+        cfg.acq_now = acq_now;
+        cfg.sample_bytes = sample_bits / 8;
+        geo.ddr_interface = axis ? CoreGeometry::DdrInterface::axis :
+                                   CoreGeometry::DdrInterface::ui;
+        lines++;
+
+        AcqLayout layout(cfg, geo);
+        if (!layout.trig_pos_known())
+            continue;
+        if (layout.expected_trig_pos() != trig_pos) {
+            std::fprintf(stderr, "test #%03u: TRIG_POS 0x%08lx, model 0x%08x\n",
+                         test, trig_pos, layout.expected_trig_pos());
+            failures++;
+        }
+    }
+
+    std::fclose(f);
+    std::printf("acq_layout_test: %d testbench acquisitions checked\n", lines);
+}
+
+int main(int argc, char **argv)
+{
+    std::mt19937 rng(2026);
+
+    for (int i = 0; i < 20000; i++)
+        test_random(rng);
+    for (int i = 0; i < 2000; i++)
+        test_stream(rng);
+    test_invalid();
+    test_write_perf();
+    test_decim();
+
+    if (argc > 1)
+        check_tb_log(argv[1]);
+
+    if (failures) {
+        std::fprintf(stderr, "acq_layout_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("acq_layout_test: OK\n");
+    return EXIT_SUCCESS;
+}
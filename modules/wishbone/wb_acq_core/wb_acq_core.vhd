@@ -67,7 +67,10 @@ generic
   g_fifo_fc_size                            : natural := 64;
   g_sim_readback                            : boolean := false;
   g_ddr_interface_type                      : string  := "AXIS";
-  g_max_burst_size                          : natural := 4
+  g_max_burst_size                          : natural := 4;
+  g_max_outstanding_bursts                  : natural := 8;
+  g_decim_max_avg_order_sel                 : natural := 0;
+  g_with_delta_comp                         : boolean := false
 );
 port
 (
@@ -196,7 +199,7 @@ architecture rtl of wb_acq_core is
   -----------------------------
   constant c_acq_samples_size               : natural := 32;
   constant c_dpram_depth                    : integer := f_log2_size(g_multishot_ram_size);
-  constant c_periph_addr_size               : natural := 3+5;
+  constant c_periph_addr_size               : natural := 4+5;
   constant c_max_num_channels               : natural := 24;
   constant c_multishot_ram_size_impl        : boolean := true;
   constant c_trig_cnt_off_width             : natural := 8;
@@ -319,6 +322,13 @@ architecture rtl of wb_acq_core is
   signal acq_id                             : t_acq_id;
   signal acq_valid_fsm                      : std_logic;
   signal acq_id_fsm                         : t_acq_id;
+  signal acq_data_comp                      : std_logic_vector(c_acq_data_width-1 downto 0);
+  signal acq_valid_comp                     : std_logic;
+  signal acq_trig_comp                      : std_logic;
+  signal acq_comp_en                        : std_logic;
+  signal acq_comp_block_log2                : unsigned(3 downto 0);
+  signal acq_comp_active                    : std_logic;
+  signal acq_comp_ovf                       : std_logic;
   signal samples_wr_en                      : std_logic;
 
   -- ACQ trigger registers
@@ -342,12 +352,33 @@ architecture rtl of wb_acq_core is
   signal acq_ddr3_start_addr                : std_logic_vector(g_ddr_addr_width-1 downto 0);
   signal acq_ddr3_end_addr_full             : std_logic_vector(31 downto 0); -- full 32-bit address
   signal acq_ddr3_end_addr                  : std_logic_vector(g_ddr_addr_width-1 downto 0);
+  signal acq_stream                         : std_logic;
+  signal acq_stream_overwrite               : std_logic;
+  signal acq_stream_ext                     : std_logic;
+  signal acq_stream_overwrite_ext           : std_logic;
+  signal acq_stream_rd_ptr_full             : std_logic_vector(31 downto 0); -- full 32-bit address
+  signal acq_stream_rd_ptr                  : std_logic_vector(g_ddr_addr_width-1 downto 0);
+  signal acq_stream_wr_ptr                  : std_logic_vector(g_ddr_addr_width-1 downto 0);
+  signal acq_stream_overrun                 : std_logic;
+  signal ddr3_perf_beats                    : std_logic_vector(31 downto 0);
+  signal ddr3_perf_cycles                   : std_logic_vector(31 downto 0);
 
   signal acq_pre_trig_done                  : std_logic;
   signal acq_wait_trig_skip_done            : std_logic;
   signal acq_post_trig_done                 : std_logic;
   signal lmt_curr_chan_id                   : unsigned(c_chan_id_width-1 downto 0);
   signal lmt_dtrig_chan_id                  : unsigned(c_chan_id_width-1 downto 0);
+  signal lmt_chan_mask                      : std_logic_vector(g_acq_num_channels-1 downto 0);
+  signal lmt_frame_size_log2                : unsigned(c_acq_frame_size_log2_width-1 downto 0);
+  signal acq_frame_ovf                      : std_logic;
+  signal acq_decim_ratio                    : unsigned(15 downto 0);
+  signal acq_decim_avg_order_sel            : unsigned(3 downto 0);
+  signal acq_decim_chan_mask                : std_logic_vector(g_acq_num_channels-1 downto 0);
+  signal acq_val_low_decim                  : t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  signal acq_val_high_decim                 : t_acq_val_half_array(g_acq_num_channels-1 downto 0);
+  signal acq_dvalid_decim                   : std_logic_vector(g_acq_num_channels-1 downto 0);
+  signal acq_id_decim                       : t_acq_id_array(g_acq_num_channels-1 downto 0);
+  signal acq_trig_decim                     : std_logic_vector(g_acq_num_channels-1 downto 0);
   signal samples_cnt                        : unsigned(c_acq_samples_size-1 downto 0);
   signal shots_cnt                          : unsigned(15 downto 0);
   signal shots_decr                         : std_logic;
@@ -451,7 +482,7 @@ architecture rtl of wb_acq_core is
   port (
     rst_n_i                                 : in     std_logic;
     clk_sys_i                               : in     std_logic;
-    wb_adr_i                                : in     std_logic_vector(5 downto 0);
+    wb_adr_i                                : in     std_logic_vector(6 downto 0);
     wb_dat_i                                : in     std_logic_vector(31 downto 0);
     wb_dat_o                                : out    std_logic_vector(31 downto 0);
     wb_cyc_i                                : in     std_logic;
@@ -533,7 +564,7 @@ begin
   port map(
     rst_n_i                                 => sys_rst_n_i,
     clk_sys_i                               => sys_clk_i,
-    wb_adr_i                                => wb_slv_adp_out.adr(5 downto 0),
+    wb_adr_i                                => wb_slv_adp_out.adr(6 downto 0),
     wb_dat_i                                => wb_slv_adp_out.dat,
     wb_dat_o                                => wb_slv_adp_in.dat,
     wb_cyc_i                                => wb_slv_adp_out.cyc,
@@ -557,6 +588,10 @@ begin
   shots_nb_c                                <= unsigned(regs_out.shots_nb_o);
 
   lmt_curr_chan_id                          <= unsigned(regs_out.acq_chan_ctl_which_o); -- 5-bit
+  -- Channels acquired together with WHICH, one frame per WHICH sample
+  lmt_chan_mask                             <= regs_out.acq_chan_mask_mask_o(lmt_chan_mask'left downto 0);
+  lmt_frame_size_log2                       <= to_unsigned(f_acq_chan_mask_frame_log2(lmt_chan_mask),
+                                                    lmt_frame_size_log2'length);
   lmt_dtrig_chan_id                         <= unsigned(regs_out.acq_chan_ctl_dtrig_which_o); -- 5-bit
 
   -- Synchronous to ext_clk_i
@@ -575,6 +610,16 @@ begin
   acq_stop                                  <= regs_out.ctl_fsm_stop_acq_o; -- 1 fs_clk cycle pulse
   acq_now                                   <= regs_out.ctl_fsm_acq_now_o;
 
+  -- Streaming is only supported by the AXIS DDR3 interface, as it needs the
+  -- write acknowledges to advance the write pointer
+  acq_stream                                <= regs_out.stream_ctl_en_o when g_ddr_interface_type = "AXIS" else '0';
+  acq_stream_overwrite                      <= regs_out.stream_ctl_overwrite_o;
+
+  -- Synchronous to ext_clk_i
+  acq_stream_rd_ptr_full                    <= regs_out.stream_rd_ptr_o;
+  -- Truncate address to the actually width of external memory
+  acq_stream_rd_ptr                         <= acq_stream_rd_ptr_full(acq_stream_rd_ptr'left downto 0);
+
   acq_trig_hw_sel                           <= regs_out.trig_cfg_hw_trig_sel_o;
   acq_trig_hw_pol                           <= regs_out.trig_cfg_hw_trig_pol_o;
   acq_trig_hw_en                            <= regs_out.trig_cfg_hw_trig_en_o;
@@ -598,8 +643,30 @@ begin
   regs_in.trig_pos_i                        <= f_gen_std_logic_vector(regs_in.trig_pos_i'length-
                                                     ddr_trig_addr'length, '0') & ddr_trig_addr;
   regs_in.samples_cnt_i                     <= std_logic_vector(samples_cnt);
+  regs_in.stream_ctl_overrun_i              <= acq_stream_overrun;
+  regs_in.stream_ctl_reserved1_i            <= (others => '0');
+  regs_in.stream_wr_ptr_i                   <= f_gen_std_logic_vector(regs_in.stream_wr_ptr_i'length-
+                                                    acq_stream_wr_ptr'length, '0') & acq_stream_wr_ptr;
   regs_in.acq_chan_ctl_num_chan_i           <= std_logic_vector(to_unsigned(g_acq_num_channels,
                                                     regs_in.acq_chan_ctl_num_chan_i'length));
+  regs_in.acq_chan_mask_ovf_i               <= acq_frame_ovf;
+  regs_in.ddr3_perf_beats_i                 <= ddr3_perf_beats;
+  regs_in.ddr3_perf_cycles_i                <= ddr3_perf_cycles;
+  regs_in.acq_decim_ctl_max_avg_order_sel_i <= std_logic_vector(to_unsigned(g_decim_max_avg_order_sel,
+                                                    regs_in.acq_decim_ctl_max_avg_order_sel_i'length));
+
+  acq_decim_ratio                           <= unsigned(regs_out.acq_decim_ctl_ratio_o);
+  acq_decim_avg_order_sel                   <= unsigned(regs_out.acq_decim_ctl_avg_order_sel_o);
+  acq_decim_chan_mask                       <= regs_out.acq_decim_mask_mask_o(acq_decim_chan_mask'left downto 0);
+
+  -- Compressed data has no fixed number of samples per word, so it is only
+  -- used by streaming acquisitions
+  acq_comp_en                               <= regs_out.acq_comp_ctl_en_o and acq_stream;
+  acq_comp_block_log2                       <= unsigned(regs_out.acq_comp_ctl_block_log2_o);
+  regs_in.acq_comp_ctl_active_i             <= acq_comp_active;
+  regs_in.acq_comp_ctl_ovf_i                <= acq_comp_ovf;
+  regs_in.acq_comp_ctl_avail_i              <= to_std_logic(g_with_delta_comp);
+  regs_in.acq_comp_ctl_reserved1_i          <= (others => '0');
   regs_in.shots_multishot_ram_size_impl_i   <= to_std_logic(c_multishot_ram_size_impl);
   regs_in.shots_multishot_ram_size_i        <= std_logic_vector(to_unsigned(g_multishot_ram_size,
                                                     regs_in.shots_multishot_ram_size_i'length));
@@ -776,7 +843,42 @@ begin
     acq_data_o                              => dtrig_data_marsh,
     acq_dvalid_o                            => dtrig_valid_in,
     acq_id_o                                => dtrig_id_in,
-    acq_trig_o                              => open
+    acq_trig_o                              => open,
+    acq_frame_ovf_o                         => open
+  );
+
+  ------------------------------------------------------------------------------
+  -- Channel Decimation. The data-driven trigger still sees every sample
+  -----------------------------------------------------------------------------
+  cmp_acq_decim : acq_decim
+  generic map
+  (
+    g_acq_num_channels                      => g_acq_num_channels,
+    g_acq_channels                          => g_acq_channels,
+    g_max_avg_order_sel                     => g_decim_max_avg_order_sel,
+    g_decim_ratio_width                     => acq_decim_ratio'length
+  )
+  port map
+  (
+    clk_i                                   => fs_clk_i,
+    rst_n_i                                 => fs_rst_n,
+
+    decim_ratio_i                           => acq_decim_ratio,
+    avg_order_sel_i                         => acq_decim_avg_order_sel,
+    decim_chan_mask_i                       => acq_decim_chan_mask,
+    lmt_valid_i                             => acq_start_safe,
+
+    acq_val_low_i                           => acq_val_low_i,
+    acq_val_high_i                          => acq_val_high_i,
+    acq_dvalid_i                            => acq_dvalid_i,
+    acq_id_i                                => acq_id_i,
+    acq_trig_i                              => acq_trig_i,
+
+    acq_val_low_o                           => acq_val_low_decim,
+    acq_val_high_o                          => acq_val_high_decim,
+    acq_dvalid_o                            => acq_dvalid_decim,
+    acq_id_o                                => acq_id_decim,
+    acq_trig_o                              => acq_trig_decim
   );
 
   ------------------------------------------------------------------------------
@@ -796,13 +898,15 @@ begin
     -----------------------------
     -- Acquisiton Interface
     -----------------------------
-    acq_val_low_i                           => acq_val_low_i,
-    acq_val_high_i                          => acq_val_high_i,
-    acq_dvalid_i                            => acq_dvalid_i,
-    acq_id_i                                => acq_id_i,
-    acq_trig_i                              => acq_trig_i,
+    acq_val_low_i                           => acq_val_low_decim,
+    acq_val_high_i                          => acq_val_high_decim,
+    acq_dvalid_i                            => acq_dvalid_decim,
+    acq_id_i                                => acq_id_decim,
+    acq_trig_i                              => acq_trig_decim,
 
     lmt_curr_chan_id_i                      => lmt_curr_chan_id,
+    lmt_chan_mask_i                         => lmt_chan_mask,
+    lmt_frame_size_log2_i                   => lmt_frame_size_log2,
     lmt_valid_i                             => acq_start_safe,
 
     -----------------------------
@@ -811,7 +915,8 @@ begin
     acq_data_o                              => acq_data_marsh,
     acq_dvalid_o                            => acq_dvalid_in,
     acq_id_o                                => acq_id_in,
-    acq_trig_o                              => acq_trig_in
+    acq_trig_o                              => acq_trig_in,
+    acq_frame_ovf_o                         => acq_frame_ovf
   );
 
   -----------------------------------------------------------------------------
@@ -857,6 +962,7 @@ begin
     acq_single_shot_i                       => acq_single_shot,
 
     lmt_curr_chan_id_i                      => lmt_curr_chan_id,
+    lmt_frame_size_log2_i                   => lmt_frame_size_log2,
     lmt_valid_i                             => acq_start_safe,
 
     acq_wr_en_i                             => acq_fsm_accepting,
@@ -893,6 +999,7 @@ begin
     -----------------------------
     acq_start_i                             => acq_start_sync_fs,
     acq_now_i                               => acq_now,
+    acq_stream_i                            => acq_stream,
     acq_stop_i                              => acq_stop,
     acq_data_i                              => acq_data,
     acq_trig_i                              => acq_trig,
@@ -906,6 +1013,7 @@ begin
     post_trig_samples_i                     => post_trig_samples_c,
     shots_nb_i                              => shots_nb_c,
     lmt_curr_chan_id_i                      => lmt_curr_chan_id,
+    lmt_frame_size_log2_i                   => lmt_frame_size_log2,
     lmt_valid_i                             => acq_start_safe,
     samples_cnt_o                           => samples_cnt,
 
@@ -947,6 +1055,51 @@ begin
     samples_wr_en_o                         => samples_wr_en
   );
 
+  ------------------------------------------------------------------------------
+  -- Delta compression of streaming acquisitions
+  -----------------------------------------------------------------------------
+  gen_delta_comp : if g_with_delta_comp generate
+
+    cmp_acq_delta_comp : acq_delta_comp
+    generic map
+    (
+      g_data_width                          => c_acq_data_width,
+      g_acq_num_channels                    => g_acq_num_channels,
+      g_acq_channels                        => g_acq_channels
+    )
+    port map
+    (
+      clk_i                                 => fs_clk_i,
+      rst_n_i                               => fs_rst_n,
+
+      comp_en_i                             => acq_comp_en,
+      block_log2_i                          => acq_comp_block_log2,
+      lmt_curr_chan_id_i                    => lmt_curr_chan_id,
+      lmt_valid_i                           => acq_start_safe,
+      acq_stop_i                            => acq_stop,
+
+      acq_data_i                            => acq_data_fsm,
+      acq_valid_i                           => acq_valid_fsm,
+      acq_trig_i                            => acq_trig_fsm,
+
+      acq_data_o                            => acq_data_comp,
+      acq_valid_o                           => acq_valid_comp,
+      acq_trig_o                            => acq_trig_comp,
+
+      comp_active_o                         => acq_comp_active,
+      comp_ovf_o                            => acq_comp_ovf
+    );
+
+  end generate;
+
+  gen_no_delta_comp : if not g_with_delta_comp generate
+    acq_data_comp                           <= acq_data_fsm;
+    acq_valid_comp                          <= acq_valid_fsm;
+    acq_trig_comp                           <= acq_trig_fsm;
+    acq_comp_active                         <= '0';
+    acq_comp_ovf                            <= '0';
+  end generate;
+
   ------------------------------------------------------------------------------
   -- Dual DPRAM buffers for multi-shots acquisition
   -----------------------------------------------------------------------------
@@ -1026,10 +1179,10 @@ begin
     dpram_stall_o                           => dpram_stall,
 
     -- Passthrough data
-    pt_data_i                               => acq_data_fsm,
+    pt_data_i                               => acq_data_comp,
     pt_data_id_i                            => acq_fsm_state,
-    pt_trig_i                               => acq_trig_fsm,
-    pt_dvalid_i                             => acq_valid_fsm,
+    pt_trig_i                               => acq_trig_comp,
+    pt_dvalid_i                             => acq_valid_comp,
     pt_wr_en_i                              => samples_wr_en,
 
     -- Request transaction reset as soon as possible (when all outstanding
@@ -1262,6 +1415,27 @@ begin
   ext_dreq_o                                <= ext_dreq;   -- for debugging purposes
   ext_stall_o                               <= ext_stall;  -- for debugging purposes
 
+  ------------------------------------------------------------------------------
+  -- Streaming mode control
+  ------------------------------------------------------------------------------
+
+  -- These are only expected to change while the acquisition is stopped
+  cmp_stream_en_ext_synch : gc_sync_ffs
+  port map(
+    clk_i                                   => ext_clk_i,
+    rst_n_i                                 => ext_rst_n_i,
+    data_i                                  => acq_stream,
+    synced_o                                => acq_stream_ext
+  );
+
+  cmp_stream_overwrite_ext_synch : gc_sync_ffs
+  port map(
+    clk_i                                   => ext_clk_i,
+    rst_n_i                                 => ext_rst_n_i,
+    data_i                                  => acq_stream_overwrite,
+    synced_o                                => acq_stream_overwrite_ext
+  );
+
   ------------------------------------------------------------------------------
   -- DDR3 Interface
   ------------------------------------------------------------------------------
@@ -1338,6 +1512,11 @@ begin
       ui_app_req_o                            => ui_app_wdf_req,
       ui_app_gnt_i                            => ui_app_wdf_gnt
     );
+
+    acq_stream_wr_ptr                         <= (others => '0');
+    acq_stream_overrun                        <= '0';
+    ddr3_perf_beats                           <= (others => '0');
+    ddr3_perf_cycles                          <= (others => '0');
   end generate;
 
   gen_ddr3_axis_interface : if g_ddr_interface_type = "AXIS" generate
@@ -1354,7 +1533,8 @@ begin
       g_ddr_payload_width                     => g_ddr_payload_width,
       g_ddr_dq_width                          => g_ddr_dq_width,
       g_ddr_addr_width                        => g_ddr_addr_width,
-      g_max_burst_size                        => g_max_burst_size
+      g_max_burst_size                        => g_max_burst_size,
+      g_max_outstanding_bursts                => g_max_outstanding_bursts
     )
     port map
     (
@@ -1380,6 +1560,15 @@ begin
       wr_end_addr_i                           => acq_ddr3_end_addr,
       wr_trig_cnt_off_i                       => acq_trig_cnt_off,
 
+      stream_en_i                             => acq_stream_ext,
+      stream_overwrite_i                      => acq_stream_overwrite_ext,
+      stream_rd_ptr_i                         => acq_stream_rd_ptr,
+      stream_wr_ptr_o                         => acq_stream_wr_ptr,
+      stream_overrun_o                        => acq_stream_overrun,
+
+      perf_beats_o                            => ddr3_perf_beats,
+      perf_cycles_o                           => ddr3_perf_cycles,
+
       lmt_all_trans_done_p_o                  => ddr3_wr_all_trans_done_p,
       lmt_ddr_trig_addr_o                     => ddr_trig_addr,
       lmt_rst_i                               => '0', --remove this signal
@@ -49,7 +49,10 @@ generic
   g_fifo_fc_size                            : natural := 64;
   g_sim_readback                            : boolean := false;
   g_ddr_interface_type                      : string  := "AXIS";
-  g_max_burst_size                          : natural := 4
+  g_max_burst_size                          : natural := 4;
+  g_max_outstanding_bursts                  : natural := 8;
+  g_decim_max_avg_order_sel                 : natural := 0;
+  g_with_delta_comp                         : boolean := false
 );
 port
 (
@@ -161,7 +164,10 @@ begin
     g_fifo_fc_size                            => g_fifo_fc_size,
     g_sim_readback                            => g_sim_readback,
     g_ddr_interface_type                      => g_ddr_interface_type,
-    g_max_burst_size                          => g_max_burst_size
+    g_max_burst_size                          => g_max_burst_size,
+    g_max_outstanding_bursts                  => g_max_outstanding_bursts,
+    g_decim_max_avg_order_sel                 => g_decim_max_avg_order_sel,
+    g_with_delta_comp                         => g_with_delta_comp
   )
   port map
   (
@@ -21,7 +21,7 @@ entity acq_core_regs is
   port (
     rst_n_i                                  : in     std_logic;
     clk_sys_i                                : in     std_logic;
-    wb_adr_i                                 : in     std_logic_vector(5 downto 0);
+    wb_adr_i                                 : in     std_logic_vector(6 downto 0);
     wb_dat_i                                 : in     std_logic_vector(31 downto 0);
     wb_dat_o                                 : out    std_logic_vector(31 downto 0);
     wb_cyc_i                                 : in     std_logic;
@@ -171,11 +171,90 @@ signal acq_core_acq_chan_ctl_dtrig_which_swb_s1 : std_logic      ;
 signal acq_core_acq_chan_ctl_dtrig_which_swb_s2 : std_logic      ;
 signal acq_core_acq_chan_ctl_reserved1_int      : std_logic_vector(2 downto 0);
 signal acq_core_acq_chan_ctl_reserved2_int      : std_logic_vector(10 downto 0);
+signal acq_core_stream_ctl_en_int               : std_logic      ;
+signal acq_core_stream_ctl_en_sync0             : std_logic      ;
+signal acq_core_stream_ctl_en_sync1             : std_logic      ;
+signal acq_core_stream_ctl_overwrite_int        : std_logic      ;
+signal acq_core_stream_ctl_overwrite_sync0      : std_logic      ;
+signal acq_core_stream_ctl_overwrite_sync1      : std_logic      ;
+signal acq_core_stream_ctl_reserved_int         : std_logic_vector(5 downto 0);
+signal acq_core_stream_ctl_overrun_sync0        : std_logic      ;
+signal acq_core_stream_ctl_overrun_sync1        : std_logic      ;
+signal acq_core_stream_wr_ptr_int               : std_logic_vector(31 downto 0);
+signal acq_core_stream_wr_ptr_lwb               : std_logic      ;
+signal acq_core_stream_wr_ptr_lwb_delay         : std_logic      ;
+signal acq_core_stream_wr_ptr_lwb_in_progress   : std_logic      ;
+signal acq_core_stream_wr_ptr_lwb_s0            : std_logic      ;
+signal acq_core_stream_wr_ptr_lwb_s1            : std_logic      ;
+signal acq_core_stream_wr_ptr_lwb_s2            : std_logic      ;
+signal acq_core_stream_rd_ptr_int               : std_logic_vector(31 downto 0);
+signal acq_core_stream_rd_ptr_swb               : std_logic      ;
+signal acq_core_stream_rd_ptr_swb_delay         : std_logic      ;
+signal acq_core_stream_rd_ptr_swb_s0            : std_logic      ;
+signal acq_core_stream_rd_ptr_swb_s1            : std_logic      ;
+signal acq_core_stream_rd_ptr_swb_s2            : std_logic      ;
+signal acq_core_acq_chan_mask_mask_int          : std_logic_vector(23 downto 0);
+signal acq_core_acq_chan_mask_mask_swb          : std_logic      ;
+signal acq_core_acq_chan_mask_mask_swb_delay    : std_logic      ;
+signal acq_core_acq_chan_mask_mask_swb_s0       : std_logic      ;
+signal acq_core_acq_chan_mask_mask_swb_s1       : std_logic      ;
+signal acq_core_acq_chan_mask_mask_swb_s2       : std_logic      ;
+signal acq_core_acq_chan_mask_reserved_int      : std_logic_vector(6 downto 0);
+signal acq_core_acq_chan_mask_ovf_sync0         : std_logic      ;
+signal acq_core_acq_chan_mask_ovf_sync1         : std_logic      ;
+signal acq_core_ddr3_perf_beats_int             : std_logic_vector(31 downto 0);
+signal acq_core_ddr3_perf_beats_lwb             : std_logic      ;
+signal acq_core_ddr3_perf_beats_lwb_delay       : std_logic      ;
+signal acq_core_ddr3_perf_beats_lwb_in_progress : std_logic      ;
+signal acq_core_ddr3_perf_beats_lwb_s0          : std_logic      ;
+signal acq_core_ddr3_perf_beats_lwb_s1          : std_logic      ;
+signal acq_core_ddr3_perf_beats_lwb_s2          : std_logic      ;
+signal acq_core_ddr3_perf_cycles_int            : std_logic_vector(31 downto 0);
+signal acq_core_ddr3_perf_cycles_lwb            : std_logic      ;
+signal acq_core_ddr3_perf_cycles_lwb_delay      : std_logic      ;
+signal acq_core_ddr3_perf_cycles_lwb_in_progress : std_logic      ;
+signal acq_core_ddr3_perf_cycles_lwb_s0         : std_logic      ;
+signal acq_core_ddr3_perf_cycles_lwb_s1         : std_logic      ;
+signal acq_core_ddr3_perf_cycles_lwb_s2         : std_logic      ;
+signal acq_core_acq_decim_ctl_ratio_int         : std_logic_vector(15 downto 0);
+signal acq_core_acq_decim_ctl_ratio_swb         : std_logic      ;
+signal acq_core_acq_decim_ctl_ratio_swb_delay   : std_logic      ;
+signal acq_core_acq_decim_ctl_ratio_swb_s0      : std_logic      ;
+signal acq_core_acq_decim_ctl_ratio_swb_s1      : std_logic      ;
+signal acq_core_acq_decim_ctl_ratio_swb_s2      : std_logic      ;
+signal acq_core_acq_decim_ctl_avg_order_sel_int : std_logic_vector(3 downto 0);
+signal acq_core_acq_decim_ctl_avg_order_sel_swb : std_logic      ;
+signal acq_core_acq_decim_ctl_avg_order_sel_swb_delay : std_logic      ;
+signal acq_core_acq_decim_ctl_avg_order_sel_swb_s0 : std_logic      ;
+signal acq_core_acq_decim_ctl_avg_order_sel_swb_s1 : std_logic      ;
+signal acq_core_acq_decim_ctl_avg_order_sel_swb_s2 : std_logic      ;
+signal acq_core_acq_decim_ctl_reserved_int      : std_logic_vector(7 downto 0);
+signal acq_core_acq_decim_mask_mask_int         : std_logic_vector(23 downto 0);
+signal acq_core_acq_decim_mask_mask_swb         : std_logic      ;
+signal acq_core_acq_decim_mask_mask_swb_delay   : std_logic      ;
+signal acq_core_acq_decim_mask_mask_swb_s0      : std_logic      ;
+signal acq_core_acq_decim_mask_mask_swb_s1      : std_logic      ;
+signal acq_core_acq_decim_mask_mask_swb_s2      : std_logic      ;
+signal acq_core_acq_decim_mask_reserved_int     : std_logic_vector(7 downto 0);
+signal acq_core_acq_comp_ctl_en_int             : std_logic      ;
+signal acq_core_acq_comp_ctl_en_sync0           : std_logic      ;
+signal acq_core_acq_comp_ctl_en_sync1           : std_logic      ;
+signal acq_core_acq_comp_ctl_block_log2_int     : std_logic_vector(3 downto 0);
+signal acq_core_acq_comp_ctl_block_log2_swb     : std_logic      ;
+signal acq_core_acq_comp_ctl_block_log2_swb_delay : std_logic      ;
+signal acq_core_acq_comp_ctl_block_log2_swb_s0  : std_logic      ;
+signal acq_core_acq_comp_ctl_block_log2_swb_s1  : std_logic      ;
+signal acq_core_acq_comp_ctl_block_log2_swb_s2  : std_logic      ;
+signal acq_core_acq_comp_ctl_reserved_int       : std_logic_vector(2 downto 0);
+signal acq_core_acq_comp_ctl_active_sync0       : std_logic      ;
+signal acq_core_acq_comp_ctl_active_sync1       : std_logic      ;
+signal acq_core_acq_comp_ctl_ovf_sync0          : std_logic      ;
+signal acq_core_acq_comp_ctl_ovf_sync1          : std_logic      ;
 signal ack_sreg                                 : std_logic_vector(9 downto 0);
 signal rddata_reg                               : std_logic_vector(31 downto 0);
 signal wrdata_reg                               : std_logic_vector(31 downto 0);
 signal bwsel_reg                                : std_logic_vector(3 downto 0);
-signal rwaddr_reg                               : std_logic_vector(5 downto 0);
+signal rwaddr_reg                               : std_logic_vector(6 downto 0);
 signal ack_in_progress                          : std_logic      ;
 signal wr_int                                   : std_logic      ;
 signal rd_int                                   : std_logic      ;
@@ -258,6 +337,41 @@ begin
       acq_core_acq_chan_ctl_dtrig_which_swb_delay <= '0';
       acq_core_acq_chan_ctl_reserved1_int <= "000";
       acq_core_acq_chan_ctl_reserved2_int <= "00000000000";
+      acq_core_stream_ctl_en_int <= '0';
+      acq_core_stream_ctl_overwrite_int <= '0';
+      acq_core_stream_ctl_reserved_int <= "000000";
+      acq_core_stream_wr_ptr_lwb <= '0';
+      acq_core_stream_wr_ptr_lwb_delay <= '0';
+      acq_core_stream_wr_ptr_lwb_in_progress <= '0';
+      acq_core_stream_rd_ptr_int <= "00000000000000000000000000000000";
+      acq_core_stream_rd_ptr_swb <= '0';
+      acq_core_stream_rd_ptr_swb_delay <= '0';
+      acq_core_acq_chan_mask_mask_int <= "000000000000000000000000";
+      acq_core_acq_chan_mask_mask_swb <= '0';
+      acq_core_acq_chan_mask_mask_swb_delay <= '0';
+      acq_core_acq_chan_mask_reserved_int <= "0000000";
+      acq_core_ddr3_perf_beats_lwb <= '0';
+      acq_core_ddr3_perf_beats_lwb_delay <= '0';
+      acq_core_ddr3_perf_beats_lwb_in_progress <= '0';
+      acq_core_ddr3_perf_cycles_lwb <= '0';
+      acq_core_ddr3_perf_cycles_lwb_delay <= '0';
+      acq_core_ddr3_perf_cycles_lwb_in_progress <= '0';
+      acq_core_acq_decim_ctl_ratio_int <= "0000000000000000";
+      acq_core_acq_decim_ctl_ratio_swb <= '0';
+      acq_core_acq_decim_ctl_ratio_swb_delay <= '0';
+      acq_core_acq_decim_ctl_avg_order_sel_int <= "0000";
+      acq_core_acq_decim_ctl_avg_order_sel_swb <= '0';
+      acq_core_acq_decim_ctl_avg_order_sel_swb_delay <= '0';
+      acq_core_acq_decim_ctl_reserved_int <= "00000000";
+      acq_core_acq_decim_mask_mask_int <= "000000000000000000000000";
+      acq_core_acq_decim_mask_mask_swb <= '0';
+      acq_core_acq_decim_mask_mask_swb_delay <= '0';
+      acq_core_acq_decim_mask_reserved_int <= "00000000";
+      acq_core_acq_comp_ctl_en_int <= '0';
+      acq_core_acq_comp_ctl_block_log2_int <= "0000";
+      acq_core_acq_comp_ctl_block_log2_swb <= '0';
+      acq_core_acq_comp_ctl_block_log2_swb_delay <= '0';
+      acq_core_acq_comp_ctl_reserved_int <= "000";
     elsif rising_edge(clk_sys_i) then
 -- advance the ACK generator shift register
       ack_sreg(8 downto 0) <= ack_sreg(9 downto 1);
@@ -312,11 +426,41 @@ begin
           acq_core_acq_chan_ctl_which_swb_delay <= '0';
           acq_core_acq_chan_ctl_dtrig_which_swb <= acq_core_acq_chan_ctl_dtrig_which_swb_delay;
           acq_core_acq_chan_ctl_dtrig_which_swb_delay <= '0';
+          acq_core_stream_wr_ptr_lwb <= acq_core_stream_wr_ptr_lwb_delay;
+          acq_core_stream_wr_ptr_lwb_delay <= '0';
+          if ((ack_sreg(1) = '1') and (acq_core_stream_wr_ptr_lwb_in_progress = '1')) then
+            rddata_reg(31 downto 0) <= acq_core_stream_wr_ptr_int;
+            acq_core_stream_wr_ptr_lwb_in_progress <= '0';
+          end if;
+          acq_core_stream_rd_ptr_swb <= acq_core_stream_rd_ptr_swb_delay;
+          acq_core_stream_rd_ptr_swb_delay <= '0';
+          acq_core_acq_chan_mask_mask_swb <= acq_core_acq_chan_mask_mask_swb_delay;
+          acq_core_acq_chan_mask_mask_swb_delay <= '0';
+          acq_core_ddr3_perf_beats_lwb <= acq_core_ddr3_perf_beats_lwb_delay;
+          acq_core_ddr3_perf_beats_lwb_delay <= '0';
+          if ((ack_sreg(1) = '1') and (acq_core_ddr3_perf_beats_lwb_in_progress = '1')) then
+            rddata_reg(31 downto 0) <= acq_core_ddr3_perf_beats_int;
+            acq_core_ddr3_perf_beats_lwb_in_progress <= '0';
+          end if;
+          acq_core_ddr3_perf_cycles_lwb <= acq_core_ddr3_perf_cycles_lwb_delay;
+          acq_core_ddr3_perf_cycles_lwb_delay <= '0';
+          if ((ack_sreg(1) = '1') and (acq_core_ddr3_perf_cycles_lwb_in_progress = '1')) then
+            rddata_reg(31 downto 0) <= acq_core_ddr3_perf_cycles_int;
+            acq_core_ddr3_perf_cycles_lwb_in_progress <= '0';
+          end if;
+          acq_core_acq_decim_ctl_ratio_swb <= acq_core_acq_decim_ctl_ratio_swb_delay;
+          acq_core_acq_decim_ctl_ratio_swb_delay <= '0';
+          acq_core_acq_decim_ctl_avg_order_sel_swb <= acq_core_acq_decim_ctl_avg_order_sel_swb_delay;
+          acq_core_acq_decim_ctl_avg_order_sel_swb_delay <= '0';
+          acq_core_acq_decim_mask_mask_swb <= acq_core_acq_decim_mask_mask_swb_delay;
+          acq_core_acq_decim_mask_mask_swb_delay <= '0';
+          acq_core_acq_comp_ctl_block_log2_swb <= acq_core_acq_comp_ctl_block_log2_swb_delay;
+          acq_core_acq_comp_ctl_block_log2_swb_delay <= '0';
         end if;
       else
         if ((wb_cyc_i = '1') and (wb_stb_i = '1')) then
-          case rwaddr_reg(5 downto 0) is
-          when "000000" => 
+          case rwaddr_reg(6 downto 0) is
+          when "0000000" => 
             if (wb_we_i = '1') then
               acq_core_ctl_fsm_start_acq_int <= wrdata_reg(0);
               acq_core_ctl_fsm_start_acq_int_delay <= wrdata_reg(0);
@@ -333,7 +477,7 @@ begin
             rddata_reg(31 downto 17) <= acq_core_ctl_reserved2_int;
             ack_sreg(4) <= '1';
             ack_in_progress <= '1';
-          when "000001" => 
+          when "0000001" => 
             if (wb_we_i = '1') then
             end if;
             if (wb_we_i = '0') then
@@ -350,7 +494,7 @@ begin
             rddata_reg(31 downto 17) <= regs_i.sta_reserved3_i;
             ack_sreg(5) <= '1';
             ack_in_progress <= '1';
-          when "000010" => 
+          when "0000010" => 
             if (wb_we_i = '1') then
               acq_core_trig_cfg_hw_trig_sel_int <= wrdata_reg(0);
               acq_core_trig_cfg_hw_trig_pol_int <= wrdata_reg(1);
@@ -369,7 +513,7 @@ begin
             rddata_reg(31 downto 9) <= acq_core_trig_cfg_reserved_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "000011" => 
+          when "0000011" => 
             if (wb_we_i = '1') then
               acq_core_trig_data_cfg_thres_filt_int <= wrdata_reg(7 downto 0);
               acq_core_trig_data_cfg_thres_filt_swb <= '1';
@@ -380,7 +524,7 @@ begin
             rddata_reg(31 downto 8) <= acq_core_trig_data_cfg_reserved_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "000100" => 
+          when "0000100" => 
             if (wb_we_i = '1') then
               acq_core_trig_data_thres_int <= wrdata_reg(31 downto 0);
               acq_core_trig_data_thres_swb <= '1';
@@ -389,7 +533,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_trig_data_thres_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "000101" => 
+          when "0000101" => 
             if (wb_we_i = '1') then
               acq_core_trig_dly_int <= wrdata_reg(31 downto 0);
               acq_core_trig_dly_swb <= '1';
@@ -398,7 +542,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_trig_dly_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "000110" => 
+          when "0000110" => 
             if (wb_we_i = '1') then
               acq_core_sw_trig_wr_int <= '1';
               acq_core_sw_trig_wr_int_delay <= '1';
@@ -437,7 +581,7 @@ begin
             rddata_reg(31) <= 'X';
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "000111" => 
+          when "0000111" => 
             if (wb_we_i = '1') then
               acq_core_shots_nb_int <= wrdata_reg(15 downto 0);
               acq_core_shots_nb_swb <= '1';
@@ -448,7 +592,7 @@ begin
             rddata_reg(31 downto 17) <= regs_i.shots_multishot_ram_size_i;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001000" => 
+          when "0001000" => 
             if (wb_we_i = '1') then
             end if;
             if (wb_we_i = '0') then
@@ -458,7 +602,7 @@ begin
             end if;
             ack_sreg(5) <= '1';
             ack_in_progress <= '1';
-          when "001001" => 
+          when "0001001" => 
             if (wb_we_i = '1') then
               acq_core_pre_samples_int <= wrdata_reg(31 downto 0);
               acq_core_pre_samples_swb <= '1';
@@ -467,7 +611,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_pre_samples_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001010" => 
+          when "0001010" => 
             if (wb_we_i = '1') then
               acq_core_post_samples_int <= wrdata_reg(31 downto 0);
               acq_core_post_samples_swb <= '1';
@@ -476,7 +620,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_post_samples_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001011" => 
+          when "0001011" => 
             if (wb_we_i = '1') then
             end if;
             if (wb_we_i = '0') then
@@ -486,7 +630,7 @@ begin
             end if;
             ack_sreg(5) <= '1';
             ack_in_progress <= '1';
-          when "001100" => 
+          when "0001100" => 
             if (wb_we_i = '1') then
               acq_core_ddr3_start_addr_int <= wrdata_reg(31 downto 0);
               acq_core_ddr3_start_addr_swb <= '1';
@@ -495,7 +639,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_ddr3_start_addr_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001101" => 
+          when "0001101" => 
             if (wb_we_i = '1') then
               acq_core_ddr3_end_addr_int <= wrdata_reg(31 downto 0);
               acq_core_ddr3_end_addr_swb <= '1';
@@ -504,7 +648,7 @@ begin
             rddata_reg(31 downto 0) <= acq_core_ddr3_end_addr_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001110" => 
+          when "0001110" => 
             if (wb_we_i = '1') then
               acq_core_acq_chan_ctl_which_int <= wrdata_reg(4 downto 0);
               acq_core_acq_chan_ctl_which_swb <= '1';
@@ -524,342 +668,450 @@ begin
             rddata_reg(31 downto 21) <= acq_core_acq_chan_ctl_reserved2_int;
             ack_sreg(3) <= '1';
             ack_in_progress <= '1';
-          when "001111" => 
+          when "0001111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch0_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch0_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010000" => 
+          when "0010000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch0_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch0_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010001" => 
+          when "0010001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch1_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch1_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010010" => 
+          when "0010010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch1_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch1_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010011" => 
+          when "0010011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch2_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch2_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010100" => 
+          when "0010100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch2_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch2_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010101" => 
+          when "0010101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch3_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch3_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010110" => 
+          when "0010110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch3_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch3_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "010111" => 
+          when "0010111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch4_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch4_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011000" => 
+          when "0011000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch4_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch4_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011001" => 
+          when "0011001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch5_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch5_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011010" => 
+          when "0011010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch5_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch5_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011011" => 
+          when "0011011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch6_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch6_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011100" => 
+          when "0011100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch6_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch6_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011101" => 
+          when "0011101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch7_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch7_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011110" => 
+          when "0011110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch7_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch7_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "011111" => 
+          when "0011111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch8_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch8_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100000" => 
+          when "0100000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch8_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch8_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100001" => 
+          when "0100001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch9_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch9_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100010" => 
+          when "0100010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch9_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch9_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100011" => 
+          when "0100011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch10_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch10_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100100" => 
+          when "0100100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch10_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch10_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100101" => 
+          when "0100101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch11_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch11_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100110" => 
+          when "0100110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch11_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch11_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "100111" => 
+          when "0100111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch12_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch12_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101000" => 
+          when "0101000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch12_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch12_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101001" => 
+          when "0101001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch13_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch13_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101010" => 
+          when "0101010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch13_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch13_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101011" => 
+          when "0101011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch14_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch14_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101100" => 
+          when "0101100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch14_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch14_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101101" => 
+          when "0101101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch15_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch15_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101110" => 
+          when "0101110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch15_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch15_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "101111" => 
+          when "0101111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch16_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch16_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110000" => 
+          when "0110000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch16_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch16_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110001" => 
+          when "0110001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch17_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch17_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110010" => 
+          when "0110010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch17_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch17_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110011" => 
+          when "0110011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch18_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch18_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110100" => 
+          when "0110100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch18_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch18_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110101" => 
+          when "0110101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch19_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch19_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110110" => 
+          when "0110110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch19_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch19_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "110111" => 
+          when "0110111" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch20_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch20_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111000" => 
+          when "0111000" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch20_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch20_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111001" => 
+          when "0111001" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch21_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch21_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111010" => 
+          when "0111010" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch21_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch21_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111011" => 
+          when "0111011" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch22_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch22_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111100" => 
+          when "0111100" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch22_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch22_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111101" => 
+          when "0111101" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch23_desc_int_width_i;
             rddata_reg(31 downto 16) <= regs_i.ch23_desc_num_coalesce_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
-          when "111110" => 
+          when "0111110" => 
             if (wb_we_i = '1') then
             end if;
             rddata_reg(15 downto 0) <= regs_i.ch23_atom_desc_num_atoms_i;
             rddata_reg(31 downto 16) <= regs_i.ch23_atom_desc_atom_width_i;
             ack_sreg(0) <= '1';
             ack_in_progress <= '1';
+          when "0111111" => 
+            if (wb_we_i = '1') then
+              acq_core_stream_ctl_en_int <= wrdata_reg(0);
+              acq_core_stream_ctl_overwrite_int <= wrdata_reg(1);
+              acq_core_stream_ctl_reserved_int <= wrdata_reg(7 downto 2);
+            end if;
+            rddata_reg(0) <= acq_core_stream_ctl_en_int;
+            rddata_reg(1) <= acq_core_stream_ctl_overwrite_int;
+            rddata_reg(7 downto 2) <= acq_core_stream_ctl_reserved_int;
+            rddata_reg(8) <= acq_core_stream_ctl_overrun_sync1;
+            rddata_reg(31 downto 9) <= regs_i.stream_ctl_reserved1_i;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
+          when "1000000" => 
+            if (wb_we_i = '1') then
+            end if;
+            if (wb_we_i = '0') then
+              acq_core_stream_wr_ptr_lwb <= '1';
+              acq_core_stream_wr_ptr_lwb_delay <= '1';
+              acq_core_stream_wr_ptr_lwb_in_progress <= '1';
+            end if;
+            ack_sreg(5) <= '1';
+            ack_in_progress <= '1';
+          when "1000001" => 
+            if (wb_we_i = '1') then
+              acq_core_stream_rd_ptr_int <= wrdata_reg(31 downto 0);
+              acq_core_stream_rd_ptr_swb <= '1';
+              acq_core_stream_rd_ptr_swb_delay <= '1';
+            end if;
+            rddata_reg(31 downto 0) <= acq_core_stream_rd_ptr_int;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
+          when "1000010" => 
+            if (wb_we_i = '1') then
+              acq_core_acq_chan_mask_mask_int <= wrdata_reg(23 downto 0);
+              acq_core_acq_chan_mask_mask_swb <= '1';
+              acq_core_acq_chan_mask_mask_swb_delay <= '1';
+              acq_core_acq_chan_mask_reserved_int <= wrdata_reg(30 downto 24);
+            end if;
+            rddata_reg(23 downto 0) <= acq_core_acq_chan_mask_mask_int;
+            rddata_reg(30 downto 24) <= acq_core_acq_chan_mask_reserved_int;
+            rddata_reg(31) <= acq_core_acq_chan_mask_ovf_sync1;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
+          when "1000011" => 
+            if (wb_we_i = '1') then
+            end if;
+            if (wb_we_i = '0') then
+              acq_core_ddr3_perf_beats_lwb <= '1';
+              acq_core_ddr3_perf_beats_lwb_delay <= '1';
+              acq_core_ddr3_perf_beats_lwb_in_progress <= '1';
+            end if;
+            ack_sreg(5) <= '1';
+            ack_in_progress <= '1';
+          when "1000100" => 
+            if (wb_we_i = '1') then
+            end if;
+            if (wb_we_i = '0') then
+              acq_core_ddr3_perf_cycles_lwb <= '1';
+              acq_core_ddr3_perf_cycles_lwb_delay <= '1';
+              acq_core_ddr3_perf_cycles_lwb_in_progress <= '1';
+            end if;
+            ack_sreg(5) <= '1';
+            ack_in_progress <= '1';
+          when "1000101" => 
+            if (wb_we_i = '1') then
+              acq_core_acq_decim_ctl_ratio_int <= wrdata_reg(15 downto 0);
+              acq_core_acq_decim_ctl_ratio_swb <= '1';
+              acq_core_acq_decim_ctl_ratio_swb_delay <= '1';
+              acq_core_acq_decim_ctl_avg_order_sel_int <= wrdata_reg(19 downto 16);
+              acq_core_acq_decim_ctl_avg_order_sel_swb <= '1';
+              acq_core_acq_decim_ctl_avg_order_sel_swb_delay <= '1';
+              acq_core_acq_decim_ctl_reserved_int <= wrdata_reg(31 downto 24);
+            end if;
+            rddata_reg(15 downto 0) <= acq_core_acq_decim_ctl_ratio_int;
+            rddata_reg(19 downto 16) <= acq_core_acq_decim_ctl_avg_order_sel_int;
+            rddata_reg(23 downto 20) <= regs_i.acq_decim_ctl_max_avg_order_sel_i;
+            rddata_reg(31 downto 24) <= acq_core_acq_decim_ctl_reserved_int;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
+          when "1000110" => 
+            if (wb_we_i = '1') then
+              acq_core_acq_decim_mask_mask_int <= wrdata_reg(23 downto 0);
+              acq_core_acq_decim_mask_mask_swb <= '1';
+              acq_core_acq_decim_mask_mask_swb_delay <= '1';
+              acq_core_acq_decim_mask_reserved_int <= wrdata_reg(31 downto 24);
+            end if;
+            rddata_reg(23 downto 0) <= acq_core_acq_decim_mask_mask_int;
+            rddata_reg(31 downto 24) <= acq_core_acq_decim_mask_reserved_int;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
+          when "1000111" => 
+            if (wb_we_i = '1') then
+              acq_core_acq_comp_ctl_en_int <= wrdata_reg(0);
+              acq_core_acq_comp_ctl_block_log2_int <= wrdata_reg(4 downto 1);
+              acq_core_acq_comp_ctl_block_log2_swb <= '1';
+              acq_core_acq_comp_ctl_block_log2_swb_delay <= '1';
+              acq_core_acq_comp_ctl_reserved_int <= wrdata_reg(7 downto 5);
+            end if;
+            rddata_reg(0) <= acq_core_acq_comp_ctl_en_int;
+            rddata_reg(4 downto 1) <= acq_core_acq_comp_ctl_block_log2_int;
+            rddata_reg(7 downto 5) <= acq_core_acq_comp_ctl_reserved_int;
+            rddata_reg(8) <= acq_core_acq_comp_ctl_active_sync1;
+            rddata_reg(9) <= acq_core_acq_comp_ctl_ovf_sync1;
+            rddata_reg(10) <= regs_i.acq_comp_ctl_avail_i;
+            rddata_reg(31 downto 11) <= regs_i.acq_comp_ctl_reserved1_i;
+            ack_sreg(3) <= '1';
+            ack_in_progress <= '1';
           when others =>
 -- prevent the slave from hanging the bus on invalid address
             ack_in_progress <= '1';
@@ -1457,6 +1709,304 @@ begin
 -- Number of coalescing words
 -- Number of atoms inside the complete data word (int_width*num_coalesce)
 -- Atom width
+-- Streaming mode enable
+-- synchronizer chain for field : Streaming mode enable (type RW/RO, clk_sys_i <-> fs_clk_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      regs_o.stream_ctl_en_o <= '0';
+      acq_core_stream_ctl_en_sync0 <= '0';
+      acq_core_stream_ctl_en_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_stream_ctl_en_sync0 <= acq_core_stream_ctl_en_int;
+      acq_core_stream_ctl_en_sync1 <= acq_core_stream_ctl_en_sync0;
+      regs_o.stream_ctl_en_o <= acq_core_stream_ctl_en_sync1;
+    end if;
+  end process;
+  
+  
+-- Overwrite unread data
+-- synchronizer chain for field : Overwrite unread data (type RW/RO, clk_sys_i <-> fs_clk_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      regs_o.stream_ctl_overwrite_o <= '0';
+      acq_core_stream_ctl_overwrite_sync0 <= '0';
+      acq_core_stream_ctl_overwrite_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_stream_ctl_overwrite_sync0 <= acq_core_stream_ctl_overwrite_int;
+      acq_core_stream_ctl_overwrite_sync1 <= acq_core_stream_ctl_overwrite_sync0;
+      regs_o.stream_ctl_overwrite_o <= acq_core_stream_ctl_overwrite_sync1;
+    end if;
+  end process;
+  
+  
+-- Reserved
+  regs_o.stream_ctl_reserved_o <= acq_core_stream_ctl_reserved_int;
+-- Streaming overrun
+-- synchronizer chain for field : Streaming overrun (type RO/WO, ext_clk_i -> clk_sys_i)
+  process (ext_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_stream_ctl_overrun_sync0 <= '0';
+      acq_core_stream_ctl_overrun_sync1 <= '0';
+    elsif rising_edge(ext_clk_i) then
+      acq_core_stream_ctl_overrun_sync0 <= regs_i.stream_ctl_overrun_i;
+      acq_core_stream_ctl_overrun_sync1 <= acq_core_stream_ctl_overrun_sync0;
+    end if;
+  end process;
+  
+  
+-- Reserved1
+-- Streaming write pointer
+-- asynchronous std_logic_vector register : Streaming write pointer (type RO/WO, ext_clk_i <-> clk_sys_i)
+  process (ext_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_stream_wr_ptr_lwb_s0 <= '0';
+      acq_core_stream_wr_ptr_lwb_s1 <= '0';
+      acq_core_stream_wr_ptr_lwb_s2 <= '0';
+      acq_core_stream_wr_ptr_int <= "00000000000000000000000000000000";
+    elsif rising_edge(ext_clk_i) then
+      acq_core_stream_wr_ptr_lwb_s0 <= acq_core_stream_wr_ptr_lwb;
+      acq_core_stream_wr_ptr_lwb_s1 <= acq_core_stream_wr_ptr_lwb_s0;
+      acq_core_stream_wr_ptr_lwb_s2 <= acq_core_stream_wr_ptr_lwb_s1;
+      if ((acq_core_stream_wr_ptr_lwb_s1 = '1') and (acq_core_stream_wr_ptr_lwb_s2 = '0')) then
+        acq_core_stream_wr_ptr_int <= regs_i.stream_wr_ptr_i;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Streaming read pointer
+-- asynchronous std_logic_vector register : Streaming read pointer (type RW/RO, ext_clk_i <-> clk_sys_i)
+  process (ext_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_stream_rd_ptr_swb_s0 <= '0';
+      acq_core_stream_rd_ptr_swb_s1 <= '0';
+      acq_core_stream_rd_ptr_swb_s2 <= '0';
+      regs_o.stream_rd_ptr_o <= "00000000000000000000000000000000";
+    elsif rising_edge(ext_clk_i) then
+      acq_core_stream_rd_ptr_swb_s0 <= acq_core_stream_rd_ptr_swb;
+      acq_core_stream_rd_ptr_swb_s1 <= acq_core_stream_rd_ptr_swb_s0;
+      acq_core_stream_rd_ptr_swb_s2 <= acq_core_stream_rd_ptr_swb_s1;
+      if ((acq_core_stream_rd_ptr_swb_s2 = '0') and (acq_core_stream_rd_ptr_swb_s1 = '1')) then
+        regs_o.stream_rd_ptr_o <= acq_core_stream_rd_ptr_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Channel mask
+-- asynchronous std_logic_vector register : Channel mask (type RW/RO, fs_clk_i <-> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_chan_mask_mask_swb_s0 <= '0';
+      acq_core_acq_chan_mask_mask_swb_s1 <= '0';
+      acq_core_acq_chan_mask_mask_swb_s2 <= '0';
+      regs_o.acq_chan_mask_mask_o <= "000000000000000000000000";
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_chan_mask_mask_swb_s0 <= acq_core_acq_chan_mask_mask_swb;
+      acq_core_acq_chan_mask_mask_swb_s1 <= acq_core_acq_chan_mask_mask_swb_s0;
+      acq_core_acq_chan_mask_mask_swb_s2 <= acq_core_acq_chan_mask_mask_swb_s1;
+      if ((acq_core_acq_chan_mask_mask_swb_s2 = '0') and (acq_core_acq_chan_mask_mask_swb_s1 = '1')) then
+        regs_o.acq_chan_mask_mask_o <= acq_core_acq_chan_mask_mask_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Reserved
+  regs_o.acq_chan_mask_reserved_o <= acq_core_acq_chan_mask_reserved_int;
+-- Frame overflow
+-- synchronizer chain for field : Frame overflow (type RO/WO, fs_clk_i -> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_chan_mask_ovf_sync0 <= '0';
+      acq_core_acq_chan_mask_ovf_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_chan_mask_ovf_sync0 <= regs_i.acq_chan_mask_ovf_i;
+      acq_core_acq_chan_mask_ovf_sync1 <= acq_core_acq_chan_mask_ovf_sync0;
+    end if;
+  end process;
+  
+  
+-- Accepted payload words
+-- asynchronous std_logic_vector register : Accepted payload words (type RO/WO, ext_clk_i <-> clk_sys_i)
+  process (ext_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_ddr3_perf_beats_lwb_s0 <= '0';
+      acq_core_ddr3_perf_beats_lwb_s1 <= '0';
+      acq_core_ddr3_perf_beats_lwb_s2 <= '0';
+      acq_core_ddr3_perf_beats_int <= "00000000000000000000000000000000";
+    elsif rising_edge(ext_clk_i) then
+      acq_core_ddr3_perf_beats_lwb_s0 <= acq_core_ddr3_perf_beats_lwb;
+      acq_core_ddr3_perf_beats_lwb_s1 <= acq_core_ddr3_perf_beats_lwb_s0;
+      acq_core_ddr3_perf_beats_lwb_s2 <= acq_core_ddr3_perf_beats_lwb_s1;
+      if ((acq_core_ddr3_perf_beats_lwb_s1 = '1') and (acq_core_ddr3_perf_beats_lwb_s2 = '0')) then
+        acq_core_ddr3_perf_beats_int <= regs_i.ddr3_perf_beats_i;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Cycles with payload pending
+-- asynchronous std_logic_vector register : Cycles with payload pending (type RO/WO, ext_clk_i <-> clk_sys_i)
+  process (ext_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_ddr3_perf_cycles_lwb_s0 <= '0';
+      acq_core_ddr3_perf_cycles_lwb_s1 <= '0';
+      acq_core_ddr3_perf_cycles_lwb_s2 <= '0';
+      acq_core_ddr3_perf_cycles_int <= "00000000000000000000000000000000";
+    elsif rising_edge(ext_clk_i) then
+      acq_core_ddr3_perf_cycles_lwb_s0 <= acq_core_ddr3_perf_cycles_lwb;
+      acq_core_ddr3_perf_cycles_lwb_s1 <= acq_core_ddr3_perf_cycles_lwb_s0;
+      acq_core_ddr3_perf_cycles_lwb_s2 <= acq_core_ddr3_perf_cycles_lwb_s1;
+      if ((acq_core_ddr3_perf_cycles_lwb_s1 = '1') and (acq_core_ddr3_perf_cycles_lwb_s2 = '0')) then
+        acq_core_ddr3_perf_cycles_int <= regs_i.ddr3_perf_cycles_i;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Decimation ratio
+-- asynchronous std_logic_vector register : Decimation ratio (type RW/RO, fs_clk_i <-> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_decim_ctl_ratio_swb_s0 <= '0';
+      acq_core_acq_decim_ctl_ratio_swb_s1 <= '0';
+      acq_core_acq_decim_ctl_ratio_swb_s2 <= '0';
+      regs_o.acq_decim_ctl_ratio_o <= "0000000000000000";
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_decim_ctl_ratio_swb_s0 <= acq_core_acq_decim_ctl_ratio_swb;
+      acq_core_acq_decim_ctl_ratio_swb_s1 <= acq_core_acq_decim_ctl_ratio_swb_s0;
+      acq_core_acq_decim_ctl_ratio_swb_s2 <= acq_core_acq_decim_ctl_ratio_swb_s1;
+      if ((acq_core_acq_decim_ctl_ratio_swb_s2 = '0') and (acq_core_acq_decim_ctl_ratio_swb_s1 = '1')) then
+        regs_o.acq_decim_ctl_ratio_o <= acq_core_acq_decim_ctl_ratio_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Moving average order selector
+-- asynchronous std_logic_vector register : Moving average order selector (type RW/RO, fs_clk_i <-> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s0 <= '0';
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s1 <= '0';
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s2 <= '0';
+      regs_o.acq_decim_ctl_avg_order_sel_o <= "0000";
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s0 <= acq_core_acq_decim_ctl_avg_order_sel_swb;
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s1 <= acq_core_acq_decim_ctl_avg_order_sel_swb_s0;
+      acq_core_acq_decim_ctl_avg_order_sel_swb_s2 <= acq_core_acq_decim_ctl_avg_order_sel_swb_s1;
+      if ((acq_core_acq_decim_ctl_avg_order_sel_swb_s2 = '0') and (acq_core_acq_decim_ctl_avg_order_sel_swb_s1 = '1')) then
+        regs_o.acq_decim_ctl_avg_order_sel_o <= acq_core_acq_decim_ctl_avg_order_sel_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Maximum moving average order selector
+-- Reserved
+  regs_o.acq_decim_ctl_reserved_o <= acq_core_acq_decim_ctl_reserved_int;
+-- Decimated channels
+-- asynchronous std_logic_vector register : Decimated channels (type RW/RO, fs_clk_i <-> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_decim_mask_mask_swb_s0 <= '0';
+      acq_core_acq_decim_mask_mask_swb_s1 <= '0';
+      acq_core_acq_decim_mask_mask_swb_s2 <= '0';
+      regs_o.acq_decim_mask_mask_o <= "000000000000000000000000";
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_decim_mask_mask_swb_s0 <= acq_core_acq_decim_mask_mask_swb;
+      acq_core_acq_decim_mask_mask_swb_s1 <= acq_core_acq_decim_mask_mask_swb_s0;
+      acq_core_acq_decim_mask_mask_swb_s2 <= acq_core_acq_decim_mask_mask_swb_s1;
+      if ((acq_core_acq_decim_mask_mask_swb_s2 = '0') and (acq_core_acq_decim_mask_mask_swb_s1 = '1')) then
+        regs_o.acq_decim_mask_mask_o <= acq_core_acq_decim_mask_mask_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Reserved
+  regs_o.acq_decim_mask_reserved_o <= acq_core_acq_decim_mask_reserved_int;
+-- Compression enable
+-- synchronizer chain for field : Compression enable (type RW/RO, clk_sys_i <-> fs_clk_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      regs_o.acq_comp_ctl_en_o <= '0';
+      acq_core_acq_comp_ctl_en_sync0 <= '0';
+      acq_core_acq_comp_ctl_en_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_comp_ctl_en_sync0 <= acq_core_acq_comp_ctl_en_int;
+      acq_core_acq_comp_ctl_en_sync1 <= acq_core_acq_comp_ctl_en_sync0;
+      regs_o.acq_comp_ctl_en_o <= acq_core_acq_comp_ctl_en_sync1;
+    end if;
+  end process;
+  
+  
+-- Block size
+-- asynchronous std_logic_vector register : Block size (type RW/RO, fs_clk_i <-> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_comp_ctl_block_log2_swb_s0 <= '0';
+      acq_core_acq_comp_ctl_block_log2_swb_s1 <= '0';
+      acq_core_acq_comp_ctl_block_log2_swb_s2 <= '0';
+      regs_o.acq_comp_ctl_block_log2_o <= "0000";
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_comp_ctl_block_log2_swb_s0 <= acq_core_acq_comp_ctl_block_log2_swb;
+      acq_core_acq_comp_ctl_block_log2_swb_s1 <= acq_core_acq_comp_ctl_block_log2_swb_s0;
+      acq_core_acq_comp_ctl_block_log2_swb_s2 <= acq_core_acq_comp_ctl_block_log2_swb_s1;
+      if ((acq_core_acq_comp_ctl_block_log2_swb_s2 = '0') and (acq_core_acq_comp_ctl_block_log2_swb_s1 = '1')) then
+        regs_o.acq_comp_ctl_block_log2_o <= acq_core_acq_comp_ctl_block_log2_int;
+      end if;
+    end if;
+  end process;
+  
+  
+-- Reserved
+  regs_o.acq_comp_ctl_reserved_o <= acq_core_acq_comp_ctl_reserved_int;
+-- Compressing
+-- synchronizer chain for field : Compressing (type RO/WO, fs_clk_i -> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_comp_ctl_active_sync0 <= '0';
+      acq_core_acq_comp_ctl_active_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_comp_ctl_active_sync0 <= regs_i.acq_comp_ctl_active_i;
+      acq_core_acq_comp_ctl_active_sync1 <= acq_core_acq_comp_ctl_active_sync0;
+    end if;
+  end process;
+  
+  
+-- Compression overflow
+-- synchronizer chain for field : Compression overflow (type RO/WO, fs_clk_i -> clk_sys_i)
+  process (fs_clk_i, rst_n_i)
+  begin
+    if (rst_n_i = '0') then 
+      acq_core_acq_comp_ctl_ovf_sync0 <= '0';
+      acq_core_acq_comp_ctl_ovf_sync1 <= '0';
+    elsif rising_edge(fs_clk_i) then
+      acq_core_acq_comp_ctl_ovf_sync0 <= regs_i.acq_comp_ctl_ovf_i;
+      acq_core_acq_comp_ctl_ovf_sync1 <= acq_core_acq_comp_ctl_ovf_sync0;
+    end if;
+  end process;
+  
+  
+-- Compression available
+-- Reserved1
   rwaddr_reg <= wb_adr_i;
   wb_stall_o <= (not ack_sreg(0)) and (wb_stb_i and wb_cyc_i);
 -- ACK signal generation. Just pass the LSB of ACK counter.
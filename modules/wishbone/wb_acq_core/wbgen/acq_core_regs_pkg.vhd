@@ -129,6 +129,17 @@ package acq_core_wbgen2_pkg is
     ch23_desc_num_coalesce_i                 : std_logic_vector(15 downto 0);
     ch23_atom_desc_num_atoms_i               : std_logic_vector(15 downto 0);
     ch23_atom_desc_atom_width_i              : std_logic_vector(15 downto 0);
+    stream_ctl_overrun_i                     : std_logic;
+    stream_ctl_reserved1_i                   : std_logic_vector(22 downto 0);
+    stream_wr_ptr_i                          : std_logic_vector(31 downto 0);
+    acq_chan_mask_ovf_i                      : std_logic;
+    ddr3_perf_beats_i                        : std_logic_vector(31 downto 0);
+    ddr3_perf_cycles_i                       : std_logic_vector(31 downto 0);
+    acq_decim_ctl_max_avg_order_sel_i        : std_logic_vector(3 downto 0);
+    acq_comp_ctl_active_i                    : std_logic;
+    acq_comp_ctl_ovf_i                       : std_logic;
+    acq_comp_ctl_avail_i                     : std_logic;
+    acq_comp_ctl_reserved1_i                 : std_logic_vector(20 downto 0);
     end record;
   
   constant c_acq_core_in_registers_init_value: t_acq_core_in_registers := (
@@ -240,7 +251,18 @@ package acq_core_wbgen2_pkg is
     ch23_desc_int_width_i => (others => '0'),
     ch23_desc_num_coalesce_i => (others => '0'),
     ch23_atom_desc_num_atoms_i => (others => '0'),
-    ch23_atom_desc_atom_width_i => (others => '0')
+    ch23_atom_desc_atom_width_i => (others => '0'),
+    stream_ctl_overrun_i => '0',
+    stream_ctl_reserved1_i => (others => '0'),
+    stream_wr_ptr_i => (others => '0'),
+    acq_chan_mask_ovf_i => '0',
+    ddr3_perf_beats_i => (others => '0'),
+    ddr3_perf_cycles_i => (others => '0'),
+    acq_decim_ctl_max_avg_order_sel_i => (others => '0'),
+    acq_comp_ctl_active_i => '0',
+    acq_comp_ctl_ovf_i => '0',
+    acq_comp_ctl_avail_i => '0',
+    acq_comp_ctl_reserved1_i => (others => '0')
     );
     
     -- Output registers (WB slave -> user design)
@@ -273,6 +295,20 @@ package acq_core_wbgen2_pkg is
       acq_chan_ctl_dtrig_which_o               : std_logic_vector(4 downto 0);
       acq_chan_ctl_reserved1_o                 : std_logic_vector(2 downto 0);
       acq_chan_ctl_reserved2_o                 : std_logic_vector(10 downto 0);
+      stream_ctl_en_o                          : std_logic;
+      stream_ctl_overwrite_o                   : std_logic;
+      stream_ctl_reserved_o                    : std_logic_vector(5 downto 0);
+      stream_rd_ptr_o                          : std_logic_vector(31 downto 0);
+      acq_chan_mask_mask_o                     : std_logic_vector(23 downto 0);
+      acq_chan_mask_reserved_o                 : std_logic_vector(6 downto 0);
+      acq_decim_ctl_ratio_o                    : std_logic_vector(15 downto 0);
+      acq_decim_ctl_avg_order_sel_o            : std_logic_vector(3 downto 0);
+      acq_decim_ctl_reserved_o                 : std_logic_vector(7 downto 0);
+      acq_decim_mask_mask_o                    : std_logic_vector(23 downto 0);
+      acq_decim_mask_reserved_o                : std_logic_vector(7 downto 0);
+      acq_comp_ctl_en_o                        : std_logic;
+      acq_comp_ctl_block_log2_o                : std_logic_vector(3 downto 0);
+      acq_comp_ctl_reserved_o                  : std_logic_vector(2 downto 0);
       end record;
     
     constant c_acq_core_out_registers_init_value: t_acq_core_out_registers := (
@@ -302,7 +338,21 @@ package acq_core_wbgen2_pkg is
       acq_chan_ctl_reserved_o => (others => '0'),
       acq_chan_ctl_dtrig_which_o => (others => '0'),
       acq_chan_ctl_reserved1_o => (others => '0'),
-      acq_chan_ctl_reserved2_o => (others => '0')
+      acq_chan_ctl_reserved2_o => (others => '0'),
+      stream_ctl_en_o => '0',
+      stream_ctl_overwrite_o => '0',
+      stream_ctl_reserved_o => (others => '0'),
+      stream_rd_ptr_o => (others => '0'),
+      acq_chan_mask_mask_o => (others => '0'),
+      acq_chan_mask_reserved_o => (others => '0'),
+      acq_decim_ctl_ratio_o => (others => '0'),
+      acq_decim_ctl_avg_order_sel_o => (others => '0'),
+      acq_decim_ctl_reserved_o => (others => '0'),
+      acq_decim_mask_mask_o => (others => '0'),
+      acq_decim_mask_reserved_o => (others => '0'),
+      acq_comp_ctl_en_o => '0',
+      acq_comp_ctl_block_log2_o => (others => '0'),
+      acq_comp_ctl_reserved_o => (others => '0')
       );
     function "or" (left, right: t_acq_core_in_registers) return t_acq_core_in_registers;
     function f_x_to_zero (x:std_logic) return std_logic;
@@ -328,6 +378,17 @@ else
 tmp(i):=x(i);
 end if; 
 end loop; 
+tmp.stream_ctl_overrun_i := f_x_to_zero(left.stream_ctl_overrun_i) or f_x_to_zero(right.stream_ctl_overrun_i);
+tmp.stream_ctl_reserved1_i := f_x_to_zero(left.stream_ctl_reserved1_i) or f_x_to_zero(right.stream_ctl_reserved1_i);
+tmp.stream_wr_ptr_i := f_x_to_zero(left.stream_wr_ptr_i) or f_x_to_zero(right.stream_wr_ptr_i);
+tmp.acq_chan_mask_ovf_i := f_x_to_zero(left.acq_chan_mask_ovf_i) or f_x_to_zero(right.acq_chan_mask_ovf_i);
+tmp.ddr3_perf_beats_i := f_x_to_zero(left.ddr3_perf_beats_i) or f_x_to_zero(right.ddr3_perf_beats_i);
+tmp.ddr3_perf_cycles_i := f_x_to_zero(left.ddr3_perf_cycles_i) or f_x_to_zero(right.ddr3_perf_cycles_i);
+tmp.acq_decim_ctl_max_avg_order_sel_i := f_x_to_zero(left.acq_decim_ctl_max_avg_order_sel_i) or f_x_to_zero(right.acq_decim_ctl_max_avg_order_sel_i);
+tmp.acq_comp_ctl_active_i := f_x_to_zero(left.acq_comp_ctl_active_i) or f_x_to_zero(right.acq_comp_ctl_active_i);
+tmp.acq_comp_ctl_ovf_i := f_x_to_zero(left.acq_comp_ctl_ovf_i) or f_x_to_zero(right.acq_comp_ctl_ovf_i);
+tmp.acq_comp_ctl_avail_i := f_x_to_zero(left.acq_comp_ctl_avail_i) or f_x_to_zero(right.acq_comp_ctl_avail_i);
+tmp.acq_comp_ctl_reserved1_i := f_x_to_zero(left.acq_comp_ctl_reserved1_i) or f_x_to_zero(right.acq_comp_ctl_reserved1_i);
 return tmp;
 end function;
 function "or" (left, right: t_acq_core_in_registers) return t_acq_core_in_registers is
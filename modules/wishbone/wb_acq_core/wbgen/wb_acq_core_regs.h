@@ -876,6 +876,126 @@
 #define ACQ_CORE_CH23_ATOM_DESC_ATOM_WIDTH_SHIFT 16
 #define ACQ_CORE_CH23_ATOM_DESC_ATOM_WIDTH_W(value) WBGEN2_GEN_WRITE(value, 16, 16)
 #define ACQ_CORE_CH23_ATOM_DESC_ATOM_WIDTH_R(reg) WBGEN2_GEN_READ(reg, 16, 16)
+
+/* definitions for register: Streaming control */
+
+/* definitions for field: Streaming mode enable in reg: Streaming control */
+#define ACQ_CORE_STREAM_CTL_EN                WBGEN2_GEN_MASK(0, 1)
+
+/* definitions for field: Overwrite unread data in reg: Streaming control */
+#define ACQ_CORE_STREAM_CTL_OVERWRITE         WBGEN2_GEN_MASK(1, 1)
+
+/* definitions for field: Reserved in reg: Streaming control */
+#define ACQ_CORE_STREAM_CTL_RESERVED_MASK     WBGEN2_GEN_MASK(2, 6)
+#define ACQ_CORE_STREAM_CTL_RESERVED_SHIFT    2
+#define ACQ_CORE_STREAM_CTL_RESERVED_W(value) WBGEN2_GEN_WRITE(value, 2, 6)
+#define ACQ_CORE_STREAM_CTL_RESERVED_R(reg)   WBGEN2_GEN_READ(reg, 2, 6)
+
+/* definitions for field: Streaming overrun in reg: Streaming control */
+#define ACQ_CORE_STREAM_CTL_OVERRUN           WBGEN2_GEN_MASK(8, 1)
+
+/* definitions for field: Reserved1 in reg: Streaming control */
+#define ACQ_CORE_STREAM_CTL_RESERVED1_MASK    WBGEN2_GEN_MASK(9, 23)
+#define ACQ_CORE_STREAM_CTL_RESERVED1_SHIFT   9
+#define ACQ_CORE_STREAM_CTL_RESERVED1_W(value) WBGEN2_GEN_WRITE(value, 9, 23)
+#define ACQ_CORE_STREAM_CTL_RESERVED1_R(reg)  WBGEN2_GEN_READ(reg, 9, 23)
+
+/* definitions for register: Streaming write pointer */
+
+/* definitions for register: Streaming read pointer */
+
+/* definitions for register: Multi-channel acquisition mask */
+
+/* definitions for field: Channel mask in reg: Multi-channel acquisition mask */
+#define ACQ_CORE_ACQ_CHAN_MASK_MASK_MASK      WBGEN2_GEN_MASK(0, 24)
+#define ACQ_CORE_ACQ_CHAN_MASK_MASK_SHIFT     0
+#define ACQ_CORE_ACQ_CHAN_MASK_MASK_W(value)  WBGEN2_GEN_WRITE(value, 0, 24)
+#define ACQ_CORE_ACQ_CHAN_MASK_MASK_R(reg)    WBGEN2_GEN_READ(reg, 0, 24)
+
+/* definitions for field: Reserved in reg: Multi-channel acquisition mask */
+#define ACQ_CORE_ACQ_CHAN_MASK_RESERVED_MASK  WBGEN2_GEN_MASK(24, 7)
+#define ACQ_CORE_ACQ_CHAN_MASK_RESERVED_SHIFT 24
+#define ACQ_CORE_ACQ_CHAN_MASK_RESERVED_W(value) WBGEN2_GEN_WRITE(value, 24, 7)
+#define ACQ_CORE_ACQ_CHAN_MASK_RESERVED_R(reg) WBGEN2_GEN_READ(reg, 24, 7)
+
+/* definitions for field: Frame overflow in reg: Multi-channel acquisition mask */
+#define ACQ_CORE_ACQ_CHAN_MASK_OVF            WBGEN2_GEN_MASK(31, 1)
+
+/* definitions for register: DDR3 write performance beats */
+
+/* definitions for register: DDR3 write performance cycles */
+
+/* definitions for register: Decimation control */
+
+/* definitions for field: Decimation ratio in reg: Decimation control */
+#define ACQ_CORE_ACQ_DECIM_CTL_RATIO_MASK     WBGEN2_GEN_MASK(0, 16)
+#define ACQ_CORE_ACQ_DECIM_CTL_RATIO_SHIFT    0
+#define ACQ_CORE_ACQ_DECIM_CTL_RATIO_W(value) WBGEN2_GEN_WRITE(value, 0, 16)
+#define ACQ_CORE_ACQ_DECIM_CTL_RATIO_R(reg)   WBGEN2_GEN_READ(reg, 0, 16)
+
+/* definitions for field: Moving average order selector in reg: Decimation control */
+#define ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_MASK WBGEN2_GEN_MASK(16, 4)
+#define ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_SHIFT 16
+#define ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_W(value) WBGEN2_GEN_WRITE(value, 16, 4)
+#define ACQ_CORE_ACQ_DECIM_CTL_AVG_ORDER_SEL_R(reg) WBGEN2_GEN_READ(reg, 16, 4)
+
+/* definitions for field: Maximum moving average order selector in reg: Decimation control */
+#define ACQ_CORE_ACQ_DECIM_CTL_MAX_AVG_ORDER_SEL_MASK WBGEN2_GEN_MASK(20, 4)
+#define ACQ_CORE_ACQ_DECIM_CTL_MAX_AVG_ORDER_SEL_SHIFT 20
+#define ACQ_CORE_ACQ_DECIM_CTL_MAX_AVG_ORDER_SEL_W(value) WBGEN2_GEN_WRITE(value, 20, 4)
+#define ACQ_CORE_ACQ_DECIM_CTL_MAX_AVG_ORDER_SEL_R(reg) WBGEN2_GEN_READ(reg, 20, 4)
+
+/* definitions for field: Reserved in reg: Decimation control */
+#define ACQ_CORE_ACQ_DECIM_CTL_RESERVED_MASK  WBGEN2_GEN_MASK(24, 8)
+#define ACQ_CORE_ACQ_DECIM_CTL_RESERVED_SHIFT 24
+#define ACQ_CORE_ACQ_DECIM_CTL_RESERVED_W(value) WBGEN2_GEN_WRITE(value, 24, 8)
+#define ACQ_CORE_ACQ_DECIM_CTL_RESERVED_R(reg) WBGEN2_GEN_READ(reg, 24, 8)
+
+/* definitions for register: Decimation channel mask */
+
+/* definitions for field: Decimated channels in reg: Decimation channel mask */
+#define ACQ_CORE_ACQ_DECIM_MASK_MASK_MASK     WBGEN2_GEN_MASK(0, 24)
+#define ACQ_CORE_ACQ_DECIM_MASK_MASK_SHIFT    0
+#define ACQ_CORE_ACQ_DECIM_MASK_MASK_W(value) WBGEN2_GEN_WRITE(value, 0, 24)
+#define ACQ_CORE_ACQ_DECIM_MASK_MASK_R(reg)   WBGEN2_GEN_READ(reg, 0, 24)
+
+/* definitions for field: Reserved in reg: Decimation channel mask */
+#define ACQ_CORE_ACQ_DECIM_MASK_RESERVED_MASK WBGEN2_GEN_MASK(24, 8)
+#define ACQ_CORE_ACQ_DECIM_MASK_RESERVED_SHIFT 24
+#define ACQ_CORE_ACQ_DECIM_MASK_RESERVED_W(value) WBGEN2_GEN_WRITE(value, 24, 8)
+#define ACQ_CORE_ACQ_DECIM_MASK_RESERVED_R(reg) WBGEN2_GEN_READ(reg, 24, 8)
+
+/* definitions for register: Compression control */
+
+/* definitions for field: Compression enable in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_EN              WBGEN2_GEN_MASK(0, 1)
+
+/* definitions for field: Block size in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_MASK WBGEN2_GEN_MASK(1, 4)
+#define ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_SHIFT 1
+#define ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_W(value) WBGEN2_GEN_WRITE(value, 1, 4)
+#define ACQ_CORE_ACQ_COMP_CTL_BLOCK_LOG2_R(reg) WBGEN2_GEN_READ(reg, 1, 4)
+
+/* definitions for field: Reserved in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED_MASK   WBGEN2_GEN_MASK(5, 3)
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED_SHIFT  5
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED_W(value) WBGEN2_GEN_WRITE(value, 5, 3)
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED_R(reg) WBGEN2_GEN_READ(reg, 5, 3)
+
+/* definitions for field: Compressing in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_ACTIVE          WBGEN2_GEN_MASK(8, 1)
+
+/* definitions for field: Compression overflow in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_OVF             WBGEN2_GEN_MASK(9, 1)
+
+/* definitions for field: Compression available in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_AVAIL           WBGEN2_GEN_MASK(10, 1)
+
+/* definitions for field: Reserved1 in reg: Compression control */
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED1_MASK  WBGEN2_GEN_MASK(11, 21)
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED1_SHIFT 11
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED1_W(value) WBGEN2_GEN_WRITE(value, 11, 21)
+#define ACQ_CORE_ACQ_COMP_CTL_RESERVED1_R(reg) WBGEN2_GEN_READ(reg, 11, 21)
 /* [0x0]: REG Control register */
 #define ACQ_CORE_REG_CTL 0x00000000
 /* [0x4]: REG Status register */
@@ -1002,4 +1122,22 @@
 #define ACQ_CORE_REG_CH23_DESC 0x000000f4
 /* [0xf8]: REG Channel 23 Atom Description */
 #define ACQ_CORE_REG_CH23_ATOM_DESC 0x000000f8
+/* [0xfc]: REG Streaming control */
+#define ACQ_CORE_REG_STREAM_CTL 0x000000fc
+/* [0x100]: REG Streaming write pointer */
+#define ACQ_CORE_REG_STREAM_WR_PTR 0x00000100
+/* [0x104]: REG Streaming read pointer */
+#define ACQ_CORE_REG_STREAM_RD_PTR 0x00000104
+/* [0x108]: REG Multi-channel acquisition mask */
+#define ACQ_CORE_REG_ACQ_CHAN_MASK 0x00000108
+/* [0x10c]: REG DDR3 write performance beats */
+#define ACQ_CORE_REG_DDR3_PERF_BEATS 0x0000010c
+/* [0x110]: REG DDR3 write performance cycles */
+#define ACQ_CORE_REG_DDR3_PERF_CYCLES 0x00000110
+/* [0x114]: REG Decimation control */
+#define ACQ_CORE_REG_ACQ_DECIM_CTL 0x00000114
+/* [0x118]: REG Decimation channel mask */
+#define ACQ_CORE_REG_ACQ_DECIM_MASK 0x00000118
+/* [0x11c]: REG Compression control */
+#define ACQ_CORE_REG_ACQ_COMP_CTL 0x0000011c
 #endif
@@ -52,7 +52,10 @@ generic
   g_sim_readback                            : boolean := false;
   g_acq_num_cores                           : natural := 2;
   g_ddr_interface_type                      : string  := "AXIS";
-  g_max_burst_size                          : natural := 4
+  g_max_burst_size                          : natural := 4;
+  g_max_outstanding_bursts                  : natural := 8;
+  g_decim_max_avg_order_sel                 : natural := 0;
+  g_with_delta_comp                         : boolean := false
 );
 port
 (
@@ -188,7 +191,10 @@ begin
     g_sim_readback                           => g_sim_readback,
     g_acq_num_cores                          => g_acq_num_cores,
     g_ddr_interface_type                     => g_ddr_interface_type,
-    g_max_burst_size                         => g_max_burst_size
+    g_max_burst_size                         => g_max_burst_size,
+    g_max_outstanding_bursts                 => g_max_outstanding_bursts,
+    g_decim_max_avg_order_sel                => g_decim_max_avg_order_sel,
+    g_with_delta_comp                        => g_with_delta_comp
   )
   port map
   (
@@ -0,0 +1,4 @@
+files = [
+    "xwb_iir_filt.vhd",
+    "cheby/wb_iir_filt_regs.vhd"
+    ]
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+cheby -i wb_iir_filt_regs.cheby --hdl vhdl --gen-hdl wb_iir_filt_regs.vhd --gen-c wb_iir_filt_regs.h
+
+# cheby leaves the data input of the read-only external RAM port undriven
+sed -i "s/^\(  coeffs_coeff_raminst: cheby_dpssram\)$/  coeffs_coeff_ext_dat <= (others => '0');\n\1/" wb_iir_filt_regs.vhd
@@ -0,0 +1,60 @@
+/*
+  Written by hand from wb_iir_filt_regs.cheby, following the layout of
+  cheby 1.6 output, as cheby was not available. build_cheby.sh regenerates
+  it, along with wb_iir_filt_regs.vhd.
+*/
+
+#ifndef __CHEBY__WB_IIR_FILT_REGS__H__
+#define __CHEBY__WB_IIR_FILT_REGS__H__
+
+#include <stdint.h>
+
+#define WB_IIR_FILT_REGS_SIZE 2048 /* 0x800 */
+
+/* Control register */
+#define WB_IIR_FILT_REGS_CTL 0x0UL
+#define WB_IIR_FILT_REGS_CTL_COMMIT 0x1UL
+
+/* Status register */
+#define WB_IIR_FILT_REGS_STA 0x4UL
+#define WB_IIR_FILT_REGS_STA_PENDING 0x1UL
+
+/* Filter configuration */
+#define WB_IIR_FILT_REGS_CFG 0x8UL
+#define WB_IIR_FILT_REGS_CFG_NUM_BIQUADS_MASK 0xffUL
+#define WB_IIR_FILT_REGS_CFG_NUM_BIQUADS_SHIFT 0
+#define WB_IIR_FILT_REGS_CFG_COEFF_INT_WIDTH_MASK 0xff00UL
+#define WB_IIR_FILT_REGS_CFG_COEFF_INT_WIDTH_SHIFT 8
+#define WB_IIR_FILT_REGS_CFG_COEFF_FRAC_WIDTH_MASK 0xff0000UL
+#define WB_IIR_FILT_REGS_CFG_COEFF_FRAC_WIDTH_SHIFT 16
+
+/* Shadow coefficients */
+#define WB_IIR_FILT_REGS_COEFFS 0x400UL
+#define WB_IIR_FILT_REGS_COEFFS_SIZE 4 /* 0x4 */
+
+/* Coefficient */
+#define WB_IIR_FILT_REGS_COEFFS_COEFF 0x0UL
+
+#ifndef __ASSEMBLER__
+struct wb_iir_filt_regs {
+  /* [0x0]: REG (rw) Control register */
+  uint32_t ctl;
+
+  /* [0x4]: REG (ro) Status register */
+  uint32_t sta;
+
+  /* [0x8]: REG (ro) Filter configuration */
+  uint32_t cfg;
+
+  /* padding to: 256 words */
+  uint32_t __padding_0[253];
+
+  /* [0x400]: MEMORY Shadow coefficients */
+  struct coeffs {
+    /* [0x0]: REG (rw) Coefficient */
+    uint32_t coeff;
+  } coeffs[256];
+};
+#endif /* !__ASSEMBLER__*/
+
+#endif /* __CHEBY__WB_IIR_FILT_REGS__H__ */
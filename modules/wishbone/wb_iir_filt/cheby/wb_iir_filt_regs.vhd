@@ -0,0 +1,261 @@
+-- Written by hand from wb_iir_filt_regs.cheby, following the layout of
+-- cheby 1.6 output, as cheby was not available. build_cheby.sh regenerates
+-- it, along with wb_iir_filt_regs.h, and ties off the unused coefficient
+-- data input of the external RAM port. Keep them in sync with the .cheby
+-- source until then.
+
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use work.wishbone_pkg.all;
+use work.cheby_pkg.all;
+
+entity wb_iir_filt_regs is
+  port (
+    rst_n_i              : in    std_logic;
+    clk_i                : in    std_logic;
+    wb_i                 : in    t_wishbone_slave_in;
+    wb_o                 : out   t_wishbone_slave_out;
+
+    -- Control register
+    -- 0: Do nothing;
+    -- 1: Copy the shadow coefficients to the filter, which starts
+    -- using all of them at the same sample (autoclear). Ignored
+    -- while sta.pending is 1.
+    ctl_commit_o         : out   std_logic;
+
+    -- Status register
+    -- 0: The filter uses the last committed coefficients, the shadow
+    --    memory can be written;
+    -- 1: A commit has not reached every biquad yet; do not write the
+    --    shadow memory nor commit.
+    sta_pending_i        : in    std_logic;
+
+    -- Filter configuration (synthesis parameters)
+    cfg_num_biquads_i    : in    std_logic_vector(7 downto 0);
+    cfg_coeff_int_width_i : in    std_logic_vector(7 downto 0);
+    cfg_coeff_frac_width_i : in    std_logic_vector(7 downto 0);
+
+    -- RAM port for coeffs
+    coeffs_adr_i         : in    std_logic_vector(7 downto 0);
+    coeffs_coeff_rd_i    : in    std_logic;
+    coeffs_coeff_dat_o   : out   std_logic_vector(31 downto 0)
+  );
+end wb_iir_filt_regs;
+
+architecture syn of wb_iir_filt_regs is
+  signal adr_int                        : std_logic_vector(10 downto 2);
+  signal rd_req_int                     : std_logic;
+  signal wr_req_int                     : std_logic;
+  signal rd_ack_int                     : std_logic;
+  signal wr_ack_int                     : std_logic;
+  signal wb_en                          : std_logic;
+  signal ack_int                        : std_logic;
+  signal wb_rip                         : std_logic;
+  signal wb_wip                         : std_logic;
+  signal ctl_commit_reg                 : std_logic;
+  signal ctl_wreq                       : std_logic;
+  signal ctl_wack                       : std_logic;
+  signal coeffs_coeff_int_dato          : std_logic_vector(31 downto 0);
+  signal coeffs_coeff_ext_dat           : std_logic_vector(31 downto 0);
+  signal coeffs_coeff_rreq              : std_logic;
+  signal coeffs_coeff_rack              : std_logic;
+  signal coeffs_coeff_int_wr            : std_logic;
+  signal rd_ack_d0                      : std_logic;
+  signal rd_dat_d0                      : std_logic_vector(31 downto 0);
+  signal wr_req_d0                      : std_logic;
+  signal wr_adr_d0                      : std_logic_vector(10 downto 2);
+  signal wr_dat_d0                      : std_logic_vector(31 downto 0);
+  signal wr_sel_d0                      : std_logic_vector(3 downto 0);
+  signal coeffs_wr                      : std_logic;
+  signal coeffs_wreq                    : std_logic;
+  signal coeffs_adr_int                 : std_logic_vector(7 downto 0);
+begin
+
+  -- WB decode signals
+  adr_int <= wb_i.adr(10 downto 2);
+  wb_en <= wb_i.cyc and wb_i.stb;
+
+  process (clk_i) begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        wb_rip <= '0';
+      else
+        wb_rip <= (wb_rip or (wb_en and not wb_i.we)) and not rd_ack_int;
+      end if;
+    end if;
+  end process;
+  rd_req_int <= (wb_en and not wb_i.we) and not wb_rip;
+
+  process (clk_i) begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        wb_wip <= '0';
+      else
+        wb_wip <= (wb_wip or (wb_en and wb_i.we)) and not wr_ack_int;
+      end if;
+    end if;
+  end process;
+  wr_req_int <= (wb_en and wb_i.we) and not wb_wip;
+
+  ack_int <= rd_ack_int or wr_ack_int;
+  wb_o.ack <= ack_int;
+  wb_o.stall <= not ack_int and wb_en;
+  wb_o.rty <= '0';
+  wb_o.err <= '0';
+
+  -- pipelining for wr-in+rd-out
+  process (clk_i) begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        rd_ack_int <= '0';
+        wr_req_d0 <= '0';
+      else
+        rd_ack_int <= rd_ack_d0;
+        wb_o.dat <= rd_dat_d0;
+        wr_req_d0 <= wr_req_int;
+        wr_adr_d0 <= adr_int;
+        wr_dat_d0 <= wb_i.dat;
+        wr_sel_d0 <= wb_i.sel;
+      end if;
+    end if;
+  end process;
+
+  -- Register ctl
+  ctl_commit_o <= ctl_commit_reg;
+  process (clk_i) begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        ctl_commit_reg <= '0';
+        ctl_wack <= '0';
+      else
+        if ctl_wreq = '1' then
+          ctl_commit_reg <= wr_dat_d0(0);
+        else
+          ctl_commit_reg <= '0';
+        end if;
+        ctl_wack <= ctl_wreq;
+      end if;
+    end if;
+  end process;
+
+  -- Register sta
+
+  -- Register cfg
+
+  -- Memory coeffs
+  process (adr_int, wr_adr_d0, coeffs_wr) begin
+    if coeffs_wr = '1' then
+      coeffs_adr_int <= wr_adr_d0(9 downto 2);
+    else
+      coeffs_adr_int <= adr_int(9 downto 2);
+    end if;
+  end process;
+  coeffs_wreq <= coeffs_coeff_int_wr;
+  coeffs_wr <= coeffs_wreq;
+  coeffs_coeff_ext_dat <= (others => '0');
+  coeffs_coeff_raminst: cheby_dpssram
+    generic map (
+      g_data_width         => 32,
+      g_size               => 256,
+      g_addr_width         => 8,
+      g_dual_clock         => '0',
+      g_use_bwsel          => '1'
+    )
+    port map (
+      clk_a_i              => clk_i,
+      clk_b_i              => clk_i,
+      addr_a_i             => coeffs_adr_int,
+      bwsel_a_i            => wr_sel_d0,
+      data_a_i             => wr_dat_d0,
+      data_a_o             => coeffs_coeff_int_dato,
+      rd_a_i               => coeffs_coeff_rreq,
+      wr_a_i               => coeffs_coeff_int_wr,
+      addr_b_i             => coeffs_adr_i,
+      bwsel_b_i            => (others => '1'),
+      data_b_i             => coeffs_coeff_ext_dat,
+      data_b_o             => coeffs_coeff_dat_o,
+      rd_b_i               => coeffs_coeff_rd_i,
+      wr_b_i               => '0'
+    );
+  
+  process (clk_i) begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        coeffs_coeff_rack <= '0';
+      else
+        coeffs_coeff_rack <= coeffs_coeff_rreq;
+      end if;
+    end if;
+  end process;
+
+  -- Process for write requests.
+  process (wr_adr_d0, wr_req_d0, ctl_wack) begin
+    ctl_wreq <= '0';
+    coeffs_coeff_int_wr <= '0';
+    case wr_adr_d0(10 downto 10) is
+    when "0" =>
+      case wr_adr_d0(3 downto 2) is
+      when "00" =>
+        -- Reg ctl
+        ctl_wreq <= wr_req_d0;
+        wr_ack_int <= ctl_wack;
+      when "01" =>
+        -- Reg sta
+        wr_ack_int <= wr_req_d0;
+      when "10" =>
+        -- Reg cfg
+        wr_ack_int <= wr_req_d0;
+      when others =>
+        wr_ack_int <= wr_req_d0;
+      end case;
+    when "1" =>
+      -- Memory coeffs
+      coeffs_coeff_int_wr <= wr_req_d0;
+      wr_ack_int <= wr_req_d0;
+    when others =>
+      wr_ack_int <= wr_req_d0;
+    end case;
+  end process;
+
+  -- Process for read requests.
+  process (adr_int, rd_req_int, sta_pending_i, cfg_num_biquads_i,
+           cfg_coeff_int_width_i, cfg_coeff_frac_width_i,
+           coeffs_coeff_int_dato, coeffs_coeff_rack) begin
+    -- By default ack read requests
+    rd_dat_d0 <= (others => 'X');
+    coeffs_coeff_rreq <= '0';
+    case adr_int(10 downto 10) is
+    when "0" =>
+      case adr_int(3 downto 2) is
+      when "00" =>
+        -- Reg ctl
+        rd_ack_d0 <= rd_req_int;
+        rd_dat_d0(0) <= '0';
+        rd_dat_d0(31 downto 1) <= (others => '0');
+      when "01" =>
+        -- Reg sta
+        rd_ack_d0 <= rd_req_int;
+        rd_dat_d0(0) <= sta_pending_i;
+        rd_dat_d0(31 downto 1) <= (others => '0');
+      when "10" =>
+        -- Reg cfg
+        rd_ack_d0 <= rd_req_int;
+        rd_dat_d0(7 downto 0) <= cfg_num_biquads_i;
+        rd_dat_d0(15 downto 8) <= cfg_coeff_int_width_i;
+        rd_dat_d0(23 downto 16) <= cfg_coeff_frac_width_i;
+        rd_dat_d0(31 downto 24) <= (others => '0');
+      when others =>
+        rd_ack_d0 <= rd_req_int;
+      end case;
+    when "1" =>
+      -- Memory coeffs
+      rd_dat_d0 <= coeffs_coeff_int_dato;
+      coeffs_coeff_rreq <= rd_req_int;
+      rd_ack_d0 <= coeffs_coeff_rack;
+    when others =>
+      rd_ack_d0 <= rd_req_int;
+    end case;
+  end process;
+end syn;
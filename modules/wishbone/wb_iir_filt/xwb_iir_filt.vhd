@@ -0,0 +1,363 @@
+------------------------------------------------------------------------------
+-- Title      : XWB IIR Filter Interface
+------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-GIE
+-- Created    : 2026-10-17
+-- Platform   : FPGA-generic
+-------------------------------------------------------------------------------
+-- Description: iir_filt with its coefficients in a Wishbone memory.
+--
+-- The coefficients are written to the coeffs memory, which is a shadow bank:
+-- the filter does not see them until ctl.commit. The commit copies the memory
+-- to the registers that drive iir_filt and then loads them into every biquad
+-- at a sample boundary (g_COEFFS_DOUBLE_BUFFER), so no sample is computed
+-- with a mix of old and new coefficients. sta.pending is '1' from the commit
+-- until the last biquad has loaded the new set; the memory must not be
+-- written meanwhile and a commit is ignored.
+--
+-- Biquad n takes the words 8*n to 8*n+4 of the memory: b0, b1, b2, a1 and
+-- a2, as raw fixed point values (LSB aligned, sign-extended to 32 bits).
+-- This limits g_NUM_BIQUADS to 32 and the coefficients to 32 bits.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.fixed_pkg.all;
+
+use work.wishbone_pkg.all;
+use work.ifc_common_pkg.all;
+
+entity xwb_iir_filt is
+  generic (
+    -- Number of internal biquads (at most 32)
+    g_NUM_BIQUADS         : natural;
+    -- Integer width of x
+    g_X_INT_WIDTH         : natural;
+    -- Fractionary width of x
+    g_X_FRAC_WIDTH        : natural;
+    -- Integer width of coefficients
+    g_COEFF_INT_WIDTH     : natural;
+    -- Fractionary width of coefficients (integer + fractionary width
+    -- at most 32)
+    g_COEFF_FRAC_WIDTH    : natural;
+    -- Integer width of y
+    g_Y_INT_WIDTH         : natural;
+    -- Fractionary width of y
+    g_Y_FRAC_WIDTH        : natural;
+    -- Extra bits for biquads' internal arithmetic
+    g_ARITH_EXTRA_BITS    : natural;
+    -- Extra bits for between-biquads cascade interfaces
+    g_IFCS_EXTRA_BITS     : natural;
+    g_INTERFACE_MODE      : t_wishbone_interface_mode      := CLASSIC;
+    g_ADDRESS_GRANULARITY : t_wishbone_address_granularity := WORD;
+    g_WITH_EXTRA_WB_REG   : boolean := false
+    );
+  port (
+    -- Clock, for both Wishbone and the filter
+    clk_i                 : in  std_logic;
+    -- Reset
+    rst_n_i               : in  std_logic;
+    -- Wishbone interface
+    wb_slv_i              : in  t_wishbone_slave_in;
+    wb_slv_o              : out t_wishbone_slave_out;
+    -- x[n]
+    x_i                   : in  sfixed(g_X_INT_WIDTH-1 downto -g_X_FRAC_WIDTH);
+    -- Input valid
+    x_valid_i             : in  std_logic;
+    -- Busy flag
+    busy_o                : out std_logic;
+    -- y[n]
+    y_o                   : out sfixed(g_Y_INT_WIDTH-1 downto -g_Y_FRAC_WIDTH);
+    -- Output valid
+    y_valid_o             : out std_logic
+    );
+end xwb_iir_filt;
+
+architecture rtl of xwb_iir_filt is
+  type t_copy_state is (IDLE, LOAD, COMMIT);
+
+  constant c_COEFF_WIDTH : natural := g_COEFF_INT_WIDTH + g_COEFF_FRAC_WIDTH;
+  -- Memory word of a2 of the last biquad
+  constant c_LAST_ADR    : natural := 8*(g_NUM_BIQUADS-1) + 4;
+
+  signal copy_state      : t_copy_state := IDLE;
+  signal ctl_commit      : std_logic;
+  signal sta_pending     : std_logic;
+  signal mem_adr         : unsigned(7 downto 0) := (others => '0');
+  signal mem_adr_d1      : unsigned(7 downto 0) := (others => '0');
+  signal mem_rd          : std_logic := '0';
+  signal mem_rd_d1       : std_logic := '0';
+  signal mem_dat         : std_logic_vector(31 downto 0);
+  signal coeffs          : t_iir_filt_coeffs(g_NUM_BIQUADS-1 downto 0)(
+                             b0(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                             b1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                             b2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                             a1(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH),
+                             a2(g_COEFF_INT_WIDTH-1 downto -g_COEFF_FRAC_WIDTH)
+                           );
+  signal coeffs_commit   : std_logic := '0';
+  signal coeffs_pending  : std_logic;
+
+  -----------------------------
+  -- Wishbone slave adapter signals/structures
+  -----------------------------
+  signal wb_slv_adp_out                      : t_wishbone_master_out;
+  signal wb_slv_adp_in                       : t_wishbone_master_in;
+  signal resized_addr                        : std_logic_vector(c_wishbone_address_width-1 downto 0);
+
+  -- Extra Wishbone registering stage
+  signal wb_slave_in                         : t_wishbone_slave_in_array (0 downto 0);
+  signal wb_slave_out                        : t_wishbone_slave_out_array(0 downto 0);
+  signal wb_slave_in_reg0                    : t_wishbone_slave_in_array (0 downto 0);
+  signal wb_slave_out_reg0                   : t_wishbone_slave_out_array(0 downto 0);
+
+  -----------------------------
+  -- General Constants
+  -----------------------------
+  -- Number of bits in Wishbone register interface. Plus 2 to account for BYTE addressing
+  constant c_PERIPH_ADDR_SIZE                : natural := 9+2;
+
+  -----------------------------
+  -- Functions
+  -----------------------------
+
+  -- Map Wishbone MODE/GRANULARITY to all components
+  -- according to this module generics
+  type t_wb_generics is record
+    reg_in_mode         : t_wishbone_interface_mode;
+    reg_in_granularity  : t_wishbone_address_granularity;
+    reg_out_mode        : t_wishbone_interface_mode;
+    reg_out_granularity : t_wishbone_address_granularity;
+    slave_mode          : t_wishbone_interface_mode;
+    slave_granularity   : t_wishbone_address_granularity;
+  end record;
+
+  function f_wb_generics (with_reg_link : boolean; mode : t_wishbone_interface_mode; granularity : t_wishbone_address_granularity)
+    return t_wb_generics is
+      variable v_wb_generic : t_wb_generics;
+   begin
+      if with_reg_link then
+        v_wb_generic.reg_in_mode := mode;
+        v_wb_generic.reg_in_granularity := granularity;
+        -- Use CLASSIC/BYTE as xwb_register_links needs them, so convert
+        -- only once in our wb_slave_adapter
+        -- Otherwise a wb_slave adapter will convert them to CLASSIC/BYTE.
+        v_wb_generic.reg_out_mode := CLASSIC;
+        v_wb_generic.reg_out_granularity := BYTE;
+        v_wb_generic.slave_mode := CLASSIC;
+        v_wb_generic.slave_granularity := BYTE;
+      else
+        -- Unused
+        v_wb_generic.reg_in_mode := CLASSIC;
+        v_wb_generic.reg_in_granularity := BYTE;
+        v_wb_generic.reg_out_mode := CLASSIC;
+        v_wb_generic.reg_out_granularity := BYTE;
+        -- Use the passed generics
+        v_wb_generic.slave_mode := mode;
+        v_wb_generic.slave_granularity := granularity;
+      end if;
+      return v_wb_generic;
+   end f_wb_generics;
+
+   constant c_WB_GENERICS : t_wb_generics :=
+      f_wb_generics (g_WITH_EXTRA_WB_REG, g_INTERFACE_MODE, g_ADDRESS_GRANULARITY);
+begin
+
+  assert g_NUM_BIQUADS <= 32 and c_COEFF_WIDTH <= 32
+    report "xwb_iir_filt: the coefficients memory holds up to 32 biquads of 32-bit coefficients"
+    severity failure;
+
+  -----------------------------
+  -- Insert extra Wishbone registering stage for ease timing.
+  -----------------------------
+  gen_with_extra_wb_reg : if g_WITH_EXTRA_WB_REG generate
+
+    cmp_register_link : xwb_register_link -- puts a register of delay between crossbars
+    generic map (
+      g_WB_IN_MODE                          => c_WB_GENERICS.reg_in_mode,
+      g_WB_IN_GRANULARITY                   => c_WB_GENERICS.reg_in_granularity,
+      g_WB_OUT_MODE                         => c_WB_GENERICS.reg_out_mode,
+      g_WB_OUT_GRANULARITY                  => c_WB_GENERICS.reg_out_granularity
+    )
+    port map (
+      clk_sys_i                             => clk_i,
+      rst_n_i                               => rst_n_i,
+      slave_i                               => wb_slave_in_reg0(0),
+      slave_o                               => wb_slave_out_reg0(0),
+      master_i                              => wb_slave_out(0),
+      master_o                              => wb_slave_in(0)
+    );
+
+    wb_slave_in_reg0(0)  <= wb_slv_i;
+    wb_slv_o             <= wb_slave_out_reg0(0);
+
+  end generate;
+
+  gen_without_extra_wb_reg : if not g_WITH_EXTRA_WB_REG generate
+
+    -- External master connection
+    wb_slave_in(0)  <= wb_slv_i;
+    wb_slv_o        <= wb_slave_out(0);
+
+  end generate;
+
+  -----------------------------
+  -- Slave adapter for Wishbone Register Interface
+  -----------------------------
+  cmp_slave_adapter : wb_slave_adapter
+  generic map (
+    g_master_use_struct                      => true,
+    g_master_mode                            => g_INTERFACE_MODE,
+    -- Cheby with default register map requires granularity to be BYTE
+    g_master_granularity                     => BYTE,
+    g_slave_use_struct                       => false,
+    g_slave_mode                             => c_WB_GENERICS.slave_mode,
+    g_slave_granularity                      => c_WB_GENERICS.slave_granularity
+  )
+  port map (
+    clk_sys_i                                => clk_i,
+    rst_n_i                                  => rst_n_i,
+    master_i                                 => wb_slv_adp_in,
+    master_o                                 => wb_slv_adp_out,
+    sl_adr_i                                 => resized_addr,
+    sl_dat_i                                 => wb_slave_in(0).dat,
+    sl_sel_i                                 => wb_slave_in(0).sel,
+    sl_cyc_i                                 => wb_slave_in(0).cyc,
+    sl_stb_i                                 => wb_slave_in(0).stb,
+    sl_we_i                                  => wb_slave_in(0).we,
+    sl_dat_o                                 => wb_slave_out(0).dat,
+    sl_ack_o                                 => wb_slave_out(0).ack,
+    sl_rty_o                                 => wb_slave_out(0).rty,
+    sl_err_o                                 => wb_slave_out(0).err,
+    sl_stall_o                               => wb_slave_out(0).stall
+  );
+
+  -- By doing this zeroing we avoid the issue related to BYTE -> WORD  conversion
+  -- slave addressing (possibly performed by the slave adapter component)
+  -- in which a bit in the MSB of the peripheral addressing part (31 - 5 in our case)
+  -- is shifted to the internal register adressing part (4 - 0 in our case).
+  -- Therefore, possibly changing the these bits!
+  resized_addr(c_PERIPH_ADDR_SIZE-1 downto 0)
+                                             <= wb_slave_in(0).adr(c_PERIPH_ADDR_SIZE-1 downto 0);
+  resized_addr(c_WISHBONE_ADDRESS_WIDTH-1 downto c_PERIPH_ADDR_SIZE)
+                                             <= (others => '0');
+
+  -- Wishbone registers component
+  cmp_iir_filt_regs: entity work.wb_iir_filt_regs
+    port map (
+      rst_n_i                => rst_n_i,
+      clk_i                  => clk_i,
+      wb_i                   => wb_slv_adp_out,
+      wb_o                   => wb_slv_adp_in,
+      ctl_commit_o           => ctl_commit,
+      sta_pending_i          => sta_pending,
+      cfg_num_biquads_i      => std_logic_vector(to_unsigned(g_NUM_BIQUADS, 8)),
+      cfg_coeff_int_width_i  => std_logic_vector(to_unsigned(g_COEFF_INT_WIDTH, 8)),
+      cfg_coeff_frac_width_i => std_logic_vector(to_unsigned(g_COEFF_FRAC_WIDTH, 8)),
+      coeffs_adr_i           => std_logic_vector(mem_adr),
+      coeffs_coeff_rd_i      => mem_rd,
+      coeffs_coeff_dat_o     => mem_dat
+      );
+
+  -- The commit pulse reaches iir_filt one cycle after the FSM is back in IDLE
+  sta_pending <= '1' when copy_state /= IDLE or coeffs_commit = '1' or
+                          coeffs_pending = '1' else '0';
+
+  -- Copies the memory to coeffs, one word per cycle, and commits it
+  process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        copy_state <= IDLE;
+        mem_rd <= '0';
+        mem_rd_d1 <= '0';
+        coeffs_commit <= '0';
+      else
+        coeffs_commit <= '0';
+        mem_rd_d1 <= mem_rd;
+        mem_adr_d1 <= mem_adr;
+
+        -- The memory answers one cycle after the read
+        if mem_rd_d1 = '1' then
+          case to_integer(mem_adr_d1(2 downto 0)) is
+            when 0 =>
+              coeffs(to_integer(mem_adr_d1(7 downto 3))).b0 <=
+                to_sfixed(mem_dat(c_COEFF_WIDTH-1 downto 0), g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+            when 1 =>
+              coeffs(to_integer(mem_adr_d1(7 downto 3))).b1 <=
+                to_sfixed(mem_dat(c_COEFF_WIDTH-1 downto 0), g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+            when 2 =>
+              coeffs(to_integer(mem_adr_d1(7 downto 3))).b2 <=
+                to_sfixed(mem_dat(c_COEFF_WIDTH-1 downto 0), g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+            when 3 =>
+              coeffs(to_integer(mem_adr_d1(7 downto 3))).a1 <=
+                to_sfixed(mem_dat(c_COEFF_WIDTH-1 downto 0), g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+            when others =>
+              coeffs(to_integer(mem_adr_d1(7 downto 3))).a2 <=
+                to_sfixed(mem_dat(c_COEFF_WIDTH-1 downto 0), g_COEFF_INT_WIDTH-1, -g_COEFF_FRAC_WIDTH);
+          end case;
+        end if;
+
+        case copy_state is
+          when IDLE =>
+            -- coeffs must be held while iir_filt has a commit pending
+            if ctl_commit = '1' and sta_pending = '0' then
+              mem_adr <= (others => '0');
+              mem_rd <= '1';
+              copy_state <= LOAD;
+            end if;
+
+          when LOAD =>
+            if mem_rd = '1' then
+              if mem_adr = c_LAST_ADR then
+                mem_rd <= '0';
+              elsif mem_adr(2 downto 0) = 4 then
+                -- Skip to the next biquad
+                mem_adr <= mem_adr + 4;
+              else
+                mem_adr <= mem_adr + 1;
+              end if;
+            else
+              -- The last word is being stored
+              copy_state <= COMMIT;
+            end if;
+
+          when COMMIT =>
+            coeffs_commit <= '1';
+            copy_state <= IDLE;
+        end case;
+      end if;
+    end if;
+  end process;
+
+  cmp_iir_filt : iir_filt
+    generic map (
+      g_NUM_BIQUADS          => g_NUM_BIQUADS,
+      g_X_INT_WIDTH          => g_X_INT_WIDTH,
+      g_X_FRAC_WIDTH         => g_X_FRAC_WIDTH,
+      g_COEFF_INT_WIDTH      => g_COEFF_INT_WIDTH,
+      g_COEFF_FRAC_WIDTH     => g_COEFF_FRAC_WIDTH,
+      g_Y_INT_WIDTH          => g_Y_INT_WIDTH,
+      g_Y_FRAC_WIDTH         => g_Y_FRAC_WIDTH,
+      g_ARITH_EXTRA_BITS     => g_ARITH_EXTRA_BITS,
+      g_IFCS_EXTRA_BITS      => g_IFCS_EXTRA_BITS,
+      g_COEFFS_DOUBLE_BUFFER => true
+    )
+    port map (
+      clk_i                  => clk_i,
+      rst_n_i                => rst_n_i,
+      x_i                    => x_i,
+      x_valid_i              => x_valid_i,
+      coeffs_i               => coeffs,
+      coeffs_commit_i        => coeffs_commit,
+      coeffs_pending_o       => coeffs_pending,
+      busy_o                 => busy_o,
+      y_o                    => y_o,
+      y_valid_o              => y_valid_o
+    );
+
+end architecture rtl;
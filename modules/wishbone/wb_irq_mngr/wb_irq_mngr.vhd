@@ -5,6 +5,11 @@
 -- Project       :  Wishbone Interruption Manager (ARMadeus wishbone example)
 
 -- See: http://www.armadeus.com/wiki/index.php?title=A_simple_design_with_Wishbone_bus
+--
+-- Interrupt coalescing: the sources set in COAL_MASK only become pending
+-- after COAL_CNT events (0 and 1 mean every event), or COAL_TOUT ticks of
+-- 2**g_coal_tick_log2 clk_sys_i cycles after the first one (0 disables the
+-- timeout). The other sources become pending on every event.
 
 library IEEE;
 use IEEE.std_logic_1164.all;
@@ -18,7 +23,8 @@ entity wb_irq_mngr is
         g_irq_count                          : integer := 16;
         g_irq_level                       : std_logic := '1';
         g_interface_mode            : t_wishbone_interface_mode       := CLASSIC;
-    g_address_granularity       : t_wishbone_address_granularity  := BYTE
+    g_address_granularity       : t_wishbone_address_granularity  := BYTE;
+    g_coal_tick_log2            : positive := 8
   );
     port(
         -- Global Signals
@@ -42,7 +48,9 @@ entity wb_irq_mngr is
     irq_req_i                          : in  std_logic_vector(g_irq_count-1 downto 0);
 
     -- Component external signals
-    irq_req_o                       : out std_logic
+    irq_req_o                       : out std_logic;
+    -- Pending sources, for one interrupt vector per source
+    irq_pend_o                      : out std_logic_vector(g_irq_count-1 downto 0)
   );
 end wb_irq_mngr;
 
@@ -50,6 +58,9 @@ architecture rtl of wb_irq_mngr is
     -- Read/Write regs
   constant c_IRQ_REG_MASK             : std_logic_vector(2 downto 0) := "000";  -- *reg* IRQ mask
     constant c_IRQ_REG_ACK                 : std_logic_vector(2 downto 0) := "001";  -- *reg* IRQ acknowledge from master
+    constant c_IRQ_REG_COAL_MASK        : std_logic_vector(2 downto 0) := "011";  -- *reg* IRQ coalesced sources
+    constant c_IRQ_REG_COAL_CNT         : std_logic_vector(2 downto 0) := "100";  -- *reg* IRQ coalescing event count
+    constant c_IRQ_REG_COAL_TOUT        : std_logic_vector(2 downto 0) := "101";  -- *reg* IRQ coalescing timeout
 
     -- Read regs
     constant c_IRQ_REG_PEND             : std_logic_vector(2 downto 0) := "010";  -- *reg* IRQ pending
@@ -67,6 +78,20 @@ architecture rtl of wb_irq_mngr is
 
     signal irq_mask                 : std_logic_vector(g_irq_count-1 downto 0);
 
+    -- Coalescing
+    constant c_coal_width           : natural := 16;
+    type t_coal_cnt_array is array (natural range <>) of unsigned(c_coal_width-1 downto 0);
+
+    signal coal_mask                : std_logic_vector(g_irq_count-1 downto 0);
+    signal coal_thres               : unsigned(c_coal_width-1 downto 0);
+    signal coal_tout                : unsigned(c_coal_width-1 downto 0);
+    signal coal_presc               : unsigned(g_coal_tick_log2-1 downto 0);
+    signal coal_tick                : std_logic;
+    signal coal_cnt                 : t_coal_cnt_array(g_irq_count-1 downto 0);
+    signal coal_tmr                 : t_coal_cnt_array(g_irq_count-1 downto 0);
+    signal coal_fire                : std_logic_vector(g_irq_count-1 downto 0);
+    signal irq_fire                 : std_logic_vector(g_irq_count-1 downto 0);
+
     signal readdata                 : std_logic_vector(c_wishbone_data_width-1 downto 0);
     signal rd_ack                     : std_logic;
     signal wr_ack                     : std_logic;
@@ -121,15 +146,72 @@ begin
 ----------------------------------------------------------------------------
 --  Interruption requests latching process on rising edge
 ----------------------------------------------------------------------------
+    irq_fire                      <= (irq_r and irq_mask and not coal_mask) or coal_fire;
+
     p_int_req : process(clk_sys_i, rst_n_i)
     begin
         if(rst_n_i = '0') then
             irq_pend             <= (others => '0');
           elsif rising_edge(clk_sys_i) then
-            irq_pend             <= (irq_pend or (irq_r and irq_mask)) and (not irq_ack);
+            irq_pend             <= (irq_pend or irq_fire) and (not irq_ack);
           end if;
     end process p_int_req;
 
+----------------------------------------------------------------------------
+--  Coalescing timeout tick
+----------------------------------------------------------------------------
+    p_coal_tick : process(clk_sys_i, rst_n_i)
+    begin
+        if(rst_n_i = '0') then
+            coal_presc          <= (others => '0');
+            coal_tick           <= '0';
+        elsif rising_edge(clk_sys_i) then
+            coal_presc          <= coal_presc + 1;
+            if(coal_presc = (coal_presc'range => '1')) then
+                coal_tick       <= '1';
+            else
+                coal_tick       <= '0';
+            end if;
+        end if;
+    end process p_coal_tick;
+
+----------------------------------------------------------------------------
+--  Coalesced sources: count events and ticks since the first one
+----------------------------------------------------------------------------
+    p_coal : process(clk_sys_i, rst_n_i)
+    begin
+        if(rst_n_i = '0') then
+            coal_cnt            <= (others => (others => '0'));
+            coal_tmr            <= (others => (others => '0'));
+            coal_fire           <= (others => '0');
+        elsif rising_edge(clk_sys_i) then
+            for i in 0 to g_irq_count-1 loop
+                coal_fire(i)    <= '0';
+
+                if(coal_mask(i) = '0') then
+                    coal_cnt(i) <= (others => '0');
+                    coal_tmr(i) <= (others => '0');
+                elsif(irq_r(i) = '1' and irq_mask(i) = '1' and coal_cnt(i) + 1 >= coal_thres) then
+                    coal_cnt(i) <= (others => '0');
+                    coal_tmr(i) <= (others => '0');
+                    coal_fire(i) <= '1';
+                elsif(coal_tick = '1' and coal_cnt(i) /= 0 and coal_tout /= 0 and
+                      coal_tmr(i) + 1 >= coal_tout) then
+                    coal_cnt(i) <= (others => '0');
+                    coal_tmr(i) <= (others => '0');
+                    coal_fire(i) <= '1';
+                else
+                    if(irq_r(i) = '1' and irq_mask(i) = '1') then
+                        coal_cnt(i) <= coal_cnt(i) + 1;
+                    end if;
+                    if(coal_tick = '1' and coal_cnt(i) /= 0) then
+                        coal_tmr(i) <= coal_tmr(i) + 1;
+                    end if;
+                end if;
+            end loop;
+        end if;
+    end process p_coal;
+
 ----------------------------------------------------------------------------
 --  Register reading process
 ----------------------------------------------------------------------------
@@ -149,6 +231,12 @@ begin
                 readdata(g_irq_count-1 downto 0)    <= irq_mask;
               elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_PEND) then
                 readdata(g_irq_count-1 downto 0)     <= irq_pend;
+              elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_MASK) then
+                readdata(g_irq_count-1 downto 0)     <= coal_mask;
+              elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_CNT) then
+                readdata(c_coal_width-1 downto 0)    <= std_logic_vector(coal_thres);
+              elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_TOUT) then
+                readdata(c_coal_width-1 downto 0)    <= std_logic_vector(coal_tout);
               --elsif(wbs_s1_address="10") then
                 --readdata <= std_logic_vector(to_unsigned(id,16));
               else
@@ -167,17 +255,26 @@ begin
             irq_ack                <= (others => '0');
             wr_ack              <= '0';
             irq_mask             <= (others => '0');
+            coal_mask            <= (others => '0');
+            coal_thres           <= (others => '0');
+            coal_tout            <= (others => '0');
         elsif rising_edge(clk_sys_i) then
             irq_ack             <= (others => '0');
             wr_ack              <= '0';
 
         -- WB WRITE classic cycle. Word granularity
-      if(wb_in.stb = '1' and wb_in.we = '0' and wb_in.cyc = '1' and sel = '1') then
+      if(wb_in.stb = '1' and wb_in.we = '1' and wb_in.cyc = '1' and sel = '1') then
           wr_ack              <= '1';
         if(wb_in.adr(4 downto 2) = c_IRQ_REG_MASK) then
           irq_mask         <= wb_in.dat(g_irq_count-1 downto 0);
         elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_ACK) then
           irq_ack         <= wb_in.dat(g_irq_count-1 downto 0);
+        elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_MASK) then
+          coal_mask        <= wb_in.dat(g_irq_count-1 downto 0);
+        elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_CNT) then
+          coal_thres       <= unsigned(wb_in.dat(c_coal_width-1 downto 0));
+        elsif(wb_in.adr(4 downto 2) = c_IRQ_REG_COAL_TOUT) then
+          coal_tout        <= unsigned(wb_in.dat(c_coal_width-1 downto 0));
         end if;
             end if;
     end if;
@@ -186,6 +283,8 @@ begin
     irq_req_o                             <= g_irq_level when(unsigned(irq_pend) /= 0 and rst_n_i = '1') else
                                                not g_irq_level;
 
+    irq_pend_o                            <= irq_pend;
+
     wb_out.ack                             <= rd_ack or wr_ack;
     wb_out.dat                          <= readdata when (wb_in.stb = '1' and wb_in.we = '0' and wb_in.cyc = '1') else (others => '0');
 
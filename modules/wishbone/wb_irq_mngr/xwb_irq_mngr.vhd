@@ -18,7 +18,8 @@ entity xwb_irq_mngr is
         g_irq_count                    : integer := 16;
         g_irq_level                 : std_logic := '1';
         g_interface_mode            : t_wishbone_interface_mode      := CLASSIC;
-        g_address_granularity       : t_wishbone_address_granularity := BYTE
+        g_address_granularity       : t_wishbone_address_granularity := BYTE;
+        g_coal_tick_log2            : positive := 8
     );
     port(
         -- Global Signals
@@ -33,7 +34,8 @@ entity xwb_irq_mngr is
         irq_req_i                    : in  std_logic_vector(g_irq_count-1 downto 0);
       
         -- Component external signals
-        irq_req_o                   : out std_logic
+        irq_req_o                   : out std_logic;
+        irq_pend_o                  : out std_logic_vector(g_irq_count-1 downto 0)
     );
 end entity;
     
@@ -44,7 +46,8 @@ architecture rtl of xwb_irq_mngr is
         g_irq_count                    : integer := 16;
         g_irq_level                 : std_logic := '1';
         g_interface_mode            : t_wishbone_interface_mode      := CLASSIC;
-        g_address_granularity       : t_wishbone_address_granularity := BYTE
+        g_address_granularity       : t_wishbone_address_granularity := BYTE;
+        g_coal_tick_log2            : positive := 8
     );
     port(
         -- Global Signals
@@ -68,7 +71,8 @@ architecture rtl of xwb_irq_mngr is
         irq_req_i                    : in  std_logic_vector(g_irq_count-1 downto 0);
       
         -- Component external signals
-        irq_req_o                   : out std_logic
+        irq_req_o                   : out std_logic;
+        irq_pend_o                  : out std_logic_vector(g_irq_count-1 downto 0)
     );
     end component;
 
@@ -79,7 +83,8 @@ begin
         g_irq_count                    => g_irq_count,            
         g_irq_level                 => g_irq_level,
         g_interface_mode            => g_interface_mode,     
-        g_address_granularity       => g_address_granularity
+        g_address_granularity       => g_address_granularity,
+        g_coal_tick_log2            => g_coal_tick_log2
     )
     port map (
         clk_sys_i                   => clk_sys_i,
@@ -95,7 +100,8 @@ begin
         wb_stall_o                  => slave_o.stall,
         
         irq_req_i                   => irq_req_i,
-        irq_req_o                   => irq_req_o
+        irq_req_o                   => irq_req_o,
+        irq_pend_o                  => irq_pend_o
     );
 
     slave_o.err   <= '0';
@@ -0,0 +1,270 @@
+/*
+ * wb_master_uart client self-test
+ *
+ * Runs the client against a byte-level model of the binary protocol of
+ * wb_master_uart.vhd, backed by a sparse memory with addresses that fail.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "wb_master_uart.h"
+
+using namespace wb_uart;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/* Model of the binary commands of wb_master_uart */
+class ModelTransport : public Transport {
+public:
+    std::map<uint32_t, uint32_t> mem;
+    std::set<uint32_t> bad;          /* Accesses to these addresses fail */
+    std::size_t commands = 0;
+
+    void write(const uint8_t *buf, std::size_t n) override
+    {
+        in_.insert(in_.end(), buf, buf + n);
+        while (step())
+            ;
+    }
+
+    void read(uint8_t *buf, std::size_t n) override
+    {
+        if (out_.size() < n)
+            throw std::runtime_error("UART read timeout");
+        for (std::size_t i = 0; i < n; i++) {
+            buf[i] = out_.front();
+            out_.pop_front();
+        }
+    }
+
+    std::size_t pending() const { return out_.size(); }
+
+private:
+    /* Run the command at the head of the input, if it is complete */
+    bool step()
+    {
+        if (in_.empty())
+            return false;
+
+        uint8_t op = in_[0];
+        if (op == op_sync) {
+            in_.pop_front();
+            commands++;
+            trailer(sts_ok, 0);
+            return true;
+        }
+        if ((op & 0xf8) != op_write)
+            throw std::logic_error("unexpected opcode");
+        if ((op & op_posted) && (op & op_read))
+            throw std::logic_error("posted read");
+        if (in_.size() < header_bytes)
+            return false;
+
+        uint32_t addr = get(1, 4);
+        std::size_t n = get(5, 2) + 1;
+        bool read = op & op_read;
+        bool fixed = op & op_fixed;
+        bool posted = op & op_posted;
+
+        if (!read && in_.size() < header_bytes + 4 * n)
+            return false;
+
+        uint8_t status = sts_ok;
+        std::size_t done = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            uint32_t a = fixed ? addr : addr + 4 * static_cast<uint32_t>(i);
+            if (status == sts_ok && bad.count(a))
+                status = sts_err;
+            if (read) {
+                uint32_t v = status == sts_ok ? mem[a] : 0;
+                for (int b = 3; b >= 0; b--)
+                    out_.push_back(static_cast<uint8_t>(v >> (8 * b)));
+            } else if (status == sts_ok) {
+                mem[a] = get(header_bytes + 4 * i, 4);
+            }
+            if (status == sts_ok)
+                done++;
+        }
+
+        in_.erase(in_.begin(), in_.begin() + header_bytes + (read ? 0 : 4 * n));
+        commands++;
+        if (posted)
+            posted_err_ |= status != sts_ok;
+        else
+            trailer(status, done);
+        return true;
+    }
+
+    uint32_t get(std::size_t ofs, unsigned nbytes) const
+    {
+        uint32_t v = 0;
+        for (unsigned i = 0; i < nbytes; i++)
+            v = v << 8 | in_[ofs + i];
+        return v;
+    }
+
+    void trailer(uint8_t status, std::size_t done)
+    {
+        if (status == sts_ok && posted_err_) {
+            status = sts_posted_err;
+            posted_err_ = false;
+        }
+        out_.push_back(status);
+        out_.push_back(static_cast<uint8_t>(done >> 8));
+        out_.push_back(static_cast<uint8_t>(done));
+    }
+
+    std::deque<uint8_t> in_, out_;
+    bool posted_err_ = false;
+};
+
+static void test_roundtrip(std::mt19937 &rng)
+{
+    ModelTransport t;
+    Master m(t);
+
+    std::vector<uint32_t> data(1000);
+    for (auto &v : data)
+        v = rng();
+
+    /* Posted writes get no response until the sync */
+    m.write_burst(0x1000, data);
+    CHECK(t.pending() == 0);
+    m.sync();
+    CHECK(t.pending() == 0);
+
+    CHECK(m.read_burst(0x1000, data.size()) == data);
+    CHECK(m.read(0x1000 + 4 * 999) == data[999]);
+
+    m.write(0x20, 0xcafe0001);
+    CHECK(t.mem[0x20] == 0xcafe0001);
+    CHECK(m.read(0x20) == 0xcafe0001);
+
+    /* Fixed address: only the last word is left */
+    m.write_burst(0x40, data.data(), 10, true, false);
+    CHECK(t.mem[0x40] == data[9]);
+    CHECK(t.mem.count(0x44) == 0);
+    std::vector<uint32_t> f = m.read_burst(0x40, 3, true);
+    CHECK(f.size() == 3 && f[0] == data[9] && f[2] == data[9]);
+    CHECK(t.pending() == 0);
+}
+
+static void test_split()
+{
+    ModelTransport t;
+    Master m(t);
+
+    const std::size_t n = 2 * max_burst_words + 5;
+    std::vector<uint32_t> data(n);
+    for (std::size_t i = 0; i < n; i++)
+        data[i] = static_cast<uint32_t>(i * 2654435761u);
+
+    m.write_burst(0x100000, data);
+    CHECK(t.commands == 3);
+    m.sync();
+    CHECK(m.read_burst(0x100000, n) == data);
+    CHECK(t.commands == 7);
+
+    /* Fixed bursts are split too, and keep the address */
+    t.commands = 0;
+    m.write_burst(0x10, data.data(), max_burst_words + 1, true, false);
+    CHECK(t.commands == 2);
+    CHECK(t.mem[0x10] == data[max_burst_words]);
+}
+
+static void test_errors()
+{
+    ModelTransport t;
+    Master m(t);
+    std::vector<uint32_t> data(max_burst_words + 100, 0x5a5a5a5a);
+
+    /* The failed word is counted from the start of the whole burst */
+    t.bad.insert(0x8000 + 4 * (max_burst_words + 10));
+    bool thrown = false;
+    try {
+        m.write_burst(0x8000, data, false, false);
+    } catch (const BusError &e) {
+        thrown = true;
+        CHECK(e.status() == sts_err);
+        CHECK(e.addr() == 0x8000);
+        CHECK(e.words_done() == max_burst_words + 10);
+    }
+    CHECK(thrown);
+    CHECK(t.mem.count(0x8000 + 4 * (max_burst_words + 11)) == 0);
+
+    /* Words read after a failure are zeros */
+    std::vector<uint32_t> v(20, 1);
+    t.bad.insert(0x4010);
+    t.mem[0x400c] = 7;
+    t.mem[0x4014] = 9;
+    thrown = false;
+    try {
+        m.read_burst(0x4000, v.data(), v.size());
+    } catch (const BusError &e) {
+        thrown = true;
+        CHECK(e.status() == sts_err);
+        CHECK(e.words_done() == 4);
+    }
+    CHECK(thrown);
+    CHECK(v[3] == 7 && v[4] == 0 && v[5] == 0);
+    CHECK(t.pending() == 0);
+
+    /* A failed posted write is reported once, by the next response */
+    m.write(0x4010, 1, true);
+    m.write(0x5000, 2, true);
+    thrown = false;
+    try {
+        m.sync();
+    } catch (const BusError &e) {
+        thrown = true;
+        CHECK(e.status() == sts_posted_err);
+    }
+    CHECK(thrown);
+    CHECK(t.mem[0x5000] == 2);
+    m.sync();
+
+    m.write(0x4010, 1, true);
+    thrown = false;
+    try {
+        m.read(0x5000);
+    } catch (const BusError &e) {
+        thrown = true;
+        CHECK(e.status() == sts_posted_err);
+        CHECK(e.words_done() == 1);
+    }
+    CHECK(thrown);
+    CHECK(m.read(0x5000) == 2);
+}
+
+int main()
+{
+    std::mt19937 rng(2026);
+
+    test_roundtrip(rng);
+    test_split();
+    test_errors();
+
+    if (failures) {
+        std::fprintf(stderr, "wb_master_uart_test: %d failures\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("wb_master_uart_test: OK\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,263 @@
+/*
+ * Host-side client for the wb_master_uart binary burst protocol
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#include "wb_master_uart.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace wb_uart {
+
+namespace {
+
+speed_t baud_to_speed(unsigned baud)
+{
+    switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+#ifdef B1000000
+    case 1000000: return B1000000;
+#endif
+#ifdef B2000000
+    case 2000000: return B2000000;
+#endif
+#ifdef B3000000
+    case 3000000: return B3000000;
+#endif
+#ifdef B4000000
+    case 4000000: return B4000000;
+#endif
+    default:
+        throw std::invalid_argument("unsupported baud rate " + std::to_string(baud));
+    }
+}
+
+std::string status_name(uint8_t status)
+{
+    switch (status) {
+    case sts_err: return "bus error";
+    case sts_timeout: return "bus timeout";
+    case sts_posted_err: return "posted write failed";
+    case sts_rx_ovf: return "receive FIFO overflow";
+    default: return "bad status " + std::to_string(status);
+    }
+}
+
+std::string hex_addr(uint32_t addr)
+{
+    char s[11];
+    std::snprintf(s, sizeof(s), "0x%08x", addr);
+    return s;
+}
+
+void put_be(std::vector<uint8_t> &buf, uint32_t v, unsigned nbytes)
+{
+    for (unsigned i = nbytes; i-- > 0;)
+        buf.push_back(static_cast<uint8_t>(v >> (8 * i)));
+}
+
+uint32_t get_be32(const uint8_t *p)
+{
+    return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | p[3];
+}
+
+} /* namespace */
+
+SerialTransport::SerialTransport(const std::string &device, unsigned baud, unsigned timeout_ms) :
+    timeout_ms_(timeout_ms)
+{
+    speed_t speed = baud_to_speed(baud);
+
+    fd_ = ::open(device.c_str(), O_RDWR | O_NOCTTY);
+    if (fd_ < 0)
+        throw std::system_error(errno, std::generic_category(), device);
+
+    struct termios tio;
+    if (tcgetattr(fd_, &tio) < 0) {
+        int err = errno;
+        ::close(fd_);
+        throw std::system_error(err, std::generic_category(), device);
+    }
+
+    cfmakeraw(&tio);
+    tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_iflag &= ~(IXON | IXOFF);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+
+    if (tcsetattr(fd_, TCSANOW, &tio) < 0 || tcflush(fd_, TCIOFLUSH) < 0) {
+        int err = errno;
+        ::close(fd_);
+        throw std::system_error(err, std::generic_category(), device);
+    }
+}
+
+SerialTransport::~SerialTransport()
+{
+    ::close(fd_);
+}
+
+void SerialTransport::write(const uint8_t *buf, std::size_t n)
+{
+    while (n) {
+        ssize_t r = ::write(fd_, buf, n);
+        if (r < 0) {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "UART write");
+        }
+        buf += r;
+        n -= r;
+    }
+}
+
+void SerialTransport::read(uint8_t *buf, std::size_t n)
+{
+    while (n) {
+        struct pollfd pfd = { fd_, POLLIN, 0 };
+        int p = ::poll(&pfd, 1, static_cast<int>(timeout_ms_));
+        if (p < 0) {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "UART poll");
+        }
+        if (p == 0)
+            throw std::runtime_error("UART read timeout");
+
+        ssize_t r = ::read(fd_, buf, n);
+        if (r < 0) {
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "UART read");
+        }
+        buf += r;
+        n -= r;
+    }
+}
+
+BusError::BusError(uint8_t status, uint32_t addr, std::size_t words_done) :
+    std::runtime_error(status_name(status) + " at " + hex_addr(addr) + " after " +
+                       std::to_string(words_done) + " words"),
+    status_(status), addr_(addr), words_done_(words_done)
+{
+}
+
+void Master::send_header(uint8_t op, uint32_t addr, std::size_t n)
+{
+    buf_.clear();
+    buf_.push_back(op);
+    put_be(buf_, addr, 4);
+    put_be(buf_, static_cast<uint32_t>(n - 1), 2);
+}
+
+/* Throws BusError, with words_done relative to the command, unless the
+ * trailer is 'O' */
+void Master::check_trailer(uint32_t addr)
+{
+    uint8_t tr[trailer_bytes];
+    t_.read(tr, sizeof(tr));
+
+    if (tr[0] != sts_ok)
+        throw BusError(tr[0], addr, std::size_t(tr[1]) << 8 | tr[2]);
+}
+
+uint32_t Master::read(uint32_t addr)
+{
+    uint32_t v;
+    read_burst(addr, &v, 1);
+    return v;
+}
+
+void Master::write(uint32_t addr, uint32_t value, bool posted)
+{
+    write_burst(addr, &value, 1, false, posted);
+}
+
+void Master::read_burst(uint32_t addr, uint32_t *dst, std::size_t n, bool fixed)
+{
+    std::vector<uint8_t> rx;
+
+    for (std::size_t ofs = 0; ofs < n;) {
+        std::size_t len = std::min(n - ofs, max_burst_words);
+        uint32_t a = fixed ? addr : addr + static_cast<uint32_t>(4 * ofs);
+
+        send_header(op_write | op_read | (fixed ? op_fixed : 0), a, len);
+        t_.write(buf_.data(), buf_.size());
+
+        rx.resize(4 * len);
+        t_.read(rx.data(), rx.size());
+        for (std::size_t i = 0; i < len; i++)
+            dst[ofs + i] = get_be32(&rx[4 * i]);
+
+        try {
+            check_trailer(a);
+        } catch (const BusError &e) {
+            throw BusError(e.status(), addr, ofs + e.words_done());
+        }
+        ofs += len;
+    }
+}
+
+std::vector<uint32_t> Master::read_burst(uint32_t addr, std::size_t n, bool fixed)
+{
+    std::vector<uint32_t> v(n);
+    read_burst(addr, v.data(), n, fixed);
+    return v;
+}
+
+void Master::write_burst(uint32_t addr, const uint32_t *src, std::size_t n, bool fixed,
+                         bool posted)
+{
+    for (std::size_t ofs = 0; ofs < n;) {
+        std::size_t len = std::min(n - ofs, max_burst_words);
+        uint32_t a = fixed ? addr : addr + static_cast<uint32_t>(4 * ofs);
+
+        send_header(op_write | (fixed ? op_fixed : 0) | (posted ? op_posted : 0), a, len);
+        for (std::size_t i = 0; i < len; i++)
+            put_be(buf_, src[ofs + i], 4);
+        t_.write(buf_.data(), buf_.size());
+
+        if (!posted) {
+            try {
+                check_trailer(a);
+            } catch (const BusError &e) {
+                throw BusError(e.status(), addr, ofs + e.words_done());
+            }
+        }
+        ofs += len;
+    }
+}
+
+void Master::sync()
+{
+    const uint8_t op = op_sync;
+    t_.write(&op, 1);
+    check_trailer(0);
+}
+
+} /* namespace wb_uart */
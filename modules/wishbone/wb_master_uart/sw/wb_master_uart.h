@@ -0,0 +1,126 @@
+/*
+ * Host-side client for the wb_master_uart binary burst protocol
+ *
+ * Accesses the Wishbone bus behind wb_master_uart.vhd with the binary
+ * commands: a burst of up to 65536 words takes a 7-byte header plus 4 bytes
+ * per word, instead of 18 or more characters and a round trip per word with
+ * the text commands.
+ *
+ * Burst writes are posted by default: they are streamed without waiting
+ * for any response, and their errors are reported by the next sync() or
+ * replied command. Single-word writes wait for their acknowledgement by
+ * default, as reads and non-posted bursts do.
+ *
+ * Copyright (c) 2026 CNPEM
+ * Licensed under GNU Lesser General Public License (LGPL) v3.0
+ */
+
+#ifndef WB_MASTER_UART_H
+#define WB_MASTER_UART_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace wb_uart {
+
+/* Binary protocol, see wb_master_uart.vhd */
+constexpr uint8_t op_write = 0xb0;
+constexpr uint8_t op_read = 0x01;
+constexpr uint8_t op_fixed = 0x02;
+constexpr uint8_t op_posted = 0x04;
+constexpr uint8_t op_sync = 0xb8;
+
+constexpr uint8_t sts_ok = 'O';
+constexpr uint8_t sts_err = 'E';
+constexpr uint8_t sts_timeout = 'T';
+constexpr uint8_t sts_posted_err = 'P';
+constexpr uint8_t sts_rx_ovf = 'V';
+
+/* Longest burst of a single command */
+constexpr std::size_t max_burst_words = 65536;
+constexpr std::size_t header_bytes = 7;
+constexpr std::size_t trailer_bytes = 3;
+
+/* Byte stream to the core */
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    virtual void write(const uint8_t *buf, std::size_t n) = 0;
+    /* Reads exactly 'n' bytes. Throws std::runtime_error on timeout */
+    virtual void read(uint8_t *buf, std::size_t n) = 0;
+};
+
+/* POSIX serial port, 8N1 without flow control */
+class SerialTransport : public Transport {
+public:
+    /* Throws std::system_error if the port can't be opened and
+     * std::invalid_argument for a baud rate the OS doesn't support */
+    SerialTransport(const std::string &device, unsigned baud, unsigned timeout_ms = 1000);
+    ~SerialTransport() override;
+
+    SerialTransport(const SerialTransport &) = delete;
+    SerialTransport &operator=(const SerialTransport &) = delete;
+
+    void write(const uint8_t *buf, std::size_t n) override;
+    void read(uint8_t *buf, std::size_t n) override;
+
+private:
+    int fd_ = -1;
+    unsigned timeout_ms_;
+};
+
+/* A command failed. 'words_done' words were accessed before the failure,
+ * counted from the start of the command */
+class BusError : public std::runtime_error {
+public:
+    BusError(uint8_t status, uint32_t addr, std::size_t words_done);
+
+    uint8_t status() const { return status_; }
+    uint32_t addr() const { return addr_; }
+    std::size_t words_done() const { return words_done_; }
+
+private:
+    uint8_t status_;
+    uint32_t addr_;
+    std::size_t words_done_;
+};
+
+class Master {
+public:
+    explicit Master(Transport &t) : t_(t) {}
+
+    uint32_t read(uint32_t addr);
+    /* Waits for the acknowledgement unless 'posted' */
+    void write(uint32_t addr, uint32_t value, bool posted = false);
+
+    /* 'fixed' reads or writes every word at 'addr', e.g. for a FIFO port.
+     * Bursts longer than max_burst_words are split in several commands */
+    void read_burst(uint32_t addr, uint32_t *dst, std::size_t n, bool fixed = false);
+    std::vector<uint32_t> read_burst(uint32_t addr, std::size_t n, bool fixed = false);
+    void write_burst(uint32_t addr, const uint32_t *src, std::size_t n, bool fixed = false,
+                     bool posted = true);
+    void write_burst(uint32_t addr, const std::vector<uint32_t> &src, bool fixed = false,
+                     bool posted = true)
+    {
+        write_burst(addr, src.data(), src.size(), fixed, posted);
+    }
+
+    /* Wait until every posted write has been done. Throws BusError if one
+     * of them failed */
+    void sync();
+
+private:
+    void send_header(uint8_t op, uint32_t addr, std::size_t n);
+    void check_trailer(uint32_t addr);
+
+    Transport &t_;
+    std::vector<uint8_t> buf_;
+};
+
+} /* namespace wb_uart */
+
+#endif
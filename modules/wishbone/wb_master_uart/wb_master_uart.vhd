@@ -23,19 +23,53 @@
 --                - Response: "O\n" (ok), "E\n" if an error occurred or "T\n"
 --                  if an timeout has occurred
 --
+--              - Binary burst access: frames starting with a byte in the
+--                0xB0 - 0xB8 range. All fields are big-endian.
+--                - Command: opcode, address (4 bytes), number of words
+--                  minus 1 (2 bytes) and, for writes, the data words.
+--                  opcode = 0xB0 + 4*P + 2*F + R, where R selects a read,
+--                  F keeps the address fixed (e.g. for FIFO ports) instead
+--                  of incrementing it by 4 after each word, and P posts
+--                  a write: no response is sent. Posted reads are invalid.
+--                  0xB8 (sync) is a lone byte, answered with a trailer.
+--                - Response: reads return every word, the ones following
+--                  a failed access as zeros, then the trailer: status
+--                  ('O', 'E' or 'T') and the number of words accessed
+--                  before the failure (2 bytes). Writes only return the
+--                  trailer. A status 'P' reports that a posted write
+--                  failed since the last trailer, 'V' that received bytes
+--                  were dropped because the RX FIFO was full.
+--                - Example: B0 00001A00 0001 2E000000 11223344 writes two
+--                  words at 0x00001A00 and is answered with 4F 0002.
+--              Commands don't need to wait for the previous response:
+--              received bytes are queued in a 2**g_RX_FIFO_LOG2 bytes FIFO,
+--              which is drained at the UART rate by posted writes and only
+--              after the response has been sent by the other commands.
+--
 --              It doesn't have configurable granularity and address / data
 --              size. It also doesn't support byte access, only word access.
 --
+--              With g_INTERFACE_MODE = PIPELINED, the words of a read
+--              command are requested back to back, holding m_wb_stb_o while
+--              m_wb_stall_i is '1', and the acknowledged words are queued
+--              in a 2**g_RD_FIFO_LOG2 words FIFO until they are sent. A
+--              request is only issued if its word has room in the FIFO, so
+--              m_wb_cyc_o is released while the UART catches up. A burst
+--              of N words then takes N + latency cycles of the bus instead
+--              of N * latency. Writes are issued one at a time, as their
+--              data arrives at the UART rate, but also honor m_wb_stall_i.
+--
 --              Notes:
---              - The m_wb_stall_i signal is ignored because of the surprising
---                behavior of xwb_sdb_crossbar always keeping it at '1' and
---                only changing it to '0' if both m_wb_cyc_o and m_wb_stb_o are
---                set '1'. I don't know if this is compliant with the Wishbone
---                specification, but I had no alternative other than only
---                listen for ack, err and rty signals;
+--              - In CLASSIC mode, the m_wb_stall_i signal is ignored because
+--                of the surprising behavior of xwb_sdb_crossbar always
+--                keeping it at '1' and only changing it to '0' if both
+--                m_wb_cyc_o and m_wb_stb_o are set '1'. I don't know if this
+--                is compliant with the Wishbone specification, but I had no
+--                alternative other than only listen for ack, err and rty
+--                signals;
 --              - An timeout will occurr if no ack, err or rty signals are set
 --                to '1' 255 cyles after setting m_wb_cyc_o and m_wb_stb_o to
---                '1'.
+--                '1', or since the last ack of a pipelined read.
 -------------------------------------------------------------------------------
 -- Copyright (c) 2023 CNPEM
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -55,7 +89,11 @@ use work.wishbone_pkg.all;
 entity wb_master_uart is
   generic (
     g_END_LINE_CHAR:  std_logic_vector(7 downto 0) := x"0A";
-    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC
+    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC;
+    -- log2 of the receive FIFO size, in bytes
+    g_RX_FIFO_LOG2:   natural                      := 6;
+    -- log2 of the read FIFO size, in words (PIPELINED mode only)
+    g_RD_FIFO_LOG2:   natural                      := 4
   );
   port (
     -- Core clock
@@ -94,15 +132,34 @@ architecture arch of wb_master_uart is
     SENDING_WRITE_OK,
     SENDING_ERROR,
     SENDING_TIMEOUT,
-    INVALID_CMD_WAIT_LINEFEED
+    INVALID_CMD_WAIT_LINEFEED,
+    BIN_READING_HEADER,
+    BIN_READING_WRITE_DATA,
+    BIN_WAIT_WRITE_DATA,
+    BIN_WAIT_READ_DATA,
+    BIN_SENDING_READ_DATA,
+    BIN_SENDING_TRAILER
   );
 
+  type t_rx_fifo is array (0 to 2**g_RX_FIFO_LOG2-1) of std_logic_vector(7 downto 0);
+  type t_rd_fifo is array (0 to 2**g_RD_FIFO_LOG2-1) of std_logic_vector(c_wishbone_data_width-1 downto 0);
+
+  -- Binary protocol opcodes and status
+  constant c_BIN_OPCODE:      std_logic_vector(3 downto 0) := x"B";
+  constant c_BIN_SYNC:        std_logic_vector(7 downto 0) := x"B8";
+  constant c_STS_OK:          std_logic_vector(7 downto 0) := x"4F"; -- 'O'
+  constant c_STS_ERR:         std_logic_vector(7 downto 0) := x"45"; -- 'E'
+  constant c_STS_TIMEOUT:     std_logic_vector(7 downto 0) := x"54"; -- 'T'
+  constant c_STS_POSTED_ERR:  std_logic_vector(7 downto 0) := x"50"; -- 'P'
+  constant c_STS_RX_OVF:      std_logic_vector(7 downto 0) := x"56"; -- 'V'
+
   type t_wb_transaction_state is (
     IDLE,
     IDLE_ERR,
     IDLE_TIMEOUT,
     START_READ,
-    START_WRITE
+    START_WRITE,
+    BURST_READ
   );
 
   -- Check if the character is a valid hexadecimal digit
@@ -167,6 +224,37 @@ architecture arch of wb_master_uart is
   signal wb_data:       std_logic_vector(c_wishbone_data_width-1 downto 0) := (others => '0');
   signal wb_addr:       std_logic_vector(c_wishbone_address_width-1 downto 0) := (others => '0');
   signal timeout_cnt:   unsigned(7 downto 0);
+  signal wb_cyc:        std_logic := '0';
+  signal wb_stb:        std_logic := '0';
+  signal single_stb:    std_logic;
+
+  -- Receive FIFO
+  signal rx_fifo:       t_rx_fifo;
+  signal rx_fifo_wr:    unsigned(g_RX_FIFO_LOG2 downto 0) := (others => '0');
+  signal rx_fifo_rd:    unsigned(g_RX_FIFO_LOG2 downto 0) := (others => '0');
+  signal rx_fifo_empty: std_logic;
+  signal rx_fifo_full:  std_logic;
+  signal rx_ovf:        std_logic := '0';
+  signal rx_byte:       std_logic_vector(7 downto 0);
+  signal rx_byte_rd:    std_logic;
+
+  -- Binary protocol
+  signal bin_read:       std_logic := '0';
+  signal bin_fixed:      std_logic := '0';
+  signal bin_posted:     std_logic := '0';
+  signal bin_word_cnt:   unsigned(15 downto 0) := (others => '0');
+  signal bin_done:       unsigned(15 downto 0) := (others => '0');
+  signal bin_status:     std_logic_vector(7 downto 0) := c_STS_OK;
+  signal bin_posted_err: std_logic := '0';
+
+  -- Pipelined burst reads
+  signal rd_fifo:       t_rd_fifo;
+  signal rd_fifo_wr:    unsigned(g_RD_FIFO_LOG2 downto 0) := (others => '0');
+  signal rd_fifo_rd:    unsigned(g_RD_FIFO_LOG2 downto 0) := (others => '0');
+  signal rd_fifo_empty: std_logic;
+  signal rd_left:       unsigned(16 downto 0) := (others => '0');
+  signal rd_pending:    unsigned(g_RD_FIFO_LOG2 downto 0) := (others => '0');
+  signal rd_fixed:      std_logic := '0';
 begin
     uart_inst: entity work.uart
     port map (
@@ -183,13 +271,40 @@ begin
     );
 
   m_wb_adr_o <= wb_addr;
+  m_wb_cyc_o <= wb_cyc;
+  m_wb_stb_o <= wb_stb;
+
+  -- Strobe of a single access. In PIPELINED mode, it is only held until
+  -- the request is accepted
+  single_stb <= '1' when g_INTERFACE_MODE = CLASSIC or wb_cyc = '0' else
+                wb_stb and m_wb_stall_i;
+
+  rx_fifo_empty <= '1' when rx_fifo_wr = rx_fifo_rd else '0';
+  rx_fifo_full <= '1' when rx_fifo_wr - rx_fifo_rd = 2**g_RX_FIFO_LOG2 else '0';
+  rx_byte <= rx_fifo(to_integer(rx_fifo_rd(g_RX_FIFO_LOG2-1 downto 0)));
+
+  rd_fifo_empty <= '1' when rd_fifo_wr = rd_fifo_rd else '0';
+
+  -- Received bytes are consumed by the states parsing commands
+  with wb_uart_sts select
+    rx_byte_rd <= not rx_fifo_empty when IDLE | READING_READ_ADDR |
+                                         READING_WRITE_ADDR_DATA |
+                                         INVALID_CMD_WAIT_LINEFEED |
+                                         BIN_READING_HEADER |
+                                         BIN_READING_WRITE_DATA,
+                  '0' when others;
 
   process(clk_i)
+    -- Burst read state after the requests accepted in this cycle
+    variable v_accepted: boolean;
+    variable v_left:     unsigned(16 downto 0);
+    variable v_pending:  unsigned(g_RD_FIFO_LOG2 downto 0);
+    variable v_occupied: unsigned(g_RD_FIFO_LOG2+1 downto 0);
   begin
     if rising_edge(clk_i) then
       if rst_n_i = '0' then
-        m_wb_cyc_o <= '0';
-        m_wb_stb_o <= '0';
+        wb_cyc <= '0';
+        wb_stb <= '0';
         m_wb_sel_o <= (others => '0');
         wb_uart_sts <= IDLE;
         wb_trans_sts <= IDLE;
@@ -197,32 +312,56 @@ begin
         timeout_cnt <= (others => '0');
         m_wb_sel_o <= (others => '0');
         word_cnt <= (others => '0');
+        rx_fifo_wr <= (others => '0');
+        rx_fifo_rd <= (others => '0');
+        rx_ovf <= '0';
+        bin_posted_err <= '0';
+        rd_fifo_wr <= (others => '0');
+        rd_fifo_rd <= (others => '0');
+        rd_pending <= (others => '0');
       else
         tx_start <= '0';
 
         -- Command parsing and execution FSM
         case wb_uart_sts is
           when IDLE =>
-            if rx_data_valid = '1' then
-              wb_uart_sts <=
-                READING_READ_ADDR when rx_data = x"52" else -- 'R'
-                READING_WRITE_ADDR_DATA when rx_data = x"57" else -- 'W'
-                SENDING_ERROR when rx_data = g_END_LINE_CHAR else -- '\n'
-                INVALID_CMD_WAIT_LINEFEED;
+            if rx_byte_rd = '1' then
+              if rx_byte(7 downto 4) = c_BIN_OPCODE and rx_byte(3) = '0' and
+                 (rx_byte(2) = '0' or rx_byte(0) = '0') then
+                -- Binary burst command
+                bin_read <= rx_byte(0);
+                bin_fixed <= rx_byte(1);
+                bin_posted <= rx_byte(2);
+                bin_done <= (others => '0');
+                bin_status <= c_STS_OK;
+                char_cnt <= 0;
+                wb_uart_sts <= BIN_READING_HEADER;
+              elsif rx_byte = c_BIN_SYNC then
+                bin_done <= (others => '0');
+                bin_status <= c_STS_OK;
+                char_cnt <= 0;
+                wb_uart_sts <= BIN_SENDING_TRAILER;
+              else
+                wb_uart_sts <=
+                  READING_READ_ADDR when rx_byte = x"52" else -- 'R'
+                  READING_WRITE_ADDR_DATA when rx_byte = x"57" else -- 'W'
+                  SENDING_ERROR when rx_byte = g_END_LINE_CHAR else -- '\n'
+                  INVALID_CMD_WAIT_LINEFEED;
+              end if;
             end if;
           when READING_READ_ADDR =>
-            if rx_data_valid = '1' then
+            if rx_byte_rd = '1' then
               if char_cnt >= 0 and char_cnt <= 7 then
                 -- Read the starting address
                 -- Check if the received character is a valid
                 -- hexadecimal digit
-                if f_check_hex_char(rx_data) then
+                if f_check_hex_char(rx_byte) then
                   char_cnt <= char_cnt + 1;
                   wb_addr((31 - 4*char_cnt)
                              downto
-                             (28 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_data);
+                             (28 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_byte);
                 else
-                  if rx_data = g_END_LINE_CHAR then
+                  if rx_byte = g_END_LINE_CHAR then
                     wb_uart_sts <= SENDING_ERROR;
                   else
                     wb_uart_sts <= INVALID_CMD_WAIT_LINEFEED;
@@ -234,14 +373,14 @@ begin
 
                 -- Check if the received character is a valid
                 -- hexadecimal digit
-                if f_check_hex_char(rx_data) then
+                if f_check_hex_char(rx_byte) then
                   char_cnt <= char_cnt + 1;
                   word_cnt(7 - 4*(char_cnt - 8)
                            downto
-                           4 - 4*(char_cnt - 8)) <= f_hex_char_to_nibble(rx_data);
+                           4 - 4*(char_cnt - 8)) <= f_hex_char_to_nibble(rx_byte);
 
                 else
-                  if rx_data = g_END_LINE_CHAR then
+                  if rx_byte = g_END_LINE_CHAR then
                     wb_uart_sts <= SENDING_ERROR;
                   else
                     wb_uart_sts <= INVALID_CMD_WAIT_LINEFEED;
@@ -250,9 +389,15 @@ begin
               else
                 -- Expects a line feed and start a wishbone read
                 -- sequence, otherwise returns an error
-                if rx_data = g_END_LINE_CHAR then
+                if rx_byte = g_END_LINE_CHAR then
                   wb_uart_sts <= WAIT_READ_DATA;
-                  wb_trans_sts <= START_READ;
+                  if g_INTERFACE_MODE = PIPELINED then
+                    wb_trans_sts <= BURST_READ;
+                    rd_left <= resize(word_cnt, 17) + 1;
+                    rd_fixed <= '0';
+                  else
+                    wb_trans_sts <= START_READ;
+                  end if;
                 else
                   wb_uart_sts <= INVALID_CMD_WAIT_LINEFEED;
                 end if;
@@ -263,7 +408,20 @@ begin
           -- fails, send an error message, if it succeeds, start
           -- sending the read data
           when WAIT_READ_DATA =>
-            if wb_trans_sts = IDLE then
+            if g_INTERFACE_MODE = PIPELINED then
+              -- Words read before a failure are sent before the error
+              if rd_fifo_empty = '0' then
+                wb_data <= rd_fifo(to_integer(rd_fifo_rd(g_RD_FIFO_LOG2-1 downto 0)));
+                rd_fifo_rd <= rd_fifo_rd + 1;
+                wb_uart_sts <= SENDING_READ_DATA;
+              elsif wb_trans_sts = IDLE_ERR then
+                wb_uart_sts <= SENDING_ERROR;
+                wb_trans_sts <= IDLE;
+              elsif wb_trans_sts = IDLE_TIMEOUT then
+                wb_uart_sts <= SENDING_TIMEOUT;
+                wb_trans_sts <= IDLE;
+              end if;
+            elsif wb_trans_sts = IDLE then
               wb_uart_sts <= SENDING_READ_DATA;
             elsif wb_trans_sts = IDLE_ERR then
               wb_uart_sts <= SENDING_ERROR;
@@ -296,42 +454,45 @@ begin
                   char_cnt <= 0;
                 else
                   word_cnt <= word_cnt - 1;
-                  wb_trans_sts <= START_READ;
+                  -- In PIPELINED mode, the words are already being read
+                  if g_INTERFACE_MODE = CLASSIC then
+                    wb_trans_sts <= START_READ;
+                    wb_addr <= std_logic_vector(unsigned(wb_addr) + 4);
+                  end if;
                   wb_uart_sts <= WAIT_READ_DATA;
                   -- Set char_cnt to 1 to avoid sending an 'O' again
                   char_cnt <= 1;
-                  wb_addr <= std_logic_vector(unsigned(wb_addr) + 4);
                 end if;
               end if;
             end if;
 
           when READING_WRITE_ADDR_DATA =>
-            if rx_data_valid = '1' then
+            if rx_byte_rd = '1' then
               if char_cnt >= 0 and char_cnt <= 15 then
                 -- Check if the received character is a valid
                 -- hexadecimal digit
-                if f_check_hex_char(rx_data) then
+                if f_check_hex_char(rx_byte) then
                   char_cnt <= char_cnt + 1;
                   if char_cnt >= 0 and char_cnt <= 7 then
                   -- Read and decode address
                     wb_addr((31 - 4*char_cnt)
                                downto
-                               (28 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_data);
+                               (28 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_byte);
                   else
                   -- Read and decode data
                     m_wb_dat_o((63 - 4*char_cnt)
                                downto
-                               (60 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_data);
+                               (60 - 4*char_cnt)) <= f_hex_char_to_nibble(rx_byte);
                   end if;
                 else
-                  if rx_data = g_END_LINE_CHAR then
+                  if rx_byte = g_END_LINE_CHAR then
                     wb_uart_sts <= SENDING_ERROR;
                   else
                     wb_uart_sts <= INVALID_CMD_WAIT_LINEFEED;
                   end if;
                 end if;
               else
-                if rx_data = g_END_LINE_CHAR then
+                if rx_byte = g_END_LINE_CHAR then
                   wb_uart_sts <= WAIT_WRITE_DATA;
                   wb_trans_sts <= START_WRITE;
                 else
@@ -369,7 +530,7 @@ begin
 
           when INVALID_CMD_WAIT_LINEFEED =>
             -- Wait for a linefeed before sending an error
-            if rx_data_valid = '1' and rx_data = g_END_LINE_CHAR then
+            if rx_byte_rd = '1' and rx_byte = g_END_LINE_CHAR then
               wb_uart_sts <= SENDING_ERROR;
             end if;
 
@@ -402,8 +563,190 @@ begin
                 wb_uart_sts <= IDLE;
               end if;
             end if;
+
+          -- Binary protocol: address, then number of words minus 1
+          when BIN_READING_HEADER =>
+            if rx_byte_rd = '1' then
+              if char_cnt <= 3 then
+                wb_addr((31 - 8*char_cnt)
+                        downto
+                        (24 - 8*char_cnt)) <= rx_byte;
+              else
+                bin_word_cnt((15 - 8*(char_cnt - 4))
+                             downto
+                             (8 - 8*(char_cnt - 4))) <= unsigned(rx_byte);
+              end if;
+
+              if char_cnt = 5 then
+                char_cnt <= 0;
+                if bin_read = '1' then
+                  wb_uart_sts <= BIN_WAIT_READ_DATA;
+                  if g_INTERFACE_MODE = PIPELINED then
+                    wb_trans_sts <= BURST_READ;
+                    rd_left <= resize(bin_word_cnt(15 downto 8) & unsigned(rx_byte), 17) + 1;
+                    rd_fixed <= bin_fixed;
+                  else
+                    wb_trans_sts <= START_READ;
+                  end if;
+                else
+                  wb_uart_sts <= BIN_READING_WRITE_DATA;
+                end if;
+              else
+                char_cnt <= char_cnt + 1;
+              end if;
+            end if;
+
+          -- Once an access has failed, the remaining words are consumed
+          -- without accessing the bus
+          when BIN_READING_WRITE_DATA =>
+            if rx_byte_rd = '1' then
+              m_wb_dat_o((31 - 8*char_cnt)
+                         downto
+                         (24 - 8*char_cnt)) <= rx_byte;
+              if char_cnt = 3 then
+                char_cnt <= 0;
+                wb_uart_sts <= BIN_WAIT_WRITE_DATA;
+                if bin_status = c_STS_OK then
+                  wb_trans_sts <= START_WRITE;
+                end if;
+              else
+                char_cnt <= char_cnt + 1;
+              end if;
+            end if;
+
+          when BIN_WAIT_WRITE_DATA =>
+            if wb_trans_sts = IDLE then
+              if bin_status = c_STS_OK then
+                bin_done <= bin_done + 1;
+              end if;
+
+              if bin_word_cnt = 0 then
+                if bin_posted = '0' then
+                  wb_uart_sts <= BIN_SENDING_TRAILER;
+                else
+                  if bin_status /= c_STS_OK then
+                    bin_posted_err <= '1';
+                  end if;
+                  wb_uart_sts <= IDLE;
+                end if;
+              else
+                bin_word_cnt <= bin_word_cnt - 1;
+                if bin_fixed = '0' then
+                  wb_addr <= std_logic_vector(unsigned(wb_addr) + 4);
+                end if;
+                wb_uart_sts <= BIN_READING_WRITE_DATA;
+              end if;
+            elsif wb_trans_sts = IDLE_ERR then
+              bin_status <= c_STS_ERR;
+              wb_trans_sts <= IDLE;
+            elsif wb_trans_sts = IDLE_TIMEOUT then
+              bin_status <= c_STS_TIMEOUT;
+              wb_trans_sts <= IDLE;
+            end if;
+
+          when BIN_WAIT_READ_DATA =>
+            if g_INTERFACE_MODE = PIPELINED then
+              if bin_status /= c_STS_OK then
+                -- Zeros after a failure
+                wb_uart_sts <= BIN_SENDING_READ_DATA;
+              elsif rd_fifo_empty = '0' then
+                wb_data <= rd_fifo(to_integer(rd_fifo_rd(g_RD_FIFO_LOG2-1 downto 0)));
+                rd_fifo_rd <= rd_fifo_rd + 1;
+                bin_done <= bin_done + 1;
+                wb_uart_sts <= BIN_SENDING_READ_DATA;
+              elsif wb_trans_sts = IDLE_ERR then
+                bin_status <= c_STS_ERR;
+                wb_data <= (others => '0');
+                wb_trans_sts <= IDLE;
+              elsif wb_trans_sts = IDLE_TIMEOUT then
+                bin_status <= c_STS_TIMEOUT;
+                wb_data <= (others => '0');
+                wb_trans_sts <= IDLE;
+              end if;
+            elsif wb_trans_sts = IDLE then
+              if bin_status = c_STS_OK then
+                bin_done <= bin_done + 1;
+              end if;
+              wb_uart_sts <= BIN_SENDING_READ_DATA;
+            elsif wb_trans_sts = IDLE_ERR then
+              bin_status <= c_STS_ERR;
+              wb_data <= (others => '0');
+              wb_trans_sts <= IDLE;
+            elsif wb_trans_sts = IDLE_TIMEOUT then
+              bin_status <= c_STS_TIMEOUT;
+              wb_data <= (others => '0');
+              wb_trans_sts <= IDLE;
+            end if;
+
+          -- The next word is read while the last byte is being sent
+          when BIN_SENDING_READ_DATA =>
+            if tx_busy = '0' then
+              tx_data <= wb_data((31 - 8*char_cnt)
+                                 downto
+                                 (24 - 8*char_cnt));
+              tx_start <= '1';
+              if char_cnt = 3 then
+                char_cnt <= 0;
+                if bin_word_cnt = 0 then
+                  wb_uart_sts <= BIN_SENDING_TRAILER;
+                else
+                  bin_word_cnt <= bin_word_cnt - 1;
+                  wb_uart_sts <= BIN_WAIT_READ_DATA;
+                  if g_INTERFACE_MODE = CLASSIC then
+                    if bin_fixed = '0' then
+                      wb_addr <= std_logic_vector(unsigned(wb_addr) + 4);
+                    end if;
+                    if bin_status = c_STS_OK then
+                      wb_trans_sts <= START_READ;
+                    end if;
+                  end if;
+                end if;
+              else
+                char_cnt <= char_cnt + 1;
+              end if;
+            end if;
+
+          -- Send the status and the number of words accessed
+          when BIN_SENDING_TRAILER =>
+            if tx_busy = '0' then
+              tx_start <= '1';
+              if char_cnt = 0 then
+                if bin_status /= c_STS_OK then
+                  tx_data <= bin_status;
+                elsif rx_ovf = '1' then
+                  tx_data <= c_STS_RX_OVF;
+                  rx_ovf <= '0';
+                elsif bin_posted_err = '1' then
+                  tx_data <= c_STS_POSTED_ERR;
+                  bin_posted_err <= '0';
+                else
+                  tx_data <= c_STS_OK;
+                end if;
+                char_cnt <= 1;
+              elsif char_cnt = 1 then
+                tx_data <= std_logic_vector(bin_done(15 downto 8));
+                char_cnt <= 2;
+              else
+                tx_data <= std_logic_vector(bin_done(7 downto 0));
+                char_cnt <= 0;
+                wb_uart_sts <= IDLE;
+              end if;
+            end if;
         end case;
 
+        -- Receive FIFO
+        if rx_byte_rd = '1' then
+          rx_fifo_rd <= rx_fifo_rd + 1;
+        end if;
+        if rx_data_valid = '1' then
+          if rx_fifo_full = '1' then
+            rx_ovf <= '1';
+          else
+            rx_fifo(to_integer(rx_fifo_wr(g_RX_FIFO_LOG2-1 downto 0))) <= rx_data;
+            rx_fifo_wr <= rx_fifo_wr + 1;
+          end if;
+        end if;
+
         -- Wishbone transaction FSM
         case wb_trans_sts is
           -- Do nothing while idle, wb_trans_sts should be set to
@@ -415,19 +758,19 @@ begin
 
           when START_READ =>
             -- Start a data read transaction
-            m_wb_cyc_o <= '1';
-            m_wb_stb_o <= '1';
+            wb_cyc <= '1';
+            wb_stb <= single_stb;
             m_wb_sel_o <= (others => '1');
             if m_wb_ack_i = '1' then
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE;
               wb_data <= m_wb_dat_i;
               timeout_cnt <= (others => '0');
             elsif m_wb_err_i = '1' or m_wb_rty_i = '1' then
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE_ERR;
               timeout_cnt <= (others => '0');
@@ -435,8 +778,8 @@ begin
               -- If 255 cycles has passed without an response (error,
               -- retry or ack), abort the transaction and go to the
               -- IDLE_TIMEOUT state
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE_TIMEOUT;
               timeout_cnt <= (others => '0');
@@ -446,20 +789,20 @@ begin
 
           when START_WRITE =>
             -- Start a data write transaction
-            m_wb_cyc_o <= '1';
-            m_wb_stb_o <= '1';
+            wb_cyc <= '1';
+            wb_stb <= single_stb;
             m_wb_we_o <= '1';
             m_wb_sel_o <= (others => '1');
             if m_wb_ack_i = '1' then
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_we_o <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE;
               timeout_cnt <= (others => '0');
             elsif m_wb_err_i = '1' or m_wb_rty_i = '1' then
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_we_o <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE_ERR;
@@ -468,8 +811,8 @@ begin
               -- If 255 cycles has passed without an response (error,
               -- retry or ack), abort the transaction and go to the
               -- IDLE_TIMEOUT state
-              m_wb_cyc_o <= '0';
-              m_wb_stb_o <= '0';
+              wb_cyc <= '0';
+              wb_stb <= '0';
               m_wb_we_o <= '0';
               m_wb_sel_o <= (others => '0');
               wb_trans_sts <= IDLE_TIMEOUT;
@@ -477,6 +820,66 @@ begin
             else
               timeout_cnt <= timeout_cnt + 1;
             end if;
+
+          -- Pipelined burst read: the next word is requested while
+          -- the read FIFO has room for it and for every outstanding
+          -- word. m_wb_cyc_o is released when nothing is outstanding
+          when BURST_READ =>
+            v_accepted := wb_stb = '1' and m_wb_stall_i = '0';
+            v_left := rd_left;
+            v_pending := rd_pending;
+            if v_accepted then
+              v_left := v_left - 1;
+              v_pending := v_pending + 1;
+              if rd_fixed = '0' then
+                wb_addr <= std_logic_vector(unsigned(wb_addr) + 4);
+              end if;
+            end if;
+            v_occupied := resize(rd_fifo_wr - rd_fifo_rd, g_RD_FIFO_LOG2+2) +
+                          resize(v_pending, g_RD_FIFO_LOG2+2);
+
+            if m_wb_ack_i = '1' then
+              rd_fifo(to_integer(rd_fifo_wr(g_RD_FIFO_LOG2-1 downto 0))) <= m_wb_dat_i;
+              rd_fifo_wr <= rd_fifo_wr + 1;
+              v_pending := v_pending - 1;
+            end if;
+
+            if m_wb_err_i = '1' or m_wb_rty_i = '1' or
+               (m_wb_ack_i = '0' and timeout_cnt = to_unsigned(255, 8)) then
+              -- Abort, outstanding words are dropped
+              wb_cyc <= '0';
+              wb_stb <= '0';
+              m_wb_sel_o <= (others => '0');
+              rd_pending <= (others => '0');
+              wb_trans_sts <= IDLE_ERR when m_wb_err_i = '1' or m_wb_rty_i = '1' else
+                              IDLE_TIMEOUT;
+              timeout_cnt <= (others => '0');
+            elsif v_left = 0 and v_pending = 0 then
+              wb_cyc <= '0';
+              wb_stb <= '0';
+              m_wb_sel_o <= (others => '0');
+              rd_left <= v_left;
+              rd_pending <= v_pending;
+              wb_trans_sts <= IDLE;
+              timeout_cnt <= (others => '0');
+            else
+              if v_left /= 0 and v_occupied < 2**g_RD_FIFO_LOG2 then
+                wb_stb <= '1';
+                wb_cyc <= '1';
+              else
+                wb_stb <= '0';
+                wb_cyc <= '1' when v_pending /= 0 else '0';
+              end if;
+              m_wb_sel_o <= (others => '1');
+              rd_left <= v_left;
+              rd_pending <= v_pending;
+              -- Only count while waiting for the bus
+              if m_wb_ack_i = '1' or (wb_stb = '0' and rd_pending = 0) then
+                timeout_cnt <= (others => '0');
+              else
+                timeout_cnt <= timeout_cnt + 1;
+              end if;
+            end if;
         end case;
       end if;
     end if;
@@ -27,7 +27,11 @@ use work.ifc_wishbone_pkg.all;
 entity xwb_master_uart is
   generic (
     g_END_LINE_CHAR:  std_logic_vector(7 downto 0) := x"0A";
-    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC
+    g_INTERFACE_MODE: t_wishbone_interface_mode    := CLASSIC;
+    -- log2 of the receive FIFO size, in bytes
+    g_RX_FIFO_LOG2:   natural                      := 6;
+    -- log2 of the read FIFO size, in words (PIPELINED mode only)
+    g_RD_FIFO_LOG2:   natural                      := 4
   );
   port (
     -- Core clock
@@ -51,7 +55,9 @@ begin
   cmp_wb_master_uart: wb_master_uart
     generic map (
       g_END_LINE_CHAR  => g_END_LINE_CHAR,
-      g_INTERFACE_MODE => g_INTERFACE_MODE
+      g_INTERFACE_MODE => g_INTERFACE_MODE,
+      g_RX_FIFO_LOG2   => g_RX_FIFO_LOG2,
+      g_RD_FIFO_LOG2   => g_RD_FIFO_LOG2
     )
     port map (
       clk_i        => clk_i,
@@ -6,6 +6,9 @@ library work;
 
 package pcie_cntr_axi_pkg is
 
+  -- User interrupt requests (C_NUM_OF_USR_IRQ of pcie_cntr)
+  constant c_pcie_usr_irq_width              : natural := 8;
+
   -- AXIMM constants
   constant c_aximm_id_width                  : natural := 4;
   constant c_aximm_addr_width                : natural := 32;
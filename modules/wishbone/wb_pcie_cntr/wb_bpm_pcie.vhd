@@ -118,6 +118,8 @@ port (
   wb_ma_rty_i                               : in  std_logic                                             := '0';
   wb_ma_ack_i                               : in  std_logic                                             := '0';
   wb_ma_stall_i                             : in  std_logic                                             := '0';
+  -- User interrupt requests, level sensitive
+  usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
   -- Additional exported signals for instantiation
   wb_ma_pcie_rst_o                          : out std_logic;
   pcie_clk_o                                : out std_logic;
@@ -221,6 +223,8 @@ begin
     wb_ma_rty_i                               => wb_ma_rty_i,
     wb_ma_ack_i                               => wb_ma_ack_i,
     wb_ma_stall_i                             => wb_ma_stall_i,
+    -- User interrupt requests
+    usr_irq_req_i                             => usr_irq_req_i,
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                          => wb_ma_pcie_rst_o,
     pcie_clk_o                                => pcie_clk_o,
@@ -118,6 +118,8 @@ port (
   wb_ma_rty_i                               : in  std_logic                                             := '0';
   wb_ma_ack_i                               : in  std_logic                                             := '0';
   wb_ma_stall_i                             : in  std_logic                                             := '0';
+  -- User interrupt requests, level sensitive
+  usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
   -- Additional exported signals for instantiation
   wb_ma_pcie_rst_o                          : out std_logic;
   pcie_clk_o                                : out std_logic;
@@ -232,6 +234,7 @@ architecture rtl of wb_pcie_cntr is
     SEL_O : out std_logic;
     CYC_O : out std_logic;
     --/ Wishbone interface
+    usr_irq_req_i : in std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
     -- Additional exported signals for instantiation
     pcie_user_clk : out std_logic;
     ext_rst_o : out std_logic;
@@ -329,6 +332,8 @@ begin
     stb_o                                   => wb_ma_pcie_stb_out,
     sel_o                                   => wb_ma_pcie_sel_out,
     cyc_o                                   => wb_ma_pcie_cyc_out,
+    -- User interrupt requests
+    usr_irq_req_i                           => usr_irq_req_i,
     -- Additional exported signals for instantiation
     ext_rst_o                               => wb_ma_pcie_rst_o,
     pcie_user_clk                           => pcie_clk_o,
@@ -79,6 +79,8 @@ port (
   wb_ma_i                                   : in  t_wishbone_master_in := cc_dummy_slave_out;
   wb_ma_o                                   : out t_wishbone_master_out;
 
+  -- User interrupt requests, level sensitive
+  usr_irq_req_i                             : in  std_logic_vector(c_pcie_usr_irq_width-1 downto 0) := (others => '0');
   -- Additional exported signals for instantiation
   wb_ma_pcie_rst_o                          : out std_logic;
   pcie_clk_o                                : out std_logic;
@@ -182,6 +184,8 @@ begin
     wb_ma_rty_i                              => wb_ma_i.rty,
     wb_ma_ack_i                              => wb_ma_i.ack,
     wb_ma_stall_i                            => wb_ma_i.stall,
+    -- User interrupt requests
+    usr_irq_req_i                            => usr_irq_req_i,
     -- Additional exported signals for instantiation
     wb_ma_pcie_rst_o                         => wb_ma_pcie_rst_o,
     pcie_clk_o                               => pcie_clk_o,
@@ -1,5 +1,7 @@
 files = [
 	"wb_trigger_iface.vhd",
     "xwb_trigger_iface.vhd",
+    "trigger_evt_log.vhd",
+    "trigger_cnt_snap.vhd",
   	"wbgen/wb_trigger_iface_regs.vhd",
 	"wbgen/wb_trigger_iface_regs_pkg.vhd"];
@@ -0,0 +1,330 @@
+-------------------------------------------------------------------------------
+-- Title      : Trigger counters with snapshot
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : trigger_cnt_snap.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   :
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Wide received and transmitted pulse counters of
+--              wb_trigger_iface, latched all at once by a snapshot strobe
+--              into a contiguous block that can be read with one Wishbone
+--              burst.
+--
+--              The snapshot is taken on a write of CTL bit 0 or on a
+--              snap_i pulse, in the ref_clk_i cycle it arrives, together
+--              with a timestamp (ref_clk_i cycles since ref_rst_n_i) and a
+--              snapshot sequence number. STA bit 0 is set from a CTL write
+--              until its snapshot is taken.
+--
+--              A snapshot is first latched into a shadow bank and copied to
+--              the readable bank only while no burst holds it: the first
+--              access to the snapshot data in a Wishbone cycle locks the
+--              readable bank (stalling until ref_clk_i acknowledges the
+--              lock), and dropping cyc releases it. A snapshot taken during
+--              a burst thus shows up after it, with its own timestamp, and
+--              a burst never mixes two snapshots. Of several snapshots taken
+--              during one burst only the last one is kept; the sequence
+--              number tells.
+--
+--              Register map (word addresses, see trigger_cnt_snap_regs.h):
+--                0x00 CTL   bit 0: take a snapshot (self-clearing)
+--                0x01 STA   bit 0: busy, bits 23-16: counter width
+--                0x40       sequence number
+--                0x41       reserved
+--                0x42-0x43  timestamp
+--                0x44+4*ch  received count, words 0-1, transmitted count,
+--                           words 2-3 (64 bits each, zero-extended)
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+-- Main Wishbone Definitions
+use work.wishbone_pkg.all;
+-- General common cores
+use work.gencores_pkg.all;
+
+entity trigger_cnt_snap is
+  generic (
+    g_trig_num    : natural range 1 to 24  := 8;
+    g_count_width : natural range 16 to 64 := 48
+    );
+
+  port (
+    clk_i   : in std_logic;
+    rst_n_i : in std_logic;
+
+    ref_clk_i   : in std_logic;
+    ref_rst_n_i : in std_logic;
+
+    -------------------------------
+    ---- Trigger pulses and counter resets (ref_clk_i)
+    -------------------------------
+
+    rcv_i                : in std_logic_vector(g_trig_num-1 downto 0);
+    transm_i             : in std_logic_vector(g_trig_num-1 downto 0);
+    rcv_count_rst_n_i    : in std_logic_vector(g_trig_num-1 downto 0);
+    transm_count_rst_n_i : in std_logic_vector(g_trig_num-1 downto 0);
+
+    -- Snapshot strobe (ref_clk_i)
+    snap_i : in std_logic := '0';
+
+    -- Live counts, channel i at bits (i+1)*g_count_width-1 downto
+    -- i*g_count_width (ref_clk_i)
+    rcv_count_o    : out std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+    transm_count_o : out std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+
+    -------------------------------
+    ---- Wishbone (pipelined, word addresses)
+    -------------------------------
+
+    wb_slv_i : in  t_wishbone_slave_in;
+    wb_slv_o : out t_wishbone_slave_out
+    );
+
+end entity trigger_cnt_snap;
+
+architecture rtl of trigger_cnt_snap is
+
+  constant c_ctl_adr  : natural := 16#00#;
+  constant c_sta_adr  : natural := 16#01#;
+  constant c_seq_adr  : natural := 16#40#;
+  constant c_ts_adr   : natural := 16#42#;
+  constant c_cnts_adr : natural := 16#44#;
+
+  type t_count_array is array (natural range <>) of unsigned(g_count_width-1 downto 0);
+
+  -----------
+  --Signals--
+  -----------
+
+  -- ref_clk_i domain
+  signal rcv_count     : t_count_array(g_trig_num-1 downto 0);
+  signal transm_count  : t_count_array(g_trig_num-1 downto 0);
+  signal ts            : unsigned(63 downto 0);
+  signal snap_req_ref  : std_logic;
+  signal snap_done_ref : std_logic;
+  signal lock_ref      : std_logic;
+
+  -- Last snapshot taken, not yet copied to the readable bank
+  signal rcv_shadow    : t_count_array(g_trig_num-1 downto 0);
+  signal transm_shadow : t_count_array(g_trig_num-1 downto 0);
+  signal ts_shadow     : unsigned(63 downto 0);
+  signal seq_shadow    : unsigned(31 downto 0);
+  signal shadow_valid  : std_logic;
+  signal shadow_req    : std_logic;
+
+  -- Read from clk_i, static while lock_ref is set
+  signal rcv_snap      : t_count_array(g_trig_num-1 downto 0);
+  signal transm_snap   : t_count_array(g_trig_num-1 downto 0);
+  signal ts_snap       : unsigned(63 downto 0);
+  signal seq_snap      : unsigned(31 downto 0);
+
+  -- clk_i domain
+  signal snap_req      : std_logic;
+  signal snap_done     : std_logic;
+  signal snap_busy     : std_logic;
+  signal rd_lock       : std_logic;
+  signal lock_ack      : std_logic;
+  signal wb_data_acc   : std_logic;
+  signal wb_stall      : std_logic;
+  signal wb_ack        : std_logic;
+  signal wb_dat        : std_logic_vector(c_wishbone_data_width-1 downto 0);
+
+begin  -- architecture rtl
+
+  -----------------------------
+  -- Counters and snapshot (ref_clk_i)
+  -----------------------------
+
+  p_count : process(ref_clk_i)
+  begin
+    if rising_edge(ref_clk_i) then
+      for i in 0 to g_trig_num-1 loop
+        if rcv_count_rst_n_i(i) = '0' then
+          rcv_count(i) <= (others => '0');
+        elsif rcv_i(i) = '1' then
+          rcv_count(i) <= rcv_count(i) + 1;
+        end if;
+
+        if transm_count_rst_n_i(i) = '0' then
+          transm_count(i) <= (others => '0');
+        elsif transm_i(i) = '1' then
+          transm_count(i) <= transm_count(i) + 1;
+        end if;
+      end loop;
+    end if;
+  end process;
+
+  gen_count_out : for i in 0 to g_trig_num-1 generate
+    rcv_count_o((i+1)*g_count_width-1 downto i*g_count_width)    <= std_logic_vector(rcv_count(i));
+    transm_count_o((i+1)*g_count_width-1 downto i*g_count_width) <= std_logic_vector(transm_count(i));
+  end generate;
+
+  p_snap : process(ref_clk_i)
+  begin
+    if rising_edge(ref_clk_i) then
+      if ref_rst_n_i = '0' then
+        ts            <= (others => '0');
+        seq_shadow    <= (others => '0');
+        seq_snap      <= (others => '0');
+        shadow_valid  <= '0';
+        shadow_req    <= '0';
+        snap_done_ref <= '0';
+      else
+        ts            <= ts + 1;
+        snap_done_ref <= '0';
+
+        -- Publish the shadow bank while clk_i doesn't hold the lock. STA
+        -- busy only clears once the requested snapshot can be read
+        if lock_ref = '0' and shadow_valid = '1' then
+          rcv_snap      <= rcv_shadow;
+          transm_snap   <= transm_shadow;
+          ts_snap       <= ts_shadow;
+          seq_snap      <= seq_shadow;
+          shadow_valid  <= '0';
+          shadow_req    <= '0';
+          snap_done_ref <= shadow_req;
+        end if;
+
+        if snap_i = '1' or snap_req_ref = '1' then
+          rcv_shadow    <= rcv_count;
+          transm_shadow <= transm_count;
+          ts_shadow     <= ts;
+          seq_shadow    <= seq_shadow + 1;
+          shadow_valid  <= '1';
+        end if;
+        if snap_req_ref = '1' then
+          shadow_req    <= '1';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  cmp_snap_req_sync : gc_pulse_synchronizer
+    port map (
+      clk_in_i  => clk_i,
+      rst_n_i   => rst_n_i,
+      clk_out_i => ref_clk_i,
+      d_ready_o => open,
+      d_p_i     => snap_req,
+      q_p_o     => snap_req_ref);
+
+  cmp_snap_done_sync : gc_pulse_synchronizer
+    port map (
+      clk_in_i  => ref_clk_i,
+      rst_n_i   => rst_n_i,
+      clk_out_i => clk_i,
+      d_ready_o => open,
+      d_p_i     => snap_done_ref,
+      q_p_o     => snap_done);
+
+  -- Four-phase lock handshake: rd_lock is only set again once lock_ack
+  -- shows it was released, so ref_clk_i always gets a chance to publish
+  -- between two bursts
+  cmp_lock_sync : gc_sync_ffs
+    port map (
+      clk_i    => ref_clk_i,
+      rst_n_i  => ref_rst_n_i,
+      data_i   => rd_lock,
+      synced_o => lock_ref);
+
+  cmp_lock_ack_sync : gc_sync_ffs
+    port map (
+      clk_i    => clk_i,
+      rst_n_i  => rst_n_i,
+      data_i   => lock_ref,
+      synced_o => lock_ack);
+
+  -----------------------------
+  -- Wishbone (clk_i)
+  -----------------------------
+
+  -- Snapshot data accesses wait for the lock, CTL and STA don't
+  wb_data_acc <= wb_slv_i.cyc and wb_slv_i.stb when
+                 unsigned(wb_slv_i.adr(7 downto 0)) >= c_seq_adr else '0';
+  wb_stall    <= wb_data_acc and not (rd_lock and lock_ack);
+
+  p_wb : process(clk_i)
+    variable v_adr : natural range 0 to 255;
+    variable v_ch  : natural range 0 to 63;
+    variable v_cnt : unsigned(63 downto 0);
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        snap_req  <= '0';
+        snap_busy <= '0';
+        rd_lock   <= '0';
+        wb_ack    <= '0';
+      else
+        snap_req <= '0';
+        wb_ack   <= '0';
+
+        if snap_done = '1' then
+          snap_busy <= '0';
+        end if;
+
+        if wb_slv_i.cyc = '0' then
+          rd_lock <= '0';
+        elsif wb_data_acc = '1' and rd_lock = '0' and lock_ack = '0' then
+          rd_lock <= '1';
+        end if;
+
+        if wb_slv_i.cyc = '1' and wb_slv_i.stb = '1' and wb_stall = '0' then
+          wb_ack <= '1';
+          wb_dat <= (others => '0');
+
+          v_adr := to_integer(unsigned(wb_slv_i.adr(7 downto 0)));
+          if v_adr >= c_cnts_adr then
+            v_ch := (v_adr - c_cnts_adr) / 4;
+          else
+            v_ch := 0;
+          end if;
+
+          if v_adr = c_ctl_adr then
+            -- A request in flight is not repeated
+            if wb_slv_i.we = '1' and wb_slv_i.sel(0) = '1' and
+               wb_slv_i.dat(0) = '1' and snap_busy = '0' then
+              snap_req  <= '1';
+              snap_busy <= '1';
+            end if;
+          elsif v_adr = c_sta_adr then
+            wb_dat(0)            <= snap_busy;
+            wb_dat(23 downto 16) <= std_logic_vector(to_unsigned(g_count_width, 8));
+          elsif v_adr = c_seq_adr then
+            wb_dat <= std_logic_vector(seq_snap);
+          elsif v_adr = c_ts_adr then
+            wb_dat <= std_logic_vector(ts_snap(31 downto 0));
+          elsif v_adr = c_ts_adr+1 then
+            wb_dat <= std_logic_vector(ts_snap(63 downto 32));
+          elsif v_adr >= c_cnts_adr and v_ch < g_trig_num then
+            if v_adr mod 4 < 2 then
+              v_cnt := resize(rcv_snap(v_ch), 64);
+            else
+              v_cnt := resize(transm_snap(v_ch), 64);
+            end if;
+            if v_adr mod 2 = 0 then
+              wb_dat <= std_logic_vector(v_cnt(31 downto 0));
+            else
+              wb_dat <= std_logic_vector(v_cnt(63 downto 32));
+            end if;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  wb_slv_o.ack   <= wb_ack;
+  wb_slv_o.dat   <= wb_dat;
+  wb_slv_o.stall <= wb_stall;
+  wb_slv_o.err   <= '0';
+  wb_slv_o.rty   <= '0';
+
+end architecture rtl;
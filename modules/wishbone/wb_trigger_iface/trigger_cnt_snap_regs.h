@@ -0,0 +1,69 @@
+/*
+  Register definitions for the trigger counter snapshot of wb_trigger_iface
+
+  The snapshot block sits at TRIGGER_CNT_SNAP_BASE within the
+  wb_trigger_iface window. Offsets below are relative to
+  TRIGGER_CNT_SNAP_BASE.
+
+  Writing TRIGGER_CNT_SNAP_CTL_SNAP latches every counter at once; once
+  TRIGGER_CNT_SNAP_STA_BUSY clears, the whole snapshot is read with one
+  block read of struct trigger_cnt_snap_data. Snapshots are also taken by
+  the cnt_snap_i strobe of the core. The data doesn't change within a
+  block read: a snapshot taken meanwhile shows up once the read ends, so
+  keep the whole struct in one bus cycle and compare seq to tell a newer
+  snapshot from the one read before.
+*/
+
+#ifndef __TRIGGER_CNT_SNAP_REGS_H__
+#define __TRIGGER_CNT_SNAP_REGS_H__
+
+#include <stdint.h>
+
+#define TRIGGER_CNT_SNAP_BASE 0x400UL
+
+/* Control register */
+#define TRIGGER_CNT_SNAP_CTL 0x0UL
+#define TRIGGER_CNT_SNAP_CTL_SNAP 0x1UL
+
+/* Status register */
+#define TRIGGER_CNT_SNAP_STA 0x4UL
+#define TRIGGER_CNT_SNAP_STA_BUSY 0x1UL
+#define TRIGGER_CNT_SNAP_STA_WIDTH_MASK 0xff0000UL
+#define TRIGGER_CNT_SNAP_STA_WIDTH_SHIFT 16
+
+/* Snapshot data */
+#define TRIGGER_CNT_SNAP_DATA 0x100UL
+#define TRIGGER_CNT_SNAP_NUM_CHANNELS 24
+
+#ifndef __ASSEMBLER__
+/* Counts of one channel, on a little-endian host */
+struct trigger_cnt_snap_ch {
+  uint64_t rcv;
+  uint64_t transm;
+};
+
+/* The snapshot as read from TRIGGER_CNT_SNAP_DATA. ts counts the trigger
+   reference clock cycles since its reset, as the trigger event log does */
+struct trigger_cnt_snap_data {
+  uint32_t seq;
+  uint32_t reserved;
+  uint64_t ts;
+  struct trigger_cnt_snap_ch ch[TRIGGER_CNT_SNAP_NUM_CHANNELS];
+};
+
+struct trigger_cnt_snap_regs {
+  /* [0x0]: REG (wo) Control register */
+  uint32_t ctl;
+
+  /* [0x4]: REG (ro) Status register */
+  uint32_t sta;
+
+  /* padding to: 64 words */
+  uint32_t __padding_0[62];
+
+  /* [0x100]: Snapshot data */
+  struct trigger_cnt_snap_data data;
+};
+#endif /* !__ASSEMBLER__*/
+
+#endif /* __TRIGGER_CNT_SNAP_REGS_H__ */
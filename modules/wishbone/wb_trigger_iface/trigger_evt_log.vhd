@@ -0,0 +1,395 @@
+-------------------------------------------------------------------------------
+-- Title      : Trigger event log
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : trigger_evt_log.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   :
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Logs every received and transmitted trigger pulse of
+--              wb_trigger_iface into a FIFO, as {channel, direction,
+--              64-bit timestamp} entries, to be drained over Wishbone.
+--
+--              The timestamp counts ref_clk_i cycles since ref_rst_n_i, and
+--              that is its resolution: the pulses come from wb_trigger_iface
+--              already in ref_clk_i, with no sub-cycle phase to log
+--              (trigger_io has one, trig_rx_ts_fine_o, but wb_trigger_iface
+--              doesn't use it). Word 1 of the entries is reserved for it.
+--
+--              The pulses of a cycle go into a small capture FIFO as a whole
+--              and are split into one entry per pulse on the way to the main
+--              FIFO. If the capture FIFO is full, the pulses are counted as
+--              lost and a marker entry with the count takes their place in
+--              the log, so gaps can't go unnoticed.
+--
+--              Register map (word addresses, see trigger_evt_log_regs.h):
+--                0x00 CTL   bit 0: enable
+--                0x01 STA   bits 15-0: entries, bit 31: not empty
+--                0x40-0x7f  entry window: word 0 info (bit 31 valid, bit 30
+--                           lost marker, bit 8 direction, bits 7-0 channel),
+--                           word 1 reserved, words 2-3 timestamp (lost count
+--                           for markers). Reading word 3 pops the entry, so
+--                           a block read over the window drains 16 entries.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+-- Main Wishbone Definitions
+use work.wishbone_pkg.all;
+-- FIFOs and f_log2_size
+use work.genram_pkg.all;
+-- General common cores
+use work.gencores_pkg.all;
+
+entity trigger_evt_log is
+  generic (
+    g_trig_num : natural range 1 to 24 := 8;
+    -- Entries of the main FIFO
+    g_size     : natural               := 512
+    );
+
+  port (
+    clk_i   : in std_logic;
+    rst_n_i : in std_logic;
+
+    ref_clk_i   : in std_logic;
+    ref_rst_n_i : in std_logic;
+
+    -------------------------------
+    ---- Trigger pulses (ref_clk_i)
+    -------------------------------
+
+    rcv_i    : in std_logic_vector(g_trig_num-1 downto 0);
+    transm_i : in std_logic_vector(g_trig_num-1 downto 0);
+
+    -------------------------------
+    ---- Wishbone (pipelined, word addresses)
+    -------------------------------
+
+    wb_slv_i : in  t_wishbone_slave_in;
+    wb_slv_o : out t_wishbone_slave_out
+    );
+
+end entity trigger_evt_log;
+
+architecture rtl of trigger_evt_log is
+
+  constant c_capture_size : natural := 16;
+
+  -- Capture word: marker & transm & rcv & timestamp
+  constant c_capture_width : natural := 1 + 2*g_trig_num + 64;
+  -- Entry: marker & direction & channel & timestamp
+  constant c_entry_width   : natural := 1 + 1 + 8 + 64;
+
+  constant c_no_evts : std_logic_vector(2*g_trig_num-1 downto 0) := (others => '0');
+
+  constant c_ctl_adr : natural := 0;
+  constant c_sta_adr : natural := 1;
+
+  function f_count_ones(v : std_logic_vector) return natural is
+    variable v_count : natural := 0;
+  begin
+    for i in v'range loop
+      if v(i) = '1' then
+        v_count := v_count + 1;
+      end if;
+    end loop;
+    return v_count;
+  end function;
+
+  function f_add_sat(a : unsigned(31 downto 0); b : natural) return unsigned is
+    variable v_sum : unsigned(32 downto 0);
+  begin
+    v_sum := ('0' & a) + b;
+    if v_sum(32) = '1' then
+      return unsigned'(x"FFFFFFFF");
+    end if;
+    return v_sum(31 downto 0);
+  end function;
+
+  function f_lowest_one(v : std_logic_vector) return natural is
+  begin
+    for i in v'low to v'high loop
+      if v(i) = '1' then
+        return i - v'low;
+      end if;
+    end loop;
+    return 0;
+  end function;
+
+  -----------
+  --Signals--
+  -----------
+
+  -- ref_clk_i domain
+  signal en_ref       : std_logic;
+  signal ts           : unsigned(63 downto 0);
+  signal evts_d       : std_logic_vector(2*g_trig_num-1 downto 0);
+  signal ts_d         : std_logic_vector(63 downto 0);
+  signal lost         : unsigned(31 downto 0);
+  signal lost_total   : unsigned(31 downto 0);
+
+  signal cap_d        : std_logic_vector(c_capture_width-1 downto 0);
+  signal cap_we       : std_logic;
+  signal cap_full     : std_logic;
+  signal cap_q        : std_logic_vector(c_capture_width-1 downto 0);
+  signal cap_rd       : std_logic;
+  signal cap_empty    : std_logic;
+
+  signal cur_valid    : std_logic;
+  signal cur_loading  : std_logic;
+  signal cur_marker   : std_logic;
+  signal cur_evts     : std_logic_vector(2*g_trig_num-1 downto 0);
+  signal cur_ts       : std_logic_vector(63 downto 0);
+  signal cur_idx      : natural range 0 to 2*g_trig_num-1;
+
+  signal log_d        : std_logic_vector(c_entry_width-1 downto 0);
+  signal log_we       : std_logic;
+  signal log_full     : std_logic;
+
+  -- clk_i domain
+  signal log_q        : std_logic_vector(c_entry_width-1 downto 0);
+  signal log_rd       : std_logic;
+  signal log_empty    : std_logic;
+  signal log_count    : std_logic_vector(f_log2_size(g_size)-1 downto 0);
+
+  signal head         : std_logic_vector(c_entry_width-1 downto 0);
+  signal head_valid   : std_logic;
+  signal head_loading : std_logic;
+
+  signal ctl_en       : std_logic;
+  signal wb_entry     : std_logic;
+  signal wb_stall     : std_logic;
+  signal wb_ack       : std_logic;
+  signal wb_dat       : std_logic_vector(c_wishbone_data_width-1 downto 0);
+
+begin  -- architecture rtl
+
+  -----------------------------
+  -- Capture (ref_clk_i)
+  -----------------------------
+
+  cmp_en_sync : gc_sync_ffs
+    port map (
+      clk_i    => ref_clk_i,
+      rst_n_i  => ref_rst_n_i,
+      data_i   => ctl_en,
+      synced_o => en_ref);
+
+  p_capture : process(ref_clk_i)
+  begin
+    if rising_edge(ref_clk_i) then
+      if ref_rst_n_i = '0' then
+        ts     <= (others => '0');
+        evts_d <= (others => '0');
+        lost   <= (others => '0');
+      else
+        ts   <= ts + 1;
+        ts_d <= std_logic_vector(ts);
+        if en_ref = '1' then
+          evts_d <= transm_i & rcv_i;
+        else
+          evts_d <= (others => '0');
+        end if;
+
+        -- Pulses that don't make it into the capture FIFO are counted
+        -- (saturating), and so are the ones of the cycle a marker goes in
+        if cap_we = '1' and cap_d(c_capture_width-1) = '1' then
+          lost <= (others => '0');
+        elsif cap_we = '0' and evts_d /= c_no_evts then
+          lost <= f_add_sat(lost, f_count_ones(evts_d));
+        end if;
+      end if;
+    end if;
+  end process;
+
+  lost_total <= f_add_sat(lost, f_count_ones(evts_d));
+
+  cap_we <= '1' when cap_full = '0' and
+                     (lost /= 0 or evts_d /= c_no_evts) else '0';
+  cap_d  <= '1' & c_no_evts & x"00000000" & std_logic_vector(lost_total)
+              when lost /= 0 else
+            '0' & evts_d & ts_d;
+
+  cmp_capture_fifo : generic_sync_fifo
+    generic map (
+      g_data_width => c_capture_width,
+      g_size       => c_capture_size,
+      g_with_empty => true,
+      g_with_full  => true)
+    port map (
+      rst_n_i => ref_rst_n_i,
+      clk_i   => ref_clk_i,
+      d_i     => cap_d,
+      we_i    => cap_we,
+      q_o     => cap_q,
+      rd_i    => cap_rd,
+      empty_o => cap_empty,
+      full_o  => cap_full);
+
+  -----------------------------
+  -- One entry per pulse (ref_clk_i)
+  -----------------------------
+
+  cap_rd <= '1' when cur_valid = '0' and cur_loading = '0' and cap_empty = '0' else '0';
+
+  cur_idx <= f_lowest_one(cur_evts);
+
+  log_we <= cur_valid and not log_full;
+  log_d  <= '1' & '0' & x"00" & cur_ts when cur_marker = '1' else
+            '0' & '0' & std_logic_vector(to_unsigned(cur_idx, 8)) & cur_ts
+              when cur_idx < g_trig_num else
+            '0' & '1' & std_logic_vector(to_unsigned(cur_idx - g_trig_num, 8)) & cur_ts;
+
+  p_split : process(ref_clk_i)
+    variable v_evts : std_logic_vector(2*g_trig_num-1 downto 0);
+  begin
+    if rising_edge(ref_clk_i) then
+      if ref_rst_n_i = '0' then
+        cur_valid   <= '0';
+        cur_loading <= '0';
+      elsif cur_loading = '1' then
+        -- cap_q is valid the cycle after cap_rd
+        cur_marker  <= cap_q(c_capture_width-1);
+        cur_evts    <= cap_q(c_capture_width-2 downto 64);
+        cur_ts      <= cap_q(63 downto 0);
+        cur_valid   <= '1';
+        cur_loading <= '0';
+      else
+        cur_loading <= cap_rd;
+
+        if log_we = '1' then
+          v_evts          := cur_evts;
+          v_evts(cur_idx) := '0';
+          cur_evts        <= v_evts;
+          if cur_marker = '1' or v_evts = c_no_evts then
+            cur_valid <= '0';
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  cmp_log_fifo : generic_async_fifo
+    generic map (
+      g_data_width    => c_entry_width,
+      g_size          => g_size,
+      g_with_rd_empty => true,
+      g_with_rd_count => true,
+      g_with_wr_full  => true)
+    port map (
+      rst_n_i    => rst_n_i,
+      clk_wr_i   => ref_clk_i,
+      d_i        => log_d,
+      we_i       => log_we,
+      wr_full_o  => log_full,
+      clk_rd_i   => clk_i,
+      q_o        => log_q,
+      rd_i       => log_rd,
+      rd_empty_o => log_empty,
+      rd_count_o => log_count);
+
+  -----------------------------
+  -- Wishbone (clk_i)
+  -----------------------------
+
+  -- The head entry is held in a register, refilled as soon as it is popped
+  log_rd <= '1' when head_valid = '0' and head_loading = '0' and log_empty = '0' else '0';
+
+  p_head : process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        head_valid   <= '0';
+        head_loading <= '0';
+      elsif head_loading = '1' then
+        head         <= log_q;
+        head_valid   <= '1';
+        head_loading <= '0';
+      else
+        head_loading <= log_rd;
+        if wb_slv_i.cyc = '1' and wb_slv_i.stb = '1' and wb_stall = '0' and
+           wb_slv_i.we = '0' and wb_entry = '1' and
+           wb_slv_i.adr(1 downto 0) = "11" then
+          head_valid <= '0';
+        end if;
+      end if;
+    end if;
+  end process;
+
+  wb_entry <= wb_slv_i.adr(6);
+
+  -- Entry reads wait for a refill in progress, so that a burst doesn't see
+  -- the log as empty in between
+  wb_stall <= '1' when wb_entry = '1' and head_valid = '0' and
+                       (head_loading = '1' or log_empty = '0') else '0';
+
+  p_wb : process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        ctl_en <= '0';
+        wb_ack <= '0';
+      else
+        wb_ack <= '0';
+        if wb_slv_i.cyc = '1' and wb_slv_i.stb = '1' and wb_stall = '0' then
+          wb_ack <= '1';
+          wb_dat <= (others => '0');
+
+          if wb_entry = '1' then
+            case wb_slv_i.adr(1 downto 0) is
+              when "00" =>
+                wb_dat(31)         <= head_valid;
+                wb_dat(30)         <= head(c_entry_width-1) and head_valid;
+                wb_dat(8)          <= head(c_entry_width-2) and head_valid;
+                if head_valid = '1' then
+                  wb_dat(7 downto 0) <= head(71 downto 64);
+                end if;
+              when "10" =>
+                if head_valid = '1' then
+                  wb_dat <= head(31 downto 0);
+                end if;
+              when "11" =>
+                if head_valid = '1' then
+                  wb_dat <= head(63 downto 32);
+                end if;
+              when others =>
+                null;
+            end case;
+          else
+            case to_integer(unsigned(wb_slv_i.adr(5 downto 0))) is
+              when c_ctl_adr =>
+                if wb_slv_i.we = '1' and wb_slv_i.sel(0) = '1' then
+                  ctl_en <= wb_slv_i.dat(0);
+                end if;
+                wb_dat(0) <= ctl_en;
+              when c_sta_adr =>
+                wb_dat(31) <= head_valid;
+                if head_valid = '1' then
+                  wb_dat(15 downto 0) <= std_logic_vector(resize(unsigned(log_count), 16) + 1);
+                else
+                  wb_dat(15 downto 0) <= std_logic_vector(resize(unsigned(log_count), 16));
+                end if;
+              when others =>
+                null;
+            end case;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  wb_slv_o.ack   <= wb_ack;
+  wb_slv_o.dat   <= wb_dat;
+  wb_slv_o.stall <= wb_stall;
+  wb_slv_o.err   <= '0';
+  wb_slv_o.rty   <= '0';
+
+end architecture rtl;
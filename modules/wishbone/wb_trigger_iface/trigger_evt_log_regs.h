@@ -0,0 +1,69 @@
+/*
+  Register definitions for the trigger event log of wb_trigger_iface
+
+  The log sits at TRIGGER_EVT_LOG_BASE within the wb_trigger_iface window,
+  after the wbgen2 registers of wb_trigger_iface_regs.h. Offsets below are
+  relative to TRIGGER_EVT_LOG_BASE.
+
+  Each entry is 4 words, read in order through the entry window; reading
+  the last word pops it. A block read of the whole window drains up to
+  TRIGGER_EVT_LOG_WINDOW_ENTRIES entries, the ones past the last valid
+  entry reading as zeros (TRIGGER_EVT_LOG_INFO_VALID clear).
+*/
+
+#ifndef __TRIGGER_EVT_LOG_REGS_H__
+#define __TRIGGER_EVT_LOG_REGS_H__
+
+#include <stdint.h>
+
+#define TRIGGER_EVT_LOG_BASE 0x200UL
+
+/* Control register */
+#define TRIGGER_EVT_LOG_CTL 0x0UL
+#define TRIGGER_EVT_LOG_CTL_EN 0x1UL
+
+/* Status register */
+#define TRIGGER_EVT_LOG_STA 0x4UL
+#define TRIGGER_EVT_LOG_STA_COUNT_MASK 0xffffUL
+#define TRIGGER_EVT_LOG_STA_COUNT_SHIFT 0
+#define TRIGGER_EVT_LOG_STA_NOT_EMPTY 0x80000000UL
+
+/* Entry window */
+#define TRIGGER_EVT_LOG_ENTRIES 0x100UL
+#define TRIGGER_EVT_LOG_WINDOW_ENTRIES 16
+
+/* Entry info word */
+#define TRIGGER_EVT_LOG_INFO_CH_MASK 0xffUL
+#define TRIGGER_EVT_LOG_INFO_CH_SHIFT 0
+/* Set for transmitted triggers, clear for received ones */
+#define TRIGGER_EVT_LOG_INFO_DIR_TRANSM 0x100UL
+/* Set for lost markers: ts is the number of triggers lost in their place */
+#define TRIGGER_EVT_LOG_INFO_LOST 0x40000000UL
+#define TRIGGER_EVT_LOG_INFO_VALID 0x80000000UL
+
+#ifndef __ASSEMBLER__
+/* One entry as read from the entry window, on a little-endian host. ts
+   counts the trigger reference clock cycles since its reset, and has no
+   finer resolution than that */
+struct trigger_evt_log_entry {
+  uint32_t info;
+  uint32_t reserved;
+  uint64_t ts;
+};
+
+struct trigger_evt_log_regs {
+  /* [0x0]: REG (rw) Control register */
+  uint32_t ctl;
+
+  /* [0x4]: REG (ro) Status register */
+  uint32_t sta;
+
+  /* padding to: 64 words */
+  uint32_t __padding_0[62];
+
+  /* [0x100]: Entry window */
+  struct trigger_evt_log_entry entries[TRIGGER_EVT_LOG_WINDOW_ENTRIES];
+};
+#endif /* !__ASSEMBLER__*/
+
+#endif /* __TRIGGER_EVT_LOG_REGS_H__ */
@@ -63,7 +63,9 @@ entity wb_trigger_iface is
     g_address_granularity  : t_wishbone_address_granularity := WORD;
     g_sync_edge            : string                         := "positive";
     g_trig_num             : natural range 1 to 24          := 8; -- channels facing outside the FPGA. Limit defined by wb_slave_trigger.vhd
-    g_trigger_tristate     : boolean                        := true
+    g_trigger_tristate     : boolean                        := true;
+    g_evt_log_size         : natural                        := 512; -- entries of the trigger event log
+    g_count_width          : natural range 16 to 64         := 48   -- width of the pulse counters
     );
 
   port (
@@ -73,6 +75,9 @@ entity wb_trigger_iface is
     ref_clk_i   : in std_logic;
     ref_rst_n_i : in std_logic;
 
+    -- Counter snapshot strobe (ref_clk_i)
+    cnt_snap_i  : in std_logic := '0';
+
     -------------------------------
     ---- Wishbone Control Interface signals
     -------------------------------
@@ -144,11 +149,81 @@ architecture rtl of wb_trigger_iface is
   );
   end component wb_trigger_iface_regs;
 
-  constant c_periph_addr_size : natural := 7+2;
+  component trigger_evt_log is
+  generic (
+    g_trig_num : natural range 1 to 24 := 8;
+    g_size     : natural               := 512
+    );
+  port (
+    clk_i       : in  std_logic;
+    rst_n_i     : in  std_logic;
+    ref_clk_i   : in  std_logic;
+    ref_rst_n_i : in  std_logic;
+    rcv_i       : in  std_logic_vector(g_trig_num-1 downto 0);
+    transm_i    : in  std_logic_vector(g_trig_num-1 downto 0);
+    wb_slv_i    : in  t_wishbone_slave_in;
+    wb_slv_o    : out t_wishbone_slave_out
+    );
+  end component trigger_evt_log;
+
+  component trigger_cnt_snap is
+  generic (
+    g_trig_num    : natural range 1 to 24  := 8;
+    g_count_width : natural range 16 to 64 := 48
+    );
+  port (
+    clk_i                : in  std_logic;
+    rst_n_i              : in  std_logic;
+    ref_clk_i            : in  std_logic;
+    ref_rst_n_i          : in  std_logic;
+    rcv_i                : in  std_logic_vector(g_trig_num-1 downto 0);
+    transm_i             : in  std_logic_vector(g_trig_num-1 downto 0);
+    rcv_count_rst_n_i    : in  std_logic_vector(g_trig_num-1 downto 0);
+    transm_count_rst_n_i : in  std_logic_vector(g_trig_num-1 downto 0);
+    snap_i               : in  std_logic := '0';
+    rcv_count_o          : out std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+    transm_count_o       : out std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+    wb_slv_i             : in  t_wishbone_slave_in;
+    wb_slv_o             : out t_wishbone_slave_out
+    );
+  end component trigger_cnt_snap;
+
+  -- Registers at 0x000, trigger event log at 0x200, counter snapshot at
+  -- 0x400
+  constant c_periph_addr_size : natural := 9+2;
+
+  -----------------------------
+  -- Crossbar component constants
+  -----------------------------
+  -- Internal crossbar layout
+  -- 0 -> Trigger Interface Register Wishbone Interface
+  -- 1 -> Trigger event log
+  -- 2 -> Trigger counter snapshot
+  -- Number of slaves
+  constant c_slaves                : natural := 3;
+  -- Number of masters
+  constant c_masters               : natural := 1;  -- Slave adapter
+
+  -- Slaves indexes
+  constant c_slv_trigger_iface_regs_id : natural := 0;
+  constant c_slv_evt_log_id            : natural := 1;
+  constant c_slv_cnt_snap_id           : natural := 2;
+
+  -- Word addresses, as the crossbar sits after the slave adapter
+  constant c_cbar_address : t_wishbone_address_array(c_slaves-1 downto 0) :=
+  ( c_slv_trigger_iface_regs_id => x"00000000",
+    c_slv_evt_log_id            => x"00000080",
+    c_slv_cnt_snap_id           => x"00000100"
+  );
+  constant c_cbar_mask    : t_wishbone_address_array(c_slaves-1 downto 0) :=
+  ( c_slv_trigger_iface_regs_id => x"00000180",
+    c_slv_evt_log_id            => x"00000180",
+    c_slv_cnt_snap_id           => x"00000100"
+  );
 
   constant c_rcv_pulse_len      : positive := 8;  -- Defined according to the wb_slave_trigger.vhd
   constant c_transm_pulse_len   : positive := 8;  -- Defined according to the wb_slave_trigger.vhd
-  constant c_counter_width      : positive := 16; -- Defined according to the wb_slave_trigger.vhd
+  constant c_counter_width      : positive := 16; -- Defined according to the wb_slave_trigger.vhd. Low bits of the wide counters
 
   constant c_max_num_channels   : natural := 24;
 
@@ -211,6 +286,23 @@ architecture rtl of wb_trigger_iface is
   signal wb_slv_adp_in  : t_wishbone_master_in;
   signal resized_addr   : std_logic_vector(c_wishbone_address_width-1 downto 0);
 
+  -----------------------------
+  -- Wishbone crossbar signals
+  -----------------------------
+  -- Crossbar master/slave arrays
+  signal cbar_slave_in   : t_wishbone_slave_in_array (c_masters-1 downto 0);
+  signal cbar_slave_out  : t_wishbone_slave_out_array(c_masters-1 downto 0);
+  signal cbar_master_in  : t_wishbone_master_in_array(c_slaves-1 downto 0);
+  signal cbar_master_out : t_wishbone_master_out_array(c_slaves-1 downto 0);
+
+  signal rcv_pulses     : std_logic_vector(g_trig_num-1 downto 0);
+  signal transm_pulses  : std_logic_vector(g_trig_num-1 downto 0);
+
+  signal rcv_count_rst_n    : std_logic_vector(g_trig_num-1 downto 0);
+  signal transm_count_rst_n : std_logic_vector(g_trig_num-1 downto 0);
+  signal rcv_count          : std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+  signal transm_count       : std_logic_vector(g_trig_num*g_count_width-1 downto 0);
+
 begin  -- architecture rtl
 
   -- Test for maximum number of interfaces defined in wb_slave_trigger.vhd
@@ -256,6 +348,29 @@ begin  -- architecture rtl
   resized_addr(c_periph_addr_size-1 downto 0) <= wb_adr_i(c_periph_addr_size-1 downto 0);
   resized_addr(c_wishbone_address_width-1 downto c_periph_addr_size) <= (others => '0');
 
+  cbar_slave_in(0) <= wb_slv_adp_out;
+  wb_slv_adp_in    <= cbar_slave_out(0);
+
+  -- Splits the registers, the trigger event log and the counter snapshot
+  cmp_interconnect : xwb_crossbar
+  generic map(
+    g_num_masters                             => c_masters,
+    g_num_slaves                              => c_slaves,
+    g_registered                              => true,
+    g_address                                 => c_cbar_address,
+    g_mask                                    => c_cbar_mask
+  )
+  port map(
+    clk_sys_i                                 => clk_i,
+    rst_n_i                                   => rst_n_i,
+    -- Master connections (INTERCON is a slave)
+    slave_i                                   => cbar_slave_in,
+    slave_o                                   => cbar_slave_out,
+    -- Slave connections (INTERCON is a master)
+    master_i                                  => cbar_master_in,
+    master_o                                  => cbar_master_out
+  );
+
 
   wb_trigger_iface : wb_trigger_iface_regs
     port map (
@@ -263,18 +378,69 @@ begin  -- architecture rtl
       clk_sys_i  => clk_i,
       fs_clk_i   => ref_clk_i,
       wb_clk_i   => clk_i,
-      wb_adr_i   => wb_slv_adp_out.adr(6 downto 0),
-      wb_dat_i   => wb_slv_adp_out.dat,
-      wb_dat_o   => wb_slv_adp_in.dat,
-      wb_cyc_i   => wb_slv_adp_out.cyc,
-      wb_sel_i   => wb_slv_adp_out.sel,
-      wb_stb_i   => wb_slv_adp_out.stb,
-      wb_we_i    => wb_slv_adp_out.we,
-      wb_ack_o   => wb_slv_adp_in.ack,
-      wb_stall_o => wb_slv_adp_in.stall,
+      wb_adr_i   => cbar_master_out(c_slv_trigger_iface_regs_id).adr(6 downto 0),
+      wb_dat_i   => cbar_master_out(c_slv_trigger_iface_regs_id).dat,
+      wb_dat_o   => cbar_master_in(c_slv_trigger_iface_regs_id).dat,
+      wb_cyc_i   => cbar_master_out(c_slv_trigger_iface_regs_id).cyc,
+      wb_sel_i   => cbar_master_out(c_slv_trigger_iface_regs_id).sel,
+      wb_stb_i   => cbar_master_out(c_slv_trigger_iface_regs_id).stb,
+      wb_we_i    => cbar_master_out(c_slv_trigger_iface_regs_id).we,
+      wb_ack_o   => cbar_master_in(c_slv_trigger_iface_regs_id).ack,
+      wb_stall_o => cbar_master_in(c_slv_trigger_iface_regs_id).stall,
       regs_i     => regs_in,
       regs_o     => regs_out);
 
+  -- Unused wishbone signals
+  cbar_master_in(c_slv_trigger_iface_regs_id).err <= '0';
+  cbar_master_in(c_slv_trigger_iface_regs_id).rty <= '0';
+
+  -----------------------------------------------------------------
+  -- Trigger event log and counter snapshot
+  -----------------------------------------------------------------
+
+  gen_evt_log_pulses : for i in g_trig_num-1 downto 0 generate
+    rcv_pulses(i)    <= rcv_pulse_bus(i).pulse;
+    transm_pulses(i) <= transm_pulse_bus(i).pulse;
+  end generate;
+
+  cmp_trigger_evt_log : trigger_evt_log
+    generic map (
+      g_trig_num => g_trig_num,
+      g_size     => g_evt_log_size)
+    port map (
+      clk_i       => clk_i,
+      rst_n_i     => rst_n_i,
+      ref_clk_i   => ref_clk_i,
+      ref_rst_n_i => ref_rst_n_i,
+      rcv_i       => rcv_pulses,
+      transm_i    => transm_pulses,
+      wb_slv_i    => cbar_master_out(c_slv_evt_log_id),
+      wb_slv_o    => cbar_master_in(c_slv_evt_log_id));
+
+  gen_count_rst : for i in g_trig_num-1 downto 0 generate
+    rcv_count_rst_n(i)    <= ch_regs_out(i).ch_ctl_rcv_count_rst_n;
+    transm_count_rst_n(i) <= ch_regs_out(i).ch_ctl_transm_count_rst_n;
+  end generate;
+
+  cmp_trigger_cnt_snap : trigger_cnt_snap
+    generic map (
+      g_trig_num    => g_trig_num,
+      g_count_width => g_count_width)
+    port map (
+      clk_i                => clk_i,
+      rst_n_i              => rst_n_i,
+      ref_clk_i            => ref_clk_i,
+      ref_rst_n_i          => ref_rst_n_i,
+      rcv_i                => rcv_pulses,
+      transm_i             => transm_pulses,
+      rcv_count_rst_n_i    => rcv_count_rst_n,
+      transm_count_rst_n_i => transm_count_rst_n,
+      snap_i               => cnt_snap_i,
+      rcv_count_o          => rcv_count,
+      transm_count_o       => transm_count,
+      wb_slv_i             => cbar_master_out(c_slv_cnt_snap_id),
+      wb_slv_o             => cbar_master_in(c_slv_cnt_snap_id));
+
   -----------------------------------------------------------------
   -- Connecting slave ports to signals
   -----------------------------------------------------------------
@@ -634,30 +800,11 @@ begin  -- architecture rtl
                        else '0'; -- FPGA is output
 
     --------------------------------
-    -- Pulse counters
+    -- Pulse counters, kept by trigger_cnt_snap
     --------------------------------
 
-    counter_rcv : counter_simple
-      generic map (
-        g_output_width => c_counter_width)
-      port map (
-        clk_i   => ref_clk_i,
-        rst_n_i => ch_regs_out(i).ch_ctl_rcv_count_rst_n,
-        ce_i    => '1',
-        up_i    => rcv_pulse_bus(i).pulse,
-        down_i  => '0',
-        count_o => ch_regs_in(i).ch_count_rcv);
-
-    counter_transm : counter_simple
-      generic map (
-        g_output_width => c_counter_width)
-      port map (
-        clk_i   => ref_clk_i,
-        rst_n_i => ch_regs_out(i).ch_ctl_transm_count_rst_n,
-        ce_i    => '1',
-        up_i    => transm_pulse_bus(i).pulse,
-        down_i  => '0',
-        count_o => ch_regs_in(i).ch_count_transm);
+    ch_regs_in(i).ch_count_rcv    <= rcv_count(i*g_count_width+c_counter_width-1 downto i*g_count_width);
+    ch_regs_in(i).ch_count_transm <= transm_count(i*g_count_width+c_counter_width-1 downto i*g_count_width);
 
   end generate;
 
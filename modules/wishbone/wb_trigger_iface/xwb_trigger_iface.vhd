@@ -17,7 +17,9 @@ entity xwb_trigger_iface is
       g_address_granularity  : t_wishbone_address_granularity := WORD;
       g_sync_edge            : string                         := "positive";
       g_trig_num             : natural range 1 to 24          := 8;
-      g_trigger_tristate     : boolean                        := true
+      g_trigger_tristate     : boolean                        := true;
+      g_evt_log_size         : natural                        := 512;
+      g_count_width          : natural range 16 to 64         := 48
     );
   port
     (
@@ -27,6 +29,9 @@ entity xwb_trigger_iface is
       ref_clk_i   : in std_logic;
       ref_rst_n_i : in std_logic;
 
+      -- Counter snapshot strobe (ref_clk_i)
+      cnt_snap_i  : in std_logic := '0';
+
       -----------------------------
       -- Wishbone signals
       -----------------------------
@@ -71,13 +76,16 @@ begin
       g_address_granularity  => g_address_granularity,
       g_sync_edge            => g_sync_edge,
       g_trig_num             => g_trig_num,
-      g_trigger_tristate     => g_trigger_tristate
+      g_trigger_tristate     => g_trigger_tristate,
+      g_evt_log_size         => g_evt_log_size,
+      g_count_width          => g_count_width
     )
     port map (
       clk_i       => clk_i,
       rst_n_i     => rst_n_i,
       ref_clk_i   => ref_clk_i,
       ref_rst_n_i => ref_rst_n_i,
+      cnt_snap_i  => cnt_snap_i,
 
       wb_adr_i   => wb_slv_i.adr,
       wb_dat_i   => wb_slv_i.dat,
@@ -1,5 +1,6 @@
 files = [
 	"wb_trigger_mux.vhd",
+    "trigger_seq.vhd",
     "xwb_trigger_mux.vhd",
   	"wbgen/wb_trigger_mux_regs.vhd",
 	"wbgen/wb_trigger_mux_regs_pkg.vhd"];
@@ -0,0 +1,452 @@
+-------------------------------------------------------------------------------
+-- Title      : Trigger sequencer
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : trigger_seq.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   :
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Pattern generator of wb_trigger_mux. Replays a list of
+--              {delay, pulse width, channel mask} entries, kept in a
+--              dual-port RAM loaded over Wishbone, onto the output trigger
+--              channels.
+--
+--              A list starts at entry LIST and runs up to the first entry
+--              with the last flag set, wrapping at the end of the table.
+--              ARM fetches its first entry and waits for a start: a START
+--              write or, if enabled, a rising edge on the selected input
+--              (trig_in_i or trig_rcv_intern_i, as for the rcv muxes). Each
+--              entry fires delay fs_clk_i cycles after the previous one (the
+--              start, for the first), pulsing its channels for width cycles
+--              (at least one). The list is played LOOPS times, 0 meaning
+--              until STOP. Fetching an entry takes 3 cycles, so shorter
+--              delays between entries are stretched to that. LIST, LOOPS
+--              and the start selection are taken when arming.
+--
+--              Register map (word addresses, see trigger_seq_regs.h):
+--                0x00 CTL   bit 0: arm, bit 1: start, bit 2: stop (these
+--                           self-clearing), bit 3: start on input, bit 4:
+--                           input source (0: trig_in_i, 1:
+--                           trig_rcv_intern_i), bits 15-8: input select
+--                0x01 STA   bit 0: armed, bit 1: running
+--                0x02 LIST  first entry
+--                0x03 LOOPS list passes, 0: forever
+--                0x04 SIZE  table entries (ro)
+--                0x400+4*n  entry n: word 0 delay, word 1 width, word 2
+--                           channel mask (bits 23-0) and last flag (bit 31),
+--                           word 3 reserved
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+-- Main Wishbone Definitions
+use work.wishbone_pkg.all;
+-- DPRAM and f_log2_size
+use work.genram_pkg.all;
+-- General common cores
+use work.gencores_pkg.all;
+-- Trigger definitions
+use work.trigger_common_pkg.all;
+
+entity trigger_seq is
+  generic (
+    g_trig_num       : natural range 1 to 24  := 8;
+    g_rcv_intern_num : natural range 1 to 24  := 2;
+    -- Table entries, a power of 2
+    g_size           : natural range 2 to 256 := 256
+    );
+
+  port (
+    clk_i   : in std_logic;
+    rst_n_i : in std_logic;
+
+    fs_clk_i   : in std_logic;
+    fs_rst_n_i : in std_logic;
+
+    -------------------------------
+    ---- Start inputs and sequencer pulses (fs_clk_i)
+    -------------------------------
+
+    trig_in_i         : in  t_trig_channel_array(g_trig_num-1 downto 0);
+    trig_rcv_intern_i : in  t_trig_channel_array(g_rcv_intern_num-1 downto 0);
+
+    trig_out_o        : out t_trig_channel_array(g_trig_num-1 downto 0);
+
+    -------------------------------
+    ---- Wishbone (pipelined, word addresses)
+    -------------------------------
+
+    wb_slv_i : in  t_wishbone_slave_in;
+    wb_slv_o : out t_wishbone_slave_out
+    );
+
+end entity trigger_seq;
+
+architecture rtl of trigger_seq is
+
+  constant c_idx_width : natural := f_log2_size(g_size);
+  -- Entry: last & mask & width & delay, as 3 words
+  constant c_entry_width : natural := 96;
+
+  constant c_ctl_adr   : natural := 16#00#;
+  constant c_sta_adr   : natural := 16#01#;
+  constant c_list_adr  : natural := 16#02#;
+  constant c_loops_adr : natural := 16#03#;
+  constant c_size_adr  : natural := 16#04#;
+
+  type t_width_array is array (natural range <>) of unsigned(31 downto 0);
+
+  -----------
+  --Signals--
+  -----------
+
+  -- clk_i domain
+  signal ctl_hw_start  : std_logic;
+  signal ctl_src       : std_logic;
+  signal ctl_sel       : std_logic_vector(7 downto 0);
+  signal list          : unsigned(c_idx_width-1 downto 0);
+  signal loops         : unsigned(31 downto 0);
+  signal arm_req       : std_logic;
+  signal start_req     : std_logic;
+  signal stop_req      : std_logic;
+  signal armed         : std_logic;
+  signal running       : std_logic;
+
+  signal tbl_we        : std_logic;
+  signal tbl_bwe       : std_logic_vector(c_entry_width/8-1 downto 0);
+  signal tbl_q         : std_logic_vector(c_entry_width-1 downto 0);
+  signal tbl_rd        : std_logic;
+  signal tbl_word      : std_logic_vector(1 downto 0);
+  signal wb_tbl        : std_logic;
+  signal wb_ack        : std_logic;
+  signal wb_dat        : std_logic_vector(c_wishbone_data_width-1 downto 0);
+
+  -- fs_clk_i domain
+  signal arm_fs        : std_logic;
+  signal start_fs      : std_logic;
+  signal stop_fs       : std_logic;
+
+  signal hw_start      : std_logic;
+  signal src           : std_logic;
+  signal sel           : natural range 0 to 255;
+  signal first         : unsigned(c_idx_width-1 downto 0);
+  signal passes        : unsigned(31 downto 0);
+  signal start_in      : std_logic;
+  signal start_in_d    : std_logic;
+
+  signal fetch_idx     : unsigned(c_idx_width-1 downto 0);
+  signal fetch_d1      : std_logic;
+  signal fetch_d2      : std_logic;
+  signal seq_q         : std_logic_vector(c_entry_width-1 downto 0);
+
+  signal nxt_valid     : std_logic;
+  signal nxt_idx       : unsigned(c_idx_width-1 downto 0);
+  signal nxt_delay     : unsigned(31 downto 0);
+  signal nxt_width     : unsigned(31 downto 0);
+  signal nxt_mask      : std_logic_vector(23 downto 0);
+  signal nxt_last      : std_logic;
+
+  signal arming        : std_logic;
+  signal armed_fs      : std_logic;
+  signal running_fs    : std_logic;
+  signal elapsed       : unsigned(31 downto 0);
+  signal fire          : std_logic;
+  signal width_cnt     : t_width_array(g_trig_num-1 downto 0);
+  signal pulse         : std_logic_vector(g_trig_num-1 downto 0);
+
+begin  -- architecture rtl
+
+  assert (2**c_idx_width = g_size)
+  report "[trigger_seq] g_size must be a power of 2"
+  severity failure;
+
+  -----------------------------
+  -- Table
+  -----------------------------
+
+  -- Port A is the Wishbone side, port B the sequencer one
+  cmp_seq_dpram : generic_dpram
+  generic map
+  (
+    g_data_width                            => c_entry_width,
+    g_size                                  => g_size,
+    g_with_byte_enable                      => true,
+    g_addr_conflict_resolution              => "dont_care",
+    g_dual_clock                            => true
+  )
+  port map
+  (
+    rst_n_i                                 => rst_n_i,
+
+    clka_i                                  => clk_i,
+    bwea_i                                  => tbl_bwe,
+    wea_i                                   => tbl_we,
+    aa_i                                    => wb_slv_i.adr(c_idx_width+1 downto 2),
+    da_i                                    => wb_slv_i.dat & wb_slv_i.dat & wb_slv_i.dat,
+    qa_o                                    => tbl_q,
+
+    clkb_i                                  => fs_clk_i,
+    bweb_i                                  => (others => '0'),
+    web_i                                   => '0',
+    ab_i                                    => std_logic_vector(fetch_idx),
+    db_i                                    => (others => '0'),
+    qb_o                                    => seq_q
+  );
+
+  -----------------------------
+  -- Sequencer (fs_clk_i)
+  -----------------------------
+
+  start_in <= trig_in_i(sel).pulse when src = '0' and sel < g_trig_num else
+              trig_rcv_intern_i(sel).pulse when src = '1' and sel < g_rcv_intern_num else
+              '0';
+
+  -- The entry to fire next is fetched as soon as the previous one fires
+  fire <= '1' when running_fs = '1' and nxt_valid = '1' and elapsed >= nxt_delay else '0';
+
+  p_seq : process(fs_clk_i)
+  begin
+    if rising_edge(fs_clk_i) then
+      if fs_rst_n_i = '0' then
+        arming     <= '0';
+        armed_fs   <= '0';
+        running_fs <= '0';
+        nxt_valid  <= '0';
+        fetch_d1   <= '0';
+        fetch_d2   <= '0';
+        start_in_d <= '0';
+      else
+        start_in_d <= start_in;
+        fetch_d1   <= '0';
+        fetch_d2   <= fetch_d1;
+
+        if fetch_d2 = '1' then
+          nxt_delay <= unsigned(seq_q(31 downto 0));
+          nxt_width <= unsigned(seq_q(63 downto 32));
+          nxt_mask  <= seq_q(87 downto 64);
+          nxt_last  <= seq_q(95);
+          nxt_valid <= '1';
+          if arming = '1' then
+            arming   <= '0';
+            armed_fs <= '1';
+          end if;
+        end if;
+
+        elapsed <= elapsed + 1;
+
+        if stop_fs = '1' then
+          arming     <= '0';
+          armed_fs   <= '0';
+          running_fs <= '0';
+        elsif arm_fs = '1' and running_fs = '0' then
+          -- Armed once the first entry is in
+          hw_start  <= ctl_hw_start;
+          src       <= ctl_src;
+          sel       <= to_integer(unsigned(ctl_sel));
+          first     <= list;
+          passes    <= loops;
+          arming    <= '1';
+          armed_fs  <= '0';
+          nxt_valid <= '0';
+          nxt_idx   <= list;
+          fetch_idx <= list;
+          fetch_d1  <= '1';
+        elsif armed_fs = '1' and
+              (start_fs = '1' or (hw_start = '1' and start_in = '1' and start_in_d = '0')) then
+          armed_fs   <= '0';
+          running_fs <= '1';
+          elapsed    <= to_unsigned(1, elapsed'length);
+        elsif fire = '1' then
+          elapsed   <= to_unsigned(1, elapsed'length);
+          nxt_valid <= '0';
+          if nxt_last = '0' then
+            nxt_idx   <= nxt_idx + 1;
+            fetch_idx <= nxt_idx + 1;
+            fetch_d1  <= '1';
+          elsif passes /= 1 then
+            if passes /= 0 then
+              passes <= passes - 1;
+            end if;
+            nxt_idx   <= first;
+            fetch_idx <= first;
+            fetch_d1  <= '1';
+          else
+            running_fs <= '0';
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  p_pulse : process(fs_clk_i)
+  begin
+    if rising_edge(fs_clk_i) then
+      for i in 0 to g_trig_num-1 loop
+        if fs_rst_n_i = '0' or stop_fs = '1' then
+          width_cnt(i) <= (others => '0');
+          pulse(i)     <= '0';
+        elsif fire = '1' and nxt_mask(i) = '1' then
+          if nxt_width = 0 then
+            width_cnt(i) <= (others => '0');
+          else
+            width_cnt(i) <= nxt_width - 1;
+          end if;
+          pulse(i) <= '1';
+        elsif width_cnt(i) /= 0 then
+          width_cnt(i) <= width_cnt(i) - 1;
+          pulse(i)     <= '1';
+        else
+          pulse(i) <= '0';
+        end if;
+      end loop;
+    end if;
+  end process;
+
+  gen_trig_out : for i in 0 to g_trig_num-1 generate
+    trig_out_o(i).pulse <= pulse(i);
+  end generate;
+
+  cmp_arm_sync : gc_pulse_synchronizer
+    port map (
+      clk_in_i  => clk_i,
+      rst_n_i   => rst_n_i,
+      clk_out_i => fs_clk_i,
+      d_ready_o => open,
+      d_p_i     => arm_req,
+      q_p_o     => arm_fs);
+
+  cmp_start_sync : gc_pulse_synchronizer
+    port map (
+      clk_in_i  => clk_i,
+      rst_n_i   => rst_n_i,
+      clk_out_i => fs_clk_i,
+      d_ready_o => open,
+      d_p_i     => start_req,
+      q_p_o     => start_fs);
+
+  cmp_stop_sync : gc_pulse_synchronizer
+    port map (
+      clk_in_i  => clk_i,
+      rst_n_i   => rst_n_i,
+      clk_out_i => fs_clk_i,
+      d_ready_o => open,
+      d_p_i     => stop_req,
+      q_p_o     => stop_fs);
+
+  cmp_armed_sync : gc_sync_ffs
+    port map (
+      clk_i    => clk_i,
+      rst_n_i  => rst_n_i,
+      data_i   => armed_fs,
+      synced_o => armed);
+
+  cmp_running_sync : gc_sync_ffs
+    port map (
+      clk_i    => clk_i,
+      rst_n_i  => rst_n_i,
+      data_i   => running_fs,
+      synced_o => running);
+
+  -----------------------------
+  -- Wishbone (clk_i)
+  -----------------------------
+
+  wb_tbl <= wb_slv_i.adr(10);
+
+  tbl_we <= '1' when wb_slv_i.cyc = '1' and wb_slv_i.stb = '1' and wb_slv_i.we = '1' and
+                     wb_tbl = '1' and wb_slv_i.adr(1 downto 0) /= "11" else '0';
+
+  gen_tbl_bwe : for w in 0 to 2 generate
+    tbl_bwe(4*w+3 downto 4*w) <= wb_slv_i.sel when
+                                   to_integer(unsigned(wb_slv_i.adr(1 downto 0))) = w else
+                                 (others => '0');
+  end generate;
+
+  p_wb : process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if rst_n_i = '0' then
+        ctl_hw_start <= '0';
+        ctl_src      <= '0';
+        ctl_sel      <= (others => '0');
+        list         <= (others => '0');
+        loops        <= to_unsigned(1, loops'length);
+        arm_req      <= '0';
+        start_req    <= '0';
+        stop_req     <= '0';
+        tbl_rd       <= '0';
+        wb_ack       <= '0';
+      else
+        arm_req   <= '0';
+        start_req <= '0';
+        stop_req  <= '0';
+        tbl_rd    <= '0';
+        wb_ack    <= '0';
+
+        if wb_slv_i.cyc = '1' and wb_slv_i.stb = '1' then
+          wb_ack   <= '1';
+          wb_dat   <= (others => '0');
+          tbl_rd   <= wb_tbl and not wb_slv_i.we;
+          tbl_word <= wb_slv_i.adr(1 downto 0);
+
+          if wb_tbl = '0' then
+            case to_integer(unsigned(wb_slv_i.adr(9 downto 0))) is
+              when c_ctl_adr =>
+                if wb_slv_i.we = '1' then
+                  if wb_slv_i.sel(0) = '1' then
+                    arm_req      <= wb_slv_i.dat(0);
+                    start_req    <= wb_slv_i.dat(1);
+                    stop_req     <= wb_slv_i.dat(2);
+                    ctl_hw_start <= wb_slv_i.dat(3);
+                    ctl_src      <= wb_slv_i.dat(4);
+                  end if;
+                  if wb_slv_i.sel(1) = '1' then
+                    ctl_sel <= wb_slv_i.dat(15 downto 8);
+                  end if;
+                end if;
+                wb_dat(3)           <= ctl_hw_start;
+                wb_dat(4)           <= ctl_src;
+                wb_dat(15 downto 8) <= ctl_sel;
+              when c_sta_adr =>
+                wb_dat(0) <= armed;
+                wb_dat(1) <= running;
+              when c_list_adr =>
+                if wb_slv_i.we = '1' then
+                  list <= unsigned(wb_slv_i.dat(c_idx_width-1 downto 0));
+                end if;
+                wb_dat(c_idx_width-1 downto 0) <= std_logic_vector(list);
+              when c_loops_adr =>
+                if wb_slv_i.we = '1' then
+                  loops <= unsigned(wb_slv_i.dat);
+                end if;
+                wb_dat <= std_logic_vector(loops);
+              when c_size_adr =>
+                wb_dat <= std_logic_vector(to_unsigned(g_size, 32));
+              when others =>
+                null;
+            end case;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process;
+
+  -- Table reads come straight from the RAM output, valid along with the ack
+  wb_slv_o.ack   <= wb_ack;
+  wb_slv_o.dat   <= tbl_q(31 downto 0)  when tbl_rd = '1' and tbl_word = "00" else
+                    tbl_q(63 downto 32) when tbl_rd = '1' and tbl_word = "01" else
+                    tbl_q(95 downto 64) when tbl_rd = '1' and tbl_word = "10" else
+                    (others => '0')     when tbl_rd = '1' else
+                    wb_dat;
+  wb_slv_o.stall <= '0';
+  wb_slv_o.err   <= '0';
+  wb_slv_o.rty   <= '0';
+
+end architecture rtl;
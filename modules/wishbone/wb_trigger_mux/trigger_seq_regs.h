@@ -0,0 +1,93 @@
+/*
+  Register definitions for the trigger sequencer of wb_trigger_mux
+
+  The sequencer sits at TRIGGER_SEQ_BASE within the wb_trigger_mux window,
+  after the wbgen2 registers of wb_trigger_mux_regs.h. Offsets below are
+  relative to TRIGGER_SEQ_BASE.
+
+  The table is loaded with one block write of struct trigger_seq_entry
+  items at TRIGGER_SEQ_TABLE. A list runs from entry LIST to the first
+  entry with TRIGGER_SEQ_ENTRY_LAST set, so several lists can share the
+  table. Write TRIGGER_SEQ_CTL_ARM, wait for TRIGGER_SEQ_STA_ARMED, then
+  start it with TRIGGER_SEQ_CTL_START or the selected input trigger.
+  Delays and widths count the trigger mux fs clock cycles.
+*/
+
+#ifndef __TRIGGER_SEQ_REGS_H__
+#define __TRIGGER_SEQ_REGS_H__
+
+#include <stdint.h>
+
+#define TRIGGER_SEQ_BASE 0x2000UL
+
+/* Control register */
+#define TRIGGER_SEQ_CTL 0x0UL
+#define TRIGGER_SEQ_CTL_ARM 0x1UL
+#define TRIGGER_SEQ_CTL_START 0x2UL
+#define TRIGGER_SEQ_CTL_STOP 0x4UL
+/* Start on a rising edge of the selected input, once armed */
+#define TRIGGER_SEQ_CTL_HW_START 0x8UL
+/* Input source: clear for the external inputs, set for the internal ones */
+#define TRIGGER_SEQ_CTL_SRC_INTERN 0x10UL
+#define TRIGGER_SEQ_CTL_SEL_MASK 0xff00UL
+#define TRIGGER_SEQ_CTL_SEL_SHIFT 8
+
+/* Status register */
+#define TRIGGER_SEQ_STA 0x4UL
+#define TRIGGER_SEQ_STA_ARMED 0x1UL
+#define TRIGGER_SEQ_STA_RUNNING 0x2UL
+
+/* First entry of the list */
+#define TRIGGER_SEQ_LIST 0x8UL
+
+/* List passes, 0 for endless */
+#define TRIGGER_SEQ_LOOPS 0xcUL
+
+/* Table entries */
+#define TRIGGER_SEQ_SIZE 0x10UL
+
+/* Table */
+#define TRIGGER_SEQ_TABLE 0x1000UL
+#define TRIGGER_SEQ_MAX_ENTRIES 256
+
+/* Entry ctl word */
+#define TRIGGER_SEQ_ENTRY_MASK_MASK 0xffffffUL
+#define TRIGGER_SEQ_ENTRY_MASK_SHIFT 0
+#define TRIGGER_SEQ_ENTRY_LAST 0x80000000UL
+
+#ifndef __ASSEMBLER__
+/* One table entry. delay counts from the previous entry, or from the start
+   for the first one, and is at least 3 between entries; width is at least
+   1. ctl holds the output channel mask and the last flag */
+struct trigger_seq_entry {
+  uint32_t delay;
+  uint32_t width;
+  uint32_t ctl;
+  uint32_t reserved;
+};
+
+struct trigger_seq_regs {
+  /* [0x0]: REG (rw) Control register */
+  uint32_t ctl;
+
+  /* [0x4]: REG (ro) Status register */
+  uint32_t sta;
+
+  /* [0x8]: REG (rw) First entry of the list */
+  uint32_t list;
+
+  /* [0xc]: REG (rw) List passes */
+  uint32_t loops;
+
+  /* [0x10]: REG (ro) Table entries */
+  uint32_t size;
+
+  /* padding to: 1024 words */
+  uint32_t __padding_0[1019];
+
+  /* [0x1000]: Table */
+  struct trigger_seq_entry table[TRIGGER_SEQ_MAX_ENTRIES];
+};
+#endif /* !__ASSEMBLER__*/
+
+#endif /* __TRIGGER_SEQ_REGS_H__ */
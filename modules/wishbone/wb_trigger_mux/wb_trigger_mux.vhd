@@ -59,8 +59,9 @@ entity wb_trigger_mux is
     g_address_granularity  : t_wishbone_address_granularity := WORD;
     g_trig_num             : natural range 1 to 24          := 8; -- channels facing outside the FPGA. Limit defined by wb_trigger_mux_regs.vhd
     g_intern_num           : natural range 1 to 24          := 8; -- channels facing inside the FPGA. Limit defined by wb_trigger_mux_regs.vhd
-    g_rcv_intern_num       : natural range 1 to 24          := 2  -- signals from inside the FPGA that can be used as input at a rcv mux.
+    g_rcv_intern_num       : natural range 1 to 24          := 2; -- signals from inside the FPGA that can be used as input at a rcv mux.
                                                                   -- Limit defined by wb_trigger_mux_regs.vhd
+    g_seq_size             : natural range 2 to 256         := 256 -- entries of the trigger sequencer table, a power of 2
     );
 
   port (
@@ -130,9 +131,54 @@ architecture rtl of wb_trigger_mux is
     );
   end component wb_trigger_mux_regs;
 
-  constant c_periph_addr_size : natural := 6+2;
+  component trigger_seq is
+  generic (
+    g_trig_num       : natural range 1 to 24  := 8;
+    g_rcv_intern_num : natural range 1 to 24  := 2;
+    g_size           : natural range 2 to 256 := 256
+    );
+  port (
+    clk_i             : in  std_logic;
+    rst_n_i           : in  std_logic;
+    fs_clk_i          : in  std_logic;
+    fs_rst_n_i        : in  std_logic;
+    trig_in_i         : in  t_trig_channel_array(g_trig_num-1 downto 0);
+    trig_rcv_intern_i : in  t_trig_channel_array(g_rcv_intern_num-1 downto 0);
+    trig_out_o        : out t_trig_channel_array(g_trig_num-1 downto 0);
+    wb_slv_i          : in  t_wishbone_slave_in;
+    wb_slv_o          : out t_wishbone_slave_out
+    );
+  end component trigger_seq;
+
+  -- Registers at 0x0000, trigger sequencer at 0x2000
+  constant c_periph_addr_size : natural := 12+2;
   constant c_max_num_channels : natural := 24;
 
+  -----------------------------
+  -- Crossbar component constants
+  -----------------------------
+  -- Internal crossbar layout
+  -- 0 -> Trigger Mux Register Wishbone Interface
+  -- 1 -> Trigger sequencer
+  -- Number of slaves
+  constant c_slaves                  : natural := 2;
+  -- Number of masters
+  constant c_masters                 : natural := 1;  -- Slave adapter
+
+  -- Slaves indexes
+  constant c_slv_trigger_mux_regs_id : natural := 0;
+  constant c_slv_trigger_seq_id      : natural := 1;
+
+  -- Word addresses, as the crossbar sits after the slave adapter
+  constant c_cbar_address : t_wishbone_address_array(c_slaves-1 downto 0) :=
+  ( c_slv_trigger_mux_regs_id => x"00000000",
+    c_slv_trigger_seq_id      => x"00000800"
+  );
+  constant c_cbar_mask    : t_wishbone_address_array(c_slaves-1 downto 0) :=
+  ( c_slv_trigger_mux_regs_id => x"00000800",
+    c_slv_trigger_seq_id      => x"00000800"
+  );
+
   constant c_rcv_sel_buf_len    : positive := 8;  -- Defined according to the wb_slave_trigger.vhd
   constant c_transm_sel_buf_len : positive := 8;  -- Defined according to the wb_slave_trigger.vhd
 
@@ -168,6 +214,7 @@ architecture rtl of wb_trigger_mux is
 
   signal rcv_mux_out    : t_trig_channel_array(g_intern_num-1 downto 0);
   signal transm_mux_out : t_trig_channel_array(g_trig_num-1 downto 0);
+  signal seq_trig_out   : t_trig_channel_array(g_trig_num-1 downto 0);
 
   -----------------------------
   -- Wishbone slave adapter signals/structures
@@ -176,6 +223,15 @@ architecture rtl of wb_trigger_mux is
   signal wb_slv_adp_in  : t_wishbone_master_in;
   signal resized_addr   : std_logic_vector(c_wishbone_address_width-1 downto 0);
 
+  -----------------------------
+  -- Wishbone crossbar signals
+  -----------------------------
+  -- Crossbar master/slave arrays
+  signal cbar_slave_in   : t_wishbone_slave_in_array (c_masters-1 downto 0);
+  signal cbar_slave_out  : t_wishbone_slave_out_array(c_masters-1 downto 0);
+  signal cbar_master_in  : t_wishbone_master_in_array(c_slaves-1 downto 0);
+  signal cbar_master_out : t_wishbone_master_out_array(c_slaves-1 downto 0);
+
 begin  -- architecture rtl
 
   -- Test for maximum number of interfaces defined in wb_trigger_mux_regs.vhd
@@ -237,23 +293,70 @@ begin  -- architecture rtl
   resized_addr(c_periph_addr_size-1 downto 0) <= wb_adr_i(c_periph_addr_size-1 downto 0);
   resized_addr(c_wishbone_address_width-1 downto c_periph_addr_size) <= (others => '0');
 
+  cbar_slave_in(0) <= wb_slv_adp_out;
+  wb_slv_adp_in    <= cbar_slave_out(0);
+
+  -- Splits the registers and the trigger sequencer
+  cmp_interconnect : xwb_crossbar
+  generic map(
+    g_num_masters                             => c_masters,
+    g_num_slaves                              => c_slaves,
+    g_registered                              => true,
+    g_address                                 => c_cbar_address,
+    g_mask                                    => c_cbar_mask
+  )
+  port map(
+    clk_sys_i                                 => clk_i,
+    rst_n_i                                   => rst_n_i,
+    -- Master connections (INTERCON is a slave)
+    slave_i                                   => cbar_slave_in,
+    slave_o                                   => cbar_slave_out,
+    -- Slave connections (INTERCON is a master)
+    master_i                                  => cbar_master_in,
+    master_o                                  => cbar_master_out
+  );
+
   cmp_wb_trigger_mux_regs : wb_trigger_mux_regs
     port map (
       rst_n_i    => rst_n_i,
       clk_sys_i  => clk_i,
       fs_clk_i   => fs_clk_i,
-      wb_adr_i   => wb_slv_adp_out.adr(5 downto 0),
-      wb_dat_i   => wb_slv_adp_out.dat,
-      wb_dat_o   => wb_slv_adp_in.dat,
-      wb_cyc_i   => wb_slv_adp_out.cyc,
-      wb_sel_i   => wb_slv_adp_out.sel,
-      wb_stb_i   => wb_slv_adp_out.stb,
-      wb_we_i    => wb_slv_adp_out.we,
-      wb_ack_o   => wb_slv_adp_in.ack,
-      wb_stall_o => wb_slv_adp_in.stall,
+      wb_adr_i   => cbar_master_out(c_slv_trigger_mux_regs_id).adr(5 downto 0),
+      wb_dat_i   => cbar_master_out(c_slv_trigger_mux_regs_id).dat,
+      wb_dat_o   => cbar_master_in(c_slv_trigger_mux_regs_id).dat,
+      wb_cyc_i   => cbar_master_out(c_slv_trigger_mux_regs_id).cyc,
+      wb_sel_i   => cbar_master_out(c_slv_trigger_mux_regs_id).sel,
+      wb_stb_i   => cbar_master_out(c_slv_trigger_mux_regs_id).stb,
+      wb_we_i    => cbar_master_out(c_slv_trigger_mux_regs_id).we,
+      wb_ack_o   => cbar_master_in(c_slv_trigger_mux_regs_id).ack,
+      wb_stall_o => cbar_master_in(c_slv_trigger_mux_regs_id).stall,
       regs_i     => regs_in,
       regs_o     => regs_out);
 
+  -- Unused wishbone signals
+  cbar_master_in(c_slv_trigger_mux_regs_id).err <= '0';
+  cbar_master_in(c_slv_trigger_mux_regs_id).rty <= '0';
+
+  -----------------------------------------------------------------
+  -- Trigger sequencer
+  -----------------------------------------------------------------
+
+  cmp_trigger_seq : trigger_seq
+    generic map (
+      g_trig_num       => g_trig_num,
+      g_rcv_intern_num => g_rcv_intern_num,
+      g_size           => g_seq_size)
+    port map (
+      clk_i             => clk_i,
+      rst_n_i           => rst_n_i,
+      fs_clk_i          => fs_clk_i,
+      fs_rst_n_i        => fs_rst_n_i,
+      trig_in_i         => trig_in_i,
+      trig_rcv_intern_i => trig_rcv_intern_i,
+      trig_out_o        => seq_trig_out,
+      wb_slv_i          => cbar_master_out(c_slv_trigger_seq_id),
+      wb_slv_o          => cbar_master_in(c_slv_trigger_seq_id));
+
   -----------------------------------------------------------------
   -- Connecting slave ports to signals
   -----------------------------------------------------------------
@@ -513,6 +616,9 @@ begin  -- architecture rtl
     end process;
   end generate mux_transm;
 
-  trig_out_o <= transm_mux_out;
+  -- Sequencer pulses go out along with the ones of the transmitter muxes
+  gen_trig_out : for it in g_trig_num-1 downto 0 generate
+    trig_out_o(it).pulse <= transm_mux_out(it).pulse or seq_trig_out(it).pulse;
+  end generate gen_trig_out;
 
 end architecture rtl;
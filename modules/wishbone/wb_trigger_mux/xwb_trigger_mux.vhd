@@ -17,7 +17,8 @@ entity xwb_trigger_mux is
       g_address_granularity  : t_wishbone_address_granularity := WORD;
       g_trig_num             : natural range 1 to 24          := 8;
       g_intern_num           : natural range 1 to 24          := 8;
-      g_rcv_intern_num       : natural range 1 to 24          := 2
+      g_rcv_intern_num       : natural range 1 to 24          := 2;
+      g_seq_size             : natural range 2 to 256         := 256
       );
   port
     (
@@ -61,7 +62,8 @@ begin
       g_address_granularity  => g_address_granularity,
       g_trig_num             => g_trig_num,
       g_intern_num           => g_intern_num,
-      g_rcv_intern_num       => g_rcv_intern_num)
+      g_rcv_intern_num       => g_rcv_intern_num,
+      g_seq_size             => g_seq_size)
     port map (
       clk_i      => clk_i,
       rst_n_i    => rst_n_i,
@@ -62,4 +62,65 @@ package platform_generic_pkg is
   );
   end component;
 
+  component iserdes_generic
+  generic
+  (
+    -- Samples per clk_par_i cycle: 4, 6 or 8
+    g_ratio                                   : natural := 8
+  );
+  port
+  (
+    -------------------------------
+    -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, sampled
+    -- on both edges, and is phase aligned to it
+    -------------------------------
+    clk_ser_i                                 : in  std_logic;
+    clk_par_i                                 : in  std_logic;
+    rst_n_i                                   : in  std_logic;
+
+    -------------------------------
+    -- ISERDES facing external FPGA logic
+    -------------------------------
+    ser_i                                     : in  std_logic;
+    -- ser_i passed through to the fabric. ser_i drives nothing else, as it
+    -- comes straight from the input buffer
+    ser_o                                     : out std_logic;
+
+    -------------------------------
+    -- ISERDES facing internal FPGA logic. par_o(0) is the first sample in
+    -- time (clk_par_i)
+    -------------------------------
+    par_o                                     : out std_logic_vector(g_ratio-1 downto 0)
+  );
+  end component;
+
+  component oserdes_generic
+  generic
+  (
+    -- Samples per clk_par_i cycle: 4, 6 or 8
+    g_ratio                                   : natural := 8
+  );
+  port
+  (
+    -------------------------------
+    -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, driving
+    -- on both edges, and is phase aligned to it
+    -------------------------------
+    clk_ser_i                                 : in  std_logic;
+    clk_par_i                                 : in  std_logic;
+    rst_n_i                                   : in  std_logic;
+
+    -------------------------------
+    -- OSERDES facing internal FPGA logic. par_i(0) is the first sample in
+    -- time (clk_par_i)
+    -------------------------------
+    par_i                                     : in  std_logic_vector(g_ratio-1 downto 0);
+
+    -------------------------------
+    -- OSERDES facing external FPGA logic
+    -------------------------------
+    ser_o                                     : out std_logic
+  );
+  end component;
+
 end platform_generic_pkg;
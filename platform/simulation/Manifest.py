@@ -2,6 +2,8 @@ files = [
     "iobuf_generic.vhd",
     "ibufds_generic.vhd",
     "obufds_generic.vhd",
+    "iserdes_generic.vhd",
+    "oserdes_generic.vhd",
     "ila_t8_d256_s8192_cap.vhd",
     "vio_din2_w128_dout2_w128.vhd",
     "ipcores_pkg.vhd",
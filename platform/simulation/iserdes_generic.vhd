@@ -0,0 +1,81 @@
+-------------------------------------------------------------------------------
+-- Title      : ISERDES generic
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : iserdes_generic.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Simulation
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Simulation ISERDES primitive generic wrapper. Samples ser_i
+-- on both edges of clk_ser_i and hands out the last g_ratio samples at each
+-- clk_par_i edge. The latency differs from the one of the Xilinx primitive.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity iserdes_generic is
+generic
+(
+  -- Samples per clk_par_i cycle: 4, 6 or 8
+  g_ratio                                   : natural := 8
+);
+port
+(
+  -------------------------------
+  -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, sampled
+  -- on both edges, and is phase aligned to it
+  -------------------------------
+  clk_ser_i                                 : in  std_logic;
+  clk_par_i                                 : in  std_logic;
+  rst_n_i                                   : in  std_logic;
+
+  -------------------------------
+  -- ISERDES facing external FPGA logic
+  -------------------------------
+  ser_i                                     : in  std_logic;
+  -- ser_i passed through to the fabric. ser_i drives nothing else, as it
+  -- comes straight from the input buffer
+  ser_o                                     : out std_logic;
+
+  -------------------------------
+  -- ISERDES facing internal FPGA logic. par_o(0) is the first sample in
+  -- time (clk_par_i)
+  -------------------------------
+  par_o                                     : out std_logic_vector(g_ratio-1 downto 0)
+);
+end entity iserdes_generic;
+
+architecture rtl of iserdes_generic is
+
+  -- Last g_ratio samples, the newest one at the top
+  signal samples                            : std_logic_vector(g_ratio-1 downto 0) := (others => '0');
+
+begin
+
+  p_ser : process(clk_ser_i)
+  begin
+    if clk_ser_i'event and (clk_ser_i = '1' or clk_ser_i = '0') then
+      samples <= ser_i & samples(g_ratio-1 downto 1);
+    end if;
+  end process;
+
+  ser_o <= ser_i;
+
+  p_par : process(clk_par_i)
+  begin
+    if rising_edge(clk_par_i) then
+      if rst_n_i = '0' then
+        par_o <= (others => '0');
+      else
+        par_o <= samples;
+      end if;
+    end if;
+  end process;
+
+end rtl;
@@ -0,0 +1,88 @@
+-------------------------------------------------------------------------------
+-- Title      : OSERDES generic
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : oserdes_generic.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Simulation
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Simulation OSERDES primitive generic wrapper. Takes par_i at
+-- each clk_par_i edge and drives its samples out on the following edges of
+-- clk_ser_i, both rising and falling. The latency differs from the one of
+-- the Xilinx primitive.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity oserdes_generic is
+generic
+(
+  -- Samples per clk_par_i cycle: 4, 6 or 8
+  g_ratio                                   : natural := 8
+);
+port
+(
+  -------------------------------
+  -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, driving
+  -- on both edges, and is phase aligned to it
+  -------------------------------
+  clk_ser_i                                 : in  std_logic;
+  clk_par_i                                 : in  std_logic;
+  rst_n_i                                   : in  std_logic;
+
+  -------------------------------
+  -- OSERDES facing internal FPGA logic. par_i(0) is the first sample in
+  -- time (clk_par_i)
+  -------------------------------
+  par_i                                     : in  std_logic_vector(g_ratio-1 downto 0);
+
+  -------------------------------
+  -- OSERDES facing external FPGA logic
+  -------------------------------
+  ser_o                                     : out std_logic
+);
+end entity oserdes_generic;
+
+architecture rtl of oserdes_generic is
+
+  signal word                               : std_logic_vector(g_ratio-1 downto 0) := (others => '0');
+  signal samples                            : std_logic_vector(g_ratio-1 downto 0) := (others => '0');
+  -- Toggled for each new word
+  signal word_tgl                           : std_logic := '0';
+  signal word_tgl_seen                      : std_logic := '0';
+
+begin
+
+  p_par : process(clk_par_i)
+  begin
+    if rising_edge(clk_par_i) then
+      if rst_n_i = '0' then
+        word <= (others => '0');
+      else
+        word <= par_i;
+      end if;
+      word_tgl <= not word_tgl;
+    end if;
+  end process;
+
+  p_ser : process(clk_ser_i)
+  begin
+    if clk_ser_i'event and (clk_ser_i = '1' or clk_ser_i = '0') then
+      if word_tgl /= word_tgl_seen then
+        word_tgl_seen <= word_tgl;
+        ser_o <= word(0);
+        samples <= '0' & word(g_ratio-1 downto 1);
+      else
+        ser_o <= samples(0);
+        samples <= '0' & samples(g_ratio-1 downto 1);
+      end if;
+    end if;
+  end process;
+
+end rtl;
@@ -1 +1,3 @@
-modules = {"local" : "iobuf_generic"}
+modules = {"local" : ["iobuf_generic",
+                      "iserdes_generic",
+                      "oserdes_generic"]}
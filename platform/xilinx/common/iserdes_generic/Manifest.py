@@ -0,0 +1 @@
+files = ["iserdes_generic.vhd"]
@@ -0,0 +1,128 @@
+-------------------------------------------------------------------------------
+-- Title      : ISERDES generic
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : iserdes_generic.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Xilinx 7-series
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Xilinx ISERDESE2 primitive generic wrapper, in DDR networking
+-- mode. ser_i must come straight from an input buffer; logic that needs the
+-- line itself takes it from ser_o, the ISERDESE2 O pass-through.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library unisim;
+use unisim.vcomponents.all;
+
+entity iserdes_generic is
+generic
+(
+  -- Samples per clk_par_i cycle: 4, 6 or 8
+  g_ratio                                   : natural := 8
+);
+port
+(
+  -------------------------------
+  -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, sampled
+  -- on both edges, and is phase aligned to it
+  -------------------------------
+  clk_ser_i                                 : in  std_logic;
+  clk_par_i                                 : in  std_logic;
+  rst_n_i                                   : in  std_logic;
+
+  -------------------------------
+  -- ISERDES facing external FPGA logic
+  -------------------------------
+  ser_i                                     : in  std_logic;
+  -- ser_i passed through to the fabric. ser_i drives nothing else, as it
+  -- comes straight from the input buffer
+  ser_o                                     : out std_logic;
+
+  -------------------------------
+  -- ISERDES facing internal FPGA logic. par_o(0) is the first sample in
+  -- time (clk_par_i)
+  -------------------------------
+  par_o                                     : out std_logic_vector(g_ratio-1 downto 0)
+);
+end entity iserdes_generic;
+
+architecture rtl of iserdes_generic is
+
+  signal clk_ser_n                          : std_logic;
+  signal rst                                : std_logic;
+  -- ISERDESE2 outputs, q(1) being the last sample in time
+  signal q                                  : std_logic_vector(8 downto 1);
+
+begin
+
+  assert (g_ratio = 4 or g_ratio = 6 or g_ratio = 8)
+  report "[iserdes_generic] Only g_ratio = 4, 6 or 8 is supported"
+  severity failure;
+
+  clk_ser_n <= not clk_ser_i;
+  rst <= not rst_n_i;
+
+  cmp_xilinx_iserdes : iserdese2
+  generic map (
+    DATA_RATE                              => "DDR",
+    DATA_WIDTH                             => g_ratio,
+    DYN_CLKDIV_INV_EN                      => "FALSE",
+    DYN_CLK_INV_EN                         => "FALSE",
+    INIT_Q1                                => '0',
+    INIT_Q2                                => '0',
+    INIT_Q3                                => '0',
+    INIT_Q4                                => '0',
+    INTERFACE_TYPE                         => "NETWORKING",
+    IOBDELAY                               => "NONE",
+    NUM_CE                                 => 1,
+    OFB_USED                               => "FALSE",
+    SERDES_MODE                            => "MASTER",
+    SRVAL_Q1                               => '0',
+    SRVAL_Q2                               => '0',
+    SRVAL_Q3                               => '0',
+    SRVAL_Q4                               => '0')
+  port map (
+    O                                      => ser_o,
+    Q1                                     => q(1),
+    Q2                                     => q(2),
+    Q3                                     => q(3),
+    Q4                                     => q(4),
+    Q5                                     => q(5),
+    Q6                                     => q(6),
+    Q7                                     => q(7),
+    Q8                                     => q(8),
+    SHIFTOUT1                              => open,
+    SHIFTOUT2                              => open,
+    BITSLIP                                => '0',
+    CE1                                    => '1',
+    CE2                                    => '1',
+    CLKDIVP                                => '0',
+    CLK                                    => clk_ser_i,
+    CLKB                                   => clk_ser_n,
+    CLKDIV                                 => clk_par_i,
+    OCLK                                   => '0',
+    DYNCLKDIVSEL                           => '0',
+    DYNCLKSEL                              => '0',
+    D                                      => ser_i,
+    DDLY                                   => '0',
+    OFB                                    => '0',
+    OCLKB                                  => '0',
+    RST                                    => rst,
+    SHIFTIN1                               => '0',
+    SHIFTIN2                               => '0'
+  );
+
+  -- The first sample in time comes out at Q<g_ratio>
+  gen_par : for i in 0 to g_ratio-1 generate
+    par_o(i) <= q(g_ratio-i);
+  end generate;
+
+end rtl;
@@ -0,0 +1 @@
+files = ["oserdes_generic.vhd"]
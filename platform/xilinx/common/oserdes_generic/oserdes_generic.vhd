@@ -0,0 +1,112 @@
+-------------------------------------------------------------------------------
+-- Title      : OSERDES generic
+-- Project    :
+-------------------------------------------------------------------------------
+-- File       : oserdes_generic.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Xilinx 7-series
+-- Standard   : VHDL'93/02
+-------------------------------------------------------------------------------
+-- Description: Xilinx OSERDESE2 primitive generic wrapper, in DDR mode.
+-- ser_o must go straight to an output buffer.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library unisim;
+use unisim.vcomponents.all;
+
+entity oserdes_generic is
+generic
+(
+  -- Samples per clk_par_i cycle: 4, 6 or 8
+  g_ratio                                   : natural := 8
+);
+port
+(
+  -------------------------------
+  -- Clocks/Resets. clk_ser_i runs at g_ratio/2 times clk_par_i, driving
+  -- on both edges, and is phase aligned to it
+  -------------------------------
+  clk_ser_i                                 : in  std_logic;
+  clk_par_i                                 : in  std_logic;
+  rst_n_i                                   : in  std_logic;
+
+  -------------------------------
+  -- OSERDES facing internal FPGA logic. par_i(0) is the first sample in
+  -- time (clk_par_i)
+  -------------------------------
+  par_i                                     : in  std_logic_vector(g_ratio-1 downto 0);
+
+  -------------------------------
+  -- OSERDES facing external FPGA logic
+  -------------------------------
+  ser_o                                     : out std_logic
+);
+end entity oserdes_generic;
+
+architecture rtl of oserdes_generic is
+
+  signal rst                                : std_logic;
+  -- OSERDESE2 inputs, d(1) being the first sample in time
+  signal d                                  : std_logic_vector(8 downto 1) := (others => '0');
+
+begin
+
+  assert (g_ratio = 4 or g_ratio = 6 or g_ratio = 8)
+  report "[oserdes_generic] Only g_ratio = 4, 6 or 8 is supported"
+  severity failure;
+
+  rst <= not rst_n_i;
+
+  d(g_ratio downto 1) <= par_i;
+
+  cmp_xilinx_oserdes : oserdese2
+  generic map (
+    DATA_RATE_OQ                           => "DDR",
+    DATA_RATE_TQ                           => "SDR",
+    DATA_WIDTH                             => g_ratio,
+    INIT_OQ                                => '0',
+    INIT_TQ                                => '0',
+    SERDES_MODE                            => "MASTER",
+    SRVAL_OQ                               => '0',
+    SRVAL_TQ                               => '0',
+    TBYTE_CTL                              => "FALSE",
+    TBYTE_SRC                              => "FALSE",
+    TRISTATE_WIDTH                         => 1)
+  port map (
+    OFB                                    => open,
+    OQ                                     => ser_o,
+    SHIFTOUT1                              => open,
+    SHIFTOUT2                              => open,
+    TBYTEOUT                               => open,
+    TFB                                    => open,
+    TQ                                     => open,
+    CLK                                    => clk_ser_i,
+    CLKDIV                                 => clk_par_i,
+    D1                                     => d(1),
+    D2                                     => d(2),
+    D3                                     => d(3),
+    D4                                     => d(4),
+    D5                                     => d(5),
+    D6                                     => d(6),
+    D7                                     => d(7),
+    D8                                     => d(8),
+    OCE                                    => '1',
+    RST                                    => rst,
+    SHIFTIN1                               => '0',
+    SHIFTIN2                               => '0',
+    T1                                     => '0',
+    T2                                     => '0',
+    T3                                     => '0',
+    T4                                     => '0',
+    TBYTEIN                                => '0',
+    TCE                                    => '0'
+  );
+
+end rtl;
@@ -1,3 +1,4 @@
 files = [
-    "wishbone_tcp_server_pkg.vhd"
+    "wishbone_tcp_server_pkg.vhd",
+    "wishbone_tcp_server_bus_pkg.vhd",
 ]
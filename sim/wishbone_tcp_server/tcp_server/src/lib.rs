@@ -5,6 +5,7 @@
 //!
 //! ```bash
 //! $ ghdl -a --std=08 <path_to_wishbone_tcp_server>/wishbone_tcp_server_pkg.vhd
+//! $ ghdl -a --std=08 <path_to_wishbone_tcp_server>/wishbone_tcp_server_bus_pkg.vhd
 //! $ ghdl -a --std=08 testbench.vhd
 //! $ cargo build --release --manifest-path <path_to_wishbone_tcp_server>/tcp_server/Cargo.toml
 //! $ ghdl -e --std=08 -Wl,<path_to_wishbone_tcp_server>/tcp_server/target/release/libtcp_server.a -Wl,-lpthread testbench
@@ -18,13 +19,22 @@
 //! use ieee.numeric_std.all;
 //!
 //! library work;
+//! use work.wishbone_pkg.all;
 //! use work.wishbone_tcp_server_pkg.all;
+//! use work.wishbone_tcp_server_bus_pkg.all;
 //!
 //! entity testbench is
 //! end entity testbench;
 //!
 //! architecture simu of testbench is
+//!   signal clk    : std_logic := '0';
+//!   signal wb_out : t_wishbone_master_out;
+//!   signal wb_in  : t_wishbone_master_in;
 //! begin
+//!   clk <= not clk after 5 ns;
+//!
+//!   -- A pipelined Wishbone slave connected to wb_out and wb_in
+//!
 //!
 //!   process
 //!     variable wishbone_tcp_server: t_wishbone_tcp_server;
@@ -60,6 +70,9 @@
 //!           when PARSING_ERR =>
 //!             report "Parsing error";
 //!
+//!           when READ_BLOCK | WRITE_BLOCK =>
+//!             wishbone_tcp_server_run_block(wishbone_tcp_server, msg_type, clk, wb_out, wb_in);
+//!
 //!           when EXIT_SIMU =>
 //!             report "Exit simulation";
 //!             std.env.finish;
@@ -87,12 +100,47 @@
 //! * `debug` Prints internal debug information to the simulation process stdout. This command doesn't return anything;
 //! * `disconnect` Closes the current tcp socket. This command doesn't return anything;
 //! * `exit` Terminate the simulation process. This command doesn't return anything.
+//!
+//! ## TCP binary protocol
+//!
+//! Block accesses are sent as binary frames, which start with a byte in
+//! the 0xB0 - 0xB8 range and so can be mixed with the text commands. All
+//! fields are big-endian:
+//!
+//! * `0xB0 + 2*F + R`, address (4 bytes), number of words (4 bytes, 1 to
+//!   `MAX_BLOCK_WORDS`) and, for writes, the data words. `R` selects a
+//!   read and `F` keeps the address fixed (e.g. for FIFO ports) instead
+//!   of incrementing it by 4 after each word. The VHDL side gets a
+//!   `READ_BLOCK` or `WRITE_BLOCK` message and runs it as a Wishbone
+//!   burst;
+//! * `0xB8` Sync, answered by the server itself with a trailer once every
+//!   previous command has been run.
+//!
+//! Block reads are answered with every word, the ones after a failed
+//! access as zeros, followed by a trailer: a status byte (`O` ok, `E` bus
+//! error, `T` timeout, `P` a previous block write failed) and the number of
+//! words accessed before the failure (4 bytes). Block writes aren't
+//! answered, their failures are reported by the next trailer.
+//!
+//! Commands don't need to wait for the previous response, so a client can
+//! send a batch of writes and reads followed by a sync in a single round
+//! trip.
+//!
+//! ## Shared memory transport
+//!
+//! With `new_wishbone_tcp_server("shm:<name>")`, the same protocols are
+//! carried by lock-free rings in the shared memory object `/dev/shm/<name>`
+//! instead of a socket, see the `shm` module for the layout. Rust clients
+//! can use `shm::ShmClient`.
 
 // Copyright (c) 2023 CNPEM
 // Licensed under GNU Lesser General Public License (LGPL) v3.0
 // Author: Augusto Fraga Giachero
 
+pub mod shm;
+
 use std::net::{TcpListener, TcpStream, ToSocketAddrs, Shutdown};
+use std::io;
 use std::io::prelude::*;
 use std::io::BufReader;
 use std::slice;
@@ -137,8 +185,10 @@ pub struct GHDLFixedStdLogicVector <const N: usize> {
     array: [u8; N],
 }
 
-/// Indicate the message type
-#[repr(C)]
+/// Indicate the message type. GHDL passes enumerations with up to 256
+/// literals as a byte, in the order of t_wishbone_tcp_server_msg_type
+#[repr(u8)]
+#[derive(Debug, PartialEq)]
 pub enum WBMsgType {
     /// Write word from wishbone bus
     ReadData,
@@ -154,15 +204,78 @@ pub enum WBMsgType {
     ParsingErr,
     /// Exit command received
     Exit,
+    /// Read a block of words from wishbone bus
+    ReadBlock,
+    /// Write a block of words to wishbone bus
+    WriteBlock,
+}
+
+/// Result of a block access, as t_wishbone_tcp_server_status
+#[repr(u8)]
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub enum WBStatus {
+    Ok,
+    Err,
+    Timeout,
+}
+
+/// Binary frame opcodes and trailer status
+const OP_BLOCK: u8 = 0xb0;
+const OP_READ: u8 = 0x01;
+const OP_FIXED: u8 = 0x02;
+const OP_SYNC: u8 = 0xb8;
+const STS_OK: u8 = b'O';
+const STS_ERR: u8 = b'E';
+const STS_TIMEOUT: u8 = b'T';
+const STS_POSTED_ERR: u8 = b'P';
+
+/// Largest block of a single frame
+pub const MAX_BLOCK_WORDS: u32 = 1 << 20;
+
+/// Block access received in a binary frame
+#[derive(Debug, Default, PartialEq)]
+struct Block {
+    read: bool,
+    fixed: bool,
+    addr: u32,
+    count: u32,
+    /// Data to be written, or read so far
+    data: Vec<u32>,
+}
+
+/// Where clients connect from
+enum Listener {
+    Tcp(TcpListener),
+    Shm(shm::ShmServer),
+}
+
+/// Sending end of a client connection
+trait Connection: Write {
+    fn shutdown(&mut self);
+}
+
+impl Connection for TcpStream {
+    fn shutdown(&mut self) {
+        let _ = TcpStream::shutdown(self, Shutdown::Both);
+    }
+}
+
+impl Connection for shm::ShmWriter {
+    fn shutdown(&mut self) {
+        shm::ShmWriter::shutdown(self);
+    }
 }
 
 /// FOFB Server struct
 pub struct WBServer {
-    listener: TcpListener,
-    stream: Option<TcpStream>,
-    reader: Option<BufReader<TcpStream>>,
+    listener: Listener,
+    stream: Option<Box<dyn Connection>>,
+    reader: Option<BufReader<Box<dyn Read>>>,
     addr: u32,
     data: u32,
+    block: Block,
+    /// A block write failed since the last trailer
+    write_err: bool,
 }
 
 impl <const N: usize> GHDLFixedStdLogicVector<N> {
@@ -225,19 +338,28 @@ impl<'a> GHDLNaturalDimArr<'a> {
 /// Returns a pointer to a new `WBServer` instance
 ///
 /// # Arguments
-/// * `hostname` - GHDL string with hostname and port in the format "hostname:port"
+/// * `hostname` - GHDL string with hostname and port in the format
+///   "hostname:port", or "shm:name" for the shared memory transport
 #[no_mangle]
 pub extern fn new_wishbone_tcp_server(hostname: &GHDLNaturalDimArr) -> *mut WBServer {
     let host_str = hostname.get_str().unwrap();
-    let mut addr_iter = host_str.to_socket_addrs().unwrap();
-    let addr = addr_iter.next().unwrap();
+    let listener = match host_str.strip_prefix("shm:") {
+        Some(name) => Listener::Shm(shm::ShmServer::create(name).unwrap()),
+        None => {
+            let mut addr_iter = host_str.to_socket_addrs().unwrap();
+            let addr = addr_iter.next().unwrap();
+            Listener::Tcp(TcpListener::bind(addr).unwrap())
+        },
+    };
     Box::into_raw(Box::new(
         WBServer {
-            listener: TcpListener::bind(addr).unwrap(),
+            listener: listener,
             stream: None,
             reader: None,
             addr: 0,
             data: 0,
+            block: Block::default(),
+            write_err: false,
         }))
 }
 
@@ -247,10 +369,20 @@ pub extern fn new_wishbone_tcp_server(hostname: &GHDLNaturalDimArr) -> *mut WBSe
 /// * `fsrv` - WBServer instance pointer
 #[no_mangle]
 pub extern fn wishbone_tcp_server_wait_con(fsrv: &mut WBServer) {
-    let (socket, addr) = fsrv.listener.accept().unwrap();
-    println!("Connected! {:?}", addr);
-    fsrv.reader = Some(BufReader::new(socket.try_clone().unwrap()));
-    fsrv.stream = Some(socket);
+    match &fsrv.listener {
+        Listener::Tcp(listener) => {
+            let (socket, addr) = listener.accept().unwrap();
+            println!("Connected! {:?}", addr);
+            fsrv.reader = Some(BufReader::new(Box::new(socket.try_clone().unwrap())));
+            fsrv.stream = Some(Box::new(socket));
+        },
+        Listener::Shm(server) => {
+            let (reader, writer) = server.accept();
+            println!("Connected! (shared memory)");
+            fsrv.reader = Some(BufReader::new(Box::new(reader)));
+            fsrv.stream = Some(Box::new(writer));
+        },
+    }
 }
 
 /// Print internal state of the WBServer struct
@@ -260,6 +392,75 @@ pub extern fn wishbone_tcp_server_wait_con(fsrv: &mut WBServer) {
 fn print_state(fsrv: &WBServer) {
     println!("Address: 0x{:08x}", fsrv.addr);
     println!("Data: 0x{:08x}", fsrv.data);
+    println!("Block: {} {} words at 0x{:08x}{}",
+             if fsrv.block.read { "read" } else { "write" },
+             fsrv.block.count, fsrv.block.addr,
+             if fsrv.block.fixed { " (fixed)" } else { "" });
+}
+
+fn read_be32<R: Read>(reader: &mut R) -> io::Result<u32> {
+    let mut buf = [0u8; 4];
+    reader.read_exact(&mut buf)?;
+    Ok(u32::from_be_bytes(buf))
+}
+
+/// Parse the rest of a binary block frame, after its opcode
+///
+/// # Returns
+/// The block, or `None` if the frame is invalid. A client sending an
+/// invalid frame should reconnect, as the rest of the stream can't be
+/// parsed
+fn read_block<R: Read>(reader: &mut R, op: u8) -> io::Result<Option<Block>> {
+    if op & !(OP_READ | OP_FIXED) != OP_BLOCK {
+        return Ok(None);
+    }
+
+    let addr = read_be32(reader)?;
+    let count = read_be32(reader)?;
+    if count == 0 || count > MAX_BLOCK_WORDS {
+        return Ok(None);
+    }
+
+    let read = op & OP_READ != 0;
+    let mut data = Vec::with_capacity(count as usize);
+    if !read {
+        let mut buf = vec![0u8; 4 * count as usize];
+        reader.read_exact(&mut buf)?;
+        data.extend(buf.chunks_exact(4).map(|w| u32::from_be_bytes([w[0], w[1], w[2], w[3]])));
+    }
+
+    Ok(Some(Block {
+        read,
+        fixed: op & OP_FIXED != 0,
+        addr,
+        count,
+        data,
+    }))
+}
+
+/// Build the response of a block read, or of a sync if `block` is `None`
+fn block_response(block: Option<&Block>, status: WBStatus, done: u32, write_err: &mut bool) -> Vec<u8> {
+    let mut resp = Vec::new();
+
+    if let Some(block) = block {
+        resp.reserve(4 * block.count as usize + 5);
+        for i in 0..block.count as usize {
+            let word = if i < block.data.len() { block.data[i] } else { 0 };
+            resp.extend_from_slice(&word.to_be_bytes());
+        }
+    }
+
+    resp.push(match status {
+        WBStatus::Err => STS_ERR,
+        WBStatus::Timeout => STS_TIMEOUT,
+        WBStatus::Ok if *write_err => {
+            *write_err = false;
+            STS_POSTED_ERR
+        },
+        WBStatus::Ok => STS_OK,
+    });
+    resp.extend_from_slice(&done.to_be_bytes());
+    resp
 }
 
 fn parse_line(fsrv: &mut WBServer, line: &String) -> WBMsgType {
@@ -313,7 +514,7 @@ fn parse_line(fsrv: &mut WBServer, line: &String) -> WBMsgType {
                 WBMsgType::Debug
             },
             &"disconnect" => {
-                fsrv.stream.as_mut().unwrap().shutdown(Shutdown::Both).unwrap();
+                fsrv.stream.as_mut().unwrap().shutdown();
                 WBMsgType::Disconnected
             },
             &"exit" => WBMsgType::Exit,
@@ -331,17 +532,55 @@ fn parse_line(fsrv: &mut WBServer, line: &String) -> WBMsgType {
 /// * `msg_type` - A WBMsgType enum pointer for returning the message type received
 #[no_mangle]
 pub extern fn wishbone_tcp_server_wait_data(fsrv: &mut WBServer, msg_type: &mut WBMsgType) {
-    match &mut fsrv.reader {
-        None => *msg_type = WBMsgType::Disconnected,
-        Some(reader) => {
+    loop {
+        let reader = match &mut fsrv.reader {
+            None => {
+                *msg_type = WBMsgType::Disconnected;
+                return;
+            },
+            Some(reader) => reader,
+        };
+
+        let first = match reader.fill_buf() {
+            Ok(buf) if buf.len() > 0 => buf[0],
+            _ => {
+                *msg_type = WBMsgType::Disconnected;
+                return;
+            },
+        };
+
+        if first & 0xf0 != OP_BLOCK {
             let mut line = String::new();
-            let bytes = reader.read_line(&mut line).unwrap();
-            if bytes > 0 {
-                *msg_type = parse_line(fsrv, &line);
+            let bytes = reader.read_line(&mut line).unwrap_or(0);
+            *msg_type = if bytes > 0 {
+                parse_line(fsrv, &line)
             } else {
-                *msg_type = WBMsgType::Disconnected;
+                WBMsgType::Disconnected
+            };
+            return;
+        }
+
+        reader.consume(1);
+        if first == OP_SYNC {
+            // Every previous block has been run by the time the
+            // next message is asked for
+            let resp = block_response(None, WBStatus::Ok, 0, &mut fsrv.write_err);
+            if let Some(stream) = &mut fsrv.stream {
+                stream.write_all(&resp).unwrap();
             }
-        },
+            continue;
+        }
+
+        *msg_type = match read_block(reader, first) {
+            Ok(Some(block)) => {
+                let msg = if block.read { WBMsgType::ReadBlock } else { WBMsgType::WriteBlock };
+                fsrv.block = block;
+                msg
+            },
+            Ok(None) => WBMsgType::ParsingErr,
+            Err(_) => WBMsgType::Disconnected,
+        };
+        return;
     }
 }
 
@@ -373,6 +612,65 @@ pub extern fn wishbone_tcp_server_write_data(fsrv: &mut WBServer, data: &GHDLFix
     }
 }
 
+/// Get the address, length and addressing mode of the last block message
+///
+/// # Arguments
+/// * `fsrv` - WBServer instance pointer
+/// * `addr` - Address of the first word as std_logic_vector(31 downto 0)
+/// * `count` - Number of words
+/// * `fixed` - All words are accessed at `addr`
+#[no_mangle]
+pub extern fn wishbone_tcp_server_get_block(fsrv: &mut WBServer, addr: &mut GHDLFixedStdLogicVector<32>,
+                                            count: &mut i32, fixed: &mut u8) {
+    addr.from_u32(fsrv.block.addr);
+    *count = fsrv.block.count as i32;
+    *fixed = fsrv.block.fixed as u8;
+}
+
+/// Get a word to be written by the last block message
+///
+/// # Arguments
+/// * `fsrv` - WBServer instance pointer
+/// * `idx` - Word index, from 0
+/// * `data` - Data buffer as std_logic_vector(31 downto 0)
+#[no_mangle]
+pub extern fn wishbone_tcp_server_get_block_data(fsrv: &mut WBServer, idx: i32, data: &mut GHDLFixedStdLogicVector<32>) {
+    data.from_u32(*fsrv.block.data.get(idx as usize).unwrap_or(&0));
+}
+
+/// Append a word read by the last block message
+///
+/// # Arguments
+/// * `fsrv` - WBServer instance pointer
+/// * `data` - Data buffer as std_logic_vector(31 downto 0)
+#[no_mangle]
+pub extern fn wishbone_tcp_server_put_block_data(fsrv: &mut WBServer, data: &GHDLFixedStdLogicVector<32>) {
+    if fsrv.block.read && fsrv.block.data.len() < fsrv.block.count as usize {
+        fsrv.block.data.push(data.to_u32());
+    }
+}
+
+/// Finish the last block message. Reads are answered with the words
+/// appended so far, zeros for the other ones, and the trailer. A failed
+/// write is reported by the next trailer
+///
+/// # Arguments
+/// * `fsrv` - WBServer instance pointer
+/// * `status` - Bus access result
+/// * `done` - Number of words accessed before a failure
+#[no_mangle]
+pub extern fn wishbone_tcp_server_end_block(fsrv: &mut WBServer, status: WBStatus, done: i32) {
+    if !fsrv.block.read {
+        fsrv.write_err |= status != WBStatus::Ok;
+        return;
+    }
+
+    let resp = block_response(Some(&fsrv.block), status, done as u32, &mut fsrv.write_err);
+    if let Some(stream) = &mut fsrv.stream {
+        stream.write_all(&resp).unwrap();
+    }
+}
+
 /// Send event string
 ///
 /// # Arguments
@@ -408,3 +706,48 @@ pub extern fn wishbone_tcp_server_delete(fsrv: *mut WBServer) {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::io::Cursor;
+
+    #[test]
+    fn block_frames() {
+        let frame = [0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x02,
+                     0xde, 0xad, 0xbe, 0xef, 0x00, 0x00, 0x00, 0x2a];
+        let block = read_block(&mut Cursor::new(&frame[..]), OP_BLOCK).unwrap().unwrap();
+        assert!(!block.read && !block.fixed);
+        assert_eq!(block.addr, 0x01020304);
+        assert_eq!(block.data, vec![0xdeadbeef, 0x2a]);
+
+        let block = read_block(&mut Cursor::new(&frame[..8]), OP_BLOCK | OP_READ | OP_FIXED).unwrap().unwrap();
+        assert!(block.read && block.fixed);
+        assert_eq!(block.count, 2);
+        assert!(block.data.is_empty());
+
+        // Truncated data, empty and oversized blocks
+        assert!(read_block(&mut Cursor::new(&frame[..12]), OP_BLOCK).is_err());
+        let empty = [0u8; 8];
+        assert_eq!(read_block(&mut Cursor::new(&empty[..]), OP_BLOCK | OP_READ).unwrap(), None);
+        let huge = [0, 0, 0, 0, 0x00, 0x10, 0x00, 0x01];
+        assert_eq!(read_block(&mut Cursor::new(&huge[..]), OP_BLOCK | OP_READ).unwrap(), None);
+    }
+
+    #[test]
+    fn responses() {
+        let mut write_err = false;
+        let mut block = Block { read: true, count: 3, ..Block::default() };
+        block.data = vec![0x11223344];
+
+        // Words after a failure are zeros
+        assert_eq!(block_response(Some(&block), WBStatus::Err, 1, &mut write_err),
+                   vec![0x11, 0x22, 0x33, 0x44, 0, 0, 0, 0, 0, 0, 0, 0, b'E', 0, 0, 0, 1]);
+
+        // A failed write is reported once, and not hidden by a failed read
+        write_err = true;
+        assert_eq!(block_response(None, WBStatus::Timeout, 0, &mut write_err)[0], b'T');
+        assert_eq!(block_response(None, WBStatus::Ok, 0, &mut write_err), vec![b'P', 0, 0, 0, 0]);
+        assert_eq!(block_response(None, WBStatus::Ok, 0, &mut write_err)[0], b'O');
+    }
+}
@@ -0,0 +1,493 @@
+//! # Shared memory transport
+//!
+//! Carries the same text and binary protocols as the TCP socket, through
+//! two lock-free single-producer / single-consumer byte rings in a POSIX
+//! shared memory object (`/dev/shm/<name>`), so a local client doesn't pay
+//! a syscall and a loopback round trip per command. It's selected by
+//! passing `"shm:<name>"` to `new_wishbone_tcp_server`.
+//!
+//! ## Layout
+//!
+//! All fields are native-endian `u32`, each on its own 64-byte line:
+//!
+//! * offset 0: magic `SHM_MAGIC`, version, ring size in bytes (a power of
+//!   2) and, at offset 64, the connection state (0 idle, 1 connected, 2
+//!   closed by either side, 3 claimed by a connecting client);
+//! * offset 128: client to simulation ring, then simulation to client
+//!   ring. Each ring is its head (bytes written, updated by the producer),
+//!   tail at +64 (bytes read, updated by the consumer) and the data at
+//!   +128.
+//!
+//! A client connects by moving the state from 0 to 3 with a single
+//! compare-exchange, so only one client can win, then resetting both rings
+//! and setting the state to 1. After a close, the simulation only moves the
+//! state back to 0 once it's done with the connection and waits for the
+//! next one, so the rings are never reset under it. Data is written before
+//! the head is released, and read before the tail is released. Waiting sides spin, then yield, then sleep for a few
+//! microseconds.
+
+// Copyright (c) 2026 CNPEM
+// Licensed under GNU Lesser General Public License (LGPL) v3.0
+
+use std::ffi::c_void;
+use std::fs::{File, OpenOptions};
+use std::io;
+use std::io::prelude::*;
+use std::os::raw::c_int;
+use std::os::unix::io::AsRawFd;
+use std::ptr;
+use std::sync::atomic::{AtomicU32, Ordering};
+use std::sync::Arc;
+use std::thread;
+use std::time::Duration;
+
+pub const SHM_MAGIC: u32 = 0x5742_534d; // "WBSM"
+pub const SHM_VERSION: u32 = 1;
+pub const SHM_RING_SIZE: u32 = 1 << 20;
+
+const LINE: usize = 64;
+const STATE_OFS: usize = LINE;
+const RINGS_OFS: usize = 2 * LINE;
+const RING_DATA_OFS: usize = 2 * LINE;
+
+const STATE_IDLE: u32 = 0;
+const STATE_CONNECTED: u32 = 1;
+const STATE_CLOSED: u32 = 2;
+const STATE_CLAIMED: u32 = 3;
+
+/// Backoff steps a connecting client waits for the simulation to be done
+/// with the previous connection, about a second
+const CONNECT_WAIT: u32 = 1100 + 50_000;
+
+/// Client to simulation ring
+const RING_C2S: usize = 0;
+/// Simulation to client ring
+const RING_S2C: usize = 1;
+
+const PROT_READ: c_int = 1;
+const PROT_WRITE: c_int = 2;
+const MAP_SHARED: c_int = 1;
+
+extern "C" {
+    fn mmap(addr: *mut c_void, len: usize, prot: c_int, flags: c_int, fd: c_int, offset: i64) -> *mut c_void;
+    fn munmap(addr: *mut c_void, len: usize) -> c_int;
+}
+
+/// Spin, then yield, then sleep while waiting for the other side
+struct Backoff {
+    count: u32,
+}
+
+impl Backoff {
+    fn new() -> Backoff {
+        Backoff { count: 0 }
+    }
+
+    fn wait(&mut self) {
+        if self.count < 1000 {
+            std::hint::spin_loop();
+        } else if self.count < 1100 {
+            thread::yield_now();
+        } else {
+            thread::sleep(Duration::from_micros(20));
+        }
+        self.count = self.count.saturating_add(1);
+    }
+}
+
+/// Mapped shared memory object
+pub struct Shm {
+    base: *mut u8,
+    len: usize,
+    ring_size: u32,
+    _file: File,
+}
+
+// The mapping is only accessed through atomics and the SPSC protocol
+unsafe impl Send for Shm {}
+unsafe impl Sync for Shm {}
+
+impl Shm {
+    fn path(name: &str) -> String {
+        format!("/dev/shm/{}", name)
+    }
+
+    fn map(file: &File, len: usize) -> io::Result<*mut u8> {
+        let p = unsafe {
+            mmap(ptr::null_mut(), len, PROT_READ | PROT_WRITE, MAP_SHARED, file.as_raw_fd(), 0)
+        };
+        if p as isize == -1 {
+            return Err(io::Error::last_os_error());
+        }
+        Ok(p as *mut u8)
+    }
+
+    /// Create (or recreate) the shared memory object `name`, for the
+    /// simulation side
+    pub fn create(name: &str, ring_size: u32) -> io::Result<Shm> {
+        if !ring_size.is_power_of_two() {
+            return Err(io::Error::new(io::ErrorKind::InvalidInput, "ring size must be a power of 2"));
+        }
+        let len = RINGS_OFS + 2 * (RING_DATA_OFS + ring_size as usize);
+        let path = Shm::path(name);
+        let file = OpenOptions::new().read(true).write(true).create(true).truncate(true).open(&path)?;
+        file.set_len(len as u64)?;
+        let base = Shm::map(&file, len)?;
+
+        let shm = Shm { base, len, ring_size, _file: file };
+        shm.field(8).store(ring_size, Ordering::Relaxed);
+        shm.field(4).store(SHM_VERSION, Ordering::Relaxed);
+        shm.field(STATE_OFS).store(STATE_IDLE, Ordering::Relaxed);
+        shm.field(0).store(SHM_MAGIC, Ordering::Release);
+        Ok(shm)
+    }
+
+    /// Open the shared memory object `name`, for the client side
+    pub fn open(name: &str) -> io::Result<Shm> {
+        let file = OpenOptions::new().read(true).write(true).open(Shm::path(name))?;
+        let file_len = file.metadata()?.len() as usize;
+        if file_len < RINGS_OFS {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "shared memory object too small"));
+        }
+        let base = Shm::map(&file, file_len)?;
+        let mut shm = Shm { base, len: file_len, ring_size: 0, _file: file };
+
+        shm.ring_size = shm.field(8).load(Ordering::Relaxed);
+        if shm.field(0).load(Ordering::Acquire) != SHM_MAGIC ||
+            shm.field(4).load(Ordering::Relaxed) != SHM_VERSION ||
+            !shm.ring_size.is_power_of_two() ||
+            RINGS_OFS + 2 * (RING_DATA_OFS + shm.ring_size as usize) > file_len {
+                return Err(io::Error::new(io::ErrorKind::InvalidData, "not a wishbone shared memory object"));
+            }
+        Ok(shm)
+    }
+
+    fn field(&self, ofs: usize) -> &AtomicU32 {
+        unsafe { &*(self.base.add(ofs) as *const AtomicU32) }
+    }
+
+    fn ring_ofs(&self, ring: usize) -> usize {
+        RINGS_OFS + ring * (RING_DATA_OFS + self.ring_size as usize)
+    }
+
+    fn head(&self, ring: usize) -> &AtomicU32 {
+        self.field(self.ring_ofs(ring))
+    }
+
+    fn tail(&self, ring: usize) -> &AtomicU32 {
+        self.field(self.ring_ofs(ring) + LINE)
+    }
+
+    fn data(&self, ring: usize) -> *mut u8 {
+        unsafe { self.base.add(self.ring_ofs(ring) + RING_DATA_OFS) }
+    }
+
+    fn state(&self) -> u32 {
+        self.field(STATE_OFS).load(Ordering::Acquire)
+    }
+
+    fn set_state(&self, state: u32) {
+        self.field(STATE_OFS).store(state, Ordering::Release);
+    }
+
+    /// Close the connection, if it's still the one open
+    fn close(&self) {
+        let _ = self.field(STATE_OFS).compare_exchange(
+            STATE_CONNECTED, STATE_CLOSED, Ordering::Release, Ordering::Relaxed);
+    }
+
+    /// Copy as many bytes as there is room for into `ring`
+    fn push(&self, ring: usize, buf: &[u8]) -> usize {
+        let head = self.head(ring).load(Ordering::Relaxed);
+        let tail = self.tail(ring).load(Ordering::Acquire);
+        let size = self.ring_size;
+        let n = buf.len().min((size - head.wrapping_sub(tail)) as usize);
+        let pos = (head & (size - 1)) as usize;
+        let first = n.min(size as usize - pos);
+
+        unsafe {
+            ptr::copy_nonoverlapping(buf.as_ptr(), self.data(ring).add(pos), first);
+            ptr::copy_nonoverlapping(buf.as_ptr().add(first), self.data(ring), n - first);
+        }
+        self.head(ring).store(head.wrapping_add(n as u32), Ordering::Release);
+        n
+    }
+
+    /// Copy as many bytes as available from `ring`
+    fn pop(&self, ring: usize, buf: &mut [u8]) -> usize {
+        let tail = self.tail(ring).load(Ordering::Relaxed);
+        let head = self.head(ring).load(Ordering::Acquire);
+        let size = self.ring_size;
+        let n = buf.len().min(head.wrapping_sub(tail) as usize);
+        let pos = (tail & (size - 1)) as usize;
+        let first = n.min(size as usize - pos);
+
+        unsafe {
+            ptr::copy_nonoverlapping(self.data(ring).add(pos), buf.as_mut_ptr(), first);
+            ptr::copy_nonoverlapping(self.data(ring), buf.as_mut_ptr().add(first), n - first);
+        }
+        self.tail(ring).store(tail.wrapping_add(n as u32), Ordering::Release);
+        n
+    }
+
+    /// Blocking read. Returns 0 once the connection is closed and the
+    /// ring is empty
+    fn read_ring(&self, ring: usize, buf: &mut [u8]) -> io::Result<usize> {
+        let mut backoff = Backoff::new();
+        loop {
+            let n = self.pop(ring, buf);
+            if n > 0 || buf.is_empty() {
+                return Ok(n);
+            }
+            // Data written before the close is still read
+            if self.state() != STATE_CONNECTED {
+                return Ok(self.pop(ring, buf));
+            }
+            backoff.wait();
+        }
+    }
+
+    /// Blocking write of the whole buffer
+    fn write_ring(&self, ring: usize, mut buf: &[u8]) -> io::Result<usize> {
+        let len = buf.len();
+        let mut backoff = Backoff::new();
+        while !buf.is_empty() {
+            if self.state() != STATE_CONNECTED {
+                return Err(io::Error::new(io::ErrorKind::BrokenPipe, "shared memory connection closed"));
+            }
+            let n = self.push(ring, buf);
+            if n > 0 {
+                buf = &buf[n..];
+                backoff = Backoff::new();
+            } else {
+                backoff.wait();
+            }
+        }
+        Ok(len)
+    }
+}
+
+impl Drop for Shm {
+    fn drop(&mut self) {
+        unsafe {
+            munmap(self.base as *mut c_void, self.len);
+        }
+    }
+}
+
+/// Simulation side of the transport
+pub struct ShmServer {
+    shm: Arc<Shm>,
+}
+
+impl ShmServer {
+    pub fn create(name: &str) -> io::Result<ShmServer> {
+        Ok(ShmServer { shm: Arc::new(Shm::create(name, SHM_RING_SIZE)?) })
+    }
+
+    /// Wait for a client to connect, returning the reader and writer of
+    /// the connection
+    pub fn accept(&self) -> (ShmReader, ShmWriter) {
+        // Done with the previous connection, if any: a client may reset the
+        // rings now
+        let _ = self.shm.field(STATE_OFS).compare_exchange(
+            STATE_CLOSED, STATE_IDLE, Ordering::Release, Ordering::Relaxed);
+        let mut backoff = Backoff::new();
+        while self.shm.state() != STATE_CONNECTED {
+            backoff.wait();
+        }
+        (ShmReader { shm: self.shm.clone(), ring: RING_C2S },
+         ShmWriter { shm: self.shm.clone(), ring: RING_S2C })
+    }
+}
+
+/// Receiving end of a connection
+pub struct ShmReader {
+    shm: Arc<Shm>,
+    ring: usize,
+}
+
+impl Read for ShmReader {
+    fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
+        self.shm.read_ring(self.ring, buf)
+    }
+}
+
+/// Sending end of a connection
+pub struct ShmWriter {
+    shm: Arc<Shm>,
+    ring: usize,
+}
+
+impl ShmWriter {
+    /// Close the connection, the other side reads the remaining data
+    pub fn shutdown(&self) {
+        self.shm.close();
+    }
+}
+
+impl Write for ShmWriter {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        self.shm.write_ring(self.ring, buf)
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+/// Client side of the transport, e.g. for driver tests written in Rust.
+/// The connection is closed when it's dropped
+pub struct ShmClient {
+    shm: Shm,
+}
+
+impl ShmClient {
+    /// Connect to the simulation serving `name`. Fails if another client
+    /// is connected, and waits for the simulation to be done with a closed
+    /// connection
+    pub fn connect(name: &str) -> io::Result<ShmClient> {
+        let shm = Shm::open(name)?;
+        let mut backoff = Backoff::new();
+        loop {
+            match shm.field(STATE_OFS).compare_exchange(
+                STATE_IDLE, STATE_CLAIMED, Ordering::Acquire, Ordering::Acquire) {
+                Ok(_) => break,
+                Err(STATE_CLOSED) if backoff.count < CONNECT_WAIT => backoff.wait(),
+                Err(STATE_CLOSED) => {
+                    return Err(io::Error::new(io::ErrorKind::TimedOut,
+                                              "the simulation is still closing the previous connection"));
+                },
+                Err(_) => {
+                    return Err(io::Error::new(io::ErrorKind::AddrInUse, "a client is already connected"));
+                },
+            }
+        }
+        for ring in [RING_C2S, RING_S2C] {
+            shm.head(ring).store(0, Ordering::Relaxed);
+            shm.tail(ring).store(0, Ordering::Relaxed);
+        }
+        shm.set_state(STATE_CONNECTED);
+        Ok(ShmClient { shm })
+    }
+}
+
+impl Read for ShmClient {
+    fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
+        self.shm.read_ring(RING_S2C, buf)
+    }
+}
+
+impl Write for ShmClient {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        self.shm.write_ring(RING_C2S, buf)
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+impl Drop for ShmClient {
+    fn drop(&mut self) {
+        self.shm.close();
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn ring_wraps() {
+        let name = format!("wb_shm_test_ring_{}", std::process::id());
+        let shm = Shm::create(&name, 16).unwrap();
+        shm.set_state(STATE_CONNECTED);
+
+        let mut out = [0u8; 16];
+        for round in 0..10u8 {
+            let data: Vec<u8> = (0..11).map(|i| round.wrapping_mul(31).wrapping_add(i)).collect();
+            assert_eq!(shm.push(RING_C2S, &data), 11);
+            assert_eq!(shm.push(RING_C2S, &data), 5);
+            assert_eq!(shm.pop(RING_C2S, &mut out), 16);
+            assert_eq!(&out[..11], &data[..]);
+            assert_eq!(&out[11..], &data[..5]);
+        }
+        std::fs::remove_file(Shm::path(&name)).unwrap();
+    }
+
+    #[test]
+    fn stream() {
+        let name = format!("wb_shm_test_stream_{}", std::process::id());
+        let server = ShmServer::create(&name).unwrap();
+
+        let client_name = name.clone();
+        let client = thread::spawn(move || {
+            let mut c = ShmClient::connect(&client_name).unwrap();
+            // Larger than the ring, to exercise the blocking paths
+            let data: Vec<u8> = (0..3 * SHM_RING_SIZE).map(|i| (i % 251) as u8).collect();
+            c.write_all(&data).unwrap();
+            let mut echo = [0u8; 4];
+            c.read_exact(&mut echo).unwrap();
+            assert_eq!(&echo, b"done");
+        });
+
+        let (mut rd, mut wr) = server.accept();
+        let mut data = Vec::new();
+        let mut buf = vec![0u8; 4096];
+        while data.len() < 3 * SHM_RING_SIZE as usize {
+            let n = rd.read(&mut buf).unwrap();
+            data.extend_from_slice(&buf[..n]);
+        }
+        assert!(data.iter().enumerate().all(|(i, b)| *b == (i % 251) as u8));
+        wr.write_all(b"done").unwrap();
+
+        client.join().unwrap();
+        // Closed by the client
+        assert_eq!(rd.read(&mut buf).unwrap(), 0);
+        std::fs::remove_file(Shm::path(&name)).unwrap();
+    }
+
+    #[test]
+    fn single_client() {
+        let name = format!("wb_shm_test_single_{}", std::process::id());
+        let server = ShmServer::create(&name).unwrap();
+
+        // Only one of several clients racing for the rings gets them
+        let clients: Vec<_> = (0..8).map(|_| {
+            let client_name = name.clone();
+            thread::spawn(move || ShmClient::connect(&client_name))
+        }).collect();
+        let mut results: Vec<_> = clients.into_iter().map(|c| c.join().unwrap()).collect();
+        assert_eq!(results.iter().filter(|r| r.is_ok()).count(), 1);
+        assert!(results.iter().filter_map(|r| r.as_ref().err())
+                .all(|e| e.kind() == io::ErrorKind::AddrInUse));
+
+        let (mut rd, _wr) = server.accept();
+        let mut c = results.drain(..).find_map(|r| r.ok()).unwrap();
+        c.write_all(b"old").unwrap();
+        drop(c);
+
+        // A new client waits until the simulation is done with the closed
+        // connection, whose data is still there to be read
+        let client_name = name.clone();
+        let client = thread::spawn(move || {
+            let mut c = ShmClient::connect(&client_name).unwrap();
+            c.write_all(b"new").unwrap();
+            c
+        });
+        thread::sleep(Duration::from_millis(50));
+        let mut buf = [0u8; 8];
+        assert_eq!(rd.read(&mut buf).unwrap(), 3);
+        assert_eq!(&buf[..3], b"old");
+        assert_eq!(rd.read(&mut buf).unwrap(), 0);
+        assert_eq!(server.shm.state(), STATE_CLOSED);
+
+        let (mut rd, _wr) = server.accept();
+        let c = client.join().unwrap();
+        rd.read_exact(&mut buf[..3]).unwrap();
+        assert_eq!(&buf[..3], b"new");
+        drop(c);
+        std::fs::remove_file(Shm::path(&name)).unwrap();
+    }
+}
@@ -0,0 +1,116 @@
+-------------------------------------------------------------------------------
+-- Title      : Wishbone TCP Server bus procedures
+-------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-GIE
+-- Platform   : Simulation / GHDL
+-- Standard   : VHDL 2008
+-------------------------------------------------------------------------------
+-- Description: Run the block messages of the wishbone tcp server as
+--              pipelined Wishbone bursts
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+-- Revisions  :
+-- Date        Version  Author                Description
+-- 2026-10-17  1.0                            Created
+-------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library work;
+use work.wishbone_pkg.all;
+use work.wishbone_tcp_server_pkg.all;
+
+package wishbone_tcp_server_bus_pkg is
+  -- Run the last READ_BLOCK or WRITE_BLOCK message as a pipelined
+  -- Wishbone burst and answer it. Requests are issued back to back while
+  -- wb_i.stall is '0', and cyc is held until every request has been
+  -- acknowledged. An err or rty, or 'timeout' cycles without an ack,
+  -- aborts the burst. Classic slaves need a wb_slave_adapter.
+  procedure wishbone_tcp_server_run_block(variable obj      : in  t_wishbone_tcp_server;
+                                          constant msg_type : in  t_wishbone_tcp_server_msg_type;
+                                          signal   clk      : in  std_logic;
+                                          signal   wb_o     : out t_wishbone_master_out;
+                                          signal   wb_i     : in  t_wishbone_master_in;
+                                          constant timeout  : in  natural := 1000);
+end package wishbone_tcp_server_bus_pkg;
+
+package body wishbone_tcp_server_bus_pkg is
+  procedure wishbone_tcp_server_run_block(variable obj      : in  t_wishbone_tcp_server;
+                                          constant msg_type : in  t_wishbone_tcp_server_msg_type;
+                                          signal   clk      : in  std_logic;
+                                          signal   wb_o     : out t_wishbone_master_out;
+                                          signal   wb_i     : in  t_wishbone_master_in;
+                                          constant timeout  : in  natural := 1000) is
+    variable addr     : std_logic_vector(31 downto 0);
+    variable data     : std_logic_vector(31 downto 0);
+    variable count    : integer;
+    variable fixed    : boolean;
+    variable is_write : boolean;
+    variable stb      : boolean;
+    variable issued   : natural := 0;
+    variable acked    : natural := 0;
+    variable idle_cnt : natural := 0;
+    variable status   : t_wishbone_tcp_server_status := BUS_OK;
+  begin
+    wishbone_tcp_server_get_block(obj, addr, count, fixed);
+    is_write := msg_type = WRITE_BLOCK;
+
+    wb_o.cyc <= '1';
+    wb_o.stb <= '1';
+    wb_o.we <= '1' when is_write else '0';
+    wb_o.sel <= (others => '1');
+    wb_o.adr <= addr;
+    if is_write then
+      wishbone_tcp_server_get_block_data(obj, 0, data);
+      wb_o.dat <= data;
+    end if;
+    stb := true;
+
+    while acked < count loop
+      wait until rising_edge(clk);
+
+      -- Request accepted, issue the next one
+      if stb and wb_i.stall = '0' then
+        issued := issued + 1;
+        if issued = count then
+          stb := false;
+          wb_o.stb <= '0';
+        else
+          if not fixed then
+            addr := std_logic_vector(unsigned(addr) + 4);
+          end if;
+          wb_o.adr <= addr;
+          if is_write then
+            wishbone_tcp_server_get_block_data(obj, issued, data);
+            wb_o.dat <= data;
+          end if;
+        end if;
+      end if;
+
+      if wb_i.ack = '1' then
+        if not is_write then
+          wishbone_tcp_server_put_block_data(obj, wb_i.dat);
+        end if;
+        acked := acked + 1;
+        idle_cnt := 0;
+      elsif wb_i.err = '1' or wb_i.rty = '1' then
+        status := BUS_ERR;
+        exit;
+      elsif idle_cnt = timeout then
+        status := BUS_TIMEOUT;
+        exit;
+      else
+        idle_cnt := idle_cnt + 1;
+      end if;
+    end loop;
+
+    wb_o.cyc <= '0';
+    wb_o.stb <= '0';
+    wb_o.we <= '0';
+    wishbone_tcp_server_end_block(obj, status, acked);
+  end procedure;
+end package body wishbone_tcp_server_bus_pkg;
@@ -29,7 +29,10 @@ package wishbone_tcp_server_pkg is
   -- it as an argument to procedures and it seems that GHDL will automatically
   -- free the memory pointed by the 'access' type.
   type t_wishbone_tcp_server is access integer;
-  type t_wishbone_tcp_server_msg_type is (READ_DATA, WRITE_DATA, WAIT_EVENT, DEBUG, DISCONNECTED, PARSING_ERR, EXIT_SIMU);
+  type t_wishbone_tcp_server_msg_type is (READ_DATA, WRITE_DATA, WAIT_EVENT, DEBUG, DISCONNECTED, PARSING_ERR, EXIT_SIMU,
+                                          READ_BLOCK, WRITE_BLOCK);
+  -- Result of a block access
+  type t_wishbone_tcp_server_status is (BUS_OK, BUS_ERR, BUS_TIMEOUT);
 
   -- Create a new wishbone tcp server instance.
   impure function new_wishbone_tcp_server (hostname : string)
@@ -66,6 +69,34 @@ package wishbone_tcp_server_pkg is
                                                      event : in string);
   attribute foreign of wishbone_tcp_server_write_event: procedure is "VHPIDIRECT wishbone_tcp_server_write_event";
 
+  -- Get the address, number of words and addressing mode of the last
+  -- READ_BLOCK or WRITE_BLOCK message. If 'fixed' is true, every word is
+  -- accessed at 'addr', otherwise the address is incremented by 4 after
+  -- each word.
+  procedure wishbone_tcp_server_get_block(variable obj   : in  t_wishbone_tcp_server;
+                                          variable addr  : out std_logic_vector(31 downto 0);
+                                          variable count : out integer;
+                                          variable fixed : out boolean);
+  attribute foreign of wishbone_tcp_server_get_block : procedure is "VHPIDIRECT wishbone_tcp_server_get_block";
+
+  -- Get the word 'idx' (from 0) to be written by the last WRITE_BLOCK message
+  procedure wishbone_tcp_server_get_block_data(variable obj  : in  t_wishbone_tcp_server;
+                                                        idx  : in  integer;
+                                               variable data : out std_logic_vector(31 downto 0));
+  attribute foreign of wishbone_tcp_server_get_block_data : procedure is "VHPIDIRECT wishbone_tcp_server_get_block_data";
+
+  -- Append the next word read by the last READ_BLOCK message
+  procedure wishbone_tcp_server_put_block_data(variable obj  : in t_wishbone_tcp_server;
+                                                        data : in std_logic_vector(31 downto 0));
+  attribute foreign of wishbone_tcp_server_put_block_data : procedure is "VHPIDIRECT wishbone_tcp_server_put_block_data";
+
+  -- Finish the last block message, 'done' words were accessed before a
+  -- failure. Reads are answered to the client at this point
+  procedure wishbone_tcp_server_end_block(variable obj    : in t_wishbone_tcp_server;
+                                                   status : in t_wishbone_tcp_server_status;
+                                                   done   : in integer);
+  attribute foreign of wishbone_tcp_server_end_block : procedure is "VHPIDIRECT wishbone_tcp_server_end_block";
+
 end package wishbone_tcp_server_pkg;
 
 package body wishbone_tcp_server_pkg is
@@ -94,4 +125,24 @@ package body wishbone_tcp_server_pkg is
   procedure wishbone_tcp_server_write_event(variable obj   : in t_wishbone_tcp_server;
                                                      event : in string) is
   begin report "VHPIDIRECT wishbone_tcp_server_write_event" severity failure; end;
+
+  procedure wishbone_tcp_server_get_block(variable obj   : in  t_wishbone_tcp_server;
+                                          variable addr  : out std_logic_vector(31 downto 0);
+                                          variable count : out integer;
+                                          variable fixed : out boolean) is
+  begin report "VHPIDIRECT wishbone_tcp_server_get_block" severity failure; end;
+
+  procedure wishbone_tcp_server_get_block_data(variable obj  : in  t_wishbone_tcp_server;
+                                                        idx  : in  integer;
+                                               variable data : out std_logic_vector(31 downto 0)) is
+  begin report "VHPIDIRECT wishbone_tcp_server_get_block_data" severity failure; end;
+
+  procedure wishbone_tcp_server_put_block_data(variable obj  : in t_wishbone_tcp_server;
+                                                        data : in std_logic_vector(31 downto 0)) is
+  begin report "VHPIDIRECT wishbone_tcp_server_put_block_data" severity failure; end;
+
+  procedure wishbone_tcp_server_end_block(variable obj    : in t_wishbone_tcp_server;
+                                                   status : in t_wishbone_tcp_server_status;
+                                                   done   : in integer) is
+  begin report "VHPIDIRECT wishbone_tcp_server_end_block" severity failure; end;
 end package body wishbone_tcp_server_pkg;
@@ -36,6 +36,9 @@ ENTITY biquad_tb IS
     g_TEST_COEFFS_FILENAME  : STRING := "../biquad_coeffs.dat";
     -- File containing the values for x and the expected values for y
     g_TEST_X_Y_FILENAME     : STRING := "../biquad_x_y.dat";
+    -- If not empty, y is also written to this file, one binary string per
+    -- sample, for bit-exact comparisons (see modules/common/iir_filt/sw)
+    g_TEST_Y_DUMP_FILENAME  : STRING := "";
 
     -- Integer width of x
     g_X_INT_WIDTH           : NATURAL := 15;
@@ -108,7 +111,9 @@ BEGIN
 
   PROCESS
     FILE fin : TEXT;
+    FILE fout : TEXT;
     VARIABLE lin : LINE;
+    VARIABLE lout : LINE;
     VARIABLE aux : REAL;
   BEGIN
     rst_n <= '0';
@@ -126,6 +131,9 @@ BEGIN
     file_close(fin);
 
     file_open(fin, g_TEST_X_Y_FILENAME, read_mode);
+    IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+      file_open(fout, g_TEST_Y_DUMP_FILENAME, write_mode);
+    END IF;
     WHILE NOT endfile(fin)
     LOOP
       readline(fin, lin);
@@ -137,6 +145,10 @@ BEGIN
       f_wait_cycles(clk, 1);
       x_valid <= '0';
       f_wait_clocked_signal(clk, y_valid, '1');
+      IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+        write(lout, to_slv(y));
+        writeline(fout, lout);
+      END IF;
       read(lin, aux);
       IF ABS(to_real(y)/aux - 1.0) > 0.01 THEN
         REPORT "Too large error (> 1%): got " & REAL'image(to_real(y)) &
@@ -145,6 +157,9 @@ BEGIN
       END IF;
     END LOOP;
     file_close(fin);
+    IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+      file_close(fout);
+    END IF;
 
     finish;
   END PROCESS;
@@ -0,0 +1,9 @@
+files = [
+    "biquad_pipe_tb.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../modules/common",
+    ],
+}
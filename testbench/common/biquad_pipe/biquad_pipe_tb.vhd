@@ -0,0 +1,355 @@
+-------------------------------------------------------------------------------
+-- Title        : Pipelined Biquad Filter Testbench
+-- Project      :
+-------------------------------------------------------------------------------
+-- File         : biquad_pipe_tb.vhd
+-- Company      : CNPEM, LNLS - GIE
+-- Platform     : Simulation
+-- Standard     : VHDL'08
+-------------------------------------------------------------------------------
+-- Description  : Measures the frequency response of biquad_pipe and of
+--                biquad, both with the biquad_tb coefficients, by feeding
+--                them the same sines and correlating their outputs, and
+--                checks that gains (1% tolerance) and phases (0.01 rad)
+--                match. The analytic response is reported along.
+--
+--                biquad_pipe gets a sample every cycle: its y_valid_o must
+--                come c_BIQUAD_PIPE_LATENCY cycles after the first x_valid_i
+--                and then never drop. See ghdl/Manifest.py for a sweep over
+--                the look-ahead.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+LIBRARY ieee;
+USE ieee.std_logic_1164.ALL;
+USE ieee.fixed_pkg.ALL;
+USE ieee.math_real.ALL;
+
+LIBRARY std;
+USE std.env.finish;
+USE std.textio.ALL;
+
+LIBRARY work;
+USE work.ifc_common_pkg.ALL;
+
+ENTITY biquad_pipe_tb IS
+  GENERIC (
+    -- File containing the biquad's coefficients
+    g_TEST_COEFFS_FILENAME  : STRING := "../../biquad/biquad_coeffs.dat";
+
+    -- Integer width of x
+    g_X_INT_WIDTH           : NATURAL := 15;
+    -- Fractionary width of x
+    g_X_FRAC_WIDTH          : NATURAL := 10;
+
+    -- Integer width of coefficients
+    g_COEFF_INT_WIDTH       : NATURAL := 1;
+    -- Fractionary width of coefficients
+    g_COEFF_FRAC_WIDTH      : NATURAL := 31;
+
+    -- Integer width of y
+    g_Y_INT_WIDTH           : NATURAL := 15;
+    -- Fractionary width of y
+    g_Y_FRAC_WIDTH          : NATURAL := 10;
+
+    -- Extra bits for internal arithmetic
+    g_EXTRA_BITS            : NATURAL := 1;
+
+    -- Look-ahead of biquad_pipe
+    g_LOOKAHEAD             : NATURAL := 3
+  );
+END ENTITY biquad_pipe_tb;
+
+ARCHITECTURE test OF biquad_pipe_tb IS
+  PROCEDURE f_gen_clk(CONSTANT freq : IN    NATURAL;
+                      SIGNAL   clk  : INOUT STD_LOGIC) IS
+  BEGIN
+    LOOP
+      WAIT FOR (0.5 / REAL(freq)) * 1 sec;
+      clk <= NOT clk;
+    END LOOP;
+  END PROCEDURE f_gen_clk;
+
+  PROCEDURE f_wait_cycles(SIGNAL   clk    : IN STD_LOGIC;
+                          CONSTANT cycles : NATURAL) IS
+  BEGIN
+    FOR i IN 1 TO cycles LOOP
+      WAIT UNTIL rising_edge(clk);
+    END LOOP;
+  END PROCEDURE f_wait_cycles;
+
+  PROCEDURE f_wait_clocked_signal(SIGNAL clk : IN STD_LOGIC;
+                                  SIGNAL sig : IN STD_LOGIC;
+                                  val        : IN STD_LOGIC;
+                                  timeout    : IN NATURAL := 2147483647) IS
+  VARIABLE cnt : NATURAL := timeout;
+  BEGIN
+    WHILE sig /= val AND cnt > 0 LOOP
+      WAIT UNTIL rising_edge(clk);
+      cnt := cnt - 1;
+    END LOOP;
+  END PROCEDURE f_wait_clocked_signal;
+
+  CONSTANT c_SYS_CLOCK_FREQ : NATURAL := 100_000_000;
+
+  -- Each sine lasts c_SETTLE + c_MEAS samples, the last c_MEAS being
+  -- correlated. Its frequency is c_BINS(i)/c_MEAS cycles per sample, so
+  -- that the window holds a whole number of periods.
+  TYPE t_nat_arr IS ARRAY (NATURAL RANGE <>) OF NATURAL;
+  TYPE t_real_arr IS ARRAY (NATURAL RANGE <>) OF REAL;
+  CONSTANT c_BINS : t_nat_arr := (3, 40, 125, 250, 333, 480);
+  CONSTANT c_SETTLE : NATURAL := 200;
+  CONSTANT c_MEAS : NATURAL := 1000;
+  CONSTANT c_SEG : NATURAL := c_SETTLE + c_MEAS;
+  CONSTANT c_SAMPLES : NATURAL := c_BINS'LENGTH*c_SEG;
+  CONSTANT c_AMPLITUDE : REAL := 1000.0;
+
+  FUNCTION f_x(n : NATURAL) RETURN REAL IS
+  BEGIN
+    RETURN c_AMPLITUDE*sin(MATH_2_PI*REAL(c_BINS(n / c_SEG))*
+                           REAL(n MOD c_SEG)/REAL(c_MEAS));
+  END FUNCTION f_x;
+
+  -- Accumulates y, the n-th output, into the sin and cos correlations
+  PROCEDURE f_correlate(n        : IN    NATURAL;
+                        y        : IN    REAL;
+                        VARIABLE corr_sin : INOUT t_real_arr;
+                        VARIABLE corr_cos : INOUT t_real_arr) IS
+    VARIABLE v_bin : NATURAL := n / c_SEG;
+    VARIABLE v_ph : REAL;
+  BEGIN
+    IF v_bin < c_BINS'LENGTH AND n MOD c_SEG >= c_SETTLE THEN
+      v_ph := MATH_2_PI*REAL(c_BINS(v_bin))*REAL(n MOD c_SEG)/REAL(c_MEAS);
+      corr_sin(v_bin) := corr_sin(v_bin) + y*sin(v_ph);
+      corr_cos(v_bin) := corr_cos(v_bin) + y*cos(v_ph);
+    END IF;
+  END PROCEDURE f_correlate;
+
+  -- Wraps a phase difference to [-pi, pi]
+  FUNCTION f_wrap(ph : REAL) RETURN REAL IS
+  BEGIN
+    RETURN ph - MATH_2_PI*round(ph/MATH_2_PI);
+  END FUNCTION f_wrap;
+
+  SIGNAL clk : STD_LOGIC := '0';
+  SIGNAL rst_n : STD_LOGIC := '1';
+  SIGNAL coeffs : t_biquad_coeffs(
+                    b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+                  );
+  SIGNAL start : BOOLEAN := FALSE;
+
+  -- biquad
+  SIGNAL ref_x : SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
+  SIGNAL ref_x_valid : STD_LOGIC := '0';
+  SIGNAL ref_busy : STD_LOGIC := '0';
+  SIGNAL ref_y : SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
+  SIGNAL ref_y_valid : STD_LOGIC := '0';
+  SIGNAL ref_gain, ref_phase : t_real_arr(c_BINS'RANGE);
+  SIGNAL ref_done : BOOLEAN := FALSE;
+
+  -- biquad_pipe
+  SIGNAL x : SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
+  SIGNAL x_valid : STD_LOGIC := '0';
+  SIGNAL y : SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
+  SIGNAL y_valid : STD_LOGIC := '0';
+  SIGNAL gain, phase : t_real_arr(c_BINS'RANGE);
+  SIGNAL done : BOOLEAN := FALSE;
+BEGIN
+  f_gen_clk(c_SYS_CLOCK_FREQ, clk);
+
+  PROCESS
+    FILE fin : TEXT;
+    VARIABLE lin : LINE;
+    VARIABLE aux : REAL;
+    VARIABLE b0, b1, b2, a1, a2, w, h_re, h_im, h_gain, h_phase : REAL;
+  BEGIN
+    rst_n <= '0';
+    f_wait_cycles(clk, 1);
+    rst_n <= '1';
+
+    f_wait_cycles(clk, 1);
+    file_open(fin, g_TEST_COEFFS_FILENAME, read_mode);
+    readline(fin, lin);
+    read(lin, aux); coeffs.b0 <= to_sfixed(aux, coeffs.b0'LEFT, coeffs.b0'RIGHT);
+    read(lin, aux); coeffs.b1 <= to_sfixed(aux, coeffs.b1'LEFT, coeffs.b1'RIGHT);
+    read(lin, aux); coeffs.b2 <= to_sfixed(aux, coeffs.b2'LEFT, coeffs.b2'RIGHT);
+    read(lin, aux); coeffs.a1 <= to_sfixed(aux, coeffs.a1'LEFT, coeffs.a1'RIGHT);
+    read(lin, aux); coeffs.a2 <= to_sfixed(aux, coeffs.a2'LEFT, coeffs.a2'RIGHT);
+    file_close(fin);
+
+    -- biquad_pipe takes two rounds of 3*g_LOOKAHEAD cycles, at most, to
+    -- switch to the new coefficients
+    f_wait_cycles(clk, 6*g_LOOKAHEAD + 1);
+    start <= TRUE;
+
+    WAIT UNTIL ref_done AND done;
+
+    b0 := to_real(coeffs.b0);
+    b1 := to_real(coeffs.b1);
+    b2 := to_real(coeffs.b2);
+    a1 := to_real(coeffs.a1);
+    a2 := to_real(coeffs.a2);
+    FOR i IN c_BINS'RANGE LOOP
+      -- H(e^jw) = (b0 + b1*e^-jw + b2*e^-2jw)/(1 + a1*e^-jw + a2*e^-2jw)
+      w := MATH_2_PI*REAL(c_BINS(i))/REAL(c_MEAS);
+      h_re := b0 + b1*cos(w) + b2*cos(2.0*w);
+      h_im := -b1*sin(w) - b2*sin(2.0*w);
+      aux := 1.0 + a1*cos(w) + a2*cos(2.0*w);
+      h_phase := arctan(h_im, h_re) - arctan(-a1*sin(w) - a2*sin(2.0*w), aux);
+      h_gain := sqrt((h_re**2 + h_im**2)/(aux**2 + (a1*sin(w) + a2*sin(2.0*w))**2));
+
+      REPORT "f = " & REAL'image(REAL(c_BINS(i))/REAL(c_MEAS)) &
+             ": biquad_pipe " & REAL'image(gain(i)) & " @ " & REAL'image(phase(i)) &
+             ", biquad " & REAL'image(ref_gain(i)) & " @ " & REAL'image(ref_phase(i)) &
+             ", analytic " & REAL'image(h_gain) & " @ " & REAL'image(f_wrap(h_phase))
+      SEVERITY NOTE;
+
+      IF ABS(gain(i)/ref_gain(i) - 1.0) > 0.01 THEN
+        REPORT "Gain mismatch (> 1%) at f = " & REAL'image(REAL(c_BINS(i))/REAL(c_MEAS)) &
+               ": got " & REAL'image(gain(i)) &
+               " (biquad: " & REAL'image(ref_gain(i)) & ")"
+        SEVERITY ERROR;
+      END IF;
+      IF ABS(f_wrap(phase(i) - ref_phase(i))) > 0.01 THEN
+        REPORT "Phase mismatch (> 0.01 rad) at f = " & REAL'image(REAL(c_BINS(i))/REAL(c_MEAS)) &
+               ": got " & REAL'image(phase(i)) &
+               " (biquad: " & REAL'image(ref_phase(i)) & ")"
+        SEVERITY ERROR;
+      END IF;
+    END LOOP;
+
+    finish;
+  END PROCESS;
+
+  -- Feeds biquad, a sample at a time
+  PROCESS
+    VARIABLE v_corr_sin, v_corr_cos : t_real_arr(c_BINS'RANGE) := (OTHERS => 0.0);
+  BEGIN
+    WAIT UNTIL start;
+    FOR n IN 0 TO c_SAMPLES-1 LOOP
+      ref_x <= to_sfixed(f_x(n), ref_x'LEFT, ref_x'RIGHT);
+      f_wait_clocked_signal(clk, ref_busy, '0');
+      ref_x_valid <= '1';
+      f_wait_cycles(clk, 1);
+      ref_x_valid <= '0';
+      f_wait_clocked_signal(clk, ref_y_valid, '1');
+      f_correlate(n, to_real(ref_y), v_corr_sin, v_corr_cos);
+    END LOOP;
+
+    FOR i IN c_BINS'RANGE LOOP
+      ref_gain(i) <= 2.0*sqrt(v_corr_sin(i)**2 + v_corr_cos(i)**2)/(c_AMPLITUDE*REAL(c_MEAS));
+      ref_phase(i) <= arctan(v_corr_cos(i), v_corr_sin(i));
+    END LOOP;
+    ref_done <= TRUE;
+    WAIT;
+  END PROCESS;
+
+  -- Feeds biquad_pipe every cycle, then flushes it with zeros
+  PROCESS
+  BEGIN
+    WAIT UNTIL start;
+    x_valid <= '1';
+    FOR n IN 0 TO c_SAMPLES + c_BIQUAD_PIPE_LATENCY - 1 LOOP
+      IF n < c_SAMPLES THEN
+        x <= to_sfixed(f_x(n), x'LEFT, x'RIGHT);
+      ELSE
+        x <= (OTHERS => '0');
+      END IF;
+      f_wait_cycles(clk, 1);
+    END LOOP;
+    x_valid <= '0';
+    WAIT;
+  END PROCESS;
+
+  -- Checks the latency and that y_valid never drops, and correlates y
+  PROCESS
+    VARIABLE v_corr_sin, v_corr_cos : t_real_arr(c_BINS'RANGE) := (OTHERS => 0.0);
+    VARIABLE v_cycle, v_first_x, v_first_y : NATURAL := 0;
+    VARIABLE v_outs : NATURAL := 0;
+  BEGIN
+    WAIT UNTIL start;
+    f_wait_clocked_signal(clk, x_valid, '1');
+    v_first_x := v_cycle;
+
+    WHILE v_outs < c_SAMPLES LOOP
+      WAIT UNTIL rising_edge(clk);
+      v_cycle := v_cycle + 1;
+      IF y_valid = '1' THEN
+        IF v_outs = 0 THEN
+          v_first_y := v_cycle;
+          IF v_first_y - v_first_x /= c_BIQUAD_PIPE_LATENCY THEN
+            REPORT "Wrong latency: " & NATURAL'image(v_first_y - v_first_x) &
+                   " cycles (expected: " & NATURAL'image(c_BIQUAD_PIPE_LATENCY) & ")"
+            SEVERITY ERROR;
+          END IF;
+        END IF;
+        f_correlate(v_outs, to_real(y), v_corr_sin, v_corr_cos);
+        v_outs := v_outs + 1;
+      ELSIF v_outs > 0 THEN
+        REPORT "y_valid dropped after " & NATURAL'image(v_outs) & " samples"
+        SEVERITY ERROR;
+      END IF;
+    END LOOP;
+
+    REPORT "biquad_pipe (g_LOOKAHEAD = " & NATURAL'image(g_LOOKAHEAD) & "): " &
+           NATURAL'image(v_outs) & " samples in " &
+           NATURAL'image(v_cycle - v_first_y + 1) & " cycles, latency " &
+           NATURAL'image(v_first_y - v_first_x) & " cycles"
+    SEVERITY NOTE;
+
+    FOR i IN c_BINS'RANGE LOOP
+      gain(i) <= 2.0*sqrt(v_corr_sin(i)**2 + v_corr_cos(i)**2)/(c_AMPLITUDE*REAL(c_MEAS));
+      phase(i) <= arctan(v_corr_cos(i), v_corr_sin(i));
+    END LOOP;
+    done <= TRUE;
+    WAIT;
+  END PROCESS;
+
+  REF : biquad
+    GENERIC MAP (
+      g_X_INT_WIDTH       => g_X_INT_WIDTH,
+      g_X_FRAC_WIDTH      => g_X_FRAC_WIDTH,
+      g_COEFF_INT_WIDTH   => g_COEFF_INT_WIDTH,
+      g_COEFF_FRAC_WIDTH  => g_COEFF_FRAC_WIDTH,
+      g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
+      g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH,
+      g_EXTRA_BITS        => g_EXTRA_BITS
+    )
+    PORT MAP (
+      clk_i               => clk,
+      rst_n_i             => rst_n,
+      x_i                 => ref_x,
+      x_valid_i           => ref_x_valid,
+      coeffs_i            => coeffs,
+      busy_o              => ref_busy,
+      y_o                 => ref_y,
+      y_valid_o           => ref_y_valid
+    );
+
+  UUT : biquad_pipe
+    GENERIC MAP (
+      g_X_INT_WIDTH       => g_X_INT_WIDTH,
+      g_X_FRAC_WIDTH      => g_X_FRAC_WIDTH,
+      g_COEFF_INT_WIDTH   => g_COEFF_INT_WIDTH,
+      g_COEFF_FRAC_WIDTH  => g_COEFF_FRAC_WIDTH,
+      g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
+      g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH,
+      g_EXTRA_BITS        => g_EXTRA_BITS,
+      g_LOOKAHEAD         => g_LOOKAHEAD
+    )
+    PORT MAP (
+      clk_i               => clk,
+      rst_n_i             => rst_n,
+      x_i                 => x,
+      x_valid_i           => x_valid,
+      coeffs_i            => coeffs,
+      y_o                 => y,
+      y_valid_o           => y_valid
+    );
+END ARCHITECTURE test;
@@ -0,0 +1,11 @@
+action = "simulation"
+sim_tool = "ghdl"
+ghdl_opt = "--std=08"
+
+top_module = "biquad_pipe_tb"
+modules = {"local" : ["../"]}
+
+# Frequency response and throughput for a few look-aheads
+sim_post_cmd = " && ".join(
+    "ghdl -r --std=08 %s -gg_LOOKAHEAD=%d --assert-level=error" % (top_module, m)
+    for m in (3, 4, 8))
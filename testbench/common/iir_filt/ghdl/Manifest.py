@@ -5,4 +5,7 @@ ghdl_opt = "--std=08"
 top_module = "iir_filt_tb"
 modules = {"local" : ["../"]}
 
-sim_post_cmd = "ghdl -r --std=08 %s --wave=%s.ghw --assert-level=error" % (top_module, top_module)
+# Coefficients given directly, then through the shadow set
+sim_post_cmd = " && ".join((
+    "ghdl -r --std=08 %s --wave=%s.ghw --assert-level=error" % (top_module, top_module),
+    "ghdl -r --std=08 %s -gg_COEFFS_DOUBLE_BUFFER=true --assert-level=error" % top_module))
@@ -10,6 +10,15 @@
 -------------------------------------------------------------------------------
 -- Description  : Tests the IIR filter against values computed using floating
 --                point arithmetic. The error tolerance is 1%.
+--
+--                With g_COEFFS_DOUBLE_BUFFER, the coefficients are loaded
+--                through the shadow set while samples flow: set A first, then
+--                set B is written to the shadow set some samples before it is
+--                committed, and so on, with the commit at different points of
+--                a sample. The output is checked against a floating point
+--                model that switches sets at the first sample after the one
+--                the commit is taken at, so a set swapped mid-sample or at
+--                the wrong sample shows up as a too large error.
 -------------------------------------------------------------------------------
 -- Copyright (c) 2023
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -39,8 +48,14 @@ ENTITY iir_filt_tb IS
     -- File containing the biquad's coefficients
     -- This file must have at least g_NUM_BIQUADS lines of coefficients
     g_TEST_COEFFS_FILENAME  : STRING := "../iir_filt_coeffs.dat";
+    -- File containing the second set of coefficients, for
+    -- g_COEFFS_DOUBLE_BUFFER
+    g_TEST_COEFFS_B_FILENAME : STRING := "../iir_filt_coeffs_b.dat";
     -- File containing the values for x and the expected values for y
     g_TEST_X_Y_FILENAME     : STRING := "../iir_filt_x_y.dat";
+    -- If not empty, y is also written to this file, one binary string per
+    -- sample, for bit-exact comparisons (see modules/common/iir_filt/sw)
+    g_TEST_Y_DUMP_FILENAME  : STRING := "";
 
     -- Integer width of x
     g_X_INT_WIDTH           : NATURAL := 5;
@@ -60,7 +75,10 @@ ENTITY iir_filt_tb IS
     -- Extra bits for biquads' internal arithmetic
     g_ARITH_EXTRA_BITS      : NATURAL := 1;
     -- Extra bits for between-biquads cascade interfaces
-    g_IFCS_EXTRA_BITS       : NATURAL := 0
+    g_IFCS_EXTRA_BITS       : NATURAL := 0;
+
+    -- Load the coefficients through the shadow set
+    g_COEFFS_DOUBLE_BUFFER  : BOOLEAN := FALSE
   );
 END ENTITY iir_filt_tb;
 
@@ -96,6 +114,53 @@ ARCHITECTURE test OF iir_filt_tb IS
 
   CONSTANT c_SYS_CLOCK_FREQ : NATURAL := 100_000_000;
 
+  -- b0, b1, b2, a1, a2 of each biquad
+  TYPE t_real_biquad_coeffs IS ARRAY (0 TO 4) OF REAL;
+  TYPE t_real_coeffs IS ARRAY (0 TO g_NUM_BIQUADS-1) OF t_real_biquad_coeffs;
+  TYPE t_real_state IS ARRAY (0 TO g_NUM_BIQUADS-1) OF REAL;
+
+  -- Coefficient set changes for g_COEFFS_DOUBLE_BUFFER. Before sample
+  -- 'sample' is sent, the shadow set is written with set 'set' (0: A, 1: B,
+  -- -1: unchanged), and 'delay' cycles after x_valid is deasserted, the set
+  -- is committed (-1: no commit)
+  TYPE t_coeffs_step IS RECORD
+    sample  : NATURAL;
+    set     : INTEGER;
+    delay   : INTEGER;
+  END RECORD;
+  TYPE t_coeffs_steps IS ARRAY (NATURAL RANGE <>) OF t_coeffs_step;
+
+  CONSTANT c_COEFFS_STEPS : t_coeffs_steps := (
+    -- Set A, taken at the first sample, which still goes with all zeros
+    (sample => 0,   set => 0,  delay => 0),
+    -- Set B waits in the shadow set for 20 samples
+    (sample => 40,  set => 1,  delay => -1),
+    -- Commit sampled in the cycle before the b0 product of the first biquad:
+    -- taken at this sample
+    (sample => 60,  set => -1, delay => 0),
+    (sample => 100, set => 0,  delay => -1),
+    -- Commit sampled at or after the b0 product: taken at the next sample
+    (sample => 110, set => -1, delay => 3),
+    (sample => 150, set => 1,  delay => 1)
+  );
+
+  PROCEDURE f_read_coeffs(CONSTANT filename : IN  STRING;
+                          VARIABLE coeffs   : OUT t_real_coeffs) IS
+    FILE fin : TEXT;
+    VARIABLE lin : LINE;
+  BEGIN
+    file_open(fin, filename, read_mode);
+    FOR idx IN 0 TO g_NUM_BIQUADS-1
+    LOOP
+      readline(fin, lin);
+      FOR coeff IN 0 TO 4
+      LOOP
+        read(lin, coeffs(idx)(coeff));
+      END LOOP;
+    END LOOP;
+    file_close(fin);
+  END PROCEDURE f_read_coeffs;
+
   SIGNAL clk : STD_LOGIC := '0';
   SIGNAL rst_n : STD_LOGIC := '1';
   SIGNAL x : SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
@@ -107,6 +172,8 @@ ARCHITECTURE test OF iir_filt_tb IS
                     a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
                     a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
                   );
+  SIGNAL coeffs_commit : STD_LOGIC := '0';
+  SIGNAL coeffs_pending : STD_LOGIC;
   SIGNAL busy : STD_LOGIC := '0';
   SIGNAL y : SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
   SIGNAL y_valid : STD_LOGIC := '0';
@@ -115,45 +182,135 @@ BEGIN
 
   PROCESS
     FILE fin : TEXT;
+    FILE fout : TEXT;
     VARIABLE lin : LINE;
+    VARIABLE lout : LINE;
     VARIABLE aux : REAL;
+    VARIABLE set_a, set_b : t_real_coeffs;
+    VARIABLE ref_set, next_set : t_real_coeffs := (OTHERS => (OTHERS => 0.0));
+    VARIABLE shadow_set : t_real_coeffs := (OTHERS => (OTHERS => 0.0));
+    VARIABLE switch_at : INTEGER := -1;
+    VARIABLE w, w_d1, w_d2 : t_real_state := (OTHERS => 0.0);
+    VARIABLE x_real, y_ref : REAL;
+    VARIABLE n : NATURAL := 0;
+    VARIABLE step : NATURAL := 0;
+    VARIABLE commit_delay : INTEGER;
+
+    PROCEDURE f_set_coeffs(CONSTANT sets : IN t_real_coeffs) IS
+    BEGIN
+      FOR idx IN 0 TO g_NUM_BIQUADS-1
+      LOOP
+        coeffs(idx).b0 <= to_sfixed(sets(idx)(0), coeffs(idx).b0'LEFT, coeffs(idx).b0'RIGHT);
+        coeffs(idx).b1 <= to_sfixed(sets(idx)(1), coeffs(idx).b1'LEFT, coeffs(idx).b1'RIGHT);
+        coeffs(idx).b2 <= to_sfixed(sets(idx)(2), coeffs(idx).b2'LEFT, coeffs(idx).b2'RIGHT);
+        coeffs(idx).a1 <= to_sfixed(sets(idx)(3), coeffs(idx).a1'LEFT, coeffs(idx).a1'RIGHT);
+        coeffs(idx).a2 <= to_sfixed(sets(idx)(4), coeffs(idx).a2'LEFT, coeffs(idx).a2'RIGHT);
+      END LOOP;
+    END PROCEDURE f_set_coeffs;
   BEGIN
     rst_n <= '0';
     f_wait_cycles(clk, 1);
     rst_n <= '1';
 
-    file_open(fin, g_TEST_COEFFS_FILENAME, read_mode);
-    FOR idx IN 0 TO g_NUM_BIQUADS-1
-    LOOP
-      readline(fin, lin);
-      read(lin, aux); coeffs(idx).b0 <= to_sfixed(aux, coeffs(idx).b0'LEFT, coeffs(idx).b0'RIGHT);
-      read(lin, aux); coeffs(idx).b1 <= to_sfixed(aux, coeffs(idx).b1'LEFT, coeffs(idx).b1'RIGHT);
-      read(lin, aux); coeffs(idx).b2 <= to_sfixed(aux, coeffs(idx).b2'LEFT, coeffs(idx).b2'RIGHT);
-      read(lin, aux); coeffs(idx).a1 <= to_sfixed(aux, coeffs(idx).a1'LEFT, coeffs(idx).a1'RIGHT);
-      read(lin, aux); coeffs(idx).a2 <= to_sfixed(aux, coeffs(idx).a2'LEFT, coeffs(idx).a2'RIGHT);
-    END LOOP;
-    file_close(fin);
+    f_read_coeffs(g_TEST_COEFFS_FILENAME, set_a);
+    f_read_coeffs(g_TEST_COEFFS_B_FILENAME, set_b);
+    IF NOT g_COEFFS_DOUBLE_BUFFER THEN
+      f_set_coeffs(set_a);
+    END IF;
 
     file_open(fin, g_TEST_X_Y_FILENAME, read_mode);
+    IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+      file_open(fout, g_TEST_Y_DUMP_FILENAME, write_mode);
+    END IF;
     WHILE NOT endfile(fin)
     LOOP
       readline(fin, lin);
 
+      commit_delay := -1;
+      IF g_COEFFS_DOUBLE_BUFFER AND step <= c_COEFFS_STEPS'HIGH THEN
+        IF c_COEFFS_STEPS(step).sample = n THEN
+          IF c_COEFFS_STEPS(step).set >= 0 THEN
+            -- The shadow set must be held while a commit is in flight
+            f_wait_clocked_signal(clk, coeffs_pending, '0');
+            IF c_COEFFS_STEPS(step).set = 0 THEN
+              shadow_set := set_a;
+            ELSE
+              shadow_set := set_b;
+            END IF;
+            f_set_coeffs(shadow_set);
+          END IF;
+          commit_delay := c_COEFFS_STEPS(step).delay;
+          step := step + 1;
+        END IF;
+      END IF;
+
       read(lin, aux);
+      x_real := aux;
       x <= to_sfixed(aux, x'LEFT, x'RIGHT);
       f_wait_clocked_signal(clk, busy, '0');
       x_valid <= '1';
       f_wait_cycles(clk, 1);
       x_valid <= '0';
+      IF commit_delay >= 0 THEN
+        f_wait_cycles(clk, commit_delay);
+        coeffs_commit <= '1';
+        f_wait_cycles(clk, 1);
+        coeffs_commit <= '0';
+        -- The first biquad takes the commit at its b0 product (2 cycles after
+        -- sampling x_valid), if already pending then, or at the next sample's.
+        -- The set changes from the sample after the one it is taken at.
+        next_set := shadow_set;
+        IF commit_delay = 0 THEN
+          switch_at := n + 1;
+        ELSE
+          switch_at := n + 2;
+        END IF;
+      END IF;
       f_wait_clocked_signal(clk, y_valid, '1');
+      IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+        write(lout, to_slv(y));
+        writeline(fout, lout);
+      END IF;
       read(lin, aux);
-      IF ABS(to_real(y)/aux - 1.0) > 0.01 THEN
+
+      IF g_COEFFS_DOUBLE_BUFFER THEN
+        -- Direct form II, as computed by biquad.vhd
+        IF n = switch_at THEN
+          ref_set := next_set;
+        END IF;
+        y_ref := x_real;
+        FOR idx IN 0 TO g_NUM_BIQUADS-1
+        LOOP
+          w(idx) := y_ref - ref_set(idx)(3)*w_d1(idx) - ref_set(idx)(4)*w_d2(idx);
+          y_ref := ref_set(idx)(0)*w(idx) + ref_set(idx)(1)*w_d1(idx) +
+                   ref_set(idx)(2)*w_d2(idx);
+          w_d2(idx) := w_d1(idx);
+          w_d1(idx) := w(idx);
+        END LOOP;
+
+        IF ABS(to_real(y) - y_ref) > 0.01*ABS(y_ref) + 1.0e-3 THEN
+          REPORT "Sample " & NATURAL'image(n) & ": too large error (> 1%): got " &
+                 REAL'image(to_real(y)) & " (expected: " & REAL'image(y_ref) & ")"
+          SEVERITY ERROR;
+        END IF;
+
+        -- The last biquad takes the commit before its output is valid
+        IF (coeffs_pending = '1') /= (n < switch_at - 1) THEN
+          REPORT "Sample " & NATURAL'image(n) & ": unexpected coeffs_pending_o = " &
+                 STD_LOGIC'image(coeffs_pending)
+          SEVERITY ERROR;
+        END IF;
+      ELSIF ABS(to_real(y)/aux - 1.0) > 0.01 THEN
         REPORT "Too large error (> 1%): got " & REAL'image(to_real(y)) &
                " (expected: " & REAL'image(aux) & ")"
         SEVERITY ERROR;
       END IF;
+      n := n + 1;
     END LOOP;
     file_close(fin);
+    IF g_TEST_Y_DUMP_FILENAME'LENGTH > 0 THEN
+      file_close(fout);
+    END IF;
 
     finish;
   END PROCESS;
@@ -168,7 +325,8 @@ BEGIN
       g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
       g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH,
       g_ARITH_EXTRA_BITS  => g_ARITH_EXTRA_BITS,
-      g_IFCS_EXTRA_BITS   => g_IFCS_EXTRA_BITS
+      g_IFCS_EXTRA_BITS   => g_IFCS_EXTRA_BITS,
+      g_COEFFS_DOUBLE_BUFFER => g_COEFFS_DOUBLE_BUFFER
     )
     PORT MAP (
       clk_i               => clk,
@@ -176,6 +334,8 @@ BEGIN
       x_i                 => x,
       x_valid_i           => x_valid,
       coeffs_i            => coeffs,
+      coeffs_commit_i     => coeffs_commit,
+      coeffs_pending_o    => coeffs_pending,
       busy_o              => busy,
       y_o                 => y,
       y_valid_o           => y_valid
@@ -0,0 +1,9 @@
+files = [
+    "iir_filt_tdm_tb.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../modules/common",
+    ],
+}
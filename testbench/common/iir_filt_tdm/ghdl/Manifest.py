@@ -0,0 +1,11 @@
+action = "simulation"
+sim_tool = "ghdl"
+ghdl_opt = "--std=08"
+
+top_module = "iir_filt_tdm_tb"
+modules = {"local" : ["../"]}
+
+# Throughput and latency for a few channel counts
+sim_post_cmd = " && ".join(
+    "ghdl -r --std=08 %s -gg_NUM_CHANNELS=%d --assert-level=error" % (top_module, ch)
+    for ch in (1, 4, 16, 64))
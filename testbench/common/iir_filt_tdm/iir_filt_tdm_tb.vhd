@@ -0,0 +1,354 @@
+-------------------------------------------------------------------------------
+-- Title        : Time-multiplexed IIR Filter Testbench
+-- Project      :
+-------------------------------------------------------------------------------
+-- File         : iir_filt_tdm_tb.vhd
+-- Company      : CNPEM, LNLS - GIE
+-- Platform     : Simulation
+-- Standard     : VHDL'08
+-------------------------------------------------------------------------------
+-- Description  : Tests iir_filt_tdm against one iir_filt per channel, bit by
+--                bit. Channel ch gets the iir_filt_tb coefficients with the
+--                b's scaled by 1 + ch/(4*g_NUM_CHANNELS) and the iir_filt_tb
+--                x scaled by 1 - ch/(2*g_NUM_CHANNELS), so channel 0 is also
+--                checked against the floating point values (1% tolerance).
+--
+--                Then measures the throughput by streaming g_BENCH_FRAMES
+--                frames as fast as busy allows, and reports it along with
+--                the latency (first x of a frame to the last y) and the
+--                multipliers used. See ghdl/Manifest.py for a sweep over the
+--                number of channels.
+-------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+-------------------------------------------------------------------------------
+
+LIBRARY ieee;
+USE ieee.std_logic_1164.ALL;
+USE ieee.fixed_pkg.ALL;
+
+LIBRARY std;
+USE std.env.finish;
+USE std.textio.ALL;
+
+LIBRARY work;
+USE work.ifc_common_pkg.ALL;
+
+ENTITY iir_filt_tdm_tb IS
+  GENERIC (
+    -- Number of channels
+    g_NUM_CHANNELS          : NATURAL := 8;
+
+    -- Number of internal biquads
+    -- The order is given by 2*g_NUM_BIQUADS
+    g_NUM_BIQUADS           : NATURAL := 5;
+
+    -- File containing the biquad's coefficients
+    -- This file must have at least g_NUM_BIQUADS lines of coefficients
+    g_TEST_COEFFS_FILENAME  : STRING := "../../iir_filt/iir_filt_coeffs.dat";
+    -- File containing the values for x and the expected values for y
+    g_TEST_X_Y_FILENAME     : STRING := "../../iir_filt/iir_filt_x_y.dat";
+
+    -- Number of frames for the throughput measurement
+    g_BENCH_FRAMES          : NATURAL := 50;
+
+    -- Integer width of x
+    g_X_INT_WIDTH           : NATURAL := 5;
+    -- Fractionary width of x
+    g_X_FRAC_WIDTH          : NATURAL := 21;
+
+    -- Integer width of coefficients
+    g_COEFF_INT_WIDTH       : NATURAL := 3;
+    -- Fractionary width of coefficients
+    g_COEFF_FRAC_WIDTH      : NATURAL := 29;
+
+    -- Integer width of y
+    g_Y_INT_WIDTH           : NATURAL := 5;
+    -- Fractionary width of y
+    g_Y_FRAC_WIDTH          : NATURAL := 21;
+
+    -- Extra bits for biquads' internal arithmetic
+    g_ARITH_EXTRA_BITS      : NATURAL := 1;
+    -- Extra bits for between-biquads cascade interfaces
+    g_IFCS_EXTRA_BITS       : NATURAL := 0
+  );
+END ENTITY iir_filt_tdm_tb;
+
+ARCHITECTURE test OF iir_filt_tdm_tb IS
+  PROCEDURE f_gen_clk(CONSTANT freq : IN    NATURAL;
+                      SIGNAL   clk  : INOUT STD_LOGIC) IS
+  BEGIN
+    LOOP
+      WAIT FOR (0.5 / REAL(freq)) * 1 sec;
+      clk <= NOT clk;
+    END LOOP;
+  END PROCEDURE f_gen_clk;
+
+  PROCEDURE f_wait_cycles(SIGNAL   clk    : IN STD_LOGIC;
+                          CONSTANT cycles : NATURAL) IS
+  BEGIN
+    FOR i IN 1 TO cycles LOOP
+      WAIT UNTIL rising_edge(clk);
+    END LOOP;
+  END PROCEDURE f_wait_cycles;
+
+  PROCEDURE f_wait_clocked_signal(SIGNAL clk : IN STD_LOGIC;
+                                  SIGNAL sig : IN STD_LOGIC;
+                                  val        : IN STD_LOGIC;
+                                  timeout    : IN NATURAL := 2147483647) IS
+  VARIABLE cnt : NATURAL := timeout;
+  BEGIN
+    WHILE sig /= val AND cnt > 0 LOOP
+      WAIT UNTIL rising_edge(clk);
+      cnt := cnt - 1;
+    END LOOP;
+  END PROCEDURE f_wait_clocked_signal;
+
+  CONSTANT c_SYS_CLOCK_FREQ : NATURAL := 100_000_000;
+
+  SUBTYPE t_x IS SFIXED(g_X_INT_WIDTH-1 DOWNTO -g_X_FRAC_WIDTH);
+  SUBTYPE t_y IS SFIXED(g_Y_INT_WIDTH-1 DOWNTO -g_Y_FRAC_WIDTH);
+  TYPE t_x_arr IS ARRAY (NATURAL RANGE <>) OF t_x;
+  TYPE t_y_arr IS ARRAY (NATURAL RANGE <>) OF t_y;
+  TYPE t_ch_coeffs IS ARRAY (NATURAL RANGE <>) OF
+    t_iir_filt_coeffs(g_NUM_BIQUADS-1 DOWNTO 0)(
+      b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+      b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+      b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+      a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+      a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+    );
+  TYPE t_real_coeffs IS ARRAY (0 TO g_NUM_BIQUADS-1, 0 TO 4) OF REAL;
+
+  SIGNAL clk : STD_LOGIC := '0';
+  SIGNAL rst_n : STD_LOGIC := '1';
+  SIGNAL cycle : NATURAL := 0;
+
+  -- Time-multiplexed filter
+  SIGNAL x : t_x;
+  SIGNAL x_valid : STD_LOGIC := '0';
+  SIGNAL coeffs : t_biquad_coeffs(
+                    b0(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    b2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a1(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH),
+                    a2(g_COEFF_INT_WIDTH-1 DOWNTO -g_COEFF_FRAC_WIDTH)
+                  );
+  SIGNAL coeffs_ch : NATURAL RANGE 0 TO g_NUM_CHANNELS-1 := 0;
+  SIGNAL coeffs_biquad : NATURAL RANGE 0 TO g_NUM_BIQUADS-1 := 0;
+  SIGNAL coeffs_wr : STD_LOGIC := '0';
+  SIGNAL busy : STD_LOGIC;
+  SIGNAL y : t_y;
+  SIGNAL y_ch : NATURAL RANGE 0 TO g_NUM_CHANNELS-1;
+  SIGNAL y_valid : STD_LOGIC;
+
+  -- y of the last frame, by channel, and frames done so far
+  SIGNAL frame_y : t_y_arr(g_NUM_CHANNELS-1 DOWNTO 0);
+  SIGNAL frames_out : NATURAL := 0;
+  SIGNAL last_y_cycle : NATURAL := 0;
+
+  -- Reference filters
+  SIGNAL ref_x : t_x_arr(g_NUM_CHANNELS-1 DOWNTO 0);
+  SIGNAL ref_x_valid : STD_LOGIC := '0';
+  SIGNAL ref_coeffs : t_ch_coeffs(g_NUM_CHANNELS-1 DOWNTO 0);
+  SIGNAL ref_y : t_y_arr(g_NUM_CHANNELS-1 DOWNTO 0);
+  SIGNAL ref_y_valid : STD_LOGIC_VECTOR(g_NUM_CHANNELS-1 DOWNTO 0);
+  SIGNAL ref_frames_out : NATURAL := 0;
+BEGIN
+  f_gen_clk(c_SYS_CLOCK_FREQ, clk);
+
+  PROCESS(clk)
+  BEGIN
+    IF rising_edge(clk) THEN
+      cycle <= cycle + 1;
+      IF y_valid = '1' THEN
+        frame_y(y_ch) <= y;
+        IF y_ch = g_NUM_CHANNELS-1 THEN
+          frames_out <= frames_out + 1;
+          last_y_cycle <= cycle;
+        END IF;
+      END IF;
+      -- The references all run in lockstep
+      IF ref_y_valid(0) = '1' THEN
+        ref_frames_out <= ref_frames_out + 1;
+      END IF;
+    END IF;
+  END PROCESS;
+
+  PROCESS
+    FILE fin : TEXT;
+    VARIABLE lin : LINE;
+    VARIABLE aux : REAL;
+    VARIABLE real_coeffs : t_real_coeffs;
+    VARIABLE scale : REAL;
+    VARIABLE frames : NATURAL := 0;
+    VARIABLE first_x_cycle : NATURAL;
+    VARIABLE latency : NATURAL := 0;
+  BEGIN
+    rst_n <= '0';
+    f_wait_cycles(clk, 1);
+    rst_n <= '1';
+
+    file_open(fin, g_TEST_COEFFS_FILENAME, read_mode);
+    FOR idx IN 0 TO g_NUM_BIQUADS-1
+    LOOP
+      readline(fin, lin);
+      FOR k IN 0 TO 4 LOOP
+        read(lin, real_coeffs(idx, k));
+      END LOOP;
+    END LOOP;
+    file_close(fin);
+
+    FOR ch IN 0 TO g_NUM_CHANNELS-1
+    LOOP
+      scale := 1.0 + REAL(ch)/REAL(4*g_NUM_CHANNELS);
+      FOR idx IN 0 TO g_NUM_BIQUADS-1
+      LOOP
+        coeffs.b0 <= to_sfixed(scale*real_coeffs(idx, 0), coeffs.b0'LEFT, coeffs.b0'RIGHT);
+        coeffs.b1 <= to_sfixed(scale*real_coeffs(idx, 1), coeffs.b1'LEFT, coeffs.b1'RIGHT);
+        coeffs.b2 <= to_sfixed(scale*real_coeffs(idx, 2), coeffs.b2'LEFT, coeffs.b2'RIGHT);
+        coeffs.a1 <= to_sfixed(real_coeffs(idx, 3), coeffs.a1'LEFT, coeffs.a1'RIGHT);
+        coeffs.a2 <= to_sfixed(real_coeffs(idx, 4), coeffs.a2'LEFT, coeffs.a2'RIGHT);
+        coeffs_ch <= ch;
+        coeffs_biquad <= idx;
+        coeffs_wr <= '1';
+        f_wait_cycles(clk, 1);
+        ref_coeffs(ch)(idx) <= coeffs;
+      END LOOP;
+    END LOOP;
+    coeffs_wr <= '0';
+
+    -- One frame at a time, checked against the references
+    file_open(fin, g_TEST_X_Y_FILENAME, read_mode);
+    WHILE NOT endfile(fin)
+    LOOP
+      readline(fin, lin);
+      read(lin, aux);
+
+      FOR ch IN 0 TO g_NUM_CHANNELS-1
+      LOOP
+        ref_x(ch) <= to_sfixed(aux*(1.0 - REAL(ch)/REAL(2*g_NUM_CHANNELS)), x'LEFT, x'RIGHT);
+      END LOOP;
+
+      f_wait_clocked_signal(clk, busy, '0');
+      first_x_cycle := cycle + 1;
+      FOR ch IN 0 TO g_NUM_CHANNELS-1
+      LOOP
+        x <= to_sfixed(aux*(1.0 - REAL(ch)/REAL(2*g_NUM_CHANNELS)), x'LEFT, x'RIGHT);
+        x_valid <= '1';
+        ref_x_valid <= '1' WHEN ch = 0 ELSE '0';
+        f_wait_cycles(clk, 1);
+      END LOOP;
+      x_valid <= '0';
+      ref_x_valid <= '0';
+
+      frames := frames + 1;
+      WHILE frames_out /= frames OR ref_frames_out /= frames LOOP
+        WAIT UNTIL rising_edge(clk);
+      END LOOP;
+      latency := last_y_cycle - first_x_cycle;
+      FOR ch IN 0 TO g_NUM_CHANNELS-1
+      LOOP
+        IF to_slv(frame_y(ch)) /= to_slv(ref_y(ch)) THEN
+          REPORT "Channel " & NATURAL'image(ch) & ", frame " & NATURAL'image(frames) &
+                 ": got " & REAL'image(to_real(frame_y(ch))) &
+                 " (iir_filt: " & REAL'image(to_real(ref_y(ch))) & ")"
+          SEVERITY ERROR;
+        END IF;
+      END LOOP;
+
+      read(lin, aux);
+      IF ABS(to_real(frame_y(0))/aux - 1.0) > 0.01 THEN
+        REPORT "Too large error (> 1%): got " & REAL'image(to_real(frame_y(0))) &
+               " (expected: " & REAL'image(aux) & ")"
+        SEVERITY ERROR;
+      END IF;
+    END LOOP;
+    file_close(fin);
+
+    -- Back to back frames
+    f_wait_clocked_signal(clk, busy, '0');
+    first_x_cycle := cycle + 1;
+    FOR frame IN 1 TO g_BENCH_FRAMES
+    LOOP
+      FOR ch IN 0 TO g_NUM_CHANNELS-1
+      LOOP
+        x_valid <= '1';
+        -- Held until taken
+        LOOP
+          WAIT UNTIL rising_edge(clk);
+          EXIT WHEN busy = '0';
+        END LOOP;
+      END LOOP;
+    END LOOP;
+    x_valid <= '0';
+    frames := frames + g_BENCH_FRAMES;
+    WHILE frames_out /= frames LOOP
+      WAIT UNTIL rising_edge(clk);
+    END LOOP;
+
+    REPORT "iir_filt_tdm: " & NATURAL'image(g_NUM_CHANNELS) & " channels x " &
+           NATURAL'image(g_NUM_BIQUADS) & " biquads: " &
+           REAL'image(REAL(last_y_cycle - first_x_cycle)/REAL(g_BENCH_FRAMES)) &
+           " cycles/frame, latency " & NATURAL'image(latency) &
+           " cycles, 5 multipliers (iir_filt: " &
+           NATURAL'image(5*g_NUM_BIQUADS*g_NUM_CHANNELS) & ")"
+    SEVERITY NOTE;
+
+    finish;
+  END PROCESS;
+
+  UUT : iir_filt_tdm
+    GENERIC MAP (
+      g_NUM_CHANNELS      => g_NUM_CHANNELS,
+      g_NUM_BIQUADS       => g_NUM_BIQUADS,
+      g_X_INT_WIDTH       => g_X_INT_WIDTH,
+      g_X_FRAC_WIDTH      => g_X_FRAC_WIDTH,
+      g_COEFF_INT_WIDTH   => g_COEFF_INT_WIDTH,
+      g_COEFF_FRAC_WIDTH  => g_COEFF_FRAC_WIDTH,
+      g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
+      g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH,
+      g_ARITH_EXTRA_BITS  => g_ARITH_EXTRA_BITS,
+      g_IFCS_EXTRA_BITS   => g_IFCS_EXTRA_BITS
+    )
+    PORT MAP (
+      clk_i               => clk,
+      rst_n_i             => rst_n,
+      x_i                 => x,
+      x_valid_i           => x_valid,
+      coeffs_i            => coeffs,
+      coeffs_ch_i         => coeffs_ch,
+      coeffs_biquad_i     => coeffs_biquad,
+      coeffs_wr_i         => coeffs_wr,
+      busy_o              => busy,
+      y_o                 => y,
+      y_ch_o              => y_ch,
+      y_valid_o           => y_valid
+    );
+
+  gen_refs : FOR ch IN 0 TO g_NUM_CHANNELS-1
+    GENERATE
+      cmp_iir_filt : iir_filt
+        GENERIC MAP (
+          g_NUM_BIQUADS       => g_NUM_BIQUADS,
+          g_X_INT_WIDTH       => g_X_INT_WIDTH,
+          g_X_FRAC_WIDTH      => g_X_FRAC_WIDTH,
+          g_COEFF_INT_WIDTH   => g_COEFF_INT_WIDTH,
+          g_COEFF_FRAC_WIDTH  => g_COEFF_FRAC_WIDTH,
+          g_Y_INT_WIDTH       => g_Y_INT_WIDTH,
+          g_Y_FRAC_WIDTH      => g_Y_FRAC_WIDTH,
+          g_ARITH_EXTRA_BITS  => g_ARITH_EXTRA_BITS,
+          g_IFCS_EXTRA_BITS   => g_IFCS_EXTRA_BITS
+        )
+        PORT MAP (
+          clk_i               => clk,
+          rst_n_i             => rst_n,
+          x_i                 => ref_x(ch),
+          x_valid_i           => ref_x_valid,
+          coeffs_i            => ref_coeffs(ch),
+          busy_o              => OPEN,
+          y_o                 => ref_y(ch),
+          y_valid_o           => ref_y_valid(ch)
+        );
+    END GENERATE gen_refs;
+END ARCHITECTURE test;
@@ -0,0 +1,9 @@
+files = [
+    "mov_avg_bram_tb.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../modules/common"
+    ],
+}
@@ -0,0 +1,12 @@
+action = "simulation"
+sim_tool = "ghdl"
+top_module = "mov_avg_bram_tb"
+
+modules = {"local" : ["../"]}
+
+ghdl_opt = "--std=08"
+
+# A single channel and a few interleaved ones
+sim_post_cmd = " && ".join(
+    "ghdl -r --std=08 %s -gg_NUM_CHANNELS=%d --assert-level=error" % (top_module, ch)
+    for ch in (1, 4, 16))
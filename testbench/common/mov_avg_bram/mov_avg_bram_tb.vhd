@@ -0,0 +1,212 @@
+--------------------------------------------------------------------------------
+-- Title      : BRAM-backed moving average filter testbench
+--------------------------------------------------------------------------------
+-- File       : mov_avg_bram_tb.vhd
+-- Company    : CNPEM, LNLS - GIE
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Testbench for mov_avg_bram core. Streams random data, with
+--              random gaps, through a sequence of lengths (not only powers of
+--              2) switched in the middle of the stream, and checks every
+--              output against floor(sum/length) over the last length_o
+--              samples of the same channel. There is no truncation error to
+--              allow for. The channels take turns at random. See
+--              ghdl/Manifest.py for a sweep over the number of channels.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.math_real.all;
+
+library std;
+use std.env.finish;
+use std.textio.all;
+
+library work;
+use work.ifc_common_pkg.all;
+
+entity mov_avg_bram_tb is
+  generic (
+    -- Number of interleaved channels
+    g_NUM_CHANNELS : natural := 4
+  );
+end entity mov_avg_bram_tb;
+
+architecture test of mov_avg_bram_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  type t_nat_arr is array (natural range <>) of natural;
+  type t_int_arr is array (natural range <>) of integer;
+  type t_int_arr_2d is array (natural range <>, natural range <>) of integer;
+
+  constant c_CLOCK_FREQ     : natural := 48193182;
+  constant c_DATA_WIDTH     : natural := 16;
+  constant c_MAX_LENGTH     : natural := 1500;
+
+  -- Lengths, each one for c_SAMPLES_PER_LENGTH samples
+  constant c_LENGTHS : t_nat_arr := (1, 7, 64, 1000, 1500, 3, 1499, 250, 2);
+  constant c_SAMPLES_PER_LENGTH : natural := 1600;
+  constant c_SAMPLES : natural := c_LENGTHS'length*c_SAMPLES_PER_LENGTH;
+
+  signal clk                : std_logic := '0';
+  signal rst_n              : std_logic := '0';
+  signal length             : natural range 1 to c_MAX_LENGTH := 1;
+  signal length_in_use      : natural range 1 to c_MAX_LENGTH;
+  signal data               : signed(c_DATA_WIDTH-1 downto 0) := (others => '0');
+  signal ch                 : natural range 0 to g_NUM_CHANNELS-1 := 0;
+  signal valid              : std_logic := '0';
+  signal avgd_data          : signed(c_DATA_WIDTH-1 downto 0);
+  signal avgd_data_ch       : natural range 0 to g_NUM_CHANNELS-1;
+  signal avgd_data_valid    : std_logic;
+
+  -- Expected averaged data and channels, in order
+  signal expected           : t_int_arr(0 to c_SAMPLES-1) := (others => 0);
+  signal expected_ch        : t_nat_arr(0 to c_SAMPLES-1) := (others => 0);
+  signal driven             : natural := 0;
+  signal checked            : natural := 0;
+begin
+  f_gen_clk(c_CLOCK_FREQ, clk);
+
+  process
+    variable v_seed1, v_seed2 : positive := 1;
+    variable v_rand : real;
+    variable v_data : integer;
+    variable v_ch : natural;
+    -- Running sums of each channel, data[0] + ... + data[m]
+    variable v_sums : t_int_arr_2d(0 to g_NUM_CHANNELS-1, 0 to c_SAMPLES-1);
+    variable v_sum : integer;
+    variable v_length : natural;
+    -- Samples of each channel, and of all of them
+    variable v_ms : t_nat_arr(0 to g_NUM_CHANNELS-1) := (others => 0);
+    variable v_m : natural;
+    variable v_n : natural := 0;
+  begin
+    rst_n <= '0';
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    f_wait_cycles(clk, 1);
+
+    for i in c_LENGTHS'range loop
+      -- Switched with data flowing
+      length <= c_LENGTHS(i);
+
+      for j in 1 to c_SAMPLES_PER_LENGTH loop
+        uniform(v_seed1, v_seed2, v_rand);
+        v_data := integer(floor(v_rand*2.0**c_DATA_WIDTH)) - 2**(c_DATA_WIDTH-1);
+        data <= to_signed(v_data, data'length);
+        uniform(v_seed1, v_seed2, v_rand);
+        v_ch := integer(floor(v_rand*real(g_NUM_CHANNELS)));
+        ch <= v_ch;
+        valid <= '1';
+        wait until rising_edge(clk);
+        -- The length taken along with data is the one before the edge
+        v_length := length_in_use;
+
+        v_m := v_ms(v_ch);
+        if v_m = 0 then
+          v_sums(v_ch, v_m) := v_data;
+        else
+          v_sums(v_ch, v_m) := v_sums(v_ch, v_m-1) + v_data;
+        end if;
+        if v_length > v_m then
+          v_sum := v_sums(v_ch, v_m);
+        else
+          v_sum := v_sums(v_ch, v_m) - v_sums(v_ch, v_m-v_length);
+        end if;
+        v_ms(v_ch) := v_m + 1;
+        -- floor(v_sum/v_length)
+        expected(v_n) <= (v_sum - (v_sum mod v_length)) / v_length;
+        expected_ch(v_n) <= v_ch;
+        v_n := v_n + 1;
+        driven <= v_n;
+
+        -- Gaps now and then
+        uniform(v_seed1, v_seed2, v_rand);
+        if v_rand < 0.2 then
+          valid <= '0';
+          f_wait_cycles(clk, 1 + integer(floor(v_rand*20.0)));
+        end if;
+      end loop;
+
+      assert length_in_use = c_LENGTHS(i)
+        report
+          "Length " & integer'image(c_LENGTHS(i)) & " not in use after " &
+          integer'image(c_SAMPLES_PER_LENGTH) & " samples"
+        severity error;
+    end loop;
+    valid <= '0';
+
+    f_wait_cycles(clk, 10);
+    assert checked = c_SAMPLES
+      report
+        "Missing outputs (got: " & integer'image(checked) & ", expected: " &
+        integer'image(c_SAMPLES) & ")"
+      severity error;
+
+    report "all good!" severity note;
+    finish;
+  end process;
+
+  process
+    variable v_n : natural := 0;
+  begin
+    wait until rising_edge(clk);
+    if avgd_data_valid = '1' then
+      assert v_n < driven
+        report "Unexpected output" severity error;
+      assert to_integer(avgd_data) = expected(v_n)
+        report
+          "Wrong average (got: " & integer'image(to_integer(avgd_data)) &
+          ", expected: " & integer'image(expected(v_n)) & ", sample: " &
+          integer'image(v_n) & ")"
+        severity error;
+      assert avgd_data_ch = expected_ch(v_n)
+        report
+          "Wrong channel (got: " & integer'image(avgd_data_ch) &
+          ", expected: " & integer'image(expected_ch(v_n)) & ", sample: " &
+          integer'image(v_n) & ")"
+        severity error;
+      v_n := v_n + 1;
+      checked <= v_n;
+    end if;
+  end process;
+
+  uut : mov_avg_bram
+    generic map (
+      g_MAX_LENGTH    => c_MAX_LENGTH,
+      g_DATA_WIDTH    => c_DATA_WIDTH,
+      g_NUM_CHANNELS  => g_NUM_CHANNELS
+    )
+    port map (
+      clk_i           => clk,
+      rst_n_i         => rst_n,
+      length_i        => length,
+      length_o        => length_in_use,
+      data_i          => data,
+      ch_i            => ch,
+      valid_i         => valid,
+      avgd_data_o     => avgd_data,
+      ch_o            => avgd_data_ch,
+      valid_o         => avgd_data_valid
+    );
+end architecture test;
@@ -10,7 +10,12 @@
 -- Platform   :
 -- Standard   : VHDL'93/02
 -------------------------------------------------------------------------------
--- Description:
+-- Description: Tests #1 to #5 check the debounce and the pulse extension.
+-- With g_rx_oversampling > 1, test #6 sends edges at each phase of a clock
+-- cycle and checks that the timestamps (trig_rx_ts_o, trig_rx_ts_fine_o)
+-- follow them. With g_tx_oversampling > 1, test #7 sends a pulse for each
+-- fine delay and width and checks when the serialized pulse starts and how
+-- long it lasts. Both only rely on the sampling latencies being constant.
 -------------------------------------------------------------------------------
 -- Copyright (c) 2017 Brazilian Synchrotron Light Laboratory, LNLS/CNPEM
 -------------------------------------------------------------------------------
@@ -31,6 +36,14 @@ library work;
 use work.ifc_common_pkg.all;
 
 entity trigger_io_tb is
+generic
+(
+  -- Receive samples per clock cycle: 1, 4 or 8
+  g_rx_oversampling                          : natural := 1;
+  -- Transmit samples per clock cycle: 1, 4 or 8. Must match
+  -- g_rx_oversampling if both are > 1
+  g_tx_oversampling                          : natural := 1
+);
 end entity trigger_io_tb;
 
 architecture test of trigger_io_tb is
@@ -42,9 +55,23 @@ architecture test of trigger_io_tb is
   constant c_tx_delay_width                  : natural := 32;
   constant c_rx_counter_width                : natural := 32;
   constant c_tx_counter_width                : natural := 32;
+  constant c_rx_ts_width                     : natural := 64;
+  constant c_clk_period                      : time := 20 ns;
+  function f_max(a, b : natural) return natural is
+  begin
+    if a > b then
+      return a;
+    else
+      return b;
+    end if;
+  end function;
+
+  -- Ratio of the oversampling clock
+  constant c_ser_ratio                       : natural := f_max(g_rx_oversampling, g_tx_oversampling);
 
   -- component ports
   signal clk                                 : std_logic := '1';
+  signal clk_ser                             : std_logic := '1';
   signal rst_n                               : std_logic := '0';
 
   signal trig_dir                            : std_logic := '1'; -- FPGA is input
@@ -57,11 +84,21 @@ architecture test of trigger_io_tb is
   signal trig_tx_rst_n                       : std_logic := '1';
   signal trig_rx_cnt                         : unsigned(c_rx_counter_width-1 downto 0);
   signal trig_tx_cnt                         : unsigned(c_tx_counter_width-1 downto 0);
+  signal trig_tx_fine_delay                  : natural range 0 to g_tx_oversampling-1 := 0;
+  signal trig_tx_fine_width                  : natural range 0 to g_tx_oversampling-1 := 0;
+  signal trig_rx_ts                          : unsigned(c_rx_ts_width-1 downto 0) := (others => '0');
+  signal trig_rx_ts_out                      : unsigned(c_rx_ts_width-1 downto 0);
+  signal trig_rx_ts_fine                     : natural range 0 to g_rx_oversampling-1;
+  signal trig_rx_ts_valid                    : std_logic;
 
   signal trig_pad_dir                        : std_logic;
   signal trig_pad_inout                      : std_logic;
   signal trig_pad_in                         : std_logic;
   signal trig_pad_out                        : std_logic;
+  -- Pin that carries the transmitted pulse: the IOBUF one, or, with the
+  -- OSERDES, the direction pin of the wired-OR scheme, as the IOBUF then
+  -- drives the line for a few more clock cycles around the pulse
+  signal trig_pad_tx                         : std_logic;
 
   signal trig_in                             : std_logic := '0';
   signal trig_out                            : std_logic;
@@ -72,16 +109,40 @@ architecture test of trigger_io_tb is
   signal pulse_from_pad                      : std_logic := '0';
   signal test_begin_pulse                    : std_logic := '0';
   signal test_end                            : std_logic := '0';
+  -- Position of the last edge sent in test #6, in samples of
+  -- 1/g_rx_oversampling of a clock cycle
+  signal edge_pos                            : natural := 0;
+  -- When the last pulse of test #7 was sent
+  signal launch_time                         : time := 0 ns;
 
 begin  -- architecture test
 
+  -- The sample period must be a whole number of ps
+  assert (g_rx_oversampling = 1 or g_rx_oversampling = 4 or g_rx_oversampling = 8) and
+         (g_tx_oversampling = 1 or g_tx_oversampling = 4 or g_tx_oversampling = 8)
+  report "Only oversampling ratios of 1, 4 or 8 are supported"
+  severity failure;
+
   -- clock generation
-  clk <= not clk after 10 ns;
+  clk <= not clk after c_clk_period/2;
+  -- Oversampling clock, at c_ser_ratio/2 times clk and rising with it
+  gen_clk_ser : if c_ser_ratio > 1 generate
+    clk_ser <= not clk_ser after c_clk_period/c_ser_ratio;
+  end generate;
+  -- Coarse time base
+  p_rx_ts : process(clk)
+  begin
+    if rising_edge(clk) then
+      trig_rx_ts <= trig_rx_ts + 1;
+    end if;
+  end process;
   -- reset generation
   rst_n <= '1' after 40 ns;
   -- Pulldown resistor for MLVDS bus
   trig_pad_inout <= 'L';
 
+  trig_pad_tx <= trig_pad_inout when g_tx_oversampling = 1 else trig_pad_dir;
+
   -- Main testbench
   p_stimulus : process
   begin
@@ -211,12 +272,83 @@ begin  -- architecture test
     end if;
     wait until rising_edge(clk);
 
+    ---------------------------------------------------------------------------
+    -- Test #6
+    -- Receiving triggers from pad, with the edge at each sample of a clock
+    -- cycle, half a sample away from the sampling instants
+    ---------------------------------------------------------------------------
+    if g_rx_oversampling > 1 then
+      report "Test #6 starting";
+      trig_dir <= '1'; -- FPGA is input
+      test_begin_pulse <= '1';
+      wait until rising_edge(clk);
+      test_begin_pulse <= '0';
+
+      for p in 0 to g_rx_oversampling-1 loop
+        for i in 0 to 29 loop
+          wait until rising_edge(clk);
+        end loop;
+        edge_pos <= to_integer(trig_rx_ts(30 downto 0))*g_rx_oversampling + p;
+        wait for (2*p + 1)*c_clk_period/(2*g_rx_oversampling);
+        trig_pad_inout <= '1';
+        for i in 0 to 15 loop
+          wait until rising_edge(clk);
+        end loop;
+        trig_pad_inout <= 'Z';
+      end loop;
+
+      report "Waiting for verification on test #6";
+      if test_end /= '1' then
+        wait until test_end = '1';
+      end if;
+      wait until rising_edge(clk);
+    end if;
+
+    ---------------------------------------------------------------------------
+    -- Test #7
+    -- Sending triggers to pad, 2 clock cycles, for each fine delay and width
+    ---------------------------------------------------------------------------
+    if g_tx_oversampling > 1 then
+      report "Test #7 starting";
+      trig_dir <= '0'; -- FPGA is output
+      trig_tx_extensor_length <= to_unsigned(1, trig_tx_extensor_length'length);
+      test_begin_pulse <= '1';
+      wait until rising_edge(clk);
+      test_begin_pulse <= '0';
+
+      for d in 0 to g_tx_oversampling-1 loop
+        for w in 0 to g_tx_oversampling-1 loop
+          for i in 0 to 9 loop
+            wait until rising_edge(clk);
+          end loop;
+          trig_tx_fine_delay <= d;
+          trig_tx_fine_width <= w;
+          wait until rising_edge(clk);
+          trig_in <= '1';
+          launch_time <= now;
+          wait until rising_edge(clk);
+          trig_in <= '0';
+        end loop;
+      end loop;
+
+      report "Waiting for verification on test #7";
+      if test_end /= '1' then
+        wait until test_end = '1';
+      end if;
+      wait until rising_edge(clk);
+    end if;
+
     wait;
 
   end process;
 
   -- Verification
   p_verification : process
+    variable v_pos                           : integer;
+    variable v_latency                       : integer;
+    variable v_rise                          : time;
+    variable v_fall                          : time;
+    variable v_tx_latency                    : time;
   begin
     ---------------------------------------------------------------------------
     -- Test #1
@@ -253,10 +385,10 @@ begin  -- architecture test
     wait until test_begin_pulse = '1';
     test_end <= '0';
     -- Trigger should arrive at pad with 10 clock cycles
-    wait until trig_pad_inout = '1';
+    wait until trig_pad_tx = '1';
     for i in 0 to 8 loop
       wait until rising_edge(clk);
-      if trig_pad_inout = '0' then
+      if trig_pad_tx = '0' then
         report "Test #3 failed at iteration " & Integer'Image(i) severity failure;
       end if;
     end loop;
@@ -272,11 +404,11 @@ begin  -- architecture test
     wait until test_begin_pulse = '1';
     test_end <= '0';
     -- Trigger should arrive as 1 clock cycle
-    wait until trig_pad_inout = '1';
+    wait until trig_pad_tx = '1';
     wait until rising_edge(clk);
     for i in 0 to 8 loop
       wait until rising_edge(clk);
-      if trig_pad_inout = '1' then
+      if trig_pad_tx = '1' then
         report "Test #4 failed at iteration " & Integer'Image(i) severity failure;
       end if;
     end loop;
@@ -292,10 +424,10 @@ begin  -- architecture test
     wait until test_begin_pulse = '1';
     test_end <= '0';
     -- Trigger should arrive as 2 clock cycle
-    wait until trig_pad_inout = '1';
+    wait until trig_pad_tx = '1';
     for i in 0 to 0 loop
       wait until rising_edge(clk);
-      if trig_pad_inout = '0' then
+      if trig_pad_tx = '0' then
         report "Test #5 failed, as pulse is not a 2 clock cycle pulse, at iteration " & Integer'Image(i) severity failure;
       end if;
     end loop;
@@ -303,7 +435,7 @@ begin  -- architecture test
     wait until rising_edge(clk);
     for i in 0 to 8 loop
       wait until rising_edge(clk);
-      if trig_pad_inout = '1' then
+      if trig_pad_tx = '1' then
         report "Test #5 failed, as pulse is glitchy at iteration " & Integer'Image(i) severity failure;
       end if;
     end loop;
@@ -313,6 +445,69 @@ begin  -- architecture test
     test_end <= '1';
     wait until rising_edge(clk);
 
+    ---------------------------------------------------------------------------
+    -- Test #6
+    ---------------------------------------------------------------------------
+    if g_rx_oversampling > 1 then
+      wait until test_begin_pulse = '1';
+      test_end <= '0';
+      -- Each timestamp, in samples, must be the edge position plus the same
+      -- latency
+      for p in 0 to g_rx_oversampling-1 loop
+        wait until rising_edge(clk) and trig_rx_ts_valid = '1';
+        v_pos := to_integer(trig_rx_ts_out(30 downto 0))*g_rx_oversampling + trig_rx_ts_fine;
+        if p = 0 then
+          v_latency := v_pos - edge_pos;
+        elsif v_pos - edge_pos /= v_latency then
+          report "Test #6 failed at phase " & integer'image(p) & ": fine = " &
+            integer'image(trig_rx_ts_fine) & ", latency " &
+            integer'image(v_pos - edge_pos) & " samples instead of " &
+            integer'image(v_latency) severity failure;
+        end if;
+      end loop;
+
+      report "Test #6 succeeded";
+
+      test_end <= '1';
+      wait until rising_edge(clk);
+    end if;
+
+    ---------------------------------------------------------------------------
+    -- Test #7
+    ---------------------------------------------------------------------------
+    if g_tx_oversampling > 1 then
+      wait until test_begin_pulse = '1';
+      test_end <= '0';
+      -- The pulse must start the fine delay after the one with no fine
+      -- delay, relative to when it was sent, and last 2 clock cycles plus
+      -- the fine width
+      for d in 0 to g_tx_oversampling-1 loop
+        for w in 0 to g_tx_oversampling-1 loop
+          wait until trig_pad_tx = '1';
+          v_rise := now;
+          wait until trig_pad_tx = '0';
+          v_fall := now;
+          if d = 0 and w = 0 then
+            v_tx_latency := v_rise - launch_time;
+          elsif v_rise - launch_time /= v_tx_latency + d*c_clk_period/g_tx_oversampling then
+            report "Test #7 failed at fine delay " & integer'image(d) &
+              ", fine width " & integer'image(w) & ": pulse starts " &
+              time'image(v_rise - launch_time) & " after it was sent" severity failure;
+          end if;
+          if v_fall - v_rise /= 2*c_clk_period + w*c_clk_period/g_tx_oversampling then
+            report "Test #7 failed at fine delay " & integer'image(d) &
+              ", fine width " & integer'image(w) & ": pulse lasts " &
+              time'image(v_fall - v_rise) severity failure;
+          end if;
+        end loop;
+      end loop;
+
+      report "Test #7 succeeded";
+
+      test_end <= '1';
+      wait until rising_edge(clk);
+    end if;
+
     wait;
 
   end process;
@@ -328,12 +523,16 @@ begin  -- architecture test
     g_rx_counter_width                       => c_rx_counter_width,
     g_tx_counter_width                       => c_tx_counter_width,
     g_rx_delay_width                         => c_rx_delay_width,
-    g_tx_delay_width                         => c_tx_delay_width
+    g_tx_delay_width                         => c_tx_delay_width,
+    g_rx_oversampling                        => g_rx_oversampling,
+    g_rx_ts_width                            => c_rx_ts_width,
+    g_tx_oversampling                        => g_tx_oversampling
   )
   port map (
     -- Clock/Resets
     clk_i                                    => clk,
     rst_n_i                                  => rst_n,
+    clk_ser_i                                => clk_ser,
 
     -------------------------------
     -- Trigger configuration
@@ -344,6 +543,8 @@ begin  -- architecture test
     trig_tx_extensor_length_i                => trig_tx_extensor_length,
     trig_rx_delay_length_i                   => trig_rx_delay_length,
     trig_tx_delay_length_i                   => trig_tx_delay_length,
+    trig_tx_fine_delay_i                     => trig_tx_fine_delay,
+    trig_tx_fine_width_i                     => trig_tx_fine_width,
 
     -------------------------------
     -- Counters
@@ -353,6 +554,14 @@ begin  -- architecture test
     trig_rx_cnt_o                            => trig_rx_cnt,
     trig_tx_cnt_o                            => trig_tx_cnt,
 
+    -------------------------------
+    -- Receive timestamps
+    -------------------------------
+    trig_rx_ts_i                             => trig_rx_ts,
+    trig_rx_ts_o                             => trig_rx_ts_out,
+    trig_rx_ts_fine_o                        => trig_rx_ts_fine,
+    trig_rx_ts_valid_o                       => trig_rx_ts_valid,
+
     -------------------------------
     -- External ports
     -------------------------------
@@ -524,6 +524,7 @@ reg 		Desc_tx_MRd_Valid;
 reg [10:00] 	Desc_tx_MRd_Leng;
 reg [31:00] 	Desc_tx_MRd_Addr;
 reg [07:00] 	Desc_tx_MRd_TAG;
+reg [30:00] 	Wback_Cnt;
 
 reg [63:00] 	PIO_Addr;
 reg [31:00] 	PIO_Leng;
@@ -79,6 +79,12 @@
 `define  C_ADDR_DMA_US_PAH              32'H002C
 `define  C_ADDR_DMA_US_CTRL             32'H0048
 `define  C_ADDR_DMA_US_STA              32'H004C
+`define  C_ADDR_DMA_US_WBAH             32'H009C
+`define  C_ADDR_DMA_US_WBAL             32'H00A0
+
+  /* MSI coalescing registers */
+`define  C_ADDR_IRQ_COAL_CTRL           32'H00A4
+`define  C_ADDR_IRQ_COAL_MASK           32'H00A8
 
   /* DMA-specific constants */
 `define  C_DMA_RST_CMD                  32'H0200000A
@@ -207,6 +213,50 @@ endtask // Copy_rnd_data
   end
   endtask
 
+  ///////////////////////////////////////////////
+  //                                           //
+  //   Expect the DMA completion write-back    //
+  //                                           //
+  ///////////////////////////////////////////////
+  //  Skips the MWr's to other addresses (the DMA data), so its tag,
+  //  which follows the data MWr's, needs not be known.
+  task TSK_EXPECT_WBACK;
+    input  [31:0] address;
+    input  [31:0] payload;
+    output        expect_status;
+
+    reg    [31:0] address_;
+    reg    [31:0] payload_;
+    reg    [9:0]  length_;
+    reg           wait_for_next;
+
+  begin
+    wait_for_next = 1'b1;
+    while (wait_for_next)
+    begin
+      @ board.RP.com_usrapp.rcvd_memwr;
+      address_ = {board.RP.com_usrapp.frame_store_rx[8], board.RP.com_usrapp.frame_store_rx[9],
+                  board.RP.com_usrapp.frame_store_rx[10], board.RP.com_usrapp.frame_store_rx[11]};
+      if (address_[31:2] == address[31:2])
+      begin
+        wait_for_next = 1'b0;
+        length_ = board.RP.com_usrapp.frame_store_rx[2];
+        length_ = (length_ << 8) | board.RP.com_usrapp.frame_store_rx[3];
+        payload_ = {board.RP.com_usrapp.frame_store_rx[12], board.RP.com_usrapp.frame_store_rx[13],
+                    board.RP.com_usrapp.frame_store_rx[14], board.RP.com_usrapp.frame_store_rx[15]};
+        $display("[%t] : Received write-back 0x%h", $realtime, payload_);
+        if (length_ == 'H1 && payload_ == payload)
+          expect_status = 1'b1;
+        else begin
+          $display("[%t] : Write-back of length 0x%h, 0x%h instead of 0x%h",
+                   $realtime, length_, payload_, payload);
+          expect_status = 1'b0;
+        end
+      end
+    end
+  end
+  endtask
+
 
     /////////////////////////////////////////////
    //                                         //
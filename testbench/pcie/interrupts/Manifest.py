@@ -0,0 +1,6 @@
+files = [
+    "interrupts_tb.vhd",
+    "../../../platform/simulation/ipcores_pkg.vhd",
+    "../../../modules/generic/pcie_cntr/pkgs/v6abb64Package_efifo_elink.vhd",
+    "../../../modules/generic/pcie_cntr/common/Interrupts.vhd",
+]
@@ -0,0 +1,10 @@
+action = "simulation"
+sim_tool = "ghdl"
+top_module = "interrupts_tb"
+
+modules = {"local" : ["../"]}
+
+# Interrupts uses std_logic_arith/std_logic_unsigned
+ghdl_opt = "--std=08 -fsynopsys"
+
+sim_post_cmd = "ghdl -r --std=08 -fsynopsys %s --wave=%s.ghw --assert-level=error" % (top_module, top_module)
@@ -0,0 +1,294 @@
+--------------------------------------------------------------------------------
+-- Title      : PCIe controller interrupts testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Drives the interrupt status bits of Interrupts and answers its
+--              cfg interrupt requests as the PCIe core would, logging the
+--              vector of each MSI and the assert/deassert of each INTx
+--              message.
+--
+--              With coalescing off, legacy INTx must be asserted once while
+--              any bit is set and deasserted when all clear, and with a
+--              single MSI vector granted, each rising edge must send one MSI
+--              on vector 0. With 8 vectors granted, every source is sent as
+--              its own vector, lowest first, and the ones above 7 as 7. Then
+--              a coalesced source must only send an MSI every count events,
+--              or once the timeout expires after its first event, while the
+--              other sources still send one per event.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.env.finish;
+
+library work;
+use work.abb64Package.all;
+
+entity interrupts_tb is
+end entity interrupts_tb;
+
+architecture test of interrupts_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  -- Cycles between cfg_interrupt and cfg_interrupt_rdy
+  constant c_RDY_DELAY    : natural := 3;
+  -- Cycles for a message to go through, with margin
+  constant c_MSG_CYCLES   : natural := 20;
+  constant c_TICK_CYCLES  : natural := 2**C_IRQ_COAL_TICK_BITS;
+
+  type t_vectors is array (natural range <>) of std_logic_vector(7 downto 0);
+
+  signal clk              : std_logic := '0';
+  signal rst              : std_logic := '1';
+  signal sys_irq          : std_logic_vector(C_DBUS_WIDTH-1 downto 0) := (others => '0');
+  signal coal_ctrl        : std_logic_vector(31 downto 0) := (others => '0');
+  signal coal_mask        : std_logic_vector(C_NUM_OF_INTERRUPTS-1 downto 0) := (others => '0');
+  signal cfg_int          : std_logic;
+  signal cfg_int_rdy      : std_logic := '0';
+  signal cfg_int_mmenable : std_logic_vector(2 downto 0) := "000";
+  signal cfg_int_msienable : std_logic := '0';
+  signal cfg_int_di       : std_logic_vector(7 downto 0);
+  signal cfg_int_assert   : std_logic;
+
+  -- Messages accepted by the core
+  signal msg_cnt          : natural := 0;
+  signal msg_vec          : t_vectors(0 to 255);
+  signal msg_assert       : std_logic_vector(0 to 255);
+begin
+  f_gen_clk(125_000_000, clk);
+
+  -- PCIe core: takes a request c_RDY_DELAY cycles after it shows up
+  p_core : process
+  begin
+    wait until rising_edge(clk) and cfg_int = '1';
+    f_wait_cycles(clk, c_RDY_DELAY - 1);
+    cfg_int_rdy <= '1';
+    wait until rising_edge(clk);
+    cfg_int_rdy <= '0';
+    msg_vec(msg_cnt) <= cfg_int_di;
+    msg_assert(msg_cnt) <= cfg_int_assert;
+    msg_cnt <= msg_cnt + 1;
+    -- cfg_interrupt drops the cycle after rdy
+    wait until rising_edge(clk);
+  end process;
+
+  process
+    variable v_first  : natural;
+    variable v_cycles : natural;
+
+    procedure f_pulse(constant src : in natural) is
+    begin
+      sys_irq(src) <= '1';
+      wait until rising_edge(clk);
+      sys_irq(src) <= '0';
+      wait until rising_edge(clk);
+    end procedure f_pulse;
+
+    -- Waits for the messages to go through and checks that 'cnt' of them
+    -- were sent since message 'first', on 'vecs' (if not empty)
+    procedure f_expect(constant what  : in string;
+                       constant first : in natural;
+                       constant cnt   : in natural;
+                       constant vecs  : in t_vectors) is
+    begin
+      f_wait_cycles(clk, c_MSG_CYCLES*(cnt+1));
+      assert msg_cnt - first = cnt
+        report what & ": " & integer'image(msg_cnt - first) & " messages instead of " &
+               integer'image(cnt)
+        severity error;
+      for i in vecs'range loop
+        if first + i - vecs'low < msg_cnt then
+          assert msg_vec(first + i - vecs'low) = vecs(i)
+            report what & ": message " & integer'image(i - vecs'low) & " on vector " &
+                   integer'image(to_integer(unsigned(msg_vec(first + i - vecs'low)))) &
+                   " instead of " & integer'image(to_integer(unsigned(vecs(i))))
+            severity error;
+        end if;
+      end loop;
+    end procedure f_expect;
+  begin
+    f_wait_cycles(clk, 10);
+    rst <= '0';
+    f_wait_cycles(clk, 10);
+
+    ----------------------------------------------------------------------------
+    -- Legacy INTx, coalescing off
+    ----------------------------------------------------------------------------
+    v_first := msg_cnt;
+    sys_irq(2) <= '1';
+    f_wait_cycles(clk, c_MSG_CYCLES);
+    sys_irq(9) <= '1';
+    f_wait_cycles(clk, c_MSG_CYCLES);
+    assert msg_cnt - v_first = 1 and msg_assert(v_first) = '1' and cfg_int_assert = '1'
+      report "INTx not asserted exactly once while the status bits are set"
+      severity error;
+    sys_irq(2) <= '0';
+    sys_irq(9) <= '0';
+    f_expect("INTx deassert", v_first, 2, (x"00", x"00"));
+    assert msg_assert(v_first + 1) = '0' and cfg_int_assert = '0'
+      report "INTx not deasserted with the status bits clear"
+      severity error;
+
+    ----------------------------------------------------------------------------
+    -- Single MSI vector, coalescing off
+    ----------------------------------------------------------------------------
+    cfg_int_msienable <= '1';
+    f_wait_cycles(clk, 2);
+
+    v_first := msg_cnt;
+    f_pulse(0);
+    f_expect("Single vector, source 0", v_first, 1, (0 => x"00"));
+
+    -- A level sends a single MSI
+    v_first := msg_cnt;
+    sys_irq(5) <= '1';
+    f_wait_cycles(clk, 10*c_MSG_CYCLES);
+    sys_irq(5) <= '0';
+    f_expect("Single vector, source 5 held", v_first, 1, (0 => x"00"));
+
+    assert msg_assert(v_first) = '0'
+      report "cfg_interrupt_assert set for an MSI" severity error;
+
+    ----------------------------------------------------------------------------
+    -- A vector per source, clamped to the ones granted
+    ----------------------------------------------------------------------------
+    cfg_int_mmenable <= "011";
+    f_wait_cycles(clk, 2);
+
+    v_first := msg_cnt;
+    sys_irq(12) <= '1';
+    sys_irq(6)  <= '1';
+    sys_irq(1)  <= '1';
+    wait until rising_edge(clk);
+    sys_irq(12) <= '0';
+    sys_irq(6)  <= '0';
+    sys_irq(1)  <= '0';
+    f_expect("Vector per source", v_first, 3, (x"01", x"06", x"07"));
+
+    v_first := msg_cnt;
+    f_pulse(15);
+    f_pulse(4);
+    f_expect("Vector per source, one after the other", v_first, 2, (x"07", x"04"));
+
+    ----------------------------------------------------------------------------
+    -- Coalescing: count threshold
+    ----------------------------------------------------------------------------
+    coal_mask(3) <= '1';
+    -- 4 events per MSI, no timeout
+    coal_ctrl <= x"0000" & x"0004";
+    f_wait_cycles(clk, 2);
+
+    v_first := msg_cnt;
+    for i in 1 to 3 loop
+      f_pulse(3);
+    end loop;
+    f_wait_cycles(clk, 4*c_TICK_CYCLES);
+    assert msg_cnt = v_first
+      report "Coalesced source sent an MSI before the count threshold"
+      severity error;
+
+    -- A source outside the mask still sends an MSI per event
+    f_pulse(4);
+    f_pulse(3);
+    f_expect("Count threshold", v_first, 2, (x"04", x"03"));
+
+    v_first := msg_cnt;
+    for i in 1 to 8 loop
+      f_pulse(3);
+    end loop;
+    f_expect("Count threshold, twice", v_first, 2, (x"03", x"03"));
+
+    ----------------------------------------------------------------------------
+    -- Coalescing: timeout flush
+    ----------------------------------------------------------------------------
+    -- 100 events per MSI, or 2 ticks after the first event
+    coal_ctrl <= std_logic_vector(to_unsigned(2, 16)) & std_logic_vector(to_unsigned(100, 16));
+    f_wait_cycles(clk, 2);
+
+    v_first := msg_cnt;
+    f_pulse(3);
+    f_pulse(3);
+    -- Counted from the first event
+    v_cycles := 4;
+    while msg_cnt = v_first and v_cycles < 4*c_TICK_CYCLES loop
+      wait until rising_edge(clk);
+      v_cycles := v_cycles + 1;
+    end loop;
+    -- Two ticks, the first of which may come right after the event
+    assert v_cycles >= c_TICK_CYCLES and v_cycles <= 2*c_TICK_CYCLES + c_MSG_CYCLES
+      report "Timeout flush after " & integer'image(v_cycles) & " cycles instead of " &
+             integer'image(c_TICK_CYCLES) & " to " & integer'image(2*c_TICK_CYCLES)
+      severity error;
+    f_expect("Timeout flush", v_first, 1, (0 => x"03"));
+
+    -- The timeout starts over with the next event
+    v_first := msg_cnt;
+    f_wait_cycles(clk, 4*c_TICK_CYCLES);
+    assert msg_cnt = v_first
+      report "MSI sent with no coalesced event" severity error;
+
+    -- Coalescing off again: an MSI per event
+    coal_mask <= (others => '0');
+    coal_ctrl <= (others => '0');
+    f_wait_cycles(clk, 2);
+    v_first := msg_cnt;
+    f_pulse(3);
+    f_pulse(3);
+    f_expect("Coalescing off", v_first, 2, (x"03", x"03"));
+
+    finish;
+  end process;
+
+  uut : entity work.Interrupts
+    port map (
+      Sys_IRQ                  => sys_irq,
+      IRQ_Coal_Ctrl            => coal_ctrl,
+      IRQ_Coal_Mask            => coal_mask,
+      IG_Reset                 => '0',
+      IG_Host_Clear            => '0',
+      IG_Latency               => (others => '0'),
+      IG_Num_Assert            => open,
+      IG_Num_Deassert          => open,
+      IG_Asserting             => open,
+      cfg_interrupt            => cfg_int,
+      cfg_interrupt_rdy        => cfg_int_rdy,
+      cfg_interrupt_mmenable   => cfg_int_mmenable,
+      cfg_interrupt_msienable  => cfg_int_msienable,
+      cfg_interrupt_msixenable => '0',
+      cfg_interrupt_msixfm     => '0',
+      cfg_interrupt_di         => cfg_int_di,
+      cfg_interrupt_do         => (others => '0'),
+      cfg_interrupt_assert     => cfg_int_assert,
+      Irpt_Req                 => open,
+      Irpt_RE                  => '0',
+      Irpt_Qout                => open,
+      user_clk                 => clk,
+      user_reset               => rst
+    );
+
+end architecture test;
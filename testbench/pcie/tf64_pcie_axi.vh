@@ -1035,6 +1035,22 @@ begin
        board.Hdr_Array[0] = `HEADER0_MWR4_ | board.Rx_TLP_Length[9:0];
        board.Hdr_Array[1] = {`C_HOST_WRREQ_ID, board.Rx_MWr_Tag, 4'Hf, 4'Hf};
        board.Hdr_Array[2] = 'h0;
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_WBAH;
+       dword_pack_data_store(0, 0);
+       //  Write WBA_H, the write-back must still wait for WBACK
+       $display("%d ns:   Write WBA_H", $time);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write WBA_L
+       $display("%d ns:   Write WBA_L", $time);
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_WBAL;
+       dword_pack_data_store(board.DMA_HA[31:00] + 'HF000, 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
        board.Hdr_Array[3] = `C_ADDR_DMA_US_PAH;
        dword_pack_data_store(board.DMA_PA[63:32], 0);
        //  Write PA_H
@@ -1104,70 +1120,83 @@ begin
        TLP_Feed_Rx(`C_BAR0_HIT);
        board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
 
-      board.Desc_tx_MRd_TAG = 'hE0;
-      board.RP.com_usrapp.TSK_EXPECT_MEMRD(3'b000, 1'b0, 1'b0, 2'b00,
+      // WBACK clear: no write-back, not even after the last descriptor
+      fork : no_wback
+        begin
+        TSK_EXPECT_WBACK(board.DMA_HA[31:00] + 'HF000, 0, expect_status);
+        $display("[%t]: got a write-back with WBACK clear !!!", $realtime);
+        $finish(1);
+        end
+
+        begin
+        board.Desc_tx_MRd_TAG = 'hE0;
+        board.RP.com_usrapp.TSK_EXPECT_MEMRD(3'b000, 1'b0, 1'b0, 2'b00,
 					'h8,
 					board.localID,
 					board.Desc_tx_MRd_TAG,
 					4'hf,
 					4'hf,
 					board.DMA_BDA[31:2] + 'h4000,
-          expect_status);
-       if (expect_status == 0) begin
-         $display("[%t]: got unexpected TLP !!!", $realtime);
-         $finish(1);
-       end
+            expect_status);
+         if (expect_status == 0) begin
+           $display("[%t]: got unexpected TLP !!!", $realtime);
+           $finish(1);
+         end
        
        
-       // feeding the descriptor CplD
-       $display("%d ns:   feeding the descriptor CplD", $time);
-       board.DMA_us_is_Last   = 'B1;
-       // Second DMA descriptor
-       dword_pack_data_store(0, 0);
-       dword_pack_data_store(board.DMA_PA[31:00] + 'H500, 1);
-       dword_pack_data_store(board.DMA_HA[63:32], 2);          // 0
-       dword_pack_data_store(board.DMA_HA[31:00] + 'H500, 3);
-       dword_pack_data_store(-1, 4);                     // dont-car
-       dword_pack_data_store(-1, 5);                     // dont-car
-       dword_pack_data_store(board.DMA_L2, 6);
-       dword_pack_data_store({4'H0
-                            ,3'H1, board.DMA_us_is_Last
-                            ,3'H0, 1'B1
-                            ,1'B0, board.DMA_bar
-                            ,1'B1
-                            ,15'H0
-                            }, 7);
-
-       board.Rx_TLP_Length    = 'H08;
+         // feeding the descriptor CplD
+         $display("%d ns:   feeding the descriptor CplD", $time);
+         board.DMA_us_is_Last   = 'B1;
+         // Second DMA descriptor
+         dword_pack_data_store(0, 0);
+         dword_pack_data_store(board.DMA_PA[31:00] + 'H500, 1);
+         dword_pack_data_store(board.DMA_HA[63:32], 2);          // 0
+         dword_pack_data_store(board.DMA_HA[31:00] + 'H500, 3);
+         dword_pack_data_store(-1, 4);                     // dont-car
+         dword_pack_data_store(-1, 5);                     // dont-car
+         dword_pack_data_store(board.DMA_L2, 6);
+         dword_pack_data_store({4'H0
+                              ,3'H1, board.DMA_us_is_Last
+                              ,3'H0, 1'B1
+                              ,1'B0, board.DMA_bar
+                              ,1'B1
+                              ,15'H0
+                              }, 7);
+
+         board.Rx_TLP_Length    = 'H08;
 
-       board.Hdr_Array[0] = `HEADER0_CPLD | board.Rx_TLP_Length[9:0];
-       board.Hdr_Array[1] = {`C_HOST_CPLD_ID, 4'H0, board.Rx_TLP_Length[9:0], 2'b00};
-       board.Hdr_Array[2] = {board.localID, board.Desc_tx_MRd_TAG, 1'b0, board.DMA_BDA[6:0]};
+         board.Hdr_Array[0] = `HEADER0_CPLD | board.Rx_TLP_Length[9:0];
+         board.Hdr_Array[1] = {`C_HOST_CPLD_ID, 4'H0, board.Rx_TLP_Length[9:0], 2'b00};
+         board.Hdr_Array[2] = {board.localID, board.Desc_tx_MRd_TAG, 1'b0, board.DMA_BDA[6:0]};
      
-       TLP_Feed_Rx(`C_NO_BAR_HIT);
+         TLP_Feed_Rx(`C_NO_BAR_HIT);
 
 
-       board.Rx_TLP_Length    = 'H01;
-     $display("%d ns:   Polling DMA status", $time);
-       board.Hdr_Array[0] = `HEADER0_MRD4_ | board.Rx_TLP_Length[9:0];
-       board.Hdr_Array[1] = {`C_HOST_RDREQ_ID, 3'H3, board.Rx_MRd_Tag, 4'Hf, 4'Hf};
-       board.Hdr_Array[2] = 'h0;
-       board.Hdr_Array[3] = `C_ADDR_DMA_US_STA;
-       TLP_Feed_Rx(`C_BAR0_HIT);
-       board.Rx_MRd_Tag      = board.Rx_MRd_Tag + 1;
-       TSK_WAIT_FOR_READ_DATA;
-       
-       while (P_READ_DATA[0] != 'b1) begin
-        $display("%d ns:   Polling DMA status", $time);
+         board.Rx_TLP_Length    = 'H01;
+       $display("%d ns:   Polling DMA status", $time);
          board.Hdr_Array[0] = `HEADER0_MRD4_ | board.Rx_TLP_Length[9:0];
          board.Hdr_Array[1] = {`C_HOST_RDREQ_ID, 3'H3, board.Rx_MRd_Tag, 4'Hf, 4'Hf};
          board.Hdr_Array[2] = 'h0;
          board.Hdr_Array[3] = `C_ADDR_DMA_US_STA;
          TLP_Feed_Rx(`C_BAR0_HIT);
-         board.Rx_MRd_Tag       = board.Rx_MRd_Tag + 1;
-         
+         board.Rx_MRd_Tag      = board.Rx_MRd_Tag + 1;
          TSK_WAIT_FOR_READ_DATA;
-       end
+       
+         while (P_READ_DATA[0] != 'b1) begin
+          $display("%d ns:   Polling DMA status", $time);
+           board.Hdr_Array[0] = `HEADER0_MRD4_ | board.Rx_TLP_Length[9:0];
+           board.Hdr_Array[1] = {`C_HOST_RDREQ_ID, 3'H3, board.Rx_MRd_Tag, 4'Hf, 4'Hf};
+           board.Hdr_Array[2] = 'h0;
+           board.Hdr_Array[3] = `C_ADDR_DMA_US_STA;
+           TLP_Feed_Rx(`C_BAR0_HIT);
+           board.Rx_MRd_Tag       = board.Rx_MRd_Tag + 1;
+         
+           TSK_WAIT_FOR_READ_DATA;
+         end
+        TSK_TX_CLK_EAT(100);
+        disable no_wback;
+        end
+      join
   
   //////////////////////////////////////////////////////////////////////////////////
 
@@ -1198,6 +1227,225 @@ begin
   //////////////////////////////////////////////////////////////////////////////////
 
 
+    //  ///////////////////////////////////////////////////////////////////
+    //  DMA read BAR[4], descriptor prefetch and write-back
+    //  The two next descriptors and a spare one come in a single MRd
+    //
+      $display("\n### DMA read BAR[4], descriptor prefetch and write-back ###\n");
+       board.DMA_us_is_Last   = 'B0;
+
+       board.Rx_TLP_Length    = 'H01;
+
+       board.Hdr_Array[0] = `HEADER0_MWR4_ | board.Rx_TLP_Length[9:0];
+       board.Hdr_Array[1] = {`C_HOST_WRREQ_ID, board.Rx_MWr_Tag, 4'Hf, 4'Hf};
+       board.Hdr_Array[2] = 'h0;
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_WBAH;
+       dword_pack_data_store(0, 0);
+       //  Write WBA_H
+       $display("%d ns:   Write WBA_H", $time);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write WBA_L
+       $display("%d ns:   Write WBA_L", $time);
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_WBAL;
+       dword_pack_data_store(board.DMA_HA[31:00] + 'HF000, 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_PAH;
+       dword_pack_data_store(board.DMA_PA[63:32], 0);
+       //  Write PA_H
+       $display("%d ns:   Write PA_H", $time);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write PA_L
+       $display("%d ns:   Write PA_L", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_PA[31:00], 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write HA_H
+       $display("%d ns:   Write HA_H", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_HA[63:32], 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write HA_L
+       $display("%d ns:   Write HA_L", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_HA[31:00], 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write BDA_H
+       $display("%d ns:   Write BDA_H", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_BDA[63:32], 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write BDA_L
+       $display("%d ns:   Write BDA_L", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_BDA[31:00] + 'h20000, 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write LENG
+       $display("%d ns:   Write LENG", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store(board.DMA_L1, 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+       //  Write CTRL, with PREF and WBACK, and start the DMA
+       $display("%d ns:   Write CTRL and start the DMA", $time);
+       board.Hdr_Array[3] = board.Hdr_Array[3] + 'H4;
+       dword_pack_data_store({4'H0
+                            ,3'H1, board.DMA_us_is_Last
+                            ,1'B0, 1'B1, 1'B1, 1'B1
+                            ,1'B0, board.DMA_bar
+                            ,1'B1
+                            ,15'H0
+                            }, 0);
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+      // One write-back per descriptor, done flag and completed count
+      fork
+        begin
+        for (board.Wback_Cnt = 1; board.Wback_Cnt <= 3; board.Wback_Cnt = board.Wback_Cnt + 1) begin
+          TSK_EXPECT_WBACK(board.DMA_HA[31:00] + 'HF000,
+            {1'b1, board.Wback_Cnt},
+            expect_status);
+          if (expect_status == 0) begin
+            $display("[%t]: got unexpected write-back !!!", $realtime);
+            $finish(1);
+          end
+        end
+        end
+
+        begin
+        // BDA[6:5] = 1: three descriptors up to the 128-byte boundary
+        board.Desc_tx_MRd_TAG = 'hE0;
+        board.RP.com_usrapp.TSK_EXPECT_MEMRD(3'b000, 1'b0, 1'b0, 2'b00,
+					'h18,
+					board.localID,
+					board.Desc_tx_MRd_TAG,
+					4'hf,
+					4'hf,
+					board.DMA_BDA[31:2] + 'h8000,
+            expect_status);
+         if (expect_status == 0) begin
+           $display("[%t]: got unexpected TLP !!!", $realtime);
+           $finish(1);
+         end
+
+
+         // feeding the descriptor batch CplD
+         $display("%d ns:   feeding the descriptor batch CplD", $time);
+         // Second DMA descriptor, chained to the third one
+         dword_pack_data_store(0, 0);
+         dword_pack_data_store(board.DMA_PA[31:00] + 'H500, 1);
+         dword_pack_data_store(board.DMA_HA[63:32], 2);
+         dword_pack_data_store(board.DMA_HA[31:00] + 'H500, 3);
+         dword_pack_data_store(0, 4);
+         dword_pack_data_store(board.DMA_BDA[31:00] + 'h20020, 5);
+         dword_pack_data_store(board.DMA_L1, 6);
+         dword_pack_data_store({4'H0
+                              ,3'H1, board.DMA_us_is_Last
+                              ,1'B0, 1'B1, 1'B1, 1'B1
+                              ,1'B0, board.DMA_bar
+                              ,1'B1
+                              ,15'H0
+                              }, 7);
+         // Third DMA descriptor, the last one
+         board.DMA_us_is_Last   = 'B1;
+         dword_pack_data_store(0, 8);
+         dword_pack_data_store(board.DMA_PA[31:00] + 'HA00, 9);
+         dword_pack_data_store(board.DMA_HA[63:32], 10);
+         dword_pack_data_store(board.DMA_HA[31:00] + 'HA00, 11);
+         dword_pack_data_store(-1, 12);                    // dont-care
+         dword_pack_data_store(-1, 13);                    // dont-care
+         dword_pack_data_store(board.DMA_L2, 14);
+         dword_pack_data_store({4'H0
+                              ,3'H1, board.DMA_us_is_Last
+                              ,1'B0, 1'B1, 1'B1, 1'B1
+                              ,1'B0, board.DMA_bar
+                              ,1'B1
+                              ,15'H0
+                              }, 15);
+         // Spare descriptor, never used
+         dword_pack_data_store(-1, 16);
+         dword_pack_data_store(-1, 17);
+         dword_pack_data_store(-1, 18);
+         dword_pack_data_store(-1, 19);
+         dword_pack_data_store(-1, 20);
+         dword_pack_data_store(-1, 21);
+         dword_pack_data_store(-1, 22);
+         dword_pack_data_store(-1, 23);
+
+         board.Rx_TLP_Length    = 'H18;
+
+         board.Hdr_Array[0] = `HEADER0_CPLD | board.Rx_TLP_Length[9:0];
+         board.Hdr_Array[1] = {`C_HOST_CPLD_ID, 4'H0, board.Rx_TLP_Length[9:0], 2'b00};
+         board.Hdr_Array[2] = {board.localID, board.Desc_tx_MRd_TAG, 1'b0, board.DMA_BDA[6:0]};
+
+         TLP_Feed_Rx(`C_NO_BAR_HIT);
+
+
+         board.Rx_TLP_Length    = 'H01;
+       $display("%d ns:   Polling DMA status", $time);
+         board.Hdr_Array[0] = `HEADER0_MRD4_ | board.Rx_TLP_Length[9:0];
+         board.Hdr_Array[1] = {`C_HOST_RDREQ_ID, 3'H3, board.Rx_MRd_Tag, 4'Hf, 4'Hf};
+         board.Hdr_Array[2] = 'h0;
+         board.Hdr_Array[3] = `C_ADDR_DMA_US_STA;
+         TLP_Feed_Rx(`C_BAR0_HIT);
+         board.Rx_MRd_Tag      = board.Rx_MRd_Tag + 1;
+         TSK_WAIT_FOR_READ_DATA;
+
+         while (P_READ_DATA[0] != 'b1) begin
+          $display("%d ns:   Polling DMA status", $time);
+           board.Hdr_Array[0] = `HEADER0_MRD4_ | board.Rx_TLP_Length[9:0];
+           board.Hdr_Array[1] = {`C_HOST_RDREQ_ID, 3'H3, board.Rx_MRd_Tag, 4'Hf, 4'Hf};
+           board.Hdr_Array[2] = 'h0;
+           board.Hdr_Array[3] = `C_ADDR_DMA_US_STA;
+           TLP_Feed_Rx(`C_BAR0_HIT);
+           board.Rx_MRd_Tag       = board.Rx_MRd_Tag + 1;
+
+           TSK_WAIT_FOR_READ_DATA;
+         end
+        end
+      join
+
+       board.Rx_TLP_Length    = 'H01;
+         // reset upstream DMA channel
+     $display("%d ns:   reset US DMA channel", $time);
+       board.Hdr_Array[0] = `HEADER0_MWR4_ | board.Rx_TLP_Length[9:0];
+       board.Hdr_Array[1] = {`C_HOST_WRREQ_ID, board.Rx_MWr_Tag, 4'Hf, 4'Hf};
+       board.Hdr_Array[2] = 'h0;
+       board.Hdr_Array[3] = `C_ADDR_DMA_US_CTRL;
+       dword_pack_data_store(`C_DMA_RST_CMD, 0);
+
+       TLP_Feed_Rx(`C_BAR0_HIT);
+       board.Rx_MWr_Tag   = board.Rx_MWr_Tag + 1;
+
+  //////////////////////////////////////////////////////////////////////////////////
+
+
       TSK_TX_CLK_EAT(100);
       $display("### Simulation FINISHED ###\n");
       $finish(2);
@@ -0,0 +1,10 @@
+files = [
+    "acq_delta_enc_tb.vhd",
+    "../../../modules/wishbone/wb_acq_core/acq_delta_enc.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../ip_cores/general-cores",
+    ],
+}
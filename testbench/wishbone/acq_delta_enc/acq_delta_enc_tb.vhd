@@ -0,0 +1,410 @@
+--------------------------------------------------------------------------------
+-- Title      : Acquisition delta encoder testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Feeds random walks through acq_delta_enc, for several word and
+--              atom layouts and block sizes, and decodes the output words
+--              back, checking that every atom is recovered bit-exact.
+--
+--              Some configurations end with a partial block closed by
+--              flush_i. Others first overload the encoder with full-rate
+--              incompressible samples, check that ovf_o is set, and then
+--              restart it with start_i.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.math_real.all;
+
+library std;
+use std.env.finish;
+
+entity acq_delta_enc_tb is
+end entity acq_delta_enc_tb;
+
+architecture test of acq_delta_enc_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  -- Random unsigned of 'width' bits, 16 bits at a time
+  procedure f_rand(variable seed1, seed2 : inout positive;
+                   constant width        : in natural;
+                   variable res          : out unsigned) is
+    variable r   : real;
+    variable v   : unsigned(res'length-1 downto 0) := (others => '0');
+  begin
+    for i in 0 to (width+15)/16-1 loop
+      uniform(seed1, seed2, r);
+      v := shift_left(v, 16) or resize(to_unsigned(integer(floor(r * 65536.0)) mod 65536, 16), v'length);
+    end loop;
+    if width < v'length then
+      v := v and shift_right(not to_unsigned(0, v'length), v'length-width);
+    end if;
+    res := v;
+  end procedure f_rand;
+
+  type t_cfg is record
+    word_width    : natural;
+    num_atoms     : natural;
+    atom_width    : natural;
+    block_log2    : natural;
+    num_blocks    : natural;
+    -- Largest random walk step, in log2
+    max_step_log2 : natural;
+    -- Idle cycles after each sample, so that the encoder keeps up
+    min_idle      : natural;
+    -- Samples of a trailing partial block, closed with flush_i
+    tail_samples  : natural;
+    -- Full-rate incompressible samples sent before a restart, which must
+    -- set ovf_o
+    ovf_samples   : natural;
+  end record;
+
+  type t_cfg_array is array (natural range <>) of t_cfg;
+
+  constant c_CFGS : t_cfg_array := (
+    (word_width => 64,  num_atoms => 4, atom_width => 16, block_log2 => 6, num_blocks => 16,
+     max_step_log2 => 6,  min_idle => 0, tail_samples => 5, ovf_samples => 0),
+    -- Every sample gets a header, so a block takes up to 64+6+64+6 = 140
+    -- bits, 3 words
+    (word_width => 64,  num_atoms => 2, atom_width => 32, block_log2 => 0, num_blocks => 64,
+     max_step_log2 => 12, min_idle => 2, tail_samples => 0, ovf_samples => 0),
+    (word_width => 64,  num_atoms => 3, atom_width => 20, block_log2 => 3, num_blocks => 32,
+     max_step_log2 => 10, min_idle => 0, tail_samples => 1, ovf_samples => 0),
+    (word_width => 128, num_atoms => 4, atom_width => 32, block_log2 => 5, num_blocks => 16,
+     max_step_log2 => 8,  min_idle => 0, tail_samples => 0, ovf_samples => 0),
+    (word_width => 128, num_atoms => 2, atom_width => 64, block_log2 => 4, num_blocks => 16,
+     max_step_log2 => 40, min_idle => 0, tail_samples => 11, ovf_samples => 0),
+    -- Overload with 3-word blocks, which fills the encoder buffer up to its
+    -- last word before padding
+    (word_width => 64,  num_atoms => 2, atom_width => 32, block_log2 => 0, num_blocks => 32,
+     max_step_log2 => 12, min_idle => 2, tail_samples => 0, ovf_samples => 64),
+    (word_width => 64,  num_atoms => 4, atom_width => 16, block_log2 => 2, num_blocks => 32,
+     max_step_log2 => 6,  min_idle => 0, tail_samples => 3, ovf_samples => 200)
+  );
+
+  constant c_CLOCK_FREQ     : natural := 100000000;
+  constant c_MAGIC          : unsigned(15 downto 0) := x"DE1A";
+
+  signal clk                : std_logic := '0';
+  signal rst_n              : std_logic := '0';
+  signal done               : std_logic_vector(c_CFGS'range) := (others => '0');
+
+begin
+  f_gen_clk(c_CLOCK_FREQ, clk);
+
+  process
+  begin
+    rst_n <= '0';
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+
+    wait until (and done) = '1';
+
+    report "all good!" severity note;
+    finish;
+  end process;
+
+  gen_cfg : for c in c_CFGS'range generate
+    constant c_W            : natural := c_CFGS(c).word_width;
+    constant c_N            : natural := c_CFGS(c).num_atoms;
+    constant c_A            : natural := c_CFGS(c).atom_width;
+    constant c_T            : natural := natural(ceil(log2(real(c_A+2))));
+    constant c_NUM_SAMPLES  : natural := c_CFGS(c).num_blocks * 2**c_CFGS(c).block_log2 +
+                                         c_CFGS(c).tail_samples;
+    -- Worst case: every sample at full width, plus header, end tag and
+    -- padding, for each block and the trailing one
+    constant c_BLOCK_WORDS  : natural := (c_W + 2**c_CFGS(c).block_log2 * (c_T + c_N*c_A) +
+                                          c_T + c_W-1) / c_W;
+    constant c_MAX_WORDS    : natural := (c_CFGS(c).num_blocks+1) * c_BLOCK_WORDS + 16;
+
+    subtype t_word is std_logic_vector(c_W-1 downto 0);
+    type t_word_array is array (natural range <>) of t_word;
+
+    -- Read 'n' bits starting at bit 'pos' of the output stream
+    procedure f_read_bits(constant words : in    t_word_array;
+                          variable pos   : inout natural;
+                          constant n     : in    natural;
+                          variable res   : out   unsigned(c_W-1 downto 0)) is
+      variable v : unsigned(c_W-1 downto 0) := (others => '0');
+    begin
+      for b in 0 to n-1 loop
+        v(b) := words((pos+b) / c_W)((pos+b) mod c_W);
+      end loop;
+      pos := pos + n;
+      res := v;
+    end procedure f_read_bits;
+
+    signal start            : std_logic := '0';
+    signal flush            : std_logic := '0';
+    signal data_in          : t_word := (others => '0');
+    signal valid_in         : std_logic := '0';
+    signal data_out         : t_word;
+    signal valid_out        : std_logic;
+    signal ovf              : std_logic;
+    signal samples          : t_word_array(0 to c_NUM_SAMPLES-1);
+    signal stim_done        : std_logic := '0';
+  begin
+
+    uut : entity work.acq_delta_enc
+      generic map (
+        g_word_width  => c_W,
+        g_num_atoms   => c_N,
+        g_atom_width  => c_A
+      )
+      port map (
+        clk_i         => clk,
+        rst_n_i       => rst_n,
+        start_i       => start,
+        block_log2_i  => to_unsigned(c_CFGS(c).block_log2, 4),
+        flush_i       => flush,
+        data_i        => data_in,
+        valid_i       => valid_in,
+        data_o        => data_out,
+        valid_o       => valid_out,
+        ovf_o         => ovf
+      );
+
+    p_stim : process
+      variable seed1  : positive := 1 + c;
+      variable seed2  : positive := 1000 + c;
+      variable r      : real;
+      variable rnd    : unsigned(c_W-1 downto 0);
+      variable step   : unsigned(c_A-1 downto 0);
+      variable x      : t_word;
+      variable k_log2 : natural;
+    begin
+      wait until rst_n = '1';
+      wait until rising_edge(clk);
+
+      -- Garbage sent before start_i must not show up
+      f_rand(seed1, seed2, c_W, rnd);
+      data_in <= std_logic_vector(rnd);
+      valid_in <= '1';
+      wait until rising_edge(clk);
+      valid_in <= '0';
+
+      start <= '1';
+      wait until rising_edge(clk);
+      start <= '0';
+
+      if c_CFGS(c).ovf_samples > 0 then
+        for s in 0 to c_CFGS(c).ovf_samples-1 loop
+          f_rand(seed1, seed2, c_W, rnd);
+          data_in <= std_logic_vector(rnd);
+          valid_in <= '1';
+          wait until rising_edge(clk);
+        end loop;
+        valid_in <= '0';
+        f_wait_cycles(clk, 8);
+
+        -- Only what follows is decoded
+        start <= '1';
+        wait until rising_edge(clk);
+        start <= '0';
+      end if;
+
+      f_rand(seed1, seed2, c_W, rnd);
+      x := std_logic_vector(rnd);
+
+      for s in 0 to c_NUM_SAMPLES-1 loop
+        uniform(seed1, seed2, r);
+        if r < 1.0/64.0 then
+          -- Occasional incompressible sample
+          f_rand(seed1, seed2, c_W, rnd);
+          x := std_logic_vector(rnd);
+        else
+          for k in 0 to c_N-1 loop
+            uniform(seed1, seed2, r);
+            k_log2 := integer(floor(r * real(c_CFGS(c).max_step_log2+1)));
+            f_rand(seed1, seed2, k_log2, rnd);
+            step := resize(rnd, c_A);
+
+            uniform(seed1, seed2, r);
+            if r < 0.5 then
+              step := 0 - step;
+            end if;
+
+            x((k+1)*c_A-1 downto k*c_A) :=
+              std_logic_vector(unsigned(x((k+1)*c_A-1 downto k*c_A)) + step);
+          end loop;
+
+          -- Bits outside the atoms are not encoded
+          if c_N*c_A < c_W then
+            f_rand(seed1, seed2, c_W, rnd);
+            x(c_W-1 downto c_N*c_A) := std_logic_vector(rnd(c_W-1 downto c_N*c_A));
+          end if;
+        end if;
+
+        samples(s) <= x;
+        data_in <= x;
+        valid_in <= '1';
+        -- Along with the last sample, which closes the trailing block if
+        -- there is one, and must do nothing otherwise
+        if s = c_NUM_SAMPLES-1 then
+          flush <= '1';
+        end if;
+        wait until rising_edge(clk);
+        flush <= '0';
+
+        if c_CFGS(c).min_idle > 0 then
+          valid_in <= '0';
+          f_wait_cycles(clk, c_CFGS(c).min_idle);
+        end if;
+
+        -- Full rate bursts, with idle cycles in between
+        uniform(seed1, seed2, r);
+        if r < 0.3 then
+          valid_in <= '0';
+          f_wait_cycles(clk, 1 + integer(floor(r * 10.0)));
+        end if;
+      end loop;
+
+      valid_in <= '0';
+      stim_done <= '1';
+      wait;
+    end process;
+
+    p_check : process
+      variable words    : t_word_array(0 to c_MAX_WORDS-1);
+      variable nwords   : natural := 0;
+      variable idle     : natural := 0;
+      variable pos      : natural := 0;
+      variable v        : unsigned(c_W-1 downto 0);
+      variable tag      : natural;
+      variable zz       : unsigned(c_A-1 downto 0);
+      variable diff     : unsigned(c_A-1 downto 0);
+      variable sign     : unsigned(c_A-1 downto 0);
+      variable prev     : unsigned(c_N*c_A-1 downto 0);
+      variable s        : natural := 0;
+      variable nblk     : natural := 0;
+      variable nblk_smp : natural;
+      variable exp_smp  : natural;
+      variable base     : natural := 0;
+      variable ovf_seen : std_logic := '0';
+    begin
+      -- Collect the output until the encoder has been idle for a while
+      while stim_done = '0' or idle < 64 loop
+        wait until rising_edge(clk);
+        if valid_out = '1' then
+          words(nwords) := data_out;
+          nwords := nwords + 1;
+          idle := 0;
+        elsif stim_done = '1' then
+          idle := idle + 1;
+        end if;
+
+        -- Words up to a restart are not decoded
+        if start = '1' then
+          ovf_seen := ovf_seen or ovf;
+          base := nwords;
+        end if;
+      end loop;
+
+      if c_CFGS(c).ovf_samples > 0 then
+        assert ovf_seen = '1'
+          report "Cfg " & integer'image(c) & ": overload not flagged" severity error;
+      else
+        assert ovf_seen = '0'
+          report "Cfg " & integer'image(c) & ": samples dropped" severity error;
+      end if;
+
+      assert ovf = '0'
+        report "Cfg " & integer'image(c) & ": samples dropped" severity error;
+
+      pos := base*c_W;
+
+      -- Decode
+      while s < c_NUM_SAMPLES loop
+        assert pos + c_W <= nwords*c_W
+          report "Cfg " & integer'image(c) & ": stream ended at sample " &
+            integer'image(s) severity failure;
+
+        f_read_bits(words, pos, c_W, v);
+        assert v(15 downto 0) = c_MAGIC and
+               v(31 downto 16) = to_unsigned(nblk mod 2**16, 16) and
+               v(39 downto 32) = to_unsigned(c_A, 8) and
+               v(47 downto 40) = to_unsigned(c_N, 8) and
+               v(51 downto 48) = to_unsigned(c_CFGS(c).block_log2, 4) and
+               v(c_W-1 downto 52) = 0
+          report "Cfg " & integer'image(c) & ": bad header for block " &
+            integer'image(nblk) severity failure;
+
+        prev := (others => '0');
+        nblk_smp := 0;
+
+        loop
+          f_read_bits(words, pos, c_T, v);
+          tag := to_integer(v(c_T-1 downto 0));
+          exit when tag = 2**c_T-1;
+
+          assert tag <= c_A
+            report "Cfg " & integer'image(c) & ": bad tag " & integer'image(tag)
+            severity failure;
+
+          for k in 0 to c_N-1 loop
+            f_read_bits(words, pos, tag, v);
+            zz := v(c_A-1 downto 0);
+            sign := (others => zz(0));
+            diff := shift_right(zz, 1) xor sign;
+            prev((k+1)*c_A-1 downto k*c_A) := prev((k+1)*c_A-1 downto k*c_A) + diff;
+          end loop;
+
+          assert std_logic_vector(prev) = samples(s)(c_N*c_A-1 downto 0)
+            report "Cfg " & integer'image(c) & ": mismatch at sample " &
+              integer'image(s) severity error;
+
+          s := s + 1;
+          nblk_smp := nblk_smp + 1;
+        end loop;
+
+        if s = c_NUM_SAMPLES and c_CFGS(c).tail_samples > 0 then
+          exp_smp := c_CFGS(c).tail_samples;
+        else
+          exp_smp := 2**c_CFGS(c).block_log2;
+        end if;
+
+        assert nblk_smp = exp_smp
+          report "Cfg " & integer'image(c) & ": block " & integer'image(nblk) &
+            " has " & integer'image(nblk_smp) & " samples" severity error;
+
+        -- Blocks end on a word boundary
+        pos := ((pos + c_W-1) / c_W) * c_W;
+        nblk := nblk + 1;
+      end loop;
+
+      assert pos = nwords*c_W
+        report "Cfg " & integer'image(c) & ": trailing words" severity error;
+
+      report "Cfg " & integer'image(c) & ": " & integer'image(c_NUM_SAMPLES) &
+        " samples in " & integer'image(nwords-base) & " words" severity note;
+
+      done(c) <= '1';
+      wait;
+    end process;
+
+  end generate;
+
+end architecture test;
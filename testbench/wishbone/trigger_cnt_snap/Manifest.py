@@ -0,0 +1,11 @@
+files = [
+    "trigger_cnt_snap_tb.vhd",
+    "../../../modules/wishbone/wb_trigger_iface/trigger_cnt_snap.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../ip_cores/general-cores",
+        "../../../ip_cores/general-cores/sim/vhdl",
+    ],
+}
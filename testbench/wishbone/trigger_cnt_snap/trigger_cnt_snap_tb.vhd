@@ -0,0 +1,332 @@
+--------------------------------------------------------------------------------
+-- Title      : Trigger counter snapshot testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Counts received and transmitted trigger pulses with
+--              trigger_cnt_snap and reads the snapshots with block reads.
+--
+--              First, a different number of pulses on each channel and a
+--              snapshot requested through CTL. Then more than 2^16 pulses
+--              on one channel, checking the low bits of the live count
+--              that wb_trigger_iface shows in its legacy 16-bit count
+--              registers against the wide snapshot. Last, pulses on every
+--              channel every cycle while snap_i fires every few cycles:
+--              each block read must hold a single snapshot, with all the
+--              counts equal and following its timestamp.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.env.finish;
+
+library work;
+use work.wishbone_pkg.all;
+use work.sim_wishbone.all;
+
+entity trigger_cnt_snap_tb is
+end entity trigger_cnt_snap_tb;
+
+architecture test of trigger_cnt_snap_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  constant c_trig_num     : natural := 4;
+  constant c_count_width  : natural := 48;
+  -- Width of the wbgen count registers of wb_trigger_iface
+  constant c_legacy_width : natural := 16;
+
+  -- Word addresses, see trigger_cnt_snap_regs.h
+  constant c_ctl_adr      : natural := 16#00#;
+  constant c_sta_adr      : natural := 16#01#;
+  constant c_data_adr     : natural := 16#40#;
+
+  constant c_data_words   : natural := 4 + 4*c_trig_num;
+
+  type t_words is array (natural range <>) of std_logic_vector(31 downto 0);
+
+  -- Pipelined block read: a new address every cycle the slave doesn't
+  -- stall, all within a single cycle
+  procedure f_read_block(signal   clk  : in  std_logic;
+                         signal   wb_o : out t_wishbone_slave_in;
+                         signal   wb_i : in  t_wishbone_slave_out;
+                         constant adr  : in  natural;
+                         variable data : out t_words) is
+    variable v_issued : natural := 0;
+    variable v_acked  : natural := 0;
+  begin
+    wb_o.cyc <= '1';
+    wb_o.stb <= '1';
+    wb_o.we  <= '0';
+    wb_o.sel <= (others => '1');
+    wb_o.adr <= std_logic_vector(to_unsigned(adr, wb_o.adr'length));
+    while v_acked < data'length loop
+      wait until rising_edge(clk);
+      if v_issued < data'length and wb_i.stall = '0' then
+        v_issued := v_issued + 1;
+      end if;
+      if wb_i.ack = '1' then
+        data(data'low + v_acked) := wb_i.dat;
+        v_acked := v_acked + 1;
+      end if;
+      if v_issued < data'length then
+        wb_o.adr <= std_logic_vector(to_unsigned(adr + v_issued, wb_o.adr'length));
+      else
+        wb_o.stb <= '0';
+      end if;
+    end loop;
+    wb_o.cyc <= '0';
+    wb_o.stb <= '0';
+  end procedure f_read_block;
+
+  -- Fields of a snapshot block read
+  function f_seq(data : t_words) return natural is
+  begin
+    return to_integer(unsigned(data(0)));
+  end function f_seq;
+
+  function f_ts(data : t_words) return unsigned is
+  begin
+    return unsigned(data(3)) & unsigned(data(2));
+  end function f_ts;
+
+  function f_count(data : t_words; ch : natural; transm : boolean) return unsigned is
+    variable v_idx : natural := 4 + 4*ch;
+  begin
+    if transm then
+      v_idx := v_idx + 2;
+    end if;
+    return unsigned(data(v_idx+1)) & unsigned(data(v_idx));
+  end function f_count;
+
+  signal clk              : std_logic := '0';
+  signal ref_clk          : std_logic := '0';
+  signal rst_n            : std_logic := '0';
+  signal ref_rst_n        : std_logic := '0';
+  signal rcv              : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal transm           : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal rcv_count_rst_n  : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal tx_count_rst_n   : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal snap             : std_logic := '0';
+  signal snap_en          : boolean := false;
+  signal rcv_count        : std_logic_vector(c_trig_num*c_count_width-1 downto 0);
+  signal transm_count     : std_logic_vector(c_trig_num*c_count_width-1 downto 0);
+  signal wb_slv_i         : t_wishbone_slave_in;
+  signal wb_slv_o         : t_wishbone_slave_out;
+begin
+  f_gen_clk(100_000_000, clk);
+  f_gen_clk(125_000_000, ref_clk);
+
+  -- snap_i every 5 ref_clk cycles while enabled
+  p_snap : process
+  begin
+    wait until rising_edge(ref_clk);
+    if snap_en then
+      snap <= '1';
+      wait until rising_edge(ref_clk);
+      snap <= '0';
+      f_wait_cycles(ref_clk, 3);
+    end if;
+  end process;
+
+  process
+    variable v_data    : std_logic_vector(31 downto 0);
+    variable v_block   : t_words(0 to c_data_words-1);
+    variable v_seq     : natural;
+    variable v_count   : unsigned(63 downto 0);
+    variable v_legacy  : unsigned(c_legacy_width-1 downto 0);
+    variable v_offset  : unsigned(63 downto 0);
+
+    constant c_wrap_pulses : natural := 2**c_legacy_width + 4464;
+    constant c_bursts      : natural := 20;
+  begin
+    init(wb_slv_i);
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    wait until rising_edge(ref_clk);
+    ref_rst_n       <= '1';
+    rcv_count_rst_n <= (others => '1');
+    tx_count_rst_n  <= (others => '1');
+    f_wait_cycles(clk, 10);
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data = std_logic_vector(to_unsigned(c_count_width * 2**16, 32))
+      report "STA 0x" & to_hstring(v_data) & " instead of idle with the counter width"
+      severity error;
+
+    ----------------------------------------------------------------------------
+    -- Snapshot requested through CTL
+    ----------------------------------------------------------------------------
+    -- i+1 received and 2*(i+1) transmitted pulses on channel i
+    for p in 1 to 2*c_trig_num loop
+      wait until rising_edge(ref_clk);
+      for i in 0 to c_trig_num-1 loop
+        rcv(i)    <= '1' when p <= i+1 else '0';
+        transm(i) <= '1' when p <= 2*(i+1) else '0';
+      end loop;
+    end loop;
+    wait until rising_edge(ref_clk);
+    rcv    <= (others => '0');
+    transm <= (others => '0');
+    f_wait_cycles(ref_clk, 2);
+
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_ctl_adr, x"00000001");
+    loop
+      read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+      exit when v_data(0) = '0';
+    end loop;
+
+    f_read_block(clk, wb_slv_i, wb_slv_o, c_data_adr, v_block);
+    assert f_seq(v_block) = 1
+      report "Sequence number " & integer'image(f_seq(v_block)) & " after the first snapshot"
+      severity error;
+    assert v_block(1) = x"00000000"
+      report "Reserved word isn't zero" severity error;
+    for i in 0 to c_trig_num-1 loop
+      assert f_count(v_block, i, false) = i+1 and f_count(v_block, i, true) = 2*(i+1)
+        report "Channel " & integer'image(i) & ": counts " &
+               integer'image(to_integer(f_count(v_block, i, false))) & " and " &
+               integer'image(to_integer(f_count(v_block, i, true))) & " instead of " &
+               integer'image(i+1) & " and " & integer'image(2*(i+1))
+        severity error;
+    end loop;
+
+    ----------------------------------------------------------------------------
+    -- Legacy 16-bit view
+    ----------------------------------------------------------------------------
+    -- Wrap the low bits of received channel 0
+    wait until rising_edge(ref_clk);
+    rcv(0) <= '1';
+    f_wait_cycles(ref_clk, c_wrap_pulses);
+    rcv(0) <= '0';
+    f_wait_cycles(ref_clk, 2);
+
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_ctl_adr, x"00000001");
+    loop
+      read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+      exit when v_data(0) = '0';
+    end loop;
+    f_read_block(clk, wb_slv_i, wb_slv_o, c_data_adr, v_block);
+
+    assert f_seq(v_block) = 2
+      report "Sequence number " & integer'image(f_seq(v_block)) & " after the second snapshot"
+      severity error;
+    v_count := f_count(v_block, 0, false);
+    assert v_count = c_wrap_pulses + 1
+      report "Wide count " & integer'image(to_integer(v_count)) & " instead of " &
+             integer'image(c_wrap_pulses + 1)
+      severity error;
+
+    -- The same slices wb_trigger_iface takes for its count registers
+    for i in 0 to c_trig_num-1 loop
+      v_legacy := unsigned(rcv_count(i*c_count_width+c_legacy_width-1 downto i*c_count_width));
+      assert v_legacy = f_count(v_block, i, false)(c_legacy_width-1 downto 0)
+        report "Channel " & integer'image(i) & ": legacy received count " &
+               integer'image(to_integer(v_legacy)) & " doesn't match the snapshot"
+        severity error;
+      v_legacy := unsigned(transm_count(i*c_count_width+c_legacy_width-1 downto i*c_count_width));
+      assert v_legacy = f_count(v_block, i, true)(c_legacy_width-1 downto 0)
+        report "Channel " & integer'image(i) & ": legacy transmitted count " &
+               integer'image(to_integer(v_legacy)) & " doesn't match the snapshot"
+        severity error;
+    end loop;
+    assert unsigned(rcv_count(c_legacy_width-1 downto 0)) = (c_wrap_pulses + 1) mod 2**c_legacy_width
+      report "Legacy received count of channel 0 didn't wrap" severity error;
+
+    ----------------------------------------------------------------------------
+    -- snap_i during block reads
+    ----------------------------------------------------------------------------
+    -- Reset every counter in the same cycle, with pulses on every channel
+    -- every cycle from then on: the counts of a snapshot are all equal and
+    -- a fixed offset from its timestamp
+    wait until rising_edge(ref_clk);
+    rcv             <= (others => '1');
+    transm          <= (others => '1');
+    rcv_count_rst_n <= (others => '0');
+    tx_count_rst_n  <= (others => '0');
+    wait until rising_edge(ref_clk);
+    rcv_count_rst_n <= (others => '1');
+    tx_count_rst_n  <= (others => '1');
+    snap_en         <= true;
+    f_wait_cycles(ref_clk, 20);
+
+    v_seq := 2;
+    for b in 0 to c_bursts-1 loop
+      f_read_block(clk, wb_slv_i, wb_slv_o, c_data_adr, v_block);
+      assert f_seq(v_block) > v_seq
+        report "Burst " & integer'image(b) & ": no new snapshot since the last one"
+        severity error;
+      v_seq := f_seq(v_block);
+
+      v_count := f_count(v_block, 0, false);
+      if b = 0 then
+        v_offset := f_ts(v_block) - v_count;
+      end if;
+      assert f_ts(v_block) - v_count = v_offset
+        report "Burst " & integer'image(b) & ": count " &
+               integer'image(to_integer(v_count)) & " doesn't follow the timestamp"
+        severity error;
+      for i in 0 to c_trig_num-1 loop
+        assert f_count(v_block, i, false) = v_count and f_count(v_block, i, true) = v_count
+          report "Burst " & integer'image(b) & ": channel " & integer'image(i) &
+                 " counts from a different snapshot"
+          severity error;
+      end loop;
+
+      f_wait_cycles(clk, b mod 7);
+    end loop;
+
+    snap_en <= false;
+    rcv     <= (others => '0');
+    transm  <= (others => '0');
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data(0) = '0'
+      report "STA busy without a CTL request" severity error;
+
+    finish;
+  end process;
+
+  uut : entity work.trigger_cnt_snap
+    generic map (
+      g_trig_num    => c_trig_num,
+      g_count_width => c_count_width)
+    port map (
+      clk_i                => clk,
+      rst_n_i              => rst_n,
+      ref_clk_i            => ref_clk,
+      ref_rst_n_i          => ref_rst_n,
+      rcv_i                => rcv,
+      transm_i             => transm,
+      rcv_count_rst_n_i    => rcv_count_rst_n,
+      transm_count_rst_n_i => tx_count_rst_n,
+      snap_i               => snap,
+      rcv_count_o          => rcv_count,
+      transm_count_o       => transm_count,
+      wb_slv_i             => wb_slv_i,
+      wb_slv_o             => wb_slv_o);
+
+end architecture test;
@@ -0,0 +1,11 @@
+files = [
+    "trigger_evt_log_tb.vhd",
+    "../../../modules/wishbone/wb_trigger_iface/trigger_evt_log.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../ip_cores/general-cores",
+        "../../../ip_cores/general-cores/sim/vhdl",
+    ],
+}
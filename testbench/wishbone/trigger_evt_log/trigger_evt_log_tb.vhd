@@ -0,0 +1,274 @@
+--------------------------------------------------------------------------------
+-- Title      : Trigger event log testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Sends received and transmitted trigger pulses to
+--              trigger_evt_log and drains the log with block reads of the
+--              entry window.
+--
+--              First, pulses on several channels of both directions in the
+--              same cycle, which must come out as one entry each, in channel
+--              order, with the same timestamp. Then pulses on every channel
+--              for many cycles in a row, which overflow the capture FIFO:
+--              the logged pulses plus the counts of the lost markers must
+--              add up to the pulses sent.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.env.finish;
+
+library work;
+use work.wishbone_pkg.all;
+use work.sim_wishbone.all;
+
+entity trigger_evt_log_tb is
+end entity trigger_evt_log_tb;
+
+architecture test of trigger_evt_log_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  constant c_trig_num       : natural := 8;
+  constant c_window_entries : natural := 16;
+
+  -- Word addresses, see trigger_evt_log_regs.h
+  constant c_ctl_adr        : natural := 16#00#;
+  constant c_sta_adr        : natural := 16#01#;
+  constant c_entries_adr    : natural := 16#40#;
+
+  type t_words is array (natural range <>) of std_logic_vector(31 downto 0);
+
+  -- Pipelined block read: a new address every cycle the slave doesn't
+  -- stall, all within a single cycle
+  procedure f_read_block(signal   clk  : in  std_logic;
+                         signal   wb_o : out t_wishbone_slave_in;
+                         signal   wb_i : in  t_wishbone_slave_out;
+                         constant adr  : in  natural;
+                         variable data : out t_words) is
+    variable v_issued : natural := 0;
+    variable v_acked  : natural := 0;
+  begin
+    wb_o.cyc <= '1';
+    wb_o.stb <= '1';
+    wb_o.we  <= '0';
+    wb_o.sel <= (others => '1');
+    wb_o.adr <= std_logic_vector(to_unsigned(adr, wb_o.adr'length));
+    while v_acked < data'length loop
+      wait until rising_edge(clk);
+      if v_issued < data'length and wb_i.stall = '0' then
+        v_issued := v_issued + 1;
+      end if;
+      if wb_i.ack = '1' then
+        data(data'low + v_acked) := wb_i.dat;
+        v_acked := v_acked + 1;
+      end if;
+      if v_issued < data'length then
+        wb_o.adr <= std_logic_vector(to_unsigned(adr + v_issued, wb_o.adr'length));
+      else
+        wb_o.stb <= '0';
+      end if;
+    end loop;
+    wb_o.cyc <= '0';
+    wb_o.stb <= '0';
+  end procedure f_read_block;
+
+  signal clk       : std_logic := '0';
+  signal ref_clk   : std_logic := '0';
+  signal rst_n     : std_logic := '0';
+  signal ref_rst_n : std_logic := '0';
+  signal rcv       : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal transm    : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+  signal wb_slv_i  : t_wishbone_slave_in;
+  signal wb_slv_o  : t_wishbone_slave_out;
+begin
+  f_gen_clk(100_000_000, clk);
+  f_gen_clk(125_000_000, ref_clk);
+
+  process
+    variable v_data       : std_logic_vector(31 downto 0);
+    variable v_block      : t_words(0 to 4*c_window_entries-1);
+    variable v_info       : std_logic_vector(31 downto 0);
+    variable v_ts         : unsigned(63 downto 0);
+    variable v_ts0        : unsigned(63 downto 0);
+    variable v_entries    : natural;
+    variable v_logged     : natural;
+    variable v_lost       : natural;
+    variable v_markers    : natural;
+    variable v_done       : boolean;
+
+    type t_exp is record
+      transm : std_logic;
+      ch     : natural;
+      dt     : natural;
+    end record;
+    type t_exps is array (natural range <>) of t_exp;
+
+    -- rcv 0 and 2 and transm 0 and 7 in the same cycle, then transm 1 five
+    -- cycles later: dt is the timestamp offset to the first entry
+    constant c_exps : t_exps := (
+      ('0', 0, 0), ('0', 2, 0), ('1', 0, 0), ('1', 7, 0), ('1', 1, 5));
+
+    constant c_ovf_cycles : natural := 64;
+  begin
+    init(wb_slv_i);
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    wait until rising_edge(ref_clk);
+    ref_rst_n <= '1';
+    f_wait_cycles(clk, 10);
+
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_ctl_adr, x"00000001");
+    f_wait_cycles(ref_clk, 10);
+
+    ----------------------------------------------------------------------------
+    -- Simultaneous pulses
+    ----------------------------------------------------------------------------
+    wait until rising_edge(ref_clk);
+    rcv    <= "00000101";
+    transm <= "10000001";
+    wait until rising_edge(ref_clk);
+    rcv    <= (others => '0');
+    transm <= (others => '0');
+    f_wait_cycles(ref_clk, 4);
+    transm <= "00000010";
+    wait until rising_edge(ref_clk);
+    transm <= (others => '0');
+    f_wait_cycles(clk, 50);
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data(31) = '1' and to_integer(unsigned(v_data(15 downto 0))) = c_exps'length
+      report "Log holds " & integer'image(to_integer(unsigned(v_data(15 downto 0)))) &
+             " entries instead of " & integer'image(c_exps'length)
+      severity error;
+
+    -- A single block read drains them all, and the rest of the window reads
+    -- as zeros
+    f_read_block(clk, wb_slv_i, wb_slv_o, c_entries_adr, v_block);
+    for i in 0 to c_window_entries-1 loop
+      v_info := v_block(4*i);
+      v_ts   := unsigned(v_block(4*i+3)) & unsigned(v_block(4*i+2));
+      if i < c_exps'length then
+        if i = 0 then
+          v_ts0 := v_ts;
+        end if;
+        assert v_info(31) = '1' and v_info(30) = '0' and
+               v_info(8) = c_exps(i).transm and
+               to_integer(unsigned(v_info(7 downto 0))) = c_exps(i).ch
+          report "Entry " & integer'image(i) & ": bad info 0x" & to_hstring(v_info)
+          severity error;
+        assert v_ts = v_ts0 + c_exps(i).dt
+          report "Entry " & integer'image(i) & ": timestamp " &
+                 integer'image(to_integer(v_ts - v_ts0)) & " cycles after the first one" &
+                 " instead of " & integer'image(c_exps(i).dt)
+          severity error;
+      else
+        assert v_block(4*i) = x"00000000" and v_block(4*i+2) = x"00000000" and
+               v_block(4*i+3) = x"00000000"
+          report "Entry " & integer'image(i) & " past the log end isn't zero"
+          severity error;
+      end if;
+      assert v_block(4*i+1) = x"00000000"
+        report "Entry " & integer'image(i) & ": reserved word isn't zero"
+        severity error;
+    end loop;
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data = x"00000000"
+      report "Log not empty after draining it" severity error;
+
+    ----------------------------------------------------------------------------
+    -- Capture FIFO overflow
+    ----------------------------------------------------------------------------
+    -- Every channel every cycle: the entries go out much slower than that
+    wait until rising_edge(ref_clk);
+    rcv    <= (others => '1');
+    transm <= (others => '1');
+    f_wait_cycles(ref_clk, c_ovf_cycles);
+    rcv    <= (others => '0');
+    transm <= (others => '0');
+    f_wait_cycles(ref_clk, 2000);
+
+    v_logged  := 0;
+    v_lost    := 0;
+    v_markers := 0;
+    v_entries := 0;
+    v_done    := false;
+    while not v_done loop
+      f_read_block(clk, wb_slv_i, wb_slv_o, c_entries_adr, v_block);
+      for i in 0 to c_window_entries-1 loop
+        v_info := v_block(4*i);
+        if v_info(31) = '0' then
+          v_done := true;
+        else
+          assert not v_done
+            report "Valid entry after an empty one in a block read" severity error;
+          v_entries := v_entries + 1;
+          if v_info(30) = '1' then
+            assert unsigned(v_block(4*i+2)) /= 0 and v_block(4*i+3) = x"00000000"
+              report "Lost marker with a bad count" severity error;
+            v_markers := v_markers + 1;
+            v_lost    := v_lost + to_integer(unsigned(v_block(4*i+2)));
+          else
+            v_logged := v_logged + 1;
+          end if;
+        end if;
+      end loop;
+    end loop;
+
+    report "Overflow: " & integer'image(v_logged) & " pulses logged, " &
+           integer'image(v_lost) & " lost in " & integer'image(v_markers) &
+           " markers";
+    assert v_markers > 0
+      report "No lost marker after overflowing the capture FIFO" severity error;
+    assert v_logged + v_lost = c_ovf_cycles*2*c_trig_num
+      report "Logged plus lost pulses: " & integer'image(v_logged + v_lost) &
+             " instead of " & integer'image(c_ovf_cycles*2*c_trig_num)
+      severity error;
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data = x"00000000"
+      report "Log not empty after draining it" severity error;
+
+    finish;
+  end process;
+
+  uut : entity work.trigger_evt_log
+    generic map (
+      g_trig_num => c_trig_num,
+      g_size     => 512)
+    port map (
+      clk_i       => clk,
+      rst_n_i     => rst_n,
+      ref_clk_i   => ref_clk,
+      ref_rst_n_i => ref_rst_n,
+      rcv_i       => rcv,
+      transm_i    => transm,
+      wb_slv_i    => wb_slv_i,
+      wb_slv_o    => wb_slv_o);
+
+end architecture test;
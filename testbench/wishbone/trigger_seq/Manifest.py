@@ -0,0 +1,12 @@
+files = [
+    "trigger_seq_tb.vhd",
+    "../../../modules/common/trigger_common/trigger_common_pkg.vhd",
+    "../../../modules/wishbone/wb_trigger_mux/trigger_seq.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../ip_cores/general-cores",
+        "../../../ip_cores/general-cores/sim/vhdl",
+    ],
+}
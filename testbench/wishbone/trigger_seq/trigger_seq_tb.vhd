@@ -0,0 +1,455 @@
+--------------------------------------------------------------------------------
+-- Title      : Trigger sequencer testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Loads three lists into the trigger_seq table with one block
+--              write, reads it back, and plays them:
+--
+--              - list A, started by a START write and played twice: the
+--                spacing and width of each pulse, with a delay under the
+--                3-cycle minimum stretched to it and a zero width giving
+--                one cycle;
+--              - list B, a single long pulse played until STOP: periodic
+--                pulses, then a STOP while one is high must cut it short;
+--              - list C, started by a rising edge on a selected external
+--                input and then on a selected internal one: pulses on
+--                other inputs must not start it, and the latency from the
+--                edge is the delay of the entry.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.env.finish;
+
+library work;
+use work.wishbone_pkg.all;
+use work.sim_wishbone.all;
+use work.trigger_common_pkg.all;
+
+entity trigger_seq_tb is
+end entity trigger_seq_tb;
+
+architecture test of trigger_seq_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  constant c_trig_num       : natural := 4;
+  constant c_rcv_intern_num : natural := 2;
+  constant c_size           : natural := 16;
+  constant c_fs_freq        : natural := 125_000_000;
+  constant c_fs_period      : time    := 1 sec / c_fs_freq;
+
+  -- Word addresses, see trigger_seq_regs.h
+  constant c_ctl_adr        : natural := 16#00#;
+  constant c_sta_adr        : natural := 16#01#;
+  constant c_list_adr       : natural := 16#02#;
+  constant c_loops_adr      : natural := 16#03#;
+  constant c_size_adr       : natural := 16#04#;
+  constant c_table_adr      : natural := 16#400#;
+
+  -- CTL bits
+  constant c_ctl_arm        : natural := 16#01#;
+  constant c_ctl_start      : natural := 16#02#;
+  constant c_ctl_stop       : natural := 16#04#;
+  constant c_ctl_hw_start   : natural := 16#08#;
+  constant c_ctl_src_intern : natural := 16#10#;
+  constant c_ctl_sel_shift  : natural := 8;
+
+  constant c_last           : std_logic_vector(31 downto 0) := x"80000000";
+
+  type t_words is array (natural range <>) of std_logic_vector(31 downto 0);
+
+  -- Table entry: delay, width, channel mask, last
+  type t_entry is record
+    delay : natural;
+    width : natural;
+    mask  : std_logic_vector(c_trig_num-1 downto 0);
+    last  : boolean;
+  end record;
+  type t_entries is array (natural range <>) of t_entry;
+
+  constant c_list_a : natural := 0;
+  constant c_list_b : natural := 4;
+  constant c_list_c : natural := 5;
+
+  constant c_table : t_entries(0 to 5) := (
+    -- List A. Entry 2 is stretched to 3 cycles and lasts one
+    (10, 3, "0001", false),
+    (5,  1, "0010", false),
+    (1,  0, "0100", false),
+    (3,  2, "1001", true),
+    -- List B
+    (40, 30, "0010", true),
+    -- List C
+    (7,  2, "1000", true));
+
+  -- Pipelined block write, all within a single cycle
+  procedure f_write_block(signal   clk  : in  std_logic;
+                          signal   wb_o : out t_wishbone_slave_in;
+                          signal   wb_i : in  t_wishbone_slave_out;
+                          constant adr  : in  natural;
+                          constant data : in  t_words) is
+    variable v_issued : natural := 0;
+    variable v_acked  : natural := 0;
+  begin
+    wb_o.cyc <= '1';
+    wb_o.stb <= '1';
+    wb_o.we  <= '1';
+    wb_o.sel <= (others => '1');
+    wb_o.adr <= std_logic_vector(to_unsigned(adr, wb_o.adr'length));
+    wb_o.dat <= data(data'low);
+    while v_acked < data'length loop
+      wait until rising_edge(clk);
+      if v_issued < data'length and wb_i.stall = '0' then
+        v_issued := v_issued + 1;
+      end if;
+      if wb_i.ack = '1' then
+        v_acked := v_acked + 1;
+      end if;
+      if v_issued < data'length then
+        wb_o.adr <= std_logic_vector(to_unsigned(adr + v_issued, wb_o.adr'length));
+        wb_o.dat <= data(data'low + v_issued);
+      else
+        wb_o.stb <= '0';
+      end if;
+    end loop;
+    wb_o.cyc <= '0';
+    wb_o.stb <= '0';
+    wb_o.we  <= '0';
+  end procedure f_write_block;
+
+  -- Pipelined block read, all within a single cycle
+  procedure f_read_block(signal   clk  : in  std_logic;
+                         signal   wb_o : out t_wishbone_slave_in;
+                         signal   wb_i : in  t_wishbone_slave_out;
+                         constant adr  : in  natural;
+                         variable data : out t_words) is
+    variable v_issued : natural := 0;
+    variable v_acked  : natural := 0;
+  begin
+    wb_o.cyc <= '1';
+    wb_o.stb <= '1';
+    wb_o.we  <= '0';
+    wb_o.sel <= (others => '1');
+    wb_o.adr <= std_logic_vector(to_unsigned(adr, wb_o.adr'length));
+    while v_acked < data'length loop
+      wait until rising_edge(clk);
+      if v_issued < data'length and wb_i.stall = '0' then
+        v_issued := v_issued + 1;
+      end if;
+      if wb_i.ack = '1' then
+        data(data'low + v_acked) := wb_i.dat;
+        v_acked := v_acked + 1;
+      end if;
+      if v_issued < data'length then
+        wb_o.adr <= std_logic_vector(to_unsigned(adr + v_issued, wb_o.adr'length));
+      else
+        wb_o.stb <= '0';
+      end if;
+    end loop;
+    wb_o.cyc <= '0';
+    wb_o.stb <= '0';
+  end procedure f_read_block;
+
+  function f_table_words(table : t_entries) return t_words is
+    variable v_words : t_words(0 to 4*table'length-1) := (others => (others => '0'));
+  begin
+    for n in 0 to table'length-1 loop
+      v_words(4*n)   := std_logic_vector(to_unsigned(table(n).delay, 32));
+      v_words(4*n+1) := std_logic_vector(to_unsigned(table(n).width, 32));
+      v_words(4*n+2)(c_trig_num-1 downto 0) := table(n).mask;
+      if table(n).last then
+        v_words(4*n+2) := v_words(4*n+2) or c_last;
+      end if;
+      -- Reserved words are written with garbage, they must read as zero
+      v_words(4*n+3) := x"deadbeef";
+    end loop;
+    return v_words;
+  end function f_table_words;
+
+  signal clk            : std_logic := '0';
+  signal fs_clk         : std_logic := '0';
+  signal rst_n          : std_logic := '0';
+  signal fs_rst_n       : std_logic := '0';
+  signal trig_in        : t_trig_channel_array(c_trig_num-1 downto 0) := (others => (pulse => '0'));
+  signal trig_rcv_intern : t_trig_channel_array(c_rcv_intern_num-1 downto 0) := (others => (pulse => '0'));
+  signal trig_out       : t_trig_channel_array(c_trig_num-1 downto 0);
+  signal wb_slv_i       : t_wishbone_slave_in;
+  signal wb_slv_o       : t_wishbone_slave_out;
+begin
+  f_gen_clk(100_000_000, clk);
+  f_gen_clk(c_fs_freq, fs_clk);
+
+  process
+    variable v_data  : std_logic_vector(31 downto 0);
+    variable v_words : t_words(0 to 4*c_table'length-1);
+    variable v_exp   : std_logic_vector(31 downto 0);
+    variable v_rise  : time;
+
+    -- Pulses seen on the outputs, in order of rising edge, then channel.
+    -- rise is the fs_clk_i edge the output went high on, counted from the
+    -- start of the capture; width is 0 if it was still high at the end
+    type t_event is record
+      ch    : natural;
+      rise  : integer;
+      width : natural;
+    end record;
+    type t_events is array (0 to 63) of t_event;
+    type t_open is array (0 to c_trig_num-1) of natural;
+
+    variable v_ev  : t_events;
+    variable v_nev : natural;
+
+    -- Samples the outputs for 'cycles' fs_clk_i cycles. With hw_ch >= 0, a
+    -- one-cycle pulse is driven on that input (internal if hw_intern) on
+    -- the first edge, so the sequencer sees it on edge 1
+    procedure f_capture(constant cycles    : in natural;
+                        constant hw_ch     : in integer;
+                        constant hw_intern : in boolean) is
+      variable v_high : std_logic_vector(c_trig_num-1 downto 0) := (others => '0');
+      variable v_open : t_open;
+    begin
+      v_nev := 0;
+      for k in 0 to cycles loop
+        wait until rising_edge(fs_clk);
+        if hw_ch >= 0 and k <= 1 then
+          if hw_intern then
+            trig_rcv_intern(hw_ch).pulse <= '1' when k = 0 else '0';
+          else
+            trig_in(hw_ch).pulse <= '1' when k = 0 else '0';
+          end if;
+        end if;
+        -- The value sampled on edge k was set on edge k-1
+        for i in 0 to c_trig_num-1 loop
+          if trig_out(i).pulse = '1' and v_high(i) = '0' then
+            assert v_nev <= t_events'high report "Too many pulses" severity failure;
+            v_ev(v_nev) := (ch => i, rise => k-1, width => 0);
+            v_open(i)   := v_nev;
+            v_nev       := v_nev + 1;
+          elsif trig_out(i).pulse = '0' and v_high(i) = '1' then
+            v_ev(v_open(i)).width := k-1 - v_ev(v_open(i)).rise;
+          end if;
+          v_high(i) := trig_out(i).pulse;
+        end loop;
+      end loop;
+    end procedure f_capture;
+
+    procedure f_check_event(constant n     : in natural;
+                            constant ch    : in natural;
+                            constant rise  : in integer;
+                            constant width : in natural) is
+    begin
+      if n >= v_nev then
+        report "Pulse " & integer'image(n) & " missing" severity error;
+      else
+        assert v_ev(n).ch = ch and v_ev(n).rise = rise and v_ev(n).width = width
+          report "Pulse " & integer'image(n) & ": channel " & integer'image(v_ev(n).ch) &
+                 " at " & integer'image(v_ev(n).rise) & " for " &
+                 integer'image(v_ev(n).width) & " cycles instead of channel " &
+                 integer'image(ch) & " at " & integer'image(rise) & " for " &
+                 integer'image(width)
+          severity error;
+      end if;
+    end procedure f_check_event;
+
+    procedure f_ctl(constant bits : in natural) is
+    begin
+      write32_pl(clk, wb_slv_i, wb_slv_o, c_ctl_adr, std_logic_vector(to_unsigned(bits, 32)));
+    end procedure f_ctl;
+
+    procedure f_arm(constant list  : in natural;
+                    constant loops : in natural;
+                    constant ctl   : in natural) is
+    begin
+      write32_pl(clk, wb_slv_i, wb_slv_o, c_list_adr, std_logic_vector(to_unsigned(list, 32)));
+      write32_pl(clk, wb_slv_i, wb_slv_o, c_loops_adr, std_logic_vector(to_unsigned(loops, 32)));
+      f_ctl(ctl + c_ctl_arm);
+      loop
+        read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+        exit when v_data(0) = '1';
+      end loop;
+    end procedure f_arm;
+
+    procedure f_check_idle is
+    begin
+      f_wait_cycles(clk, 10);
+      read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+      assert v_data = x"00000000"
+        report "STA 0x" & to_hstring(v_data) & " instead of idle" severity error;
+    end procedure f_check_idle;
+
+    -- List A, relative to its first pulse: channel, rise, width
+    type t_exp is record
+      ch    : natural;
+      rise  : natural;
+      width : natural;
+    end record;
+    type t_exps is array (natural range <>) of t_exp;
+    constant c_exps_a : t_exps := (
+      (0, 0, 3), (1, 5, 1), (2, 8, 1), (0, 11, 2), (3, 11, 2));
+    -- From the last entry of a pass to the first of the next
+    constant c_pass_a : natural := 11 + 10;
+
+    constant c_period_b : natural := 40;
+  begin
+    init(wb_slv_i);
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    wait until rising_edge(fs_clk);
+    fs_rst_n <= '1';
+    f_wait_cycles(clk, 10);
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_size_adr, v_data);
+    assert to_integer(unsigned(v_data)) = c_size
+      report "SIZE reads " & integer'image(to_integer(unsigned(v_data))) severity error;
+    f_check_idle;
+
+    ----------------------------------------------------------------------------
+    -- Table load
+    ----------------------------------------------------------------------------
+    f_write_block(clk, wb_slv_i, wb_slv_o, c_table_adr, f_table_words(c_table));
+    f_read_block(clk, wb_slv_i, wb_slv_o, c_table_adr, v_words);
+    for n in 0 to 4*c_table'length-1 loop
+      v_exp := f_table_words(c_table)(n);
+      if n mod 4 = 3 then
+        v_exp := x"00000000";
+      end if;
+      assert v_words(n) = v_exp
+        report "Table word " & integer'image(n) & " reads 0x" & to_hstring(v_words(n)) &
+               " instead of 0x" & to_hstring(v_exp)
+        severity error;
+    end loop;
+
+    ----------------------------------------------------------------------------
+    -- List A: delays and widths, two passes
+    ----------------------------------------------------------------------------
+    f_arm(c_list_a, 2, 0);
+    f_ctl(c_ctl_start);
+    f_capture(100, -1, false);
+
+    assert v_nev = 2*c_exps_a'length
+      report integer'image(v_nev) & " pulses instead of " & integer'image(2*c_exps_a'length)
+      severity error;
+    if v_nev > 0 then
+      for p in 0 to 1 loop
+        for n in c_exps_a'range loop
+          f_check_event(p*c_exps_a'length + n, c_exps_a(n).ch,
+                        v_ev(0).rise + p*c_pass_a + c_exps_a(n).rise, c_exps_a(n).width);
+        end loop;
+      end loop;
+    end if;
+    f_check_idle;
+
+    ----------------------------------------------------------------------------
+    -- List B: until STOP
+    ----------------------------------------------------------------------------
+    f_arm(c_list_b, 0, 0);
+    f_ctl(c_ctl_start);
+    f_capture(5*c_period_b, -1, false);
+
+    assert v_nev >= 4
+      report "Only " & integer'image(v_nev) & " pulses with LOOPS = 0" severity error;
+    for n in 0 to v_nev-1 loop
+      f_check_event(n, 1, v_ev(0).rise + n*c_period_b, v_ev(n).width);
+      assert v_ev(n).width = 30 or (n = v_nev-1 and v_ev(n).width = 0)
+        report "Pulse " & integer'image(n) & " lasts " & integer'image(v_ev(n).width) &
+               " cycles instead of 30"
+        severity error;
+    end loop;
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data(1) = '1'
+      report "Not running any more with LOOPS = 0" severity error;
+
+    -- STOP a few cycles into a pulse
+    if trig_out(1).pulse = '1' then
+      wait until trig_out(1).pulse = '0';
+    end if;
+    wait until trig_out(1).pulse = '1';
+    v_rise := now;
+    f_wait_cycles(fs_clk, 5);
+    f_ctl(c_ctl_stop);
+    wait until trig_out(1).pulse = '0' for 30*c_fs_period;
+    assert trig_out(1).pulse = '0' and now - v_rise < 25*c_fs_period
+      report "STOP didn't cut the pulse short" severity error;
+    f_capture(2*c_period_b, -1, false);
+    assert v_nev = 0
+      report "Pulses after STOP" severity error;
+    f_check_idle;
+
+    ----------------------------------------------------------------------------
+    -- List C: start on an input
+    ----------------------------------------------------------------------------
+    -- External input 2
+    f_arm(c_list_c, 1, c_ctl_hw_start + 2*2**c_ctl_sel_shift);
+
+    -- Not selected
+    f_capture(30, 1, false);
+    f_capture(30, 0, true);
+    assert v_nev = 0
+      report "Started by an input not selected" severity error;
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_sta_adr, v_data);
+    assert v_data = x"00000001"
+      report "Not armed any more after pulses on the other inputs" severity error;
+
+    f_capture(30, 2, false);
+    assert v_nev = 1
+      report integer'image(v_nev) & " pulses instead of 1" severity error;
+    f_check_event(0, 3, 1 + 7, 2);
+    f_check_idle;
+
+    -- Internal input 1
+    f_arm(c_list_c, 1, c_ctl_hw_start + c_ctl_src_intern + 1*2**c_ctl_sel_shift);
+    f_capture(30, 2, false);
+    assert v_nev = 0
+      report "Started by an external input with the internal ones selected" severity error;
+    f_capture(30, 1, true);
+    assert v_nev = 1
+      report integer'image(v_nev) & " pulses instead of 1" severity error;
+    f_check_event(0, 3, 1 + 7, 2);
+    f_check_idle;
+
+    finish;
+  end process;
+
+  uut : entity work.trigger_seq
+    generic map (
+      g_trig_num       => c_trig_num,
+      g_rcv_intern_num => c_rcv_intern_num,
+      g_size           => c_size)
+    port map (
+      clk_i             => clk,
+      rst_n_i           => rst_n,
+      fs_clk_i          => fs_clk,
+      fs_rst_n_i        => fs_rst_n,
+      trig_in_i         => trig_in,
+      trig_rcv_intern_i => trig_rcv_intern,
+      trig_out_o        => trig_out,
+      wb_slv_i          => wb_slv_i,
+      wb_slv_o          => wb_slv_o);
+
+end architecture test;
@@ -454,6 +454,10 @@ module wb_acq_core_tb;
   reg [32-1:0] lmt_pkt_size;
   reg skip_trig;
   reg wait_finish;
+
+  // Acquisition layout log, checked against the host layout model with
+  // modules/wishbone/wb_acq_core/sw/test/acq_layout_test acq_layout.log
+  integer layout_log;
   real data_valid_prob;
   integer min_wait_gnt;
   integer max_wait_gnt;
@@ -1103,6 +1107,8 @@ module wb_acq_core_tb;
   //**************************************************************************//
   initial begin
 
+    layout_log = $fopen("acq_layout.log", "w");
+
     // Initial values for ADC data signals
     data_gen_start = 1'b0;
     test_in_progress = 1'b0;
@@ -1548,6 +1554,9 @@ module wb_acq_core_tb;
     input real data_valid_prob;
 
     reg [31:0] acq_core_fsm_ctl_reg;
+    reg [31:0] trig_pos_reg;
+    reg [31:0] ddr3_end_addr_reg;
+    reg [31:0] shots_reg;
   begin
     $display("#############################");
     $display("######## TEST #%03d ######", test_id);
@@ -1619,6 +1628,20 @@ module wb_acq_core_tb;
       //                `ACQ_CORE_STA_FC_TRANS_DONE_OFFSET, 1'b1);
       wb_busy_wait(`ADDR_ACQ_CORE_STA >> `WB_WORD_ACC, `ACQ_CORE_STA_DDR3_TRANS_DONE,
                       `ACQ_CORE_STA_DDR3_TRANS_DONE_OFFSET, 1'b1);
+
+      WB.read32(`ADDR_ACQ_CORE_TRIG_POS >> `WB_WORD_ACC, trig_pos_reg);
+      WB.read32(`ADDR_ACQ_CORE_DDR3_END_ADDR >> `WB_WORD_ACC, ddr3_end_addr_reg);
+      WB.read32(`ADDR_ACQ_CORE_SHOTS >> `WB_WORD_ACC, shots_reg);
+
+      // test shots pre post start end ram_size acq_now sample_bits
+      // payload_bits dq_bits addr_bits axis trig_pos
+      $fwrite(layout_log, "%0d %0d %0d %0d %0d %0d %0d %0d %0d %0d %0d %0d %0d %0d\n",
+              test_id, n_shots, pre_trig_samples, post_trig_samples,
+              ddr3_start_addr, ddr3_end_addr_reg,
+              (shots_reg & `ACQ_CORE_SHOTS_MULTISHOT_RAM_SIZE) >> `ACQ_CORE_SHOTS_MULTISHOT_RAM_SIZE_OFFSET,
+              skip_trig, c_acq_channels[acq_chan], DDR3_PAYLOAD_WIDTH,
+              PAYLOAD_WIDTH, ADDR_WIDTH, 1, trig_pos_reg);
+      $fflush(layout_log);
     end
 
     $display("Done!");
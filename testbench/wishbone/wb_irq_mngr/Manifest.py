@@ -0,0 +1,12 @@
+files = [
+    "wb_irq_mngr_tb.vhd",
+    "../../../modules/wishbone/wb_irq_mngr/wb_irq_mngr.vhd",
+    "../../../modules/wishbone/wb_irq_mngr/xwb_irq_mngr.vhd",
+]
+
+modules = {
+    "local" : [
+        "../../../ip_cores/general-cores",
+        "../../../ip_cores/general-cores/sim/vhdl",
+    ],
+}
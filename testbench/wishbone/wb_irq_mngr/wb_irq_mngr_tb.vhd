@@ -0,0 +1,234 @@
+--------------------------------------------------------------------------------
+-- Title      : Wishbone IRQ manager testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Writes and reads back the wb_irq_mngr registers, then raises
+--              interrupt requests and checks when they become pending.
+--
+--              Writes must land (they are decoded on we = '1') and reads must
+--              leave the registers alone. With coalescing off, an enabled
+--              source becomes pending on each event and a masked one never
+--              does. A source in COAL_MASK only becomes pending after COAL_CNT
+--              events, or COAL_TOUT ticks after its first event, while the
+--              other sources stay pending on every event.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.env.finish;
+
+library work;
+use work.wishbone_pkg.all;
+use work.sim_wishbone.all;
+
+entity wb_irq_mngr_tb is
+end entity wb_irq_mngr_tb;
+
+architecture test of wb_irq_mngr_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  constant c_IRQ_COUNT      : natural := 16;
+  constant c_COAL_TICK_LOG2 : natural := 4;
+  constant c_TICK_CYCLES    : natural := 2**c_COAL_TICK_LOG2;
+  -- Cycles for an event to get through the input synchronizer, with margin
+  constant c_SYNC_CYCLES    : natural := 6;
+
+  -- Word addresses: wb_irq_mngr decodes adr(4 downto 2)
+  constant c_MASK_ADR       : natural := 4*0;
+  constant c_ACK_ADR        : natural := 4*1;
+  constant c_PEND_ADR       : natural := 4*2;
+  constant c_COAL_MASK_ADR  : natural := 4*3;
+  constant c_COAL_CNT_ADR   : natural := 4*4;
+  constant c_COAL_TOUT_ADR  : natural := 4*5;
+
+  signal clk              : std_logic := '0';
+  signal rst_n            : std_logic := '0';
+  signal wb_slv_i         : t_wishbone_slave_in;
+  signal wb_slv_o         : t_wishbone_slave_out;
+  signal irq_req          : std_logic_vector(c_IRQ_COUNT-1 downto 0) := (others => '0');
+  signal irq              : std_logic;
+  signal irq_pend         : std_logic_vector(c_IRQ_COUNT-1 downto 0);
+begin
+  f_gen_clk(100_000_000, clk);
+
+  process
+    variable v_data   : std_logic_vector(31 downto 0);
+    variable v_cycles : natural;
+
+    procedure f_event(constant src : in natural) is
+    begin
+      irq_req(src) <= '1';
+      f_wait_cycles(clk, 2);
+      irq_req(src) <= '0';
+      f_wait_cycles(clk, 2);
+    end procedure f_event;
+
+    procedure f_check_reg(constant name : in string;
+                          constant adr  : in natural;
+                          constant val  : in natural) is
+      variable v_reg : std_logic_vector(31 downto 0);
+    begin
+      read32_pl(clk, wb_slv_i, wb_slv_o, adr, v_reg);
+      assert unsigned(v_reg) = val
+        report name & " reads 0x" & to_hstring(v_reg) & " instead of 0x" &
+               to_hstring(to_unsigned(val, 32))
+        severity error;
+    end procedure f_check_reg;
+
+    procedure f_check_pend(constant what : in string;
+                           constant val  : in natural) is
+    begin
+      f_wait_cycles(clk, c_SYNC_CYCLES);
+      assert unsigned(irq_pend) = val
+        report what & ": pending 0x" & to_hstring(irq_pend) & " instead of 0x" &
+               to_hstring(to_unsigned(val, c_IRQ_COUNT))
+        severity error;
+      assert irq = '1' xor val = 0
+        report what & ": irq_req_o doesn't follow the pending sources"
+        severity error;
+    end procedure f_check_pend;
+
+    procedure f_ack(constant val : in natural) is
+    begin
+      write32_pl(clk, wb_slv_i, wb_slv_o, c_ACK_ADR,
+                 std_logic_vector(to_unsigned(val, 32)));
+    end procedure f_ack;
+  begin
+    init(wb_slv_i);
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    f_wait_cycles(clk, 10);
+
+    ----------------------------------------------------------------------------
+    -- Registers
+    ----------------------------------------------------------------------------
+    -- Every source but 1
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_MASK_ADR, x"0000FFFD");
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_MASK_ADR, x"00000004");
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_CNT_ADR, x"00000003");
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_TOUT_ADR, x"00000000");
+    -- Twice, reads must not write
+    for i in 1 to 2 loop
+      f_check_reg("MASK", c_MASK_ADR, 16#FFFD#);
+      f_check_reg("COAL_MASK", c_COAL_MASK_ADR, 16#0004#);
+      f_check_reg("COAL_CNT", c_COAL_CNT_ADR, 3);
+      f_check_reg("COAL_TOUT", c_COAL_TOUT_ADR, 0);
+      f_check_reg("PEND", c_PEND_ADR, 0);
+    end loop;
+
+    ----------------------------------------------------------------------------
+    -- Coalescing off
+    ----------------------------------------------------------------------------
+    f_event(0);
+    f_check_pend("Source 0", 16#0001#);
+    f_check_reg("PEND", c_PEND_ADR, 16#0001#);
+    f_ack(16#0001#);
+    f_check_pend("Source 0 acknowledged", 0);
+
+    f_event(1);
+    f_check_pend("Masked source 1", 0);
+
+    ----------------------------------------------------------------------------
+    -- Count threshold
+    ----------------------------------------------------------------------------
+    f_event(2);
+    f_event(2);
+    f_wait_cycles(clk, 4*c_TICK_CYCLES);
+    f_check_pend("Source 2, 2 of 3 events", 0);
+
+    -- A source outside COAL_MASK still becomes pending on each event
+    f_event(3);
+    f_check_pend("Source 3", 16#0008#);
+    f_ack(16#0008#);
+
+    f_event(2);
+    f_check_pend("Source 2, 3 of 3 events", 16#0004#);
+    f_ack(16#0004#);
+
+    f_event(2);
+    f_event(2);
+    f_check_pend("Source 2, count restarted", 0);
+    f_event(2);
+    f_check_pend("Source 2, 3 more events", 16#0004#);
+    f_ack(16#0004#);
+
+    ----------------------------------------------------------------------------
+    -- Timeout flush
+    ----------------------------------------------------------------------------
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_CNT_ADR, x"00000064");
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_TOUT_ADR, x"00000002");
+    f_check_reg("COAL_CNT", c_COAL_CNT_ADR, 100);
+    f_check_reg("COAL_TOUT", c_COAL_TOUT_ADR, 2);
+
+    irq_req(2) <= '1';
+    v_cycles := 0;
+    while irq_pend(2) = '0' and v_cycles < 4*c_TICK_CYCLES loop
+      wait until rising_edge(clk);
+      v_cycles := v_cycles + 1;
+    end loop;
+    irq_req(2) <= '0';
+    -- Two ticks, the first of which may come right after the event
+    assert v_cycles >= c_TICK_CYCLES and v_cycles <= 2*c_TICK_CYCLES + c_SYNC_CYCLES
+      report "Timeout flush after " & integer'image(v_cycles) & " cycles instead of " &
+             integer'image(c_TICK_CYCLES) & " to " & integer'image(2*c_TICK_CYCLES)
+      severity error;
+    f_ack(16#0004#);
+
+    -- Nothing left to flush
+    f_wait_cycles(clk, 4*c_TICK_CYCLES);
+    f_check_pend("Source 2 after the flush", 0);
+
+    ----------------------------------------------------------------------------
+    -- Coalescing off again
+    ----------------------------------------------------------------------------
+    write32_pl(clk, wb_slv_i, wb_slv_o, c_COAL_MASK_ADR, x"00000000");
+    f_event(2);
+    f_check_pend("Source 2 without coalescing", 16#0004#);
+    f_ack(16#0004#);
+    f_check_pend("Source 2 acknowledged", 0);
+
+    finish;
+  end process;
+
+  uut : entity work.xwb_irq_mngr
+    generic map (
+      g_irq_count           => c_IRQ_COUNT,
+      g_irq_level           => '1',
+      g_interface_mode      => PIPELINED,
+      g_address_granularity => WORD,
+      g_coal_tick_log2      => c_COAL_TICK_LOG2)
+    port map (
+      clk_sys_i             => clk,
+      rst_n_i               => rst_n,
+      slave_i               => wb_slv_i,
+      slave_o               => wb_slv_o,
+      irq_req_i             => irq_req,
+      irq_req_o             => irq,
+      irq_pend_o            => irq_pend);
+
+end architecture test;
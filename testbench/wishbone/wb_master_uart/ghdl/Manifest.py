@@ -6,4 +6,4 @@ modules = {"local" : ["../"]}
 
 ghdl_opt = "--std=08"
 
-sim_post_cmd = "ghdl -r --std=08 wb_master_uart_tb --wave=wb_master_uart_tb.ghw --assert-level=error"
+sim_post_cmd = "ghdl -r --std=08 wb_master_uart_tb --wave=wb_master_uart_tb.ghw --assert-level=error && ghdl -r --std=08 wb_master_uart_tb -gg_INTERFACE_MODE=PIPELINED --assert-level=error"
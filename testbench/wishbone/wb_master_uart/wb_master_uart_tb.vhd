@@ -8,7 +8,9 @@
 -- Standard   : VHDL 2008
 -------------------------------------------------------------------------------
 -- Description: Send text commands via UART to write to a Wishbone memory
---              and read it back
+--              and read it back, then do the same with binary burst
+--              commands. Run with g_INTERFACE_MODE = PIPELINED to test
+--              the pipelined burst reads
 -------------------------------------------------------------------------------
 -- Copyright (c) 2023 CNPEM
 -- Licensed under GNU Lesser General Public License (LGPL) v3.0
@@ -28,6 +30,9 @@ use work.wishbone_pkg.all;
 use work.ifc_wishbone_pkg.all;
 
 entity wb_master_uart_tb is
+  generic (
+    g_INTERFACE_MODE: t_wishbone_interface_mode := CLASSIC
+  );
 end entity wb_master_uart_tb;
 
 architecture simu of wb_master_uart_tb is
@@ -217,6 +222,73 @@ architecture simu of wb_master_uart_tb is
     end if;
   end procedure;
 
+  -- Binary burst opcodes
+  constant c_bin_write:        std_logic_vector(7 downto 0) := x"B0";
+  constant c_bin_read:         std_logic_vector(7 downto 0) := x"B1";
+  constant c_bin_read_fixed:   std_logic_vector(7 downto 0) := x"B3";
+  constant c_bin_write_posted: std_logic_vector(7 downto 0) := x"B4";
+  constant c_bin_sync:         std_logic_vector(7 downto 0) := x"B8";
+
+  -- Send a binary burst command header
+  procedure f_send_bin_cmd(opcode: in std_logic_vector(7 downto 0);
+                           addr: in std_logic_vector(c_wishbone_address_width-1 downto 0);
+                           words: in natural range 1 to 65536;
+                           baud: in integer;
+                           signal tx: out std_logic
+                           ) is
+    variable words_arg: std_logic_vector(15 downto 0);
+  begin
+    f_write_uart(opcode, baud, tx);
+    for i in 3 downto 0 loop
+      f_write_uart(addr((i*8 + 7) downto i*8), baud, tx);
+    end loop;
+    words_arg := std_logic_vector(to_unsigned(words - 1, 16));
+    f_write_uart(words_arg(15 downto 8), baud, tx);
+    f_write_uart(words_arg(7 downto 0), baud, tx);
+  end procedure;
+
+  -- Send one data word, big-endian
+  procedure f_send_bin_word(data: in std_logic_vector(c_wishbone_data_width-1 downto 0);
+                            baud: in integer;
+                            signal tx: out std_logic
+                            ) is
+  begin
+    for i in 3 downto 0 loop
+      f_write_uart(data((i*8 + 7) downto i*8), baud, tx);
+    end loop;
+  end procedure;
+
+  -- Receive one data word, big-endian
+  procedure f_read_bin_word(signal rx_data:  in  std_logic_vector(7 downto 0);
+                            signal rx_event: in  boolean;
+                            data:            out std_logic_vector(c_wishbone_data_width-1 downto 0)) is
+  begin
+    for i in 3 downto 0 loop
+      wait until rx_event'event;
+      data((i*8 + 7) downto i*8) := rx_data;
+    end loop;
+  end procedure;
+
+  -- Receive and check a response trailer
+  procedure f_check_bin_trailer(signal rx_data:  in  std_logic_vector(7 downto 0);
+                                signal rx_event: in  boolean;
+                                status:          in  std_logic_vector(7 downto 0);
+                                done:            in  natural) is
+    variable done_read: std_logic_vector(15 downto 0);
+  begin
+    wait until rx_event'event;
+    assert rx_data = status
+      report "Expected status 0x" & to_hex_string(status) & ", got 0x" &
+      to_hex_string(rx_data) severity failure;
+    wait until rx_event'event;
+    done_read(15 downto 8) := rx_data;
+    wait until rx_event'event;
+    done_read(7 downto 0) := rx_data;
+    assert to_integer(unsigned(done_read)) = done mod 65536
+      report "Expected " & integer'image(done) & " words accessed, got " &
+      integer'image(to_integer(unsigned(done_read))) severity failure;
+  end procedure;
+
   signal clk:           std_logic := '0';
   signal rst_n:         std_logic := '0';
   signal tx:            std_logic;
@@ -230,6 +302,9 @@ begin
   f_gen_clk(c_clk_freq, clk);
 
   cmp_xwb_master_uart: xwb_master_uart
+    generic map (
+      g_INTERFACE_MODE => g_INTERFACE_MODE
+    )
     port map (
       clk_i       => clk,
       rst_n_i     => rst_n,
@@ -256,6 +331,7 @@ begin
     variable data_read: std_logic_vector(c_wishbone_data_width-1 downto 0);
     variable data_written: std_logic_vector(c_wishbone_data_width-1 downto 0);
     variable data_gen_arr: t_data_arr(2047 downto 0);
+    variable bin_gen_arr: t_data_arr(511 downto 0);
     variable address: std_logic_vector(c_wishbone_address_width-1 downto 0);
     variable seed1: natural := 5860317;
     variable seed2: natural := 1102456;
@@ -331,6 +407,81 @@ begin
     assert rx_data = x"0A"
       report "Expected linefeed, got " & to_hex_string(rx_data) severity failure;
 
+    --------------------------------------------------------------------
+    -- Binary burst commands
+    --------------------------------------------------------------------
+
+    -- Burst read of the words written by the text commands
+    f_send_bin_cmd(c_bin_read, x"00000100", 256, c_baudrate, rx);
+    for i in 64 to 319 loop
+      f_read_bin_word(rx_data, rx_data_event, data_read);
+      assert data_read = data_gen_arr(i)
+        report "Burst read differs from data written!" & LF &
+        "Read: 0x" & to_hex_string(data_read) & " expected: 0x" & to_hex_string(data_gen_arr(i))
+        severity failure;
+    end loop;
+    f_check_bin_trailer(rx_data, rx_data_event, x"4F", 256);
+
+    -- Posted burst writes, in two back to back frames without any
+    -- response, then a sync
+    for i in 0 to 511 loop
+      uniform(seed1, seed2, rand);
+      bin_gen_arr(i) := std_logic_vector(
+        to_signed(integer(floor((rand - 0.5) * 4294967296.0)), 32)
+      );
+    end loop;
+
+    f_send_bin_cmd(c_bin_write_posted, x"00004000", 300, c_baudrate, rx);
+    for i in 0 to 299 loop
+      f_send_bin_word(bin_gen_arr(i), c_baudrate, rx);
+    end loop;
+    f_send_bin_cmd(c_bin_write_posted, x"000044B0", 212, c_baudrate, rx);
+    for i in 300 to 511 loop
+      f_send_bin_word(bin_gen_arr(i), c_baudrate, rx);
+    end loop;
+    f_write_uart(c_bin_sync, c_baudrate, rx);
+    f_check_bin_trailer(rx_data, rx_data_event, x"4F", 0);
+
+    -- Read them back with a single burst
+    f_send_bin_cmd(c_bin_read, x"00004000", 512, c_baudrate, rx);
+    for i in 0 to 511 loop
+      f_read_bin_word(rx_data, rx_data_event, data_read);
+      assert data_read = bin_gen_arr(i)
+        report "Burst read differs from burst write!" & LF &
+        "Read: 0x" & to_hex_string(data_read) & " expected: 0x" & to_hex_string(bin_gen_arr(i))
+        severity failure;
+    end loop;
+    f_check_bin_trailer(rx_data, rx_data_event, x"4F", 512);
+
+    -- Non-posted write, checked with the text read command
+    f_send_bin_cmd(c_bin_write, x"00006000", 2, c_baudrate, rx);
+    f_send_bin_word(x"DEADBEEF", c_baudrate, rx);
+    f_send_bin_word(x"01234567", c_baudrate, rx);
+    f_check_bin_trailer(rx_data, rx_data_event, x"4F", 2);
+
+    f_send_read_cmd(x"00006004", c_baudrate, 1, rx);
+    f_read_cmd_ans(rx_data, rx_data_event, data_read, cmd_ans_status);
+    assert cmd_ans_status = OK_DATA and data_read = x"01234567"
+      report "Expected ok_data 0x01234567, got " & to_string(cmd_ans_status) &
+      " 0x" & to_hex_string(data_read) severity failure;
+
+    -- Fixed address burst read
+    f_send_bin_cmd(c_bin_read_fixed, x"00006000", 3, c_baudrate, rx);
+    for i in 0 to 2 loop
+      f_read_bin_word(rx_data, rx_data_event, data_read);
+      assert data_read = x"DEADBEEF"
+        report "Fixed address read: got 0x" & to_hex_string(data_read) severity failure;
+    end loop;
+    f_check_bin_trailer(rx_data, rx_data_event, x"4F", 3);
+
+    -- A posted read is not a valid command, and is handled as an invalid
+    -- text command
+    f_write_uart(x"B5", c_baudrate, rx);
+    f_write_uart(x"0A", c_baudrate, rx);
+    f_read_cmd_ans(rx_data, rx_data_event, data_read, cmd_ans_status);
+    assert cmd_ans_status = CMD_ERR
+        report "Expected cmd_err, got " & to_string(cmd_ans_status) severity failure;
+
     -- Extra cycles to help visualizing final register states
     f_wait_cycles(clk, 10);
     std.env.finish;
@@ -347,7 +498,7 @@ begin
 
   process
   begin
-    wait for 100 ms;
+    wait for 200 ms;
     report "Timeout failure!" severity failure;
   end process;
 end architecture simu;
@@ -0,0 +1,6 @@
+files = ["xwb_iir_filt_tb.vhd"]
+modules = {"local" : [
+    "../../../ip_cores/general-cores",
+    "../../../ip_cores/general-cores/sim/vhdl",
+    "../../../",
+]}
@@ -0,0 +1,354 @@
+--------------------------------------------------------------------------------
+-- Title      : XWB IIR filter testbench
+--------------------------------------------------------------------------------
+-- Company    : CNPEM LNLS-DIG
+-- Created    : 2026-10-17
+-- Platform   : Simulation
+-- Standard   : VHDL'08
+---------------------------------------------------------------------------------
+-- Description: Loads coefficient sets into xwb_iir_filt over Wishbone while
+--              samples stream through it.
+--
+--              First, cfg is checked and set A is written to the coeffs
+--              memory, read back and committed, and the samples start. Then
+--              sets B, A and B are written to the memory and committed as
+--              samples flow, each while a different number of idle cycles
+--              separates the samples, so that the commits land at different
+--              points of a sample. sta.pending must be set right after each
+--              commit, and is waited for to clear before the next write.
+--
+--              The output is checked against a floating point model that
+--              starts with all coefficients zero and switches sets for every
+--              biquad at the same sample, somewhere between the commit and
+--              sta.pending clearing. Unless one choice of those samples fits
+--              every output within 1%, some sample was computed with a mix of
+--              sets or the sets switched outside the commit window.
+---------------------------------------------------------------------------------
+-- Copyright (c) 2026 CNPEM
+-- Licensed under GNU Lesser General Public License (LGPL) v3.0
+--------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+use ieee.fixed_pkg.all;
+
+library std;
+use std.env.finish;
+use std.textio.all;
+
+library work;
+use work.wishbone_pkg.all;
+use work.sim_wishbone.all;
+
+entity xwb_iir_filt_tb is
+  generic (
+    -- Coefficient sets A and B, one line per biquad: b0, b1, b2, a1, a2
+    g_TEST_COEFFS_FILENAME   : string := "../../../common/iir_filt/iir_filt_coeffs.dat";
+    g_TEST_COEFFS_B_FILENAME : string := "../../../common/iir_filt/iir_filt_coeffs_b.dat";
+    -- x in the first column of each line
+    g_TEST_X_Y_FILENAME      : string := "../../../common/iir_filt/iir_filt_x_y.dat"
+  );
+end entity xwb_iir_filt_tb;
+
+architecture test of xwb_iir_filt_tb is
+  procedure f_gen_clk(constant freq : in    natural;
+                      signal   clk  : inout std_logic) is
+  begin
+    loop
+      wait for (0.5 / real(freq)) * 1 sec;
+      clk <= not clk;
+    end loop;
+  end procedure f_gen_clk;
+
+  procedure f_wait_cycles(signal   clk    : in std_logic;
+                          constant cycles : natural) is
+  begin
+    for i in 1 to cycles loop
+      wait until rising_edge(clk);
+    end loop;
+  end procedure f_wait_cycles;
+
+  constant c_NUM_BIQUADS      : natural := 5;
+  constant c_X_INT_WIDTH      : natural := 5;
+  constant c_X_FRAC_WIDTH     : natural := 21;
+  constant c_COEFF_INT_WIDTH  : natural := 3;
+  constant c_COEFF_FRAC_WIDTH : natural := 29;
+  constant c_Y_INT_WIDTH      : natural := 5;
+  constant c_Y_FRAC_WIDTH     : natural := 21;
+  -- Lines of g_TEST_X_Y_FILENAME
+  constant c_NUM_SAMPLES      : natural := 200;
+
+  -- Byte addresses, see wb_iir_filt_regs.h
+  constant c_CTL_ADDR         : natural := 16#0#;
+  constant c_STA_ADDR         : natural := 16#4#;
+  constant c_CFG_ADDR         : natural := 16#8#;
+  constant c_COEFFS_ADDR      : natural := 16#400#;
+
+  -- b0, b1, b2, a1, a2 of each biquad
+  type t_real_biquad_coeffs is array (0 to 4) of real;
+  type t_real_coeffs is array (0 to c_NUM_BIQUADS-1) of t_real_biquad_coeffs;
+  type t_real_state is array (0 to c_NUM_BIQUADS-1) of real;
+  type t_reals is array (natural range <>) of real;
+  type t_naturals is array (natural range <>) of natural;
+
+  -- Sets written and committed (0: A, 1: B), the samples to send before
+  -- writing each one and the idle cycles between samples meanwhile
+  constant c_SWITCHES         : natural := 4;
+  constant c_SWITCH_SETS      : t_naturals(0 to c_SWITCHES-1) := (0, 1, 0, 1);
+  constant c_SWITCH_SAMPLES   : t_naturals(0 to c_SWITCHES-1) := (0, 40, 100, 150);
+  constant c_SWITCH_GAPS      : t_naturals(0 to c_SWITCHES-1) := (0, 0, 3, 5);
+
+  procedure f_read_coeffs(constant filename : in  string;
+                          variable coeffs   : out t_real_coeffs) is
+    file fin : text;
+    variable lin : line;
+  begin
+    file_open(fin, filename, read_mode);
+    for idx in 0 to c_NUM_BIQUADS-1 loop
+      readline(fin, lin);
+      for coeff in 0 to 4 loop
+        read(lin, coeffs(idx)(coeff));
+      end loop;
+    end loop;
+    file_close(fin);
+  end procedure f_read_coeffs;
+
+  -- Memory word of a coefficient, sign-extended
+  function f_coeff_word(coeff : real) return std_logic_vector is
+  begin
+    return std_logic_vector(resize(signed(to_slv(to_sfixed(coeff,
+      c_COEFF_INT_WIDTH-1, -c_COEFF_FRAC_WIDTH))), 32));
+  end function f_coeff_word;
+
+  signal clk              : std_logic := '0';
+  signal rst_n            : std_logic := '0';
+  signal wb_slv_i         : t_wishbone_slave_in;
+  signal wb_slv_o         : t_wishbone_slave_out;
+  signal x                : sfixed(c_X_INT_WIDTH-1 downto -c_X_FRAC_WIDTH) := (others => '0');
+  signal x_valid          : std_logic := '0';
+  signal busy             : std_logic;
+  signal y                : sfixed(c_Y_INT_WIDTH-1 downto -c_Y_FRAC_WIDTH);
+  signal y_valid          : std_logic;
+
+  signal stream_en        : boolean := false;
+  signal stream_gap       : natural := 0;
+  -- Samples sent to and received from the filter
+  signal x_sent           : natural := 0;
+  signal y_rcvd           : natural := 0;
+  signal x_vals           : t_reals(0 to c_NUM_SAMPLES-1);
+  signal y_vals           : t_reals(0 to c_NUM_SAMPLES-1);
+begin
+  f_gen_clk(100_000_000, clk);
+
+  p_stream : process
+    file fin : text;
+    variable lin : line;
+    variable v_x : real;
+  begin
+    file_open(fin, g_TEST_X_Y_FILENAME, read_mode);
+    for n in 0 to c_NUM_SAMPLES-1 loop
+      readline(fin, lin);
+      read(lin, v_x);
+      x_vals(n) <= v_x;
+    end loop;
+    file_close(fin);
+
+    wait until stream_en;
+    for n in 0 to c_NUM_SAMPLES-1 loop
+      x <= to_sfixed(x_vals(n), x'left, x'right);
+      wait until rising_edge(clk) and busy = '0';
+      x_valid <= '1';
+      wait until rising_edge(clk);
+      x_valid <= '0';
+      x_sent <= n + 1;
+      f_wait_cycles(clk, stream_gap);
+    end loop;
+    wait;
+  end process;
+
+  p_collect : process
+  begin
+    wait until rising_edge(clk);
+    if y_valid = '1' then
+      y_vals(y_rcvd) <= to_real(y);
+      y_rcvd <= y_rcvd + 1;
+    end if;
+  end process;
+
+  process
+    variable v_data        : std_logic_vector(31 downto 0);
+    variable v_set_a       : t_real_coeffs;
+    variable v_set_b       : t_real_coeffs;
+    variable v_set         : t_real_coeffs;
+    variable v_zeros       : t_real_coeffs := (others => (others => 0.0));
+    -- First and last sample each switch may be taken at
+    variable v_first       : t_naturals(0 to c_SWITCHES-1);
+    variable v_last        : t_naturals(0 to c_SWITCHES-1);
+    variable v_at          : t_naturals(0 to c_SWITCHES-1);
+    variable v_found       : boolean := false;
+
+    -- Writes a set to the coeffs memory: biquad n at words 8*n to 8*n+4
+    procedure f_write_set(constant coeffs : in t_real_coeffs) is
+    begin
+      for idx in 0 to c_NUM_BIQUADS-1 loop
+        for coeff in 0 to 4 loop
+          write32_pl(clk, wb_slv_i, wb_slv_o, c_COEFFS_ADDR + 4*(8*idx + coeff),
+                     f_coeff_word(coeffs(idx)(coeff)));
+        end loop;
+      end loop;
+    end procedure f_write_set;
+
+    -- Whether the filter output matches the model with all coefficients
+    -- zero up to the first switch sample and with the sets of c_SWITCH_SETS
+    -- from each switch sample on
+    impure function f_fits(at : t_naturals) return boolean is
+      variable v_ref            : t_real_coeffs := v_zeros;
+      variable v_w, v_w_d1, v_w_d2 : t_real_state := (others => 0.0);
+      variable v_y_ref          : real;
+    begin
+      for n in 0 to c_NUM_SAMPLES-1 loop
+        for s in 0 to c_SWITCHES-1 loop
+          if n = at(s) then
+            v_ref := v_set_a when c_SWITCH_SETS(s) = 0 else v_set_b;
+          end if;
+        end loop;
+
+        -- Direct form II, as computed by biquad.vhd
+        v_y_ref := x_vals(n);
+        for idx in 0 to c_NUM_BIQUADS-1 loop
+          v_w(idx) := v_y_ref - v_ref(idx)(3)*v_w_d1(idx) - v_ref(idx)(4)*v_w_d2(idx);
+          v_y_ref := v_ref(idx)(0)*v_w(idx) + v_ref(idx)(1)*v_w_d1(idx) +
+                     v_ref(idx)(2)*v_w_d2(idx);
+          v_w_d2(idx) := v_w_d1(idx);
+          v_w_d1(idx) := v_w(idx);
+        end loop;
+
+        if abs(y_vals(n) - v_y_ref) > 0.01*abs(v_y_ref) + 1.0e-3 then
+          return false;
+        end if;
+      end loop;
+      return true;
+    end function f_fits;
+  begin
+    init(wb_slv_i);
+    f_wait_cycles(clk, 10);
+    rst_n <= '1';
+    f_wait_cycles(clk, 10);
+
+    f_read_coeffs(g_TEST_COEFFS_FILENAME, v_set_a);
+    f_read_coeffs(g_TEST_COEFFS_B_FILENAME, v_set_b);
+
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_CFG_ADDR, v_data);
+    assert v_data = x"00" & std_logic_vector(to_unsigned(c_COEFF_FRAC_WIDTH, 8)) &
+                    std_logic_vector(to_unsigned(c_COEFF_INT_WIDTH, 8)) &
+                    std_logic_vector(to_unsigned(c_NUM_BIQUADS, 8))
+      report "cfg 0x" & to_hstring(v_data) & " doesn't match the generics"
+      severity error;
+    read32_pl(clk, wb_slv_i, wb_slv_o, c_STA_ADDR, v_data);
+    assert v_data(0) = '0'
+      report "sta.pending set out of reset" severity error;
+
+    ----------------------------------------------------------------------------
+    -- Write and commit the sets, the first one before any sample
+    ----------------------------------------------------------------------------
+    for s in 0 to c_SWITCHES-1 loop
+      stream_gap <= c_SWITCH_GAPS(s);
+      wait until rising_edge(clk) and x_sent >= c_SWITCH_SAMPLES(s);
+      v_set := v_set_a when c_SWITCH_SETS(s) = 0 else v_set_b;
+      f_write_set(v_set);
+      for idx in 0 to c_NUM_BIQUADS-1 loop
+        for coeff in 0 to 4 loop
+          read32_pl(clk, wb_slv_i, wb_slv_o, c_COEFFS_ADDR + 4*(8*idx + coeff), v_data);
+          assert v_data = f_coeff_word(v_set(idx)(coeff))
+            report "Biquad " & integer'image(idx) & ", coefficient " & integer'image(coeff) &
+                   ": read back 0x" & to_hstring(v_data) & " instead of 0x" &
+                   to_hstring(f_coeff_word(v_set(idx)(coeff)))
+            severity error;
+        end loop;
+      end loop;
+
+      -- A sample sent before the commit may still take the new set if it
+      -- hasn't reached the b0 product of the first biquad
+      v_first(s) := x_sent - 1 when x_sent > 0 else 0;
+      write32_pl(clk, wb_slv_i, wb_slv_o, c_CTL_ADDR, x"00000001");
+      read32_pl(clk, wb_slv_i, wb_slv_o, c_STA_ADDR, v_data);
+      assert v_data(0) = '1'
+        report "sta.pending not set after commit " & integer'image(s) severity error;
+
+      -- The biquads only take a commit with a sample
+      stream_en <= true;
+      loop
+        read32_pl(clk, wb_slv_i, wb_slv_o, c_STA_ADDR, v_data);
+        exit when v_data(0) = '0';
+      end loop;
+      v_last(s) := x_sent + 1;
+    end loop;
+    stream_gap <= 0;
+
+    wait until rising_edge(clk) and y_rcvd = c_NUM_SAMPLES;
+
+    ----------------------------------------------------------------------------
+    -- Check the output against every choice of switch samples
+    ----------------------------------------------------------------------------
+    v_at := v_first;
+    search : loop
+      if f_fits(v_at) then
+        v_found := true;
+        exit search;
+      end if;
+      -- Next choice, the first switch running fastest
+      for s in 0 to c_SWITCHES-1 loop
+        if v_at(s) < v_last(s) then
+          v_at(s) := v_at(s) + 1;
+          exit;
+        elsif s = c_SWITCHES-1 then
+          exit search;
+        else
+          v_at(s) := v_first(s);
+        end if;
+      end loop;
+    end loop;
+
+    assert v_found
+      report "The output doesn't match the sets switching at a single sample " &
+             "within each commit window"
+      severity error;
+    if v_found then
+      for s in 0 to c_SWITCHES-1 loop
+        report "Switch " & integer'image(s) & " taken at sample " & integer'image(v_at(s)) &
+               " (commit window " & integer'image(v_first(s)) & " to " &
+               integer'image(v_last(s)) & ")";
+      end loop;
+    end if;
+
+    finish;
+  end process;
+
+  uut : entity work.xwb_iir_filt
+    generic map (
+      g_NUM_BIQUADS         => c_NUM_BIQUADS,
+      g_X_INT_WIDTH         => c_X_INT_WIDTH,
+      g_X_FRAC_WIDTH        => c_X_FRAC_WIDTH,
+      g_COEFF_INT_WIDTH     => c_COEFF_INT_WIDTH,
+      g_COEFF_FRAC_WIDTH    => c_COEFF_FRAC_WIDTH,
+      g_Y_INT_WIDTH         => c_Y_INT_WIDTH,
+      g_Y_FRAC_WIDTH        => c_Y_FRAC_WIDTH,
+      g_ARITH_EXTRA_BITS    => 1,
+      g_IFCS_EXTRA_BITS     => 0,
+      g_INTERFACE_MODE      => CLASSIC,
+      g_ADDRESS_GRANULARITY => BYTE
+    )
+    port map (
+      clk_i                 => clk,
+      rst_n_i               => rst_n,
+      wb_slv_i              => wb_slv_i,
+      wb_slv_o              => wb_slv_o,
+      x_i                   => x,
+      x_valid_i             => x_valid,
+      busy_o                => busy,
+      y_o                   => y,
+      y_valid_o             => y_valid
+    );
+
+end architecture test;